@@ -24,10 +24,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Executor.h"
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
@@ -74,6 +78,24 @@ class MeshResourceLoader: public AbstractResourceLoader<GL::Mesh> {
    avoid -Wmisssing-prototypes */
 void mainMagnum();
 void mainMagnum() {
+{
+/* [Executor-threads] */
+Executor executor{[](Executor::Task task, std::size_t count, void* state, void*) {
+    /* Each thread picks the next task that wasn't taken yet */
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    const std::size_t threadCount = std::thread::hardware_concurrency();
+    for(std::size_t i = 0; i < threadCount || i == 0; ++i)
+        threads.emplace_back([&]{
+            for(std::size_t id; (id = next++) < count; )
+                task(id, state);
+        });
+    for(std::thread& thread: threads) thread.join();
+}};
+/* [Executor-threads] */
+static_cast<void>(executor);
+}
+
 {
 /* [features-using-namespace] */
 using namespace Corrade;
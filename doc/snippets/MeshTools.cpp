@@ -27,6 +27,7 @@
 #include <vector>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/PluginManager/Manager.h>
 
@@ -45,6 +46,7 @@
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/Primitives/Cube.h"
+#include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -285,6 +287,21 @@ static_cast<void>(cylinderIndexOffset);
 static_cast<void>(cylinderVertexOffset);
 }
 
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+Containers::Pointer<Trade::AbstractImporter> importer = DOXYGEN_ELLIPSIS(manager.loadAndInstantiate("SomethingWhatever"));
+/* [Concatenator] */
+Containers::Optional<Trade::MeshData> first = importer->mesh(0);
+MeshTools::Concatenator concatenator{*first};
+concatenator.add(*first);
+first = Containers::NullOpt;
+for(UnsignedInt i = 1; i != importer->meshCount(); ++i)
+    concatenator.add(*importer->mesh(i));
+
+Trade::MeshData out = concatenator.release();
+/* [Concatenator] */
+}
+
 {
 /* [generateFlatNormals] */
 Containers::ArrayView<UnsignedInt> indices;
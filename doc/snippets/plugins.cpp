@@ -24,14 +24,17 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Path.h>
 
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractFontConverter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
 
 #ifdef __has_include
 #if __has_include(<MagnumPlugins/TinyGltfImporter/importStaticPlugin.cpp>) && \
@@ -112,6 +115,22 @@ fontManager.registerExternalManager(importerManager);
 /* [MagnumFont-importer-register] */
 }
 
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+/* [MeshBlobImporter-zero-copy] */
+Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>>
+    mapped = Utility::Path::mapRead("meshes.mblob");
+Containers::Pointer<Trade::AbstractImporter> importer =
+    manager.loadAndInstantiate("MeshBlobImporter");
+if(!mapped || !importer || !importer->openMemory(*mapped))
+    Fatal{} << "Can't open meshes.mblob";
+
+/* The mesh references the mapped memory, keep it alive while it's used */
+Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+/* [MeshBlobImporter-zero-copy] */
+static_cast<void>(mesh);
+}
+
 {
 /* [MagnumFontConverter-imageconverter-register] */
 PluginManager::Manager<Trade::AbstractImageConverter> imageConverterManager;
@@ -87,6 +87,10 @@
 #  VulkanTester                 - VulkanTester class
 #  MagnumFont                   - Magnum bitmap font plugin
 #  MagnumFontConverter          - Magnum bitmap font converter plugin
+#  MeshBlobImporter             - Mesh blob importer plugin
+#  MeshBlobSceneConverter       - Mesh blob converter plugin
+#  MeshCodecImporter            - Compressed mesh importer plugin
+#  MeshCodecSceneConverter      - Compressed mesh converter plugin
 #  ObjImporter                  - OBJ importer plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
@@ -402,8 +406,9 @@ set(_MAGNUM_LIBRARY_COMPONENTS_ALWAYS_STATIC
     OpenGLTester)
 set(_MAGNUM_PLUGIN_COMPONENTS
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneConverter
-    AnySceneImporter MagnumFont MagnumFontConverter ObjImporter
-    TgaImageConverter TgaImporter WavAudioImporter)
+    AnySceneImporter MagnumFont MagnumFontConverter MeshBlobImporter
+    MeshBlobSceneConverter MeshCodecImporter MeshCodecSceneConverter
+    ObjImporter TgaImageConverter TgaImporter WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENTS
     imageconverter sceneconverter shaderconverter gl-info al-info)
 # Audio and Vk libs aren't enabled by default, and none of the Context,
@@ -540,6 +545,8 @@ set(_MAGNUM_WglContext_DEPENDENCIES GL)
 
 set(_MAGNUM_MagnumFont_DEPENDENCIES Trade TgaImporter GL) # and below
 set(_MAGNUM_MagnumFontConverter_DEPENDENCIES Trade TgaImageConverter) # and below
+set(_MAGNUM_MeshCodecImporter_DEPENDENCIES MeshTools) # and below
+set(_MAGNUM_MeshCodecSceneConverter_DEPENDENCIES MeshTools) # and below
 set(_MAGNUM_ObjImporter_DEPENDENCIES MeshTools) # and below
 foreach(_component ${_MAGNUM_PLUGIN_COMPONENTS})
     if(_component MATCHES ".+AudioImporter")
@@ -1090,6 +1097,10 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnySceneImporter plugin
         # No special setup for MagnumFont plugin
         # No special setup for MagnumFontConverter plugin
+        # No special setup for MeshBlobImporter plugin
+        # No special setup for MeshBlobSceneConverter plugin
+        # No special setup for MeshCodecImporter plugin
+        # No special setup for MeshCodecSceneConverter plugin
         # No special setup for ObjImporter plugin
         # No special setup for TgaImageConverter plugin
         # No special setup for TgaImporter plugin
@@ -45,6 +45,10 @@ cmake .. \
     -DMAGNUM_WITH_ANYSHADERCONVERTER=ON \
     -DMAGNUM_WITH_MAGNUMFONT=ON \
     -DMAGNUM_WITH_MAGNUMFONTCONVERTER=ON \
+    -DMAGNUM_WITH_MESHBLOBIMPORTER=ON \
+    -DMAGNUM_WITH_MESHBLOBSCENECONVERTER=ON \
+    -DMAGNUM_WITH_MESHCODECIMPORTER=ON \
+    -DMAGNUM_WITH_MESHCODECSCENECONVERTER=ON \
     -DMAGNUM_WITH_OBJIMPORTER=ON \
     -DMAGNUM_WITH_TGAIMAGECONVERTER=ON \
     -DMAGNUM_WITH_TGAIMPORTER=ON \
@@ -0,0 +1,151 @@
+#ifndef Magnum_Executor_h
+#define Magnum_Executor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Executor
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum {
+
+/**
+@brief Executor for independent tasks
+@m_since_latest
+
+Passed to APIs such as @ref MeshTools::removeDuplicatesInto() that can split
+their work into independent tasks. Magnum libraries never spawn threads on
+their own, instead the executor wraps whatever thread pool or job system the
+application already uses. A default-constructed instance runs all tasks
+serially on the calling thread.
+
+The @ref Function gets a task function, a task count and an opaque state
+pointer, and is expected to call the task function with every ID in the
+@cpp [0, count) @ce range exactly once, in any order and from any thread, and
+return only after all of them finished. The @p userData passed to the
+constructor is passed through to it. A minimal implementation that runs the
+tasks on a set of temporary threads could look like this:
+
+@snippet Magnum.cpp Executor-threads
+
+How the work is split into tasks depends only on the input, not on the
+executor, so APIs taking an executor always produce the same output
+regardless of which executor is used and in what order the tasks run.
+*/
+class Executor {
+    public:
+        /**
+         * @brief Task function
+         *
+         * Gets a task ID in the @cpp [0, count) @ce range and the state
+         * pointer passed to @ref operator()(std::size_t, Task, void*) const.
+         */
+        typedef void(*Task)(std::size_t id, void* state);
+
+        /**
+         * @brief Executor function
+         *
+         * Expected to call @p task with every ID in the
+         * @cpp [0, count) @ce range and @p state exactly once and return
+         * after all calls finished.
+         */
+        typedef void(*Function)(Task task, std::size_t count, void* state, void* userData);
+
+        /**
+         * @brief Construct a serial executor
+         *
+         * All tasks are run in order on the calling thread.
+         */
+        constexpr /*implicit*/ Executor() noexcept: _function{}, _userData{} {}
+
+        /**
+         * @brief Construct with an executor function
+         *
+         * The @p userData get passed to @p function on every call. Passing
+         * @cpp nullptr @ce for @p function is equivalent to
+         * @ref Executor().
+         */
+        constexpr explicit Executor(Function function, void* userData = nullptr) noexcept: _function{function}, _userData{userData} {}
+
+        /** @brief Executor function */
+        constexpr Function function() const { return _function; }
+
+        /** @brief User data passed to the executor function */
+        constexpr void* userData() const { return _userData; }
+
+        /**
+         * @brief Whether the executor is serial
+         *
+         * Returns @cpp true @ce if there's no executor function, in which
+         * case all tasks are run in order on the calling thread. APIs may
+         * use this to pick a variant that doesn't have the overhead of
+         * splitting the work into tasks.
+         */
+        constexpr bool isSerial() const { return !_function; }
+
+        /**
+         * @brief Run tasks
+         *
+         * Calls @p task with every ID in the @cpp [0, count) @ce range and
+         * @p state, either through the executor function or directly in
+         * order if the executor is serial. Returns after all tasks finished.
+         */
+        void operator()(std::size_t count, Task task, void* state) const {
+            if(_function)
+                _function(task, count, state, _userData);
+            else for(std::size_t i = 0; i != count; ++i)
+                task(i, state);
+        }
+
+        /**
+         * @brief Run tasks with a functor
+         *
+         * Calls @p functor with every ID in the @cpp [0, count) @ce range.
+         * Useful with lambdas capturing the state by reference. The functor
+         * is only referenced, not copied, and thus has to be callable from
+         * multiple threads at once.
+         */
+        template<class F> void operator()(std::size_t count, F&& functor) const {
+            typedef typename std::remove_reference<F>::type Functor;
+            operator()(count, [](std::size_t id, void* state) {
+                (*static_cast<Functor*>(state))(id);
+            }, const_cast<void*>(static_cast<const void*>(&functor)));
+        }
+
+    private:
+        Function _function;
+        void* _userData;
+};
+
+}
+
+#endif
@@ -1310,6 +1310,8 @@ template<class T> class CORRADE_DEPRECATED("use Math::Vector2 or Containers::Arr
 template<class T> class CORRADE_DEPRECATED("use Math::Vector3 or Containers::Array3 instead") Array3D;
 #endif
 
+class Executor;
+
 enum class InputFileCallbackPolicy: UnsignedByte;
 
 enum class ImageFlag1D: UnsignedShort;
@@ -0,0 +1,402 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FunctionsBatch.h"
+
+#include <limits>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+namespace {
+
+/* The reductions below keep several independent accumulators ("lanes")
+   instead of a single one, which removes the dependency between consecutive
+   iterations and lets the compiler (or the SSE2 code) process multiple values
+   at once. 12 is divisible by 1, 2, 3 and 4, so when going through contiguous
+   data as if it was a flat array of scalars, lane k always holds component
+   k % components. */
+enum: std::size_t { LaneCount = 12 };
+
+/* How many scalars to go through in the contiguous isNan() case between
+   checks for an early exit */
+enum: std::size_t { IsNanBlockSize = LaneCount*4 };
+
+/* Initial lane values. For floating-point types the infinities are used,
+   which means a component that had no non-NaN value ends up with min > max,
+   which is then used to detect the all-NaN case without having to track it
+   separately. */
+template<class T> constexpr T minmaxInitialMin() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+}
+template<class T> constexpr T minmaxInitialMax() {
+    return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+}
+
+template<class T> inline void minmaxReduceLanes(const T(&mins)[LaneCount], const T(&maxs)[LaneCount], const std::size_t components, T* const min, T* const max) {
+    for(std::size_t i = 0; i != components; ++i) {
+        T componentMin = mins[i];
+        T componentMax = maxs[i];
+        for(std::size_t k = i + components; k < LaneCount; k += components) {
+            componentMin = Math::min(componentMin, mins[k]);
+            componentMax = Math::max(componentMax, maxs[k]);
+        }
+
+        /* All values of this component were NaN, return a NaN. Can only
+           happen for floating-point types, for integers there's always at
+           least one value that makes min <= max. */
+        if(componentMax < componentMin)
+            componentMin = componentMax = std::numeric_limits<T>::quiet_NaN();
+
+        min[i] = componentMin;
+        max[i] = componentMax;
+    }
+}
+
+template<class T> void minmaxIntoImplementation(const Containers::StridedArrayView2D<const T>& src, T* const min, T* const max) {
+    const std::size_t count = src.size()[0];
+    const std::size_t components = src.size()[1];
+
+    T mins[LaneCount];
+    T maxs[LaneCount];
+    for(std::size_t k = 0; k != LaneCount; ++k) {
+        mins[k] = minmaxInitialMin<T>();
+        maxs[k] = minmaxInitialMax<T>();
+    }
+
+    /* The value is always passed as the second argument to min() / max(),
+       which makes NaNs ignored */
+    if(src.isContiguous()) {
+        const T* data = static_cast<const T*>(src.data());
+        const std::size_t total = count*components;
+        std::size_t i = 0;
+        for(; i + LaneCount <= total; i += LaneCount) {
+            for(std::size_t k = 0; k != LaneCount; ++k) {
+                mins[k] = Math::min(mins[k], data[i + k]);
+                maxs[k] = Math::max(maxs[k], data[i + k]);
+            }
+        }
+        for(std::size_t k = 0; i != total; ++i, ++k) {
+            mins[k] = Math::min(mins[k], data[i]);
+            maxs[k] = Math::max(maxs[k], data[i]);
+        }
+
+    /* Otherwise go element by element, cycling through LaneCount/components
+       groups of lanes */
+    } else {
+        const char* data = static_cast<const char*>(src.data());
+        const std::ptrdiff_t stride = src.stride()[0];
+        const std::size_t groupEnd = LaneCount - LaneCount % components;
+        for(std::size_t i = 0; i != count; ) {
+            for(std::size_t k = 0; k != groupEnd && i != count; k += components, ++i, data += stride) {
+                const T* element = reinterpret_cast<const T*>(data);
+                for(std::size_t j = 0; j != components; ++j) {
+                    mins[k + j] = Math::min(mins[k + j], element[j]);
+                    maxs[k + j] = Math::max(maxs[k + j], element[j]);
+                }
+            }
+        }
+    }
+
+    minmaxReduceLanes(mins, maxs, components, min, max);
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* Float variant with explicit SSE2. The _mm_min_ps() / _mm_max_ps()
+   instructions return the second operand if either is NaN, so passing the
+   accumulator as the second operand makes NaNs ignored the same way as with
+   Math::min() and Math::max() above. */
+void minmaxIntoSse2(const Containers::StridedArrayView2D<const Float>& src, Float* const min, Float* const max) {
+    const std::size_t count = src.size()[0];
+    const std::size_t components = src.size()[1];
+    const char* data = static_cast<const char*>(src.data());
+    const std::ptrdiff_t stride = src.stride()[0];
+
+    /* Anything else than contiguous data or interleaved data with the stride
+       large enough to load four floats from each element (so negative, zero
+       or small strides) goes through the generic implementation */
+    if(!src.isContiguous() && stride < std::ptrdiff_t(4*sizeof(Float)))
+        return minmaxIntoImplementation(src, min, max);
+
+    const __m128 initialMin = _mm_set1_ps(minmaxInitialMin<Float>());
+    const __m128 initialMax = _mm_set1_ps(minmaxInitialMax<Float>());
+    __m128 min0 = initialMin, min1 = initialMin, min2 = initialMin;
+    __m128 max0 = initialMax, max1 = initialMax, max2 = initialMax;
+    Float mins[LaneCount];
+    Float maxs[LaneCount];
+
+    /* Contiguous, go through the data as a flat array of floats, 12 at a
+       time, which matches the LaneCount assumption above. The remaining
+       values then again start from lane 0. */
+    if(src.isContiguous()) {
+        const Float* floats = reinterpret_cast<const Float*>(data);
+        const std::size_t total = count*components;
+        std::size_t i = 0;
+        for(; i + LaneCount <= total; i += LaneCount) {
+            const __m128 a = _mm_loadu_ps(floats + i);
+            const __m128 b = _mm_loadu_ps(floats + i + 4);
+            const __m128 c = _mm_loadu_ps(floats + i + 8);
+            min0 = _mm_min_ps(a, min0);
+            min1 = _mm_min_ps(b, min1);
+            min2 = _mm_min_ps(c, min2);
+            max0 = _mm_max_ps(a, max0);
+            max1 = _mm_max_ps(b, max1);
+            max2 = _mm_max_ps(c, max2);
+        }
+
+        _mm_storeu_ps(mins + 0, min0);
+        _mm_storeu_ps(mins + 4, min1);
+        _mm_storeu_ps(mins + 8, min2);
+        _mm_storeu_ps(maxs + 0, max0);
+        _mm_storeu_ps(maxs + 4, max1);
+        _mm_storeu_ps(maxs + 8, max2);
+        for(std::size_t k = 0; i != total; ++i, ++k) {
+            mins[k] = Math::min(mins[k], floats[i]);
+            maxs[k] = Math::max(maxs[k], floats[i]);
+        }
+
+    /* Interleaved data, gather whole elements at once, three elements at a
+       time. The extra lanes pick up unrelated data from other attributes,
+       but those are discarded below. The last element is processed
+       separately in order to not read past the end of the view. */
+    } else {
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 3, data += 3*stride) {
+            const __m128 a = _mm_loadu_ps(reinterpret_cast<const Float*>(data));
+            const __m128 b = _mm_loadu_ps(reinterpret_cast<const Float*>(data + stride));
+            const __m128 c = _mm_loadu_ps(reinterpret_cast<const Float*>(data + 2*stride));
+            min0 = _mm_min_ps(a, min0);
+            min1 = _mm_min_ps(b, min1);
+            min2 = _mm_min_ps(c, min2);
+            max0 = _mm_max_ps(a, max0);
+            max1 = _mm_max_ps(b, max1);
+            max2 = _mm_max_ps(c, max2);
+        }
+
+        /* Each of the three vectors holds one element in lanes 0 to
+           components - 1, merge them to the first lanes so lane k again holds
+           component k % components, the other lanes get reset */
+        Float vectorMins[LaneCount];
+        Float vectorMaxs[LaneCount];
+        _mm_storeu_ps(vectorMins + 0, min0);
+        _mm_storeu_ps(vectorMins + 4, min1);
+        _mm_storeu_ps(vectorMins + 8, min2);
+        _mm_storeu_ps(vectorMaxs + 0, max0);
+        _mm_storeu_ps(vectorMaxs + 4, max1);
+        _mm_storeu_ps(vectorMaxs + 8, max2);
+        for(std::size_t k = 0; k != LaneCount; ++k) {
+            mins[k] = minmaxInitialMin<Float>();
+            maxs[k] = minmaxInitialMax<Float>();
+        }
+        for(std::size_t v = 0; v != 3; ++v) {
+            for(std::size_t j = 0; j != components; ++j) {
+                mins[j] = Math::min(mins[j], vectorMins[v*4 + j]);
+                maxs[j] = Math::max(maxs[j], vectorMaxs[v*4 + j]);
+            }
+        }
+        for(; i != count; ++i, data += stride) {
+            const Float* element = reinterpret_cast<const Float*>(data);
+            for(std::size_t j = 0; j != components; ++j) {
+                mins[j] = Math::min(mins[j], element[j]);
+                maxs[j] = Math::max(maxs[j], element[j]);
+            }
+        }
+    }
+
+    minmaxReduceLanes(mins, maxs, components, min, max);
+}
+
+/* SSE2 has unsigned min / max only for 8-bit integers, signed for 16-bit and
+   nothing for 32-bit. The 16- and 32-bit values thus get their sign bit
+   flipped so a signed comparison gives the unsigned order, and the 32-bit
+   min / max is done with a comparison and a select. */
+template<class> struct MinmaxUnsignedSse2;
+template<> struct MinmaxUnsignedSse2<UnsignedByte> {
+    static __m128i bias() { return _mm_setzero_si128(); }
+    static __m128i min(const __m128i a, const __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i max(const __m128i a, const __m128i b) { return _mm_max_epu8(a, b); }
+};
+template<> struct MinmaxUnsignedSse2<UnsignedShort> {
+    static __m128i bias() { return _mm_set1_epi16(-0x7fff - 1); }
+    static __m128i min(const __m128i a, const __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i max(const __m128i a, const __m128i b) { return _mm_max_epi16(a, b); }
+};
+template<> struct MinmaxUnsignedSse2<UnsignedInt> {
+    static __m128i bias() { return _mm_set1_epi32(-0x7fffffff - 1); }
+    static __m128i min(const __m128i a, const __m128i b) {
+        const __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+    static __m128i max(const __m128i a, const __m128i b) {
+        const __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+/* Used only for contiguous scalar data, which is the common case of index
+   buffers. Vectors or strided data go through the generic
+   implementation. */
+template<class T> void minmaxIntoUnsignedSse2(const Containers::StridedArrayView2D<const T>& src, T* const min, T* const max) {
+    if(src.size()[1] != 1 || !src.isContiguous())
+        return minmaxIntoImplementation(src, min, max);
+
+    typedef MinmaxUnsignedSse2<T> Sse2;
+    enum: std::size_t { VectorSize = sizeof(__m128i)/sizeof(T) };
+    const std::size_t count = src.size()[0];
+    const T* const data = static_cast<const T*>(src.data());
+
+    /* Two independent accumulators for each to hide the instruction latency.
+       The minimum starts with all bits set and the maximum with all bits
+       cleared, both with the bias applied. */
+    const __m128i bias = Sse2::bias();
+    __m128i min0 = _mm_xor_si128(_mm_set1_epi32(-1), bias), min1 = min0;
+    __m128i max0 = bias, max1 = bias;
+    std::size_t i = 0;
+    for(; i + 2*VectorSize <= count; i += 2*VectorSize) {
+        const __m128i a = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+        const __m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + VectorSize)), bias);
+        min0 = Sse2::min(min0, a);
+        min1 = Sse2::min(min1, b);
+        max0 = Sse2::max(max0, a);
+        max1 = Sse2::max(max1, b);
+    }
+
+    /* Remove the bias, reduce the vector lanes and process the rest */
+    T mins[VectorSize];
+    T maxs[VectorSize];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(mins), _mm_xor_si128(Sse2::min(min0, min1), bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxs), _mm_xor_si128(Sse2::max(max0, max1), bias));
+    T outMin = mins[0];
+    T outMax = maxs[0];
+    for(std::size_t k = 1; k != VectorSize; ++k) {
+        outMin = Math::min(outMin, mins[k]);
+        outMax = Math::max(outMax, maxs[k]);
+    }
+    for(; i != count; ++i) {
+        outMin = Math::min(outMin, data[i]);
+        outMax = Math::max(outMax, data[i]);
+    }
+
+    *min = outMin;
+    *max = outMax;
+}
+#endif
+
+template<class T> UnsignedInt isNanIntoImplementation(const Containers::StridedArrayView2D<const T>& src) {
+    const std::size_t count = src.size()[0];
+    const std::size_t components = src.size()[1];
+    const UnsignedInt all = (1u << components) - 1;
+    UnsignedInt out = 0;
+
+    /* Contiguous, go through blocks of the data as if it was a flat array of
+       scalars and check for an early exit after each. Compared to checking
+       after every value the inner loop is simple enough to get
+       vectorized. */
+    if(src.isContiguous()) {
+        const T* data = static_cast<const T*>(src.data());
+        const std::size_t total = count*components;
+        for(std::size_t i = 0; i < total && out != all; i += IsNanBlockSize) {
+            const std::size_t end = i + IsNanBlockSize < total ? i + IsNanBlockSize : total;
+            bool nans[LaneCount]{};
+            for(std::size_t j = i; j < end; j += LaneCount) {
+                const std::size_t laneEnd = end - j < LaneCount ? end - j : std::size_t(LaneCount);
+                for(std::size_t k = 0; k != laneEnd; ++k)
+                    nans[k] |= data[j + k] != data[j + k];
+            }
+            for(std::size_t k = 0; k != LaneCount; ++k)
+                if(nans[k]) out |= 1u << (k % components);
+        }
+
+    /* Otherwise go element by element, exiting as soon as all components
+       were found to contain a NaN */
+    } else {
+        const char* data = static_cast<const char*>(src.data());
+        const std::ptrdiff_t stride = src.stride()[0];
+        for(std::size_t i = 0; i != count && out != all; ++i, data += stride) {
+            const T* element = reinterpret_cast<const T*>(data);
+            for(std::size_t j = 0; j != components; ++j)
+                if(element[j] != element[j]) out |= 1u << j;
+        }
+    }
+
+    return out;
+}
+
+}
+
+void minmaxInto(const Containers::StridedArrayView2D<const Float>& src, Float* const min, Float* const max) {
+    #ifdef CORRADE_TARGET_SSE2
+    minmaxIntoSse2(src, min, max);
+    #else
+    minmaxIntoImplementation(src, min, max);
+    #endif
+}
+
+void minmaxInto(const Containers::StridedArrayView2D<const Double>& src, Double* const min, Double* const max) {
+    minmaxIntoImplementation(src, min, max);
+}
+
+void minmaxInto(const Containers::StridedArrayView2D<const Int>& src, Int* const min, Int* const max) {
+    minmaxIntoImplementation(src, min, max);
+}
+
+void minmaxInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, UnsignedInt* const min, UnsignedInt* const max) {
+    #ifdef CORRADE_TARGET_SSE2
+    minmaxIntoUnsignedSse2(src, min, max);
+    #else
+    minmaxIntoImplementation(src, min, max);
+    #endif
+}
+
+void minmaxInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, UnsignedShort* const min, UnsignedShort* const max) {
+    #ifdef CORRADE_TARGET_SSE2
+    minmaxIntoUnsignedSse2(src, min, max);
+    #else
+    minmaxIntoImplementation(src, min, max);
+    #endif
+}
+
+void minmaxInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, UnsignedByte* const min, UnsignedByte* const max) {
+    #ifdef CORRADE_TARGET_SSE2
+    minmaxIntoUnsignedSse2(src, min, max);
+    #else
+    minmaxIntoImplementation(src, min, max);
+    #endif
+}
+
+UnsignedInt isNanInto(const Containers::StridedArrayView2D<const Float>& src) {
+    return isNanIntoImplementation(src);
+}
+
+UnsignedInt isNanInto(const Containers::StridedArrayView2D<const Double>& src) {
+    return isNanIntoImplementation(src);
+}
+
+}}}
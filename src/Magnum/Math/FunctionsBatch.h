@@ -36,6 +36,7 @@
 #include <type_traits>
 #include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/visibility.h"
 #include "Magnum/Math/Functions.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -53,6 +54,46 @@ template<class T, class View = decltype(Containers::Implementation::ErasedArrayV
 template<class T> static typename std::remove_const<T>::type stridedArrayViewTypeFor(const Containers::ArrayView<T>&);
 template<class T> static typename std::remove_const<T>::type stridedArrayViewTypeFor(const Containers::StridedArrayView1D<T>&);
 
+/* Scalar types and vectors of up to four components for which there's a
+   dedicated implementation in FunctionsBatch.cpp. The vectors get viewed as
+   a 2D array of their underlying type. */
+template<class T, bool = IsVector<T>::value> struct BatchUnderlyingType {
+    typedef T Type;
+    enum: std::size_t { Size = 1 };
+};
+template<class T> struct BatchUnderlyingType<T, true> {
+    typedef typename T::Type Type;
+    enum: std::size_t { Size = T::Size };
+};
+template<class T, class U = typename BatchUnderlyingType<T>::Type> struct HasBatchMinmax: std::integral_constant<bool, BatchUnderlyingType<T>::Size <= 4 && (std::is_same<U, Float>::value || std::is_same<U, Double>::value || std::is_same<U, Int>::value || std::is_same<U, UnsignedInt>::value || std::is_same<U, UnsignedShort>::value || std::is_same<U, UnsignedByte>::value)> {};
+template<class T, class U = typename BatchUnderlyingType<T>::Type> struct HasBatchIsNan: std::integral_constant<bool, BatchUnderlyingType<T>::Size <= 4 && (std::is_same<U, Float>::value || std::is_same<U, Double>::value)> {};
+
+/* Write a minimum and a maximum of each column into min and max. NaNs are
+   ignored, a column that's all NaNs results in a NaN. Expects that the
+   second dimension is contiguous and there's at least one row. */
+MAGNUM_EXPORT void minmaxInto(const Containers::StridedArrayView2D<const Float>& src, Float* min, Float* max);
+MAGNUM_EXPORT void minmaxInto(const Containers::StridedArrayView2D<const Double>& src, Double* min, Double* max);
+MAGNUM_EXPORT void minmaxInto(const Containers::StridedArrayView2D<const Int>& src, Int* min, Int* max);
+MAGNUM_EXPORT void minmaxInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, UnsignedInt* min, UnsignedInt* max);
+MAGNUM_EXPORT void minmaxInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, UnsignedShort* min, UnsignedShort* max);
+MAGNUM_EXPORT void minmaxInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, UnsignedByte* min, UnsignedByte* max);
+
+/* Returns a bit mask of columns that contain at least one NaN. Expects that
+   the second dimension is contiguous and has at most 32 items. */
+MAGNUM_EXPORT UnsignedInt isNanInto(const Containers::StridedArrayView2D<const Float>& src);
+MAGNUM_EXPORT UnsignedInt isNanInto(const Containers::StridedArrayView2D<const Double>& src);
+
+template<class T> inline Containers::StridedArrayView2D<const typename BatchUnderlyingType<T>::Type> batchView(const Containers::StridedArrayView1D<const T>& range) {
+    return Containers::arrayCast<2, const typename BatchUnderlyingType<T>::Type>(range);
+}
+
+template<class T> inline bool isNanFromMask(UnsignedInt mask, std::false_type) {
+    return mask != 0;
+}
+template<class T> inline BitVector<T::Size> isNanFromMask(UnsignedInt mask, std::true_type) {
+    return BitVector<T::Size>{UnsignedByte(mask)};
+}
+
 }
 
 /**
@@ -114,6 +155,24 @@ template<class T, std::size_t size> inline auto isInf(const T(&array)[size]) ->
     return isInf<T>(Containers::StridedArrayView1D<const T>{array});
 }
 
+namespace Implementation {
+    template<class T> inline auto isNan(const Containers::StridedArrayView1D<const T>& range, std::false_type) -> decltype(Math::isNan(std::declval<T>())) {
+        /* For scalars, this loop exits once any value is NaN. For vectors
+           the loop accumulates the bits and exits as soon as all bits are
+           set or the input is exhausted */
+        auto out = Math::isNan(range[0]); /* bool or BitVector */
+        for(std::size_t i = 1; i != range.size(); ++i) {
+            if(out) break;
+            out = out || Math::isNan(range[i]);
+        }
+
+        return out;
+    }
+    template<class T> inline auto isNan(const Containers::StridedArrayView1D<const T>& range, std::true_type) -> decltype(Math::isNan(std::declval<T>())) {
+        return isNanFromMask<T>(isNanInto(batchView(range)), IsVector<T>{});
+    }
+}
+
 /**
 @brief If any number in the range is a NaN
 
@@ -121,21 +180,20 @@ For scalar types returns @cpp true @ce as soon as it finds a NaN value,
 @cpp false @ce otherwise. For vector types, returns @ref BitVector with bits
 set to @cpp 1 @ce if any value has that component NaN. If the range is empty,
 returns @cpp false @ce or a @ref BitVector with no bits set.
+
+For @ref Magnum::Float "Float" and @ref Magnum::Double "Double" scalars and
+vectors of up to four components the range is checked in blocks of values
+instead of one value at a time, with the blocks spanning the whole range if
+it's contiguous.
 @see @ref isNan(T), @ref Constants::nan()
 */
 template<class T> inline auto isNan(const Containers::StridedArrayView1D<const T>& range) -> decltype(isNan(std::declval<T>())) {
     if(range.isEmpty()) return {};
 
-    /* For scalars, this loop exits once any value is infinity. For vectors
-       the loop accumulates the bits and exits as soon as all bits are set
-       or the input is exhausted */
-    auto out = isNan(range[0]); /* bool or BitVector */
-    for(std::size_t i = 1; i != range.size(); ++i) {
-        if(out) break;
-        out = out || isNan(range[i]);
-    }
-
-    return out;
+    /* Float and Double scalars and vectors go through a dedicated
+       implementation that checks whole blocks at once, others through a
+       generic loop */
+    return Implementation::isNan(range, Implementation::HasBatchIsNan<T>{});
 }
 
 /**
@@ -178,7 +236,7 @@ namespace Implementation {
            return the last value so the following loop in min/max/minmax()
            doesn't even execute. */
         for(std::size_t i = 0; i != range.size(); ++i)
-            if(!isNan(range[i])) return {i, range[i]};
+            if(!Math::isNan(range[i])) return {i, range[i]};
         return {range.size() - 1, range.back()};
     }
     /* Floating-point vectors. Try to gather non-NaN values for each component
@@ -192,13 +250,64 @@ namespace Implementation {
         T out = range[0];
         std::size_t firstValid = 0;
         for(std::size_t i = 1; i != range.size(); ++i) {
-            BitVector<T::Size> nans = isNan(out);
+            BitVector<T::Size> nans = Math::isNan(out);
             if(nans.none()) break;
             if(nans.all() && firstValid + 1 == i) ++firstValid;
-            out = Math::lerp(out, range[i], isNan(out));
+            out = Math::lerp(out, range[i], Math::isNan(out));
         }
         return {firstValid, out};
     }
+
+    template<class T, typename std::enable_if<IsScalar<T>::value, int>::type = 0> inline void minmax(T& min, T& max, T value) {
+        if(value < min)
+            min = value;
+        else if(value > max)
+            max = value;
+    }
+    template<std::size_t size, class T> inline void minmax(Vector<size, T>& min, Vector<size, T>& max, const Vector<size, T>& value) {
+        for(std::size_t i = 0; i != size; ++i)
+            minmax(min[i], max[i], value[i]);
+    }
+
+    /* Generic implementation for types that don't have a dedicated one in
+       FunctionsBatch.cpp */
+    template<class T> inline T min(const Containers::StridedArrayView1D<const T>& range, std::false_type) {
+        Containers::Pair<std::size_t, T> iOut = firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+        for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
+            iOut.second() = Math::min(iOut.second(), range[iOut.first()]);
+
+        return iOut.second();
+    }
+    template<class T> inline T max(const Containers::StridedArrayView1D<const T>& range, std::false_type) {
+        Containers::Pair<std::size_t, T> iOut = firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+        for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
+            iOut.second() = Math::max(iOut.second(), range[iOut.first()]);
+
+        return iOut.second();
+    }
+    template<class T> inline Containers::Pair<T, T> minmax(const Containers::StridedArrayView1D<const T>& range, std::false_type) {
+        Containers::Pair<std::size_t, T> iOut = firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+        T min{iOut.second()}, max{iOut.second()};
+        for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
+            minmax(min, max, range[iOut.first()]);
+
+        return {min, max};
+    }
+
+    /* Dedicated implementation, calculating both the min and max at once as
+       it's practically the same cost as calculating just one of them */
+    template<class T> inline Containers::Pair<T, T> minmax(const Containers::StridedArrayView1D<const T>& range, std::true_type) {
+        typedef typename BatchUnderlyingType<T>::Type Type;
+        Containers::Pair<T, T> out;
+        minmaxInto(batchView(range), reinterpret_cast<Type*>(&out.first()), reinterpret_cast<Type*>(&out.second()));
+        return out;
+    }
+    template<class T> inline T min(const Containers::StridedArrayView1D<const T>& range, std::true_type) {
+        return minmax(range, std::true_type{}).first();
+    }
+    template<class T> inline T max(const Containers::StridedArrayView1D<const T>& range, std::true_type) {
+        return minmax(range, std::true_type{}).second();
+    }
 }
 
 /**
@@ -206,16 +315,17 @@ namespace Implementation {
 
 If the range is empty, returns default-constructed value. <em>NaN</em>s are
 ignored, unless the range is all <em>NaN</em>s.
+
+See @ref minmax(const Containers::StridedArrayView1D<const T>&) for details
+about the implementation. If both the minimum and the maximum is needed,
+calling it directly instead of @ref min() and @ref max() avoids going through
+the data twice.
 @see @ref min(T, T), @ref isNan(const Containers::StridedArrayView1D<const T>&)
 */
 template<class T> inline T min(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
-    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
-        iOut.second() = Math::min(iOut.second(), range[iOut.first()]);
-
-    return iOut.second();
+    return Implementation::min(range, Implementation::HasBatchMinmax<T>{});
 }
 
 /**
@@ -251,16 +361,17 @@ template<class T, std::size_t size> inline T min(const T(&array)[size]) {
 
 If the range is empty, returns default-constructed value. <em>NaN</em>s are
 ignored, unless the range is all <em>NaN</em>s.
+
+See @ref minmax(const Containers::StridedArrayView1D<const T>&) for details
+about the implementation. If both the minimum and the maximum is needed,
+calling it directly instead of @ref min() and @ref max() avoids going through
+the data twice.
 @see @ref max(T, T), @ref isNan(const Containers::StridedArrayView1D<const T>&)
 */
 template<class T> inline T max(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
-    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
-        iOut.second() = Math::max(iOut.second(), range[iOut.first()]);
-
-    return iOut.second();
+    return Implementation::max(range, Implementation::HasBatchMinmax<T>{});
 }
 
 /**
@@ -291,24 +402,21 @@ template<class T, std::size_t size> inline T max(const T(&array)[size]) {
     return max<T>(Containers::StridedArrayView1D<const T>{array});
 }
 
-namespace Implementation {
-    template<class T, typename std::enable_if<IsScalar<T>::value, int>::type = 0> inline void minmax(T& min, T& max, T value) {
-        if(value < min)
-            min = value;
-        else if(value > max)
-            max = value;
-    }
-    template<std::size_t size, class T> inline void minmax(Vector<size, T>& min, Vector<size, T>& max, const Vector<size, T>& value) {
-        for(std::size_t i = 0; i != size; ++i)
-            minmax(min[i], max[i], value[i]);
-    }
-}
-
 /**
 @brief Minimum and maximum of a range
 
 If the range is empty, returns default-constructed values. <em>NaN</em>s are
 ignored, unless the range is all <em>NaN</em>s.
+
+For @ref Magnum::Float "Float", @ref Magnum::Double "Double",
+@ref Magnum::Int "Int", @ref Magnum::UnsignedInt "UnsignedInt",
+@ref Magnum::UnsignedShort "UnsignedShort" and
+@ref Magnum::UnsignedByte "UnsignedByte" scalars and vectors of up to four
+components the calculation is done with several independent accumulators,
+processing the data as a single flat array if the range is contiguous and
+loading whole elements at once otherwise. On @ref CORRADE_TARGET_SSE2 "SSE2"
+targets SIMD instructions are used for @ref Magnum::Float "Float" types and
+for contiguous ranges of unsigned integer scalars, such as index buffers.
 @see @ref minmax(T, T),
     @ref Range::Range(const Containers::Pair<VectorType, VectorType>&),
     @ref isNan(const Containers::StridedArrayView1D<const T>&)
@@ -316,12 +424,7 @@ ignored, unless the range is all <em>NaN</em>s.
 template<class T> inline Containers::Pair<T, T> minmax(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
-    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    T min{iOut.second()}, max{iOut.second()};
-    for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
-        Implementation::minmax(min, max, range[iOut.first()]);
-
-    return {min, max};
+    return Implementation::minmax(range, Implementation::HasBatchMinmax<T>{});
 }
 
 /**
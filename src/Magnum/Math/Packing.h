@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Functions @ref Magnum::Math::pack(), @ref Magnum::Math::unpack(), @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf()
+ * @brief Functions @ref Magnum::Math::pack(), @ref Magnum::Math::unpack(), @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packOctahedral(), @ref Magnum::Math::unpackOctahedral()
  */
 
 #include "Magnum/Math/Functions.h"
@@ -218,6 +218,62 @@ template<std::size_t size> Vector<size, Float> unpackHalf(const Vector<size, Uns
     return out;
 }
 
+/**
+@brief Pack a direction vector into an octahedral representation
+@m_since_latest
+
+Projects @p vector onto an octahedron, which is then unfolded onto a square,
+resulting in a two-component representation in range @f$ [-1, 1] @f$.
+Compared to storing all three components it needs one component less and the
+precision is distributed more uniformly over the sphere, so it's commonly used
+for storing normals and tangents. The result can be further packed into an 8-
+or 16-bit representation with @ref pack(), for example
+@cpp Math::pack<Vector2s>(Math::packOctahedral(normal)) @ce. The @p vector
+doesn't need to be normalized, but is expected to be non-zero.
+
+Algorithm used: *Zina H. Cigolle, Sam Donow, Daniel Evangelakos, Michael Mara,
+Morgan McGuire, Quirin Meyer --- A Survey of Efficient Representations for
+Independent Unit Vectors, Journal of Computer Graphics Techniques, 2014,
+http://jcgt.org/published/0003/02/01/*
+@see @ref unpackOctahedral(), @ref packOctahedralInto()
+*/
+template<class T> Vector<2, T> packOctahedral(const Vector<3, T>& vector) {
+    static_assert(IsFloatingPoint<T>::value,
+        "octahedral packing can be done only from floating-point types");
+    const T sum = abs(vector[0]) + abs(vector[1]) + abs(vector[2]);
+    const T x = vector[0]/sum;
+    const T y = vector[1]/sum;
+    if(vector[2] >= T(0))
+        return Vector<2, T>{x, y};
+
+    /* Fold the lower hemisphere over the diagonals */
+    return Vector<2, T>{(T(1) - abs(y))*(x >= T(0) ? T(1) : T(-1)),
+                        (T(1) - abs(x))*(y >= T(0) ? T(1) : T(-1))};
+}
+
+/**
+@brief Unpack an octahedral representation into a normalized direction vector
+@m_since_latest
+
+Inverse of @ref packOctahedral(). Values produced by @ref unpack() from an 8-
+or 16-bit representation can be passed directly, for example
+@cpp Math::unpackOctahedral(Math::unpack<Vector2>(packed)) @ce. The result is
+always normalized.
+@see @ref unpackOctahedralInto()
+*/
+template<class T> Vector<3, T> unpackOctahedral(const Vector<2, T>& octahedral) {
+    static_assert(IsFloatingPoint<T>::value,
+        "octahedral unpacking can be done only into floating-point types");
+    Vector<3, T> out{octahedral[0], octahedral[1],
+        T(1) - abs(octahedral[0]) - abs(octahedral[1])};
+
+    /* Unfold the lower hemisphere */
+    const T t = out[2] < T(0) ? -out[2] : T(0);
+    out[0] += out[0] >= T(0) ? -t : t;
+    out[1] += out[1] >= T(0) ? -t : t;
+    return out.normalized();
+}
+
 /* Since 1.8.17, the original short-hand group closing doesn't work anymore.
    FFS. */
 /**
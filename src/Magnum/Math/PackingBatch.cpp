@@ -35,10 +35,33 @@
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
+#ifdef CORRADE_TARGET_AVX_F16C
+#include <immintrin.h>
+#elif defined(CORRADE_TARGET_NEON_FP16)
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace {
 
+/* If both views are contiguous, they're processed as a single long row
+   instead of many short ones. That avoids the per-row overhead for small
+   types such as Vector3 and lets the compiler vectorize the inner loop
+   across the whole data. */
+template<class T, class U> inline void iterationCounts(const Containers::StridedArrayView2D<T>& src, const Containers::StridedArrayView2D<U>& dst, std::size_t& outer, std::size_t& inner) {
+    outer = src.size()[0];
+    inner = src.size()[1];
+    if(src.isContiguous() && dst.isContiguous()) {
+        inner *= outer;
+        outer = 1;
+    }
+}
+
+}
+
+namespace {
+
 template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -47,17 +70,15 @@ template<class T> inline void unpackUnsignedIntoImplementation(const Containers:
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in ebug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t maxI, maxJ;
+    iterationCounts(src, dst, maxI, maxJ);
+    for(std::size_t i = 0; i != maxI; ++i) {
         const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
         Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
         for(std::size_t j = 0; j != maxJ; ++j)
@@ -88,17 +109,15 @@ template<class T> inline void unpackSignedIntoImplementation(const Containers::S
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t maxI, maxJ;
+    iterationCounts(src, dst, maxI, maxJ);
+    for(std::size_t i = 0; i != maxI; ++i) {
         const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
         Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
         for(std::size_t j = 0; j != maxJ; ++j) {
@@ -132,22 +151,30 @@ template<class T> inline void packIntoImplementation(const Containers::StridedAr
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::packInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t maxI, maxJ;
+    iterationCounts(src, dst, maxI, maxJ);
+    for(std::size_t i = 0; i != maxI; ++i) {
         const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
         T* dstPtrI = reinterpret_cast<T*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
+        for(std::size_t j = 0; j != maxJ; ++j) {
+            /* Equivalent to std::round() for all values that fit into an
+               Int, but unlike std::round(), which is a library call and
+               rounds half away from zero in a way SSE4.1 can't do in a
+               single instruction, it's just conversions and comparisons that
+               the compiler can vectorize. Not delegating to a helper to
+               avoid function calls in debug builds. */
             /** @todo provide a version that doesn't do rounding */
-            *dstPtrI++ = std::round(*srcPtrI++*bitMax);
+            const Float value = *srcPtrI++*bitMax;
+            const Int truncated = Int(value);
+            const Float fraction = value - Float(truncated);
+            *dstPtrI++ = T(truncated + (fraction >= 0.5f) - (fraction <= -0.5f));
+        }
 
         srcPtr += srcStride;
         dstPtr += dstStride;
@@ -182,16 +209,14 @@ template<class T, class U> inline void castIntoImplementation(const Containers::
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::castInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug buílds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t maxI, maxJ;
+    iterationCounts(src, dst, maxI, maxJ);
+    for(std::size_t i = 0; i != maxI; ++i) {
         const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
         U* dstPtrI = reinterpret_cast<U*>(dstPtr);
         for(std::size_t j = 0; j != maxJ; ++j)
@@ -490,11 +515,23 @@ void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& s
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t maxI, maxJ;
+    iterationCounts(src, dst, maxI, maxJ);
+    for(std::size_t i = 0; i != maxI; ++i) {
         const UnsignedShort* srcPtrI = reinterpret_cast<const UnsignedShort*>(srcPtr);
         UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
+        std::size_t j = 0;
+        /* Hardware conversion of eight / four values at once if available.
+           Compared to the table lookup below, signaling NaNs get quieted in
+           the process, the output is bit-exact otherwise. */
+        #ifdef CORRADE_TARGET_AVX_F16C
+        for(; j + 8 <= maxJ; j += 8, srcPtrI += 8, dstPtrI += 8)
+            _mm256_storeu_ps(reinterpret_cast<Float*>(dstPtrI), _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(srcPtrI))));
+        #elif defined(CORRADE_TARGET_NEON_FP16)
+        for(; j + 4 <= maxJ; j += 4, srcPtrI += 4, dstPtrI += 4)
+            vst1q_f32(reinterpret_cast<Float*>(dstPtrI), vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(srcPtrI))));
+        #endif
+        for(; j != maxJ; ++j) {
             const UnsignedShort h = *srcPtrI++;
             *dstPtrI++ = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
         }
@@ -517,13 +554,36 @@ void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t maxI, maxJ;
+    iterationCounts(src, dst, maxI, maxJ);
+    for(std::size_t i = 0; i != maxI; ++i) {
         const UnsignedInt* srcPtrI = reinterpret_cast<const UnsignedInt*>(srcPtr);
         UnsignedShort* dstPtrI = reinterpret_cast<UnsignedShort*>(dstPtr);
         for(std::size_t j = 0; j != maxJ; ++j) {
             const UnsignedInt f = *srcPtrI++;
+            /* With AVX2 variable shifts, calculating the values of
+               HalfBaseTable and HalfShiftTable directly vectorizes and is
+               faster than the lookup. The output is bit-exact with the table
+               for all inputs. Hardware F16C conversion isn't used because it
+               rounds to nearest instead of truncating and thus differs from
+               the table in the last bit. */
+            #ifdef CORRADE_TARGET_AVX2
+            const UnsignedInt sign = (f >> 16) & 0x8000;
+            const UnsignedInt exponent = (f >> 23) & 0xff;
+            const UnsignedInt mantissa = f & 0x007fffff;
+            /* Exponents below 113 are denormals or zero, 143 and above
+               infinity, with 255 being infinity or NaN */
+            const UnsignedInt denormalShift = exponent >= 113 ? 0 :
+                exponent < 95 ? 31 : 126 - exponent;
+            const UnsignedInt denormal = (mantissa|0x00800000) >> denormalShift;
+            const UnsignedInt normal = ((exponent - 112) << 10) + (mantissa >> 13);
+            *dstPtrI++ = UnsignedShort(sign|(
+                exponent < 113 ? denormal :
+                exponent < 143 ? normal :
+                exponent < 255 ? 0x7c00 : 0x7c00 + (mantissa >> 13)));
+            #else
             *dstPtrI++ = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+            #endif
         }
 
         srcPtr += srcStride;
@@ -531,4 +591,130 @@ void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const
     }
 }
 
+namespace {
+
+/* Float destinations are written as-is, integral ones packed the same way as
+   in packIntoImplementation() above */
+inline void packOctahedralComponent(const Float value, Float& out) {
+    out = value;
+}
+
+template<class T> inline void packOctahedralComponent(const Float value, T& out) {
+    const Float scaled = value*Implementation::bitMax<T>();
+    const Int truncated = Int(scaled);
+    const Float fraction = scaled - Float(truncated);
+    out = T(truncated + (fraction >= 0.5f) - (fraction <= -0.5f));
+}
+
+inline Float unpackOctahedralComponent(const Float value) {
+    return value;
+}
+
+template<class T> inline Float unpackOctahedralComponent(const T value) {
+    const Float unpacked = value/Implementation::bitMax<T>();
+    return unpacked < -1.0f ? -1.0f : unpacked;
+}
+
+template<class T> void packOctahedralIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+    CORRADE_ASSERT(src.size()[0] == dst.size()[0] && src.size()[1] == 3 && dst.size()[1] == 2,
+        "Math::packOctahedralInto(): expected a source view with 3 and a destination view with 2 components of the same size, got" << src.size() << "and" << dst.size(), );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::packOctahedralInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.template isContiguous<1>(),
+        "Math::packOctahedralInto(): second destination view dimension is not contiguous", );
+
+    /* Written with selects instead of branches and without calling into
+       Math::abs() or Math::sign() so the loop stays vectorizable and doesn't
+       do function calls in debug builds */
+    const char* srcPtr = reinterpret_cast<const char*>(src.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t srcStride = src.stride()[0];
+    const std::ptrdiff_t dstStride = dst.stride()[0];
+    for(std::size_t i = 0, max = src.size()[0]; i != max; ++i) {
+        const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
+        T* dstPtrI = reinterpret_cast<T*>(dstPtr);
+
+        const Float x = srcPtrI[0];
+        const Float y = srcPtrI[1];
+        const Float z = srcPtrI[2];
+        const Float absX = x < 0.0f ? -x : x;
+        const Float absY = y < 0.0f ? -y : y;
+        const Float absZ = z < 0.0f ? -z : z;
+        const Float sumInverted = 1.0f/(absX + absY + absZ);
+        const Float octX = x*sumInverted;
+        const Float octY = y*sumInverted;
+        const Float absOctX = absX*sumInverted;
+        const Float absOctY = absY*sumInverted;
+        /* Fold the lower hemisphere over the diagonals */
+        const Float foldedX = x >= 0.0f ? 1.0f - absOctY : absOctY - 1.0f;
+        const Float foldedY = y >= 0.0f ? 1.0f - absOctX : absOctX - 1.0f;
+        packOctahedralComponent(z >= 0.0f ? octX : foldedX, dstPtrI[0]);
+        packOctahedralComponent(z >= 0.0f ? octY : foldedY, dstPtrI[1]);
+
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+}
+
+template<class T> void unpackOctahedralIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size()[0] == dst.size()[0] && src.size()[1] == 2 && dst.size()[1] == 3,
+        "Math::unpackOctahedralInto(): expected a source view with 2 and a destination view with 3 components of the same size, got" << src.size() << "and" << dst.size(), );
+    CORRADE_ASSERT(src.template isContiguous<1>(),
+        "Math::unpackOctahedralInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::unpackOctahedralInto(): second destination view dimension is not contiguous", );
+
+    /* Again no branches and no calls into Math functions to keep the loop
+       vectorizable; the square root is expected to be inlined as well */
+    const char* srcPtr = reinterpret_cast<const char*>(src.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t srcStride = src.stride()[0];
+    const std::ptrdiff_t dstStride = dst.stride()[0];
+    for(std::size_t i = 0, max = src.size()[0]; i != max; ++i) {
+        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
+        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
+
+        Float x = unpackOctahedralComponent(srcPtrI[0]);
+        Float y = unpackOctahedralComponent(srcPtrI[1]);
+        const Float z = 1.0f - (x < 0.0f ? -x : x) - (y < 0.0f ? -y : y);
+        /* Unfold the lower hemisphere */
+        const Float t = z < 0.0f ? -z : 0.0f;
+        x += x >= 0.0f ? -t : t;
+        y += y >= 0.0f ? -t : t;
+        const Float lengthInverted = 1.0f/std::sqrt(x*x + y*y + z*z);
+        dstPtrI[0] = x*lengthInverted;
+        dstPtrI[1] = y*lengthInverted;
+        dstPtrI[2] = z*lengthInverted;
+
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+}
+
+}
+
+void packOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    packOctahedralIntoImplementation(src, dst);
+}
+
+void packOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    packOctahedralIntoImplementation(src, dst);
+}
+
+void packOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    packOctahedralIntoImplementation(src, dst);
+}
+
+void unpackOctahedralInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackOctahedralIntoImplementation(src, dst);
+}
+
+void unpackOctahedralInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackOctahedralIntoImplementation(src, dst);
+}
+
+void unpackOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackOctahedralIntoImplementation(src, dst);
+}
+
 }}
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Functions @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::castInto()
+ * @brief Functions @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::packOctahedralInto(), @ref Magnum::Math::unpackOctahedralInto(), @ref Magnum::Math::castInto()
  * @m_since{2020,06}
  */
 
@@ -78,6 +78,11 @@ Or call the function on the nested dimensions in a loop if not:
 
 @snippet Math.cpp unpackInto-slice-loop
 
+If both @p src and @p dst are contiguous in both dimensions, the whole range
+is processed as a single contiguous block, which is significantly faster for
+small vector types than processing each vector separately. The same applies to
+all other batch packing and casting functions.
+
 @see @ref packInto(), @ref castInto(),
     @relativeref{Corrade,Containers::StridedArrayView::isContiguous()}
 */
@@ -187,11 +192,71 @@ contiguous. See @ref unpackInto(const Containers::StridedArrayView2D<const Unsig
 for various examples of how to pass the arguments.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
-ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*. If Magnum is
+compiled with @ref CORRADE_TARGET_AVX_F16C or @ref CORRADE_TARGET_NEON_FP16
+enabled, hardware conversion instructions are used instead. The result is the
+same except for signaling NaNs, which get converted to quiet NaNs.
 @see @ref Half
 */
 MAGNUM_EXPORT void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst);
 
+/**
+@brief Pack a range of direction vectors into an octahedral representation
+@param[in]  src     Source direction vectors
+@param[out] dst     Destination octahedral values
+@m_since_latest
+
+Batch equivalent of @ref packOctahedral(), combined with @ref packInto() for
+the integral destination types. Expects that @p src and @p dst have the same
+size in the first dimension, that the second dimension of @p src has a size of
+3 and the second dimension of @p dst a size of 2, and that the second dimension
+in both is contiguous. The source vectors don't need to be normalized, but are
+expected to be non-zero. See @ref unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>&, const Containers::StridedArrayView2D<Float>&)
+for various examples of how to pass the arguments.
+@see @ref unpackOctahedralInto()
+*/
+MAGNUM_EXPORT void packOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void packOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void packOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+/**
+@brief Unpack a range of octahedral values into normalized direction vectors
+@param[in]  src     Source octahedral values
+@param[out] dst     Destination direction vectors
+@m_since_latest
+
+Batch equivalent of @ref unpackOctahedral(), combined with @ref unpackInto()
+for the integral source types. Expects that @p src and @p dst have the same
+size in the first dimension, that the second dimension of @p src has a size of
+2 and the second dimension of @p dst a size of 3, and that the second dimension
+in both is contiguous. See @ref unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>&, const Containers::StridedArrayView2D<Float>&)
+for various examples of how to pass the arguments.
+@see @ref packOctahedralInto()
+*/
+MAGNUM_EXPORT void unpackOctahedralInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void unpackOctahedralInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void unpackOctahedralInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst);
+
 /**
 @brief Cast integer values into a 32-bit floating-point representation
 @param[in]  src     Source integral values
@@ -24,13 +24,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -47,6 +48,10 @@ struct FunctionsBatchTest: TestSuite::Tester {
     void nanIgnoring();
     void nanIgnoringVector();
 
+    template<class T> void isNanLong();
+    template<class T> void minmaxLong();
+    template<class T> void minmaxUnsignedHighBit();
+
     void constIterable();
 };
 
@@ -55,6 +60,93 @@ using namespace Literals;
 using Magnum::Constants;
 using Magnum::Vector2;
 using Magnum::Vector3;
+using Magnum::Vector4;
+
+template<class> struct ElementTraits;
+template<> struct ElementTraits<Float> {
+    typedef Float Type;
+    static const char* name() { return "Float"; }
+};
+template<> struct ElementTraits<Double> {
+    typedef Double Type;
+    static const char* name() { return "Double"; }
+};
+template<> struct ElementTraits<Int> {
+    typedef Int Type;
+    static const char* name() { return "Int"; }
+};
+template<> struct ElementTraits<UnsignedInt> {
+    typedef UnsignedInt Type;
+    static const char* name() { return "UnsignedInt"; }
+};
+template<> struct ElementTraits<UnsignedShort> {
+    typedef UnsignedShort Type;
+    static const char* name() { return "UnsignedShort"; }
+};
+template<> struct ElementTraits<UnsignedByte> {
+    typedef UnsignedByte Type;
+    static const char* name() { return "UnsignedByte"; }
+};
+template<> struct ElementTraits<Vector2> {
+    typedef Float Type;
+    static const char* name() { return "Vector2"; }
+};
+template<> struct ElementTraits<Vector3> {
+    typedef Float Type;
+    static const char* name() { return "Vector3"; }
+};
+template<> struct ElementTraits<Vector4> {
+    typedef Float Type;
+    static const char* name() { return "Vector4"; }
+};
+template<> struct ElementTraits<Vector3d> {
+    typedef Double Type;
+    static const char* name() { return "Vector3d"; }
+};
+template<> struct ElementTraits<Vector3i> {
+    typedef Int Type;
+    static const char* name() { return "Vector3i"; }
+};
+template<> struct ElementTraits<Vector4ui> {
+    typedef UnsignedInt Type;
+    static const char* name() { return "Vector4ui"; }
+};
+
+/* The 8 bytes of padding for the interleaved case make Vector2 and larger
+   types go through the SSE2 path that loads whole elements, while Float stays
+   on the generic path */
+const struct {
+    const char* name;
+    std::size_t count;
+    std::size_t padding;
+    bool flipped;
+    std::size_t nanEvery;
+} MinmaxLongData[]{
+    {"single item", 1, 0, false, 0},
+    {"contiguous", 120, 0, false, 0},
+    {"contiguous, not a multiple of lane count", 131, 0, false, 0},
+    {"contiguous, NaNs", 131, 0, false, 3},
+    {"interleaved", 120, 8, false, 0},
+    {"interleaved, single item", 1, 8, false, 0},
+    {"interleaved, not a multiple of lane count", 131, 8, false, 0},
+    {"interleaved, NaNs", 131, 8, false, 5},
+    {"interleaved, flipped", 131, 8, true, 0},
+    {"interleaved, flipped, NaNs", 131, 8, true, 2},
+};
+
+const struct {
+    const char* name;
+    std::size_t count;
+    std::size_t padding;
+    std::size_t nanElement, nanComponent;
+} IsNanLongData[]{
+    {"contiguous, no NaNs", 257, 0, ~std::size_t{}, 0},
+    {"contiguous, NaN at the start", 257, 0, 0, 0},
+    {"contiguous, NaN at the end", 257, 0, 256, ~std::size_t{}},
+    {"interleaved, no NaNs", 257, 8, ~std::size_t{}, 0},
+    {"interleaved, NaN in the middle", 257, 8, 133, ~std::size_t{}},
+    {"interleaved, NaN at the end", 257, 8, 256, ~std::size_t{}},
+};
 
 FunctionsBatchTest::FunctionsBatchTest() {
     addTests({&FunctionsBatchTest::isInf,
@@ -65,9 +157,38 @@ FunctionsBatchTest::FunctionsBatchTest() {
               &FunctionsBatchTest::minmax,
 
               &FunctionsBatchTest::nanIgnoring,
-              &FunctionsBatchTest::nanIgnoringVector,
-
-              &FunctionsBatchTest::constIterable});
+              &FunctionsBatchTest::nanIgnoringVector});
+
+    addInstancedTests<FunctionsBatchTest>({
+        &FunctionsBatchTest::isNanLong<Float>,
+        &FunctionsBatchTest::isNanLong<Double>,
+        &FunctionsBatchTest::isNanLong<Vector2>,
+        &FunctionsBatchTest::isNanLong<Vector3>,
+        &FunctionsBatchTest::isNanLong<Vector4>,
+        &FunctionsBatchTest::isNanLong<Vector3d>},
+        Containers::arraySize(IsNanLongData));
+
+    addInstancedTests<FunctionsBatchTest>({
+        &FunctionsBatchTest::minmaxLong<Float>,
+        &FunctionsBatchTest::minmaxLong<Double>,
+        &FunctionsBatchTest::minmaxLong<Int>,
+        &FunctionsBatchTest::minmaxLong<UnsignedInt>,
+        &FunctionsBatchTest::minmaxLong<UnsignedShort>,
+        &FunctionsBatchTest::minmaxLong<UnsignedByte>,
+        &FunctionsBatchTest::minmaxLong<Vector2>,
+        &FunctionsBatchTest::minmaxLong<Vector3>,
+        &FunctionsBatchTest::minmaxLong<Vector4>,
+        &FunctionsBatchTest::minmaxLong<Vector3d>,
+        &FunctionsBatchTest::minmaxLong<Vector3i>,
+        &FunctionsBatchTest::minmaxLong<Vector4ui>},
+        Containers::arraySize(MinmaxLongData));
+
+    addTests<FunctionsBatchTest>({
+        &FunctionsBatchTest::minmaxUnsignedHighBit<UnsignedInt>,
+        &FunctionsBatchTest::minmaxUnsignedHighBit<UnsignedShort>,
+        &FunctionsBatchTest::minmaxUnsignedHighBit<UnsignedByte>,
+
+        &FunctionsBatchTest::constIterable});
 }
 
 void FunctionsBatchTest::isInf() {
@@ -289,6 +410,104 @@ void FunctionsBatchTest::nanIgnoringVector() {
     CORRADE_COMPARE(Math::minmax(allNan).second()[1], Constants::nan());
 }
 
+template<class T> void FunctionsBatchTest::isNanLong() {
+    auto&& data = IsNanLongData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(ElementTraits<T>::name());
+
+    typedef typename ElementTraits<T>::Type Type;
+    const std::size_t stride = sizeof(T) + data.padding;
+    Containers::Array<char> storage{ValueInit, data.count*stride};
+    Containers::StridedArrayView1D<T> view{storage, reinterpret_cast<T*>(storage.data()), data.count, std::ptrdiff_t(stride)};
+    Containers::StridedArrayView2D<Type> components = Containers::arrayCast<2, Type>(view);
+
+    /* Fill the padding with NaNs to verify it's not taken into account */
+    for(std::size_t i = 0; i != data.count; ++i)
+        for(std::size_t j = 0; j != data.padding/sizeof(Float); ++j)
+            reinterpret_cast<Float*>(storage.data() + i*stride + sizeof(T))[j] = Constants::nan();
+
+    /* A NaN either in a particular component or in all of them */
+    T expected{};
+    if(data.nanElement != ~std::size_t{}) {
+        for(std::size_t j = 0; j != components.size()[1]; ++j) {
+            if(data.nanComponent != ~std::size_t{} && data.nanComponent != j)
+                continue;
+            components[data.nanElement][j] = Math::Constants<Type>::nan();
+            Containers::arrayCast<Type>(Containers::arrayView(&expected, 1))[j] = Math::Constants<Type>::nan();
+        }
+    }
+
+    CORRADE_COMPARE(Math::isNan(Containers::StridedArrayView1D<const T>{view}), Math::isNan(expected));
+}
+
+template<class T> void FunctionsBatchTest::minmaxLong() {
+    auto&& data = MinmaxLongData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(ElementTraits<T>::name());
+
+    if(data.nanEvery && !IsFloatingPoint<T>::value)
+        CORRADE_SKIP("No NaNs in integer types.");
+
+    typedef typename ElementTraits<T>::Type Type;
+    const std::size_t stride = sizeof(T) + data.padding;
+    Containers::Array<char> storage{NoInit, data.count*stride};
+    /* Fill the padding with large values to verify it's not taken into
+       account */
+    std::memset(storage.data(), 0x7f, storage.size());
+    Containers::StridedArrayView1D<T> view{storage, reinterpret_cast<T*>(storage.data()), data.count, std::ptrdiff_t(stride)};
+    if(data.flipped)
+        view = view.template flipped<0>();
+    Containers::StridedArrayView2D<Type> components = Containers::arrayCast<2, Type>(view);
+
+    /* Values in the [10, 40] range, with the minimum and maximum of each
+       component at a different position and NaNs sprinkled in between */
+    const std::size_t componentCount = components.size()[1];
+    for(std::size_t i = 0; i != data.count; ++i) {
+        for(std::size_t j = 0; j != componentCount; ++j) {
+            if(i == data.count*(j + 1)/(componentCount + 1))
+                components[i][j] = Type(1);
+            else if(i == data.count - 1 - j*data.count/(componentCount + 1))
+                components[i][j] = Type(100);
+            else if(data.nanEvery && (i + j) % data.nanEvery == 0)
+                components[i][j] = Type(Constants::nan());
+            else
+                components[i][j] = Type(10 + (i*7 + j*13) % 31);
+        }
+    }
+
+    /* With a single item the minimum and maximum is the same */
+    T expectedMin{Type(1)};
+    T expectedMax{Type(data.count == 1 ? 1 : 100)};
+
+    Containers::StridedArrayView1D<const T> cview = view;
+    CORRADE_COMPARE(Math::min(cview), expectedMin);
+    CORRADE_COMPARE(Math::max(cview), expectedMax);
+    CORRADE_COMPARE(Math::minmax(cview), Containers::pair(expectedMin, expectedMax));
+}
+
+template<class T> void FunctionsBatchTest::minmaxUnsignedHighBit() {
+    setTestCaseTemplateName(ElementTraits<T>::name());
+
+    /* The SSE2 implementation uses signed comparisons on values with a
+       flipped sign bit, verify it gives the unsigned order for values with
+       the highest bit set as well */
+    const T highBit = T(1) << (sizeof(T)*8 - 1);
+    T data[131];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = T(highBit + i % 7);
+    data[57] = T(3);
+    data[98] = T(~T{});
+
+    CORRADE_COMPARE(Math::minmax(Containers::arrayView(data)),
+        Containers::pair(T(3), T(~T{})));
+
+    /* And without the outliers */
+    data[57] = T(highBit + 1);
+    data[98] = T(highBit + 2);
+    CORRADE_COMPARE(Math::minmax(Containers::arrayView(data)),
+        Containers::pair(highBit, T(highBit + 6)));
+}
+
 void FunctionsBatchTest::constIterable() {
     const Vector2 data[]{{5, -3}, {-2, 14}, {9, -5}};
 
@@ -24,10 +24,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Vector3.h"
 
 #ifdef CORRADE_TARGET_SSE2
 #include <xmmintrin.h>
@@ -49,6 +54,15 @@ struct FunctionsBenchmark: TestSuite::Tester {
 
     void sinCosSeparate();
     void sinCosCombined();
+
+    void minmaxFloatScalar();
+    void minmaxFloat();
+    void minmaxScalar();
+    void minmax();
+    void minmaxStrided();
+    void isNanScalar();
+    void isNan();
+    void isNanStrided();
 };
 
 FunctionsBenchmark::FunctionsBenchmark() {
@@ -67,11 +81,22 @@ FunctionsBenchmark::FunctionsBenchmark() {
 
     addBenchmarks({&FunctionsBenchmark::sinCosSeparate,
                    &FunctionsBenchmark::sinCosCombined}, 100);
+
+    addBenchmarks({&FunctionsBenchmark::minmaxFloatScalar,
+                   &FunctionsBenchmark::minmaxFloat,
+                   &FunctionsBenchmark::minmaxScalar,
+                   &FunctionsBenchmark::minmax,
+                   &FunctionsBenchmark::minmaxStrided,
+                   &FunctionsBenchmark::isNanScalar,
+                   &FunctionsBenchmark::isNan,
+                   &FunctionsBenchmark::isNanStrided}, 10);
 }
 
 using Magnum::Constants;
 using Magnum::Deg;
 using Magnum::Rad;
+using Magnum::Vector2;
+using Magnum::Vector3;
 
 enum: std::size_t { Repeats = 100000 };
 
@@ -225,6 +250,142 @@ void FunctionsBenchmark::sinCosCombined() {
 }
 
 
+enum: std::size_t { BatchCount = 65536 };
+
+/* Vertex data are usually interleaved with other attributes, which means the
+   views aren't contiguous. This struct is used for the *Strided() variants to
+   simulate that. */
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+
+Containers::Array<Vertex> batchData() {
+    Containers::Array<Vertex> out{NoInit, BatchCount};
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        out[i].position = {Float(i % 1000), Float(i*3 % 997), -Float(i*7 % 1009)};
+        out[i].normal = {};
+        out[i].textureCoordinates = {};
+    }
+    return out;
+}
+
+Containers::Array<Float> batchDataFloat() {
+    Containers::Array<Float> out{NoInit, BatchCount};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Float(i*3 % 997) - 500.0f;
+    return out;
+}
+
+Containers::Array<Vector3> batchDataContiguous() {
+    Containers::Array<Vertex> data = batchData();
+    Containers::Array<Vector3> out{NoInit, BatchCount};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = data[i].position;
+    return out;
+}
+
+void FunctionsBenchmark::minmaxFloatScalar() {
+    Containers::Array<Float> data = batchDataFloat();
+
+    /* The original one-value-at-a-time loop, without NaN handling */
+    Containers::Pair<Float, Float> out;
+    CORRADE_BENCHMARK(1) {
+        Float min = data[0], max = data[0];
+        for(std::size_t i = 1; i != data.size(); ++i) {
+            if(data[i] < min) min = data[i];
+            else if(data[i] > max) max = data[i];
+        }
+        out = {min, max};
+    }
+
+    CORRADE_COMPARE(out, Containers::pair(-500.0f, 496.0f));
+}
+
+void FunctionsBenchmark::minmaxFloat() {
+    Containers::Array<Float> data = batchDataFloat();
+
+    Containers::Pair<Float, Float> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(data);
+
+    CORRADE_COMPARE(out, Containers::pair(-500.0f, 496.0f));
+}
+
+void FunctionsBenchmark::minmaxScalar() {
+    Containers::Array<Vector3> data = batchDataContiguous();
+
+    /* The original one-value-at-a-time loop, without NaN handling */
+    Containers::Pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1) {
+        Vector3 min = data[0], max = data[0];
+        for(std::size_t i = 1; i != data.size(); ++i) {
+            min = Math::min(min, data[i]);
+            max = Math::max(max, data[i]);
+        }
+        out = {min, max};
+    }
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3{0.0f, 0.0f, -1008.0f}, Vector3{999.0f, 996.0f, 0.0f}));
+}
+
+void FunctionsBenchmark::minmax() {
+    Containers::Array<Vector3> data = batchDataContiguous();
+
+    Containers::Pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(data);
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3{0.0f, 0.0f, -1008.0f}, Vector3{999.0f, 996.0f, 0.0f}));
+}
+
+void FunctionsBenchmark::minmaxStrided() {
+    Containers::Array<Vertex> data = batchData();
+
+    Containers::Pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(stridedArrayView(data).slice(&Vertex::position));
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3{0.0f, 0.0f, -1008.0f}, Vector3{999.0f, 996.0f, 0.0f}));
+}
+
+void FunctionsBenchmark::isNanScalar() {
+    Containers::Array<Vector3> data = batchDataContiguous();
+
+    /* The original one-value-at-a-time loop */
+    BitVector<3> out;
+    CORRADE_BENCHMARK(1) {
+        out = Math::isNan(data[0]);
+        for(std::size_t i = 1; i != data.size(); ++i) {
+            if(out.all()) break;
+            out = out || Math::isNan(data[i]);
+        }
+    }
+
+    CORRADE_COMPARE(out, BitVector<3>{0});
+}
+
+void FunctionsBenchmark::isNan() {
+    Containers::Array<Vector3> data = batchDataContiguous();
+
+    BitVector<3> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::isNan(data);
+
+    CORRADE_COMPARE(out, BitVector<3>{0});
+}
+
+void FunctionsBenchmark::isNanStrided() {
+    Containers::Array<Vertex> data = batchData();
+
+    BitVector<3> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::isNan(stridedArrayView(data).slice(&Vertex::position));
+
+    CORRADE_COMPARE(out, BitVector<3>{0});
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsBenchmark)
@@ -0,0 +1,274 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct PackingBatchBenchmark: TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    template<class T> void unpackScalar();
+    template<class T> void unpack();
+    template<class T> void unpackStrided();
+    template<class T> void packScalar();
+    template<class T> void pack();
+    template<class T> void packStrided();
+
+    void unpackHalfScalar();
+    void unpackHalf();
+    void unpackHalfStrided();
+    void packHalfScalar();
+    void packHalf();
+    void packHalfStrided();
+};
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addBenchmarks({
+        &PackingBatchBenchmark::unpackScalar<UnsignedByte>,
+        &PackingBatchBenchmark::unpack<UnsignedByte>,
+        &PackingBatchBenchmark::unpackStrided<UnsignedByte>,
+        &PackingBatchBenchmark::unpackScalar<Short>,
+        &PackingBatchBenchmark::unpack<Short>,
+        &PackingBatchBenchmark::unpackStrided<Short>,
+        &PackingBatchBenchmark::packScalar<UnsignedByte>,
+        &PackingBatchBenchmark::pack<UnsignedByte>,
+        &PackingBatchBenchmark::packStrided<UnsignedByte>,
+        &PackingBatchBenchmark::packScalar<Short>,
+        &PackingBatchBenchmark::pack<Short>,
+        &PackingBatchBenchmark::packStrided<Short>,
+
+        &PackingBatchBenchmark::unpackHalfScalar,
+        &PackingBatchBenchmark::unpackHalf,
+        &PackingBatchBenchmark::unpackHalfStrided,
+        &PackingBatchBenchmark::packHalfScalar,
+        &PackingBatchBenchmark::packHalf,
+        &PackingBatchBenchmark::packHalfStrided}, 10);
+}
+
+using Magnum::Vector3;
+
+enum: std::size_t { Count = 65536 };
+
+/* Vertex data are usually interleaved with other attributes, which means the
+   views aren't contiguous and have to be processed one vector at a time. This
+   struct is used for the *Strided() variants to simulate that. */
+template<class T> struct Interleaved {
+    Math::Vector3<T> value;
+    Int padding;
+};
+
+template<class T> Containers::Array<Math::Vector3<T>> integerData() {
+    Containers::Array<Math::Vector3<T>> out{NoInit, Count};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::Vector3<T>{T(i), T(i*3), T(i*7)};
+    return out;
+}
+
+template<class T> Containers::Array<Vector3> floatData() {
+    Containers::Array<Vector3> out{NoInit, Count};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::unpack<Vector3>(Math::Vector3<T>{T(i), T(i*3), T(i*7)});
+    return out;
+}
+
+template<class T> void PackingBatchBenchmark::unpackScalar() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<T>> src = integerData<T>();
+    Containers::Array<Vector3> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            dst[i] = Math::unpack<Vector3>(src[i]);
+
+    CORRADE_COMPARE(dst[37], Math::unpack<Vector3>(src[37]));
+}
+
+template<class T> void PackingBatchBenchmark::unpack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<T>> src = integerData<T>();
+    Containers::Array<Vector3> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        unpackInto(
+            Containers::stridedArrayView(src).slice(&Math::Vector3<T>::data),
+            Containers::stridedArrayView(dst).slice(&Vector3::data));
+
+    CORRADE_COMPARE(dst[37], Math::unpack<Vector3>(src[37]));
+}
+
+template<class T> void PackingBatchBenchmark::unpackStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<T>> data = integerData<T>();
+    Containers::Array<Interleaved<T>> src{NoInit, Count};
+    Containers::Array<Interleaved<Float>> dst{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i].value = data[i];
+
+    CORRADE_BENCHMARK(1)
+        unpackInto(
+            Containers::stridedArrayView(src).slice(&Interleaved<T>::value).slice(&Math::Vector3<T>::data),
+            Containers::stridedArrayView(dst).slice(&Interleaved<Float>::value).slice(&Vector3::data));
+
+    CORRADE_COMPARE(dst[37].value, Math::unpack<Vector3>(src[37].value));
+}
+
+template<class T> void PackingBatchBenchmark::packScalar() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Vector3> src = floatData<T>();
+    Containers::Array<Math::Vector3<T>> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            dst[i] = Math::pack<Math::Vector3<T>>(src[i]);
+
+    CORRADE_COMPARE(dst[37], Math::pack<Math::Vector3<T>>(src[37]));
+}
+
+template<class T> void PackingBatchBenchmark::pack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Vector3> src = floatData<T>();
+    Containers::Array<Math::Vector3<T>> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        packInto(
+            Containers::stridedArrayView(src).slice(&Vector3::data),
+            Containers::stridedArrayView(dst).slice(&Math::Vector3<T>::data));
+
+    CORRADE_COMPARE(dst[37], Math::pack<Math::Vector3<T>>(src[37]));
+}
+
+template<class T> void PackingBatchBenchmark::packStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Vector3> data = floatData<T>();
+    Containers::Array<Interleaved<Float>> src{NoInit, Count};
+    Containers::Array<Interleaved<T>> dst{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i].value = data[i];
+
+    CORRADE_BENCHMARK(1)
+        packInto(
+            Containers::stridedArrayView(src).slice(&Interleaved<Float>::value).slice(&Vector3::data),
+            Containers::stridedArrayView(dst).slice(&Interleaved<T>::value).slice(&Math::Vector3<T>::data));
+
+    CORRADE_COMPARE(dst[37].value, Math::pack<Math::Vector3<T>>(src[37].value));
+}
+
+void PackingBatchBenchmark::unpackHalfScalar() {
+    Containers::Array<Vector3us> src = integerData<UnsignedShort>();
+    Containers::Array<Vector3> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            dst[i] = Vector3{Math::unpackHalf(src[i])};
+
+    CORRADE_COMPARE(dst[37], Vector3{Math::unpackHalf(src[37])});
+}
+
+void PackingBatchBenchmark::unpackHalf() {
+    Containers::Array<Vector3us> src = integerData<UnsignedShort>();
+    Containers::Array<Vector3> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        unpackHalfInto(
+            Containers::stridedArrayView(src).slice(&Vector3us::data),
+            Containers::stridedArrayView(dst).slice(&Vector3::data));
+
+    CORRADE_COMPARE(dst[37], Vector3{Math::unpackHalf(src[37])});
+}
+
+void PackingBatchBenchmark::unpackHalfStrided() {
+    Containers::Array<Vector3us> data = integerData<UnsignedShort>();
+    Containers::Array<Interleaved<UnsignedShort>> src{NoInit, Count};
+    Containers::Array<Interleaved<Float>> dst{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i].value = data[i];
+
+    CORRADE_BENCHMARK(1)
+        unpackHalfInto(
+            Containers::stridedArrayView(src).slice(&Interleaved<UnsignedShort>::value).slice(&Vector3us::data),
+            Containers::stridedArrayView(dst).slice(&Interleaved<Float>::value).slice(&Vector3::data));
+
+    CORRADE_COMPARE(dst[37].value, Vector3{Math::unpackHalf(src[37].value)});
+}
+
+void PackingBatchBenchmark::packHalfScalar() {
+    Containers::Array<Vector3> src = floatData<UnsignedShort>();
+    Containers::Array<Vector3us> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            dst[i] = Vector3us{Math::packHalf(src[i])};
+
+    CORRADE_COMPARE(dst[37], Vector3us{Math::packHalf(src[37])});
+}
+
+void PackingBatchBenchmark::packHalf() {
+    Containers::Array<Vector3> src = floatData<UnsignedShort>();
+    Containers::Array<Vector3us> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1)
+        packHalfInto(
+            Containers::stridedArrayView(src).slice(&Vector3::data),
+            Containers::stridedArrayView(dst).slice(&Vector3us::data));
+
+    /* The batch variant truncates while packHalf() rounds, so compare just
+       with a value that's exactly representable */
+    CORRADE_COMPARE(dst[0], Vector3us{Math::packHalf(src[0])});
+}
+
+void PackingBatchBenchmark::packHalfStrided() {
+    Containers::Array<Vector3> data = floatData<UnsignedShort>();
+    Containers::Array<Interleaved<Float>> src{NoInit, Count};
+    Containers::Array<Interleaved<UnsignedShort>> dst{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i].value = data[i];
+
+    CORRADE_BENCHMARK(1)
+        packHalfInto(
+            Containers::stridedArrayView(src).slice(&Interleaved<Float>::value).slice(&Vector3::data),
+            Containers::stridedArrayView(dst).slice(&Interleaved<UnsignedShort>::value).slice(&Vector3us::data));
+
+    /* The batch variant truncates while packHalf() rounds, so compare just
+       with a value that's exactly representable */
+    CORRADE_COMPARE(dst[0].value, Vector3us{Math::packHalf(src[0].value)});
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
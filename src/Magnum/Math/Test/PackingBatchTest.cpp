@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <type_traits>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -47,9 +49,14 @@ struct PackingBatchTest: TestSuite::Tester {
     void packUnsignedShort();
     void packSignedByte();
     void packSignedShort();
+    template<class T> void packUnpackContiguous();
 
     void unpackHalf();
     void packHalf();
+    void unpackPackHalfContiguous();
+
+    template<class T> void packOctahedral();
+    template<class T> void unpackOctahedral();
 
     template<class FloatingPoint, class Integral> void castUnsignedFloatingPoint();
     template<class FloatingPoint, class Integral> void castSignedFloatingPoint();
@@ -60,6 +67,7 @@ struct PackingBatchTest: TestSuite::Tester {
 
     template<class T> void assertionsPackUnpack();
     void assertionsPackUnpackHalf();
+    void assertionsPackUnpackOctahedral();
     template<class U, class T> void assertionsCast();
 };
 
@@ -72,9 +80,21 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::packUnsignedShort,
               &PackingBatchTest::packSignedByte,
               &PackingBatchTest::packSignedShort,
+              &PackingBatchTest::packUnpackContiguous<UnsignedByte>,
+              &PackingBatchTest::packUnpackContiguous<Byte>,
+              &PackingBatchTest::packUnpackContiguous<UnsignedShort>,
+              &PackingBatchTest::packUnpackContiguous<Short>,
 
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
+              &PackingBatchTest::unpackPackHalfContiguous,
+
+              &PackingBatchTest::packOctahedral<Byte>,
+              &PackingBatchTest::packOctahedral<Short>,
+              &PackingBatchTest::packOctahedral<Float>,
+              &PackingBatchTest::unpackOctahedral<Byte>,
+              &PackingBatchTest::unpackOctahedral<Short>,
+              &PackingBatchTest::unpackOctahedral<Float>,
 
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedByte>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedShort>,
@@ -118,6 +138,7 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::assertionsPackUnpack<UnsignedShort>,
               &PackingBatchTest::assertionsPackUnpack<Short>,
               &PackingBatchTest::assertionsPackUnpackHalf,
+              &PackingBatchTest::assertionsPackUnpackOctahedral,
               &PackingBatchTest::assertionsCast<Float, UnsignedByte>,
               &PackingBatchTest::assertionsCast<Float, Byte>,
               &PackingBatchTest::assertionsCast<Float, UnsignedShort>,
@@ -416,6 +437,38 @@ void PackingBatchTest::packSignedShort() {
         CORRADE_COMPARE(Math::pack<Vector2s>(data[i].src), data[i].dst);
 }
 
+template<class T> void PackingBatchTest::packUnpackContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Both views are contiguous, so they get processed as a single row. The
+       values are picked to be around the rounding boundary, with an odd
+       count to not be a multiple of any SIMD width. Values not representable
+       in unsigned types get clamped to zero. */
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    constexpr Float min = std::is_signed<T>::value ? -1.0f : 0.0f;
+    Vector3 data[37];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        const Float value = Math::max(min, (Float(i) - 18.0f + 0.5f)/bitMax);
+        data[i] = {value, Math::max(min, value - 0.5f/bitMax), Math::clamp(value*255.0f, min, 1.0f)};
+    }
+
+    Math::Vector3<T> packed[Containers::arraySize(data)];
+    Vector3 unpacked[Containers::arraySize(data)];
+    packInto(
+        Containers::stridedArrayView(data).slice(&Vector3::data),
+        Containers::stridedArrayView(packed).slice(&Math::Vector3<T>::data));
+    unpackInto(
+        Containers::stridedArrayView(packed).slice(&Math::Vector3<T>::data),
+        Containers::stridedArrayView(unpacked).slice(&Vector3::data));
+
+    /* The results should be consistent with non-batch APIs */
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(packed[i], Math::pack<Math::Vector3<T>>(data[i]));
+        CORRADE_COMPARE(unpacked[i], Math::unpack<Vector3>(packed[i]));
+    }
+}
+
 void PackingBatchTest::unpackHalf() {
     /* Test data adapted from HalfTest */
     struct Data {
@@ -484,6 +537,117 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+void PackingBatchTest::unpackPackHalfContiguous() {
+    /* Take all half values except NaNs, which is a count that's not a
+       multiple of any SIMD width. Both views are contiguous, so they get
+       processed as a single row. */
+    Containers::Array<UnsignedShort> data{NoInit, 0x7c01 + 0x7c01};
+    for(UnsignedInt i = 0; i != 0x7c01; ++i) {
+        data[2*i + 0] = UnsignedShort(i);
+        data[2*i + 1] = UnsignedShort(i|0x8000);
+    }
+
+    Containers::Array<Float> unpacked{NoInit, data.size()};
+    Containers::Array<UnsignedShort> packed{NoInit, data.size()};
+    unpackHalfInto(Containers::stridedArrayView(data),
+        Containers::stridedArrayView(unpacked));
+    packHalfInto(Containers::stridedArrayView(unpacked),
+        Containers::stridedArrayView(packed));
+
+    /* The results should be consistent with the non-batch API */
+    Containers::Array<Float> expected{NoInit, data.size()};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        expected[i] = Math::unpackHalf(data[i]);
+    CORRADE_COMPARE_AS(unpacked, expected,
+        TestSuite::Compare::Container);
+
+    /* Every value should survive a round trip */
+    CORRADE_COMPARE_AS(packed, data,
+        TestSuite::Compare::Container);
+}
+
+/* Scalar equivalents of the batch octahedral APIs, for consistency checks */
+template<class T> Math::Vector2<T> packOctahedralScalar(const Vector3& value) {
+    return Math::pack<Math::Vector2<T>>(Math::packOctahedral(value));
+}
+template<> Vector2 packOctahedralScalar<Float>(const Vector3& value) {
+    return Math::packOctahedral(value);
+}
+template<class T> Vector3 unpackOctahedralScalar(const Math::Vector2<T>& value) {
+    return Math::unpackOctahedral(Math::unpack<Vector2>(value));
+}
+template<> Vector3 unpackOctahedralScalar<Float>(const Vector2& value) {
+    return Math::unpackOctahedral(value);
+}
+
+template<class T> void PackingBatchTest::packOctahedral() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        Vector3 src;
+        Math::Vector2<T> dst;
+    } data[]{
+        {{0.0f, 0.0f, 1.0f}, {}},
+        {{1.0f, 2.0f, 3.0f}, {}},
+        {{-4.0f, 1.0f, 0.0f}, {}},
+        {{1.0f, 2.0f, -3.0f}, {}},
+        {{-0.5f, 0.25f, -1.0f}, {}},
+        {{0.0f, 0.0f, -15.0f}, {}}
+    };
+
+    packOctahedralInto(
+        Containers::stridedArrayView(data).slice(&Data::src)
+            .slice(&Vector3::data),
+        Containers::stridedArrayView(data).slice(&Data::dst)
+            .slice(&Math::Vector2<T>::data));
+
+    /* The results should be consistent with the non-batch APIs */
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, packOctahedralScalar<T>(data[i].src));
+    }
+}
+
+template<class T> void PackingBatchTest::unpackOctahedral() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Vector3 directions[]{
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 2.0f, 3.0f},
+        {-4.0f, 1.0f, 0.0f},
+        {1.0f, 2.0f, -3.0f},
+        {-0.5f, 0.25f, -1.0f},
+        {0.0f, 0.0f, -1.0f}
+    };
+
+    struct Data {
+        Math::Vector2<T> src;
+        Vector3 dst;
+    } data[Containers::arraySize(directions)];
+    for(std::size_t i = 0; i != Containers::arraySize(directions); ++i)
+        data[i].src = packOctahedralScalar<T>(directions[i]);
+
+    unpackOctahedralInto(
+        Containers::stridedArrayView(data).slice(&Data::src)
+            .slice(&Math::Vector2<T>::data),
+        Containers::stridedArrayView(data).slice(&Data::dst)
+            .slice(&Vector3::data));
+
+    /* The results should be consistent with the non-batch APIs and always
+       normalized */
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, unpackOctahedralScalar<T>(data[i].src));
+        CORRADE_VERIFY(data[i].dst.isNormalized());
+    }
+
+    /* For floats the roundtrip should be lossless */
+    if(std::is_same<T, Float>::value) for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, directions[i].normalized());
+    }
+}
+
 template<class FloatingPoint, class Integral> void PackingBatchTest::castUnsignedFloatingPoint() {
     setTestCaseTemplateName({TypeTraits<FloatingPoint>::name(), TypeTraits<Integral>::name()});
 
@@ -811,6 +975,54 @@ void PackingBatchTest::assertionsPackUnpackHalf() {
         "Math::packHalfInto(): second destination view dimension is not contiguous\n");
 }
 
+void PackingBatchTest::assertionsPackUnpackOctahedral() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector3 data[2]{};
+    Math::Vector<6, Float> dataNonContiguous[2]{};
+    Vector2s result[2]{};
+    Vector2s resultWrongCount[1]{};
+    Vector3s resultWrongVectorSize[2]{};
+    Vector4s resultNonContiguous[2]{};
+
+    auto src = Containers::stridedArrayView(data)
+        .slice(&Vector3::data);
+    auto srcNonContiguous = Containers::StridedArrayView2D<Float>{
+            Containers::stridedArrayView(dataNonContiguous)
+                .slice(&Math::Vector<6, Float>::data)
+        }.every({1, 2});
+    auto dst = Containers::stridedArrayView(result)
+        .slice(&Vector2s::data);
+    auto dstWrongCount = Containers::stridedArrayView(resultWrongCount)
+        .slice(&Vector2s::data);
+    auto dstWrongVectorSize = Containers::stridedArrayView(resultWrongVectorSize)
+        .slice(&Vector3s::data);
+    auto dstNotContiguous = Containers::StridedArrayView2D<Short>{
+            Containers::stridedArrayView(resultNonContiguous)
+                .slice(&Vector4s::data)
+        }.every({1, 2});
+
+    Containers::String out;
+    Error redirectError{&out};
+    packOctahedralInto(src, dstWrongCount);
+    packOctahedralInto(src, dstWrongVectorSize);
+    packOctahedralInto(src, dstNotContiguous);
+    packOctahedralInto(srcNonContiguous, dst);
+    unpackOctahedralInto(dstWrongCount, src);
+    unpackOctahedralInto(dstWrongVectorSize, src);
+    unpackOctahedralInto(dstNotContiguous, src);
+    unpackOctahedralInto(dst, srcNonContiguous);
+    CORRADE_COMPARE(out,
+        "Math::packOctahedralInto(): expected a source view with 3 and a destination view with 2 components of the same size, got {2, 3} and {1, 2}\n"
+        "Math::packOctahedralInto(): expected a source view with 3 and a destination view with 2 components of the same size, got {2, 3} and {2, 3}\n"
+        "Math::packOctahedralInto(): second destination view dimension is not contiguous\n"
+        "Math::packOctahedralInto(): second source view dimension is not contiguous\n"
+        "Math::unpackOctahedralInto(): expected a source view with 2 and a destination view with 3 components of the same size, got {1, 2} and {2, 3}\n"
+        "Math::unpackOctahedralInto(): expected a source view with 2 and a destination view with 3 components of the same size, got {2, 3} and {2, 3}\n"
+        "Math::unpackOctahedralInto(): second source view dimension is not contiguous\n"
+        "Math::unpackOctahedralInto(): second destination view dimension is not contiguous\n");
+}
+
 template<class U, class T> void PackingBatchTest::assertionsCast() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -24,10 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cmath>
 #include <limits>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector2.h"
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
@@ -48,6 +51,10 @@ struct PackingTest: TestSuite::Tester {
     void pack8bitRoundtrip();
     void pack16bitRoundtrip();
 
+    void packOctahedral();
+    void unpackOctahedral();
+    void octahedralRoundtrip();
+
     /* Half (un)pack functions are tested and benchmarked in HalfTest.cpp,
        because there's involved comparison and benchmarks to ground truth */
 };
@@ -55,6 +62,7 @@ struct PackingTest: TestSuite::Tester {
 using namespace Literals;
 
 using Magnum::Rad;
+using Magnum::Vector2;
 using Magnum::Vector3;
 
 PackingTest::PackingTest() {
@@ -70,6 +78,11 @@ PackingTest::PackingTest() {
 
     addRepeatedTests({&PackingTest::pack8bitRoundtrip}, 256);
     addRepeatedTests({&PackingTest::pack16bitRoundtrip}, 65536);
+
+    addTests({&PackingTest::packOctahedral,
+              &PackingTest::unpackOctahedral});
+
+    addRepeatedTests({&PackingTest::octahedralRoundtrip}, 64);
 }
 
 void PackingTest::bitMax() {
@@ -308,6 +321,59 @@ void PackingTest::pack16bitRoundtrip() {
     CORRADE_COMPARE(Math::pack<UnsignedShort>(Math::unpack<Float, UnsignedShort>(testCaseRepeatId())), testCaseRepeatId());
 }
 
+void PackingTest::packOctahedral() {
+    /* Upper hemisphere is just a projection onto the octahedron */
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{0.0f, 0.0f, 1.0f})},
+        (Vector2{0.0f, 0.0f}));
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{1.0f, 2.0f, 3.0f})},
+        (Vector2{0.166667f, 0.333333f}));
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{-4.0f, 1.0f, 0.0f})},
+        (Vector2{-0.8f, 0.2f}));
+
+    /* Lower hemisphere gets folded into the corners */
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{1.0f, 2.0f, -3.0f})},
+        (Vector2{0.666667f, 0.833333f}));
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{-0.5f, 0.25f, -1.0f})},
+        (Vector2{-0.857143f, 0.714286f}));
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{0.0f, 0.0f, -1.0f})},
+        (Vector2{1.0f, 1.0f}));
+
+    /* The input doesn't need to be normalized */
+    CORRADE_COMPARE(Vector2{Math::packOctahedral(Vector3{0.0f, 0.0f, -15.0f})},
+        (Vector2{1.0f, 1.0f}));
+}
+
+void PackingTest::unpackOctahedral() {
+    CORRADE_COMPARE(Vector3{Math::unpackOctahedral(Vector2{0.0f, 0.0f})},
+        (Vector3{0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(Vector3{Math::unpackOctahedral(Vector2{0.166667f, 0.333333f})},
+        (Vector3{0.267261f, 0.534523f, 0.801784f}));
+    CORRADE_COMPARE(Vector3{Math::unpackOctahedral(Vector2{0.666667f, 0.833333f})},
+        (Vector3{0.267261f, 0.534523f, -0.801784f}));
+    CORRADE_COMPARE(Vector3{Math::unpackOctahedral(Vector2{1.0f, 1.0f})},
+        (Vector3{0.0f, 0.0f, -1.0f}));
+    CORRADE_COMPARE(Vector3{Math::unpackOctahedral(Vector2{-1.0f, -1.0f})},
+        (Vector3{0.0f, 0.0f, -1.0f}));
+
+    /* Output is always normalized */
+    CORRADE_VERIFY(Math::unpackOctahedral(Vector2{0.3f, -0.1f}).isNormalized());
+}
+
+void PackingTest::octahedralRoundtrip() {
+    /* Go through a spiral over the whole sphere, covering all octants */
+    const Float z = 1.0f - 2.0f*(testCaseRepeatId() + 0.5f)/64.0f;
+    const Float angle = 2.39996f*testCaseRepeatId();
+    const Float radius = std::sqrt(1.0f - z*z);
+    const Vector3 direction{radius*std::cos(angle), radius*std::sin(angle), z};
+
+    CORRADE_COMPARE(Vector3{Math::unpackOctahedral(Math::packOctahedral(direction))}, direction);
+
+    /* With 16-bit packing the angular error stays well under 0.1° */
+    const Vector3 unpacked16 = Math::unpackOctahedral(Math::unpack<Vector2>(Math::pack<Vector2s>(Math::packOctahedral(direction))));
+    CORRADE_COMPARE_AS(Math::dot(unpacked16, direction), 0.9999999f,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
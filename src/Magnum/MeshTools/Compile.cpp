@@ -165,6 +165,12 @@ GL::Mesh compileInternal(const Trade::MeshData& meshData, GL::Buffer&& indices,
                 addAttribute(GL::DynamicAttribute{Shaders::GenericGL3D::Bitangent{}, format}, 0);
                 continue;
             case Trade::MeshAttribute::Normal:
+                /* Octahedral-encoded normals would need decoding in the
+                   shader, which the builtin shaders don't do */
+                if(vertexFormatComponentCount(format) == 2) {
+                    Warning{} << "MeshTools::compile(): ignoring octahedral-encoded normals in" << format;
+                    continue;
+                }
                 addAttribute(GL::DynamicAttribute{Shaders::GenericGL3D::Normal{}, format}, 0);
                 continue;
             #ifndef MAGNUM_TARGET_GLES2
@@ -26,6 +26,7 @@
 
 #include "CompressIndices.h"
 
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Utility/Algorithms.h>
@@ -55,36 +56,79 @@ template<class T, class U> inline Containers::Array<char> compress(const Contain
     return buffer;
 }
 
-template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset) {
-    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(atLeast),
-        "MeshTools::compressIndices(): can't compress to an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(atLeast),
-        (Containers::Pair<Containers::Array<char>, MeshIndexType>{nullptr, MeshIndexType::UnsignedInt}));
-
-    const UnsignedInt max = Math::max(indices) - offset;
-    Containers::Array<char> out;
-    MeshIndexType type;
+/* Picks the smallest type that can represent given maximum, but at least
+   the atLeast type */
+MeshIndexType compressedIndexType(const UnsignedInt max, const MeshIndexType atLeast) {
     const UnsignedInt log = Math::log(256, max);
 
     /* If it fits into 8 bytes and 8 bytes are allowed, pack into 8 */
-    if(log == 0 && atLeast == MeshIndexType::UnsignedByte) {
-        out = compress<UnsignedByte>(indices, offset);
-        type = MeshIndexType::UnsignedByte;
+    if(log == 0 && atLeast == MeshIndexType::UnsignedByte)
+        return MeshIndexType::UnsignedByte;
 
     /* Otherwise, if it fits into either 8 or 16 bytes and we allow either 8 or
        16, pack into 16 */
-    } else if(log <= 1 && atLeast != MeshIndexType::UnsignedInt) {
-        out = compress<UnsignedShort>(indices, offset);
-        type = MeshIndexType::UnsignedShort;
+    if(log <= 1 && atLeast != MeshIndexType::UnsignedInt)
+        return MeshIndexType::UnsignedShort;
 
     /* Otherwise pack into 32 */
-    } else {
+    return MeshIndexType::UnsignedInt;
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset, const UnsignedInt max) {
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(atLeast),
+        "MeshTools::compressIndices(): can't compress to an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(atLeast),
+        (Containers::Pair<Containers::Array<char>, MeshIndexType>{nullptr, MeshIndexType::UnsignedInt}));
+
+    const MeshIndexType type = compressedIndexType(max - offset, atLeast);
+    Containers::Array<char> out;
+    if(type == MeshIndexType::UnsignedByte)
+        out = compress<UnsignedByte>(indices, offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        out = compress<UnsignedShort>(indices, offset);
+    else
         out = compress<UnsignedInt>(indices, offset);
-        type = MeshIndexType::UnsignedInt;
-    }
 
     return {Utility::move(out), type};
 }
 
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset) {
+    return compressIndicesImplementation(indices, atLeast, offset, Math::max(indices));
+}
+
+/* Writes the compressed indices to the same memory the original indices are
+   in, with dst being at the same position as src or before it. The output
+   type is never larger than the input, so each output value overwrites only
+   input values that were already read. Going through memcpy() as the two
+   types alias each other. */
+template<class T, class U> void compressInPlace(const char* const src, char* const dst, const std::size_t count, const Long offset) {
+    for(std::size_t i = 0; i != count; ++i) {
+        U index;
+        std::memcpy(&index, src + i*sizeof(U), sizeof(U));
+        const T compressed = index - offset;
+        std::memcpy(dst + i*sizeof(T), &compressed, sizeof(T));
+    }
+}
+
+template<class T> MeshIndexType compressIndicesInPlaceImplementation(const char* const src, char* const dst, const std::size_t count, MeshIndexType atLeast, const Long offset, const UnsignedInt max) {
+    /* Inflating to a larger type isn't possible in place, keep the original
+       type in that case */
+    if(meshIndexTypeSize(atLeast) > sizeof(T))
+        atLeast = Trade::Implementation::meshIndexTypeFor<T>();
+
+    const MeshIndexType type = compressedIndexType(max - offset, atLeast);
+    CORRADE_ASSERT(meshIndexTypeSize(type) <= sizeof(T),
+        "MeshTools::compressIndicesInPlace(): indices offset by" << offset << "need" << type << "which doesn't fit in place", {});
+
+    if(type == MeshIndexType::UnsignedByte)
+        compressInPlace<UnsignedByte, T>(src, dst, count, offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        compressInPlace<UnsignedShort, T>(src, dst, count, offset);
+    else
+        compressInPlace<UnsignedInt, T>(src, dst, count, offset);
+
+    return type;
+}
+
 }
 
 Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const MeshIndexType atLeast, const Long offset) {
@@ -127,6 +171,23 @@ Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const C
     return compressIndices(indices, MeshIndexType::UnsignedShort, offset);
 }
 
+MeshIndexType compressIndicesInPlace(const Containers::StridedArrayView2D<char>& indices, const MeshIndexType atLeast, const Long offset) {
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(atLeast),
+        "MeshTools::compressIndicesInPlace(): can't compress to an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(atLeast), {});
+    CORRADE_ASSERT(indices.isContiguous(), "MeshTools::compressIndicesInPlace(): the view is not contiguous", {});
+    const Containers::StridedArrayView2D<const char> constIndices = indices;
+    char* const data = static_cast<char*>(indices.data());
+    const std::size_t count = indices.size()[0];
+    if(indices.size()[1] == 4)
+        return compressIndicesInPlaceImplementation<UnsignedInt>(data, data, count, atLeast, offset, Math::max(Containers::arrayCast<1, const UnsignedInt>(constIndices)));
+    else if(indices.size()[1] == 2)
+        return compressIndicesInPlaceImplementation<UnsignedShort>(data, data, count, atLeast, offset, Math::max(Containers::arrayCast<1, const UnsignedShort>(constIndices)));
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::compressIndicesInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return compressIndicesInPlaceImplementation<UnsignedByte>(data, data, count, atLeast, offset, Math::max(Containers::arrayCast<1, const UnsignedByte>(constIndices)));
+    }
+}
+
 Trade::MeshData compressIndices(Trade::MeshData&& mesh, MeshIndexType atLeast) {
     CORRADE_ASSERT(mesh.isIndexed(), "MeshTools::compressIndices(): mesh data not indexed", (Trade::MeshData{MeshPrimitive::Triangles, 0}));
 
@@ -142,26 +203,70 @@ Trade::MeshData compressIndices(Trade::MeshData&& mesh, MeshIndexType atLeast) {
         Utility::copy(mesh.vertexData(), vertexData);
     }
 
-    /* Compress the indices */
-    UnsignedInt offset;
-    Containers::Pair<Containers::Array<char>, MeshIndexType> result;
-    if(mesh.indexType() == MeshIndexType::UnsignedInt) {
-        auto indices = mesh.indices<UnsignedInt>();
-        offset = Math::min(indices);
-        result = compressIndicesImplementation<UnsignedInt>(indices, atLeast, offset);
-    } else if(mesh.indexType() == MeshIndexType::UnsignedShort) {
-        auto indices = mesh.indices<UnsignedShort>();
-        offset = Math::min(indices);
-        result = compressIndicesImplementation<UnsignedShort>(indices, atLeast, offset);
+    /* Calculate the index range in a single pass */
+    Containers::Pair<UnsignedInt, UnsignedInt> minmax;
+    if(mesh.indexType() == MeshIndexType::UnsignedInt)
+        minmax = Math::minmax(mesh.indices<UnsignedInt>());
+    else if(mesh.indexType() == MeshIndexType::UnsignedShort) {
+        const Containers::Pair<UnsignedShort, UnsignedShort> minmaxShort = Math::minmax(mesh.indices<UnsignedShort>());
+        minmax = {minmaxShort.first(), minmaxShort.second()};
     } else {
         CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
             "MeshTools::compressIndices(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
             (Trade::MeshData{MeshPrimitive{}, 0}));
         CORRADE_INTERNAL_ASSERT(mesh.indexType() == MeshIndexType::UnsignedByte);
-        auto indices = mesh.indices<UnsignedByte>();
-        offset = Math::min(indices);
-        result = compressIndicesImplementation<UnsignedByte>(indices, atLeast, offset);
+        const Containers::Pair<UnsignedByte, UnsignedByte> minmaxByte = Math::minmax(mesh.indices<UnsignedByte>());
+        minmax = {minmaxByte.first(), minmaxByte.second()};
     }
+    const UnsignedInt offset = minmax.first();
+
+    /* If the index data are owned and tightly packed and the mesh isn't
+       meant to be inflated to a larger type, compress them in place.
+       Subtracting the minimum makes the values only smaller, so the
+       compressed type always fits. */
+    const UnsignedInt indexTypeSize = meshIndexTypeSize(mesh.indexType());
+    const UnsignedInt indexCount = mesh.indexCount();
+    Containers::Pair<Containers::Array<char>, MeshIndexType> result;
+    if((mesh.indexDataFlags() & (Trade::DataFlag::Owned|Trade::DataFlag::Mutable)) == (Trade::DataFlag::Owned|Trade::DataFlag::Mutable) &&
+       mesh.indexStride() == Short(indexTypeSize) &&
+       !isMeshIndexTypeImplementationSpecific(atLeast) &&
+       meshIndexTypeSize(atLeast) <= indexTypeSize)
+    {
+        /* If there's anything before the indices, they get moved to the
+           front of the array in the process */
+        const std::size_t indexOffset = mesh.indexOffset();
+        Containers::Array<char> indexData = mesh.releaseIndexData();
+        const char* const src = indexData.data() + indexOffset;
+        MeshIndexType type;
+        if(indexTypeSize == 4)
+            type = compressIndicesInPlaceImplementation<UnsignedInt>(src, indexData.data(), indexCount, atLeast, offset, minmax.second());
+        else if(indexTypeSize == 2)
+            type = compressIndicesInPlaceImplementation<UnsignedShort>(src, indexData.data(), indexCount, atLeast, offset, minmax.second());
+        else
+            type = compressIndicesInPlaceImplementation<UnsignedByte>(src, indexData.data(), indexCount, atLeast, offset, minmax.second());
+
+        /* If the indices got narrower or there was anything else in the
+           array, copy them to an array of the exact size. Otherwise the
+           output would keep the whole original allocation, with the unused
+           suffix being leftovers of the original data that would get saved
+           by anything that writes out indexData() whole. The copy is only of
+           the already narrowed data, so it's still cheaper than compressing
+           to a new array. */
+        const std::size_t compressedSize = indexCount*meshIndexTypeSize(type);
+        if(compressedSize != indexData.size()) {
+            Containers::Array<char> trimmedIndexData{NoInit, compressedSize};
+            Utility::copy(indexData.prefix(compressedSize), trimmedIndexData);
+            indexData = Utility::move(trimmedIndexData);
+        }
+        result = {Utility::move(indexData), type};
+
+    /* Otherwise compress to a new array */
+    } else if(mesh.indexType() == MeshIndexType::UnsignedInt)
+        result = compressIndicesImplementation<UnsignedInt>(mesh.indices<UnsignedInt>(), atLeast, offset, minmax.second());
+    else if(mesh.indexType() == MeshIndexType::UnsignedShort)
+        result = compressIndicesImplementation<UnsignedShort>(mesh.indices<UnsignedShort>(), atLeast, offset, minmax.second());
+    else
+        result = compressIndicesImplementation<UnsignedByte>(mesh.indices<UnsignedByte>(), atLeast, offset, minmax.second());
 
     /* Recreate the attribute array with each attribute being shifted by the
        offset calculated above */
@@ -182,6 +287,14 @@ Trade::MeshData compressIndices(const Trade::MeshData& mesh, MeshIndexType atLea
     return compressIndices(reference(mesh), atLeast);
 }
 
+void compressIndicesInPlace(const Containers::ArrayView<Trade::MeshData> meshes, const MeshIndexType atLeast, const Executor& executor) {
+    /* Each task touches just its own mesh, so they're independent */
+    executor(meshes.size(), [&](const std::size_t i) {
+        if(meshes[i].isIndexed())
+            meshes[i] = compressIndices(Utility::move(meshes[i]), atLeast);
+    });
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 std::tuple<Containers::Array<char>, MeshIndexType, UnsignedInt, UnsignedInt> compressIndices(const std::vector<UnsignedInt>& indices) {
     const auto minmax = Math::minmax(indices);
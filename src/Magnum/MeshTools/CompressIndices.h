@@ -27,11 +27,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compressIndices()
+ * @brief Function @ref Magnum::MeshTools::compressIndices(), @ref Magnum::MeshTools::compressIndicesInPlace()
  */
 
 #include <Corrade/Containers/Containers.h>
 
+#include "Magnum/Executor.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
@@ -146,6 +147,31 @@ with @p atLeast set to @ref MeshIndexType::UnsignedShort.
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView2D<const char>& indices, Long offset);
 
+/**
+@brief Compress a type-erased index array in place
+@param indices  Index array
+@param atLeast  Smallest allowed type
+@param offset   Offset to subtract from each index
+@return Compressed index type
+@m_since_latest
+
+Like @ref compressIndices(const Containers::StridedArrayView2D<const char>&, MeshIndexType, Long),
+but instead of allocating a new array writes the compressed indices to the
+beginning of the memory referenced by @p indices, as the compressed type is
+never larger than the original. The first @cpp indices.size()[0] @ce items of
+the returned type then contain the result, contents of the remaining memory
+are unspecified. If @p atLeast is larger than the original type, the original
+type is kept, as the indices can't be inflated in place.
+
+Expects that @p indices are contiguous and the second dimension represents
+the actual 1/2/4-byte index type. The @p atLeast parameter is expected to not
+be an implementation-specific type and @p offset, if negative, is expected to
+not make the indices exceed the range of the original type.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref meshIndexTypeSize()
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshIndexType compressIndicesInPlace(const Containers::StridedArrayView2D<char>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort, Long offset = 0);
+
 /**
 @brief Compress mesh data indices
 @m_since{2020,06}
@@ -171,12 +197,43 @@ MAGNUM_MESHTOOLS_EXPORT Trade::MeshData compressIndices(const Trade::MeshData& m
 
 Compared to @ref compressIndices(const Trade::MeshData&, MeshIndexType) this
 function can transfer ownership of @p data vertex buffer (in case it is
-owned) to the returned instance instead of making a copy of it. Index and
-attribute data are copied always.
-@see @ref Trade::MeshData::vertexDataFlags()
+owned) to the returned instance instead of making a copy of it. If the index
+data are owned and mutable, the index stride matches the index type size and
+@p atLeast isn't larger than the original index type, the indices are
+compressed in place as with @ref compressIndicesInPlace(). If the compressed
+indices are smaller than the original index data, they're then copied to an
+array of the exact size so the returned instance doesn't reference the unused
+remainder of the original allocation, otherwise the index data are transferred
+to the returned instance as well. In all other cases the index data are
+compressed to a new array. Attribute data are copied always.
+
+The index range is calculated in a single pass using
+@ref Math::minmax(const Containers::StridedArrayView1D<const T>&).
+@see @ref Trade::MeshData::vertexDataFlags(),
+    @ref Trade::MeshData::indexDataFlags()
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData compressIndices(Trade::MeshData&& mesh, MeshIndexType atLeast = MeshIndexType::UnsignedShort);
 
+/**
+@brief Compress indices of multiple meshes in place
+@param meshes   Meshes to compress indices of
+@param atLeast  Smallest allowed type
+@param executor Executor to run the compression with
+@m_since_latest
+
+Replaces each indexed mesh in @p meshes with the output of
+@ref compressIndices(Trade::MeshData&&, MeshIndexType), which means the
+indices of meshes with owned and mutable index data are compressed without
+allocating a new index array. Non-indexed meshes are left untouched. With a
+non-serial @p executor each mesh is compressed in a separate task, the output
+is the same regardless of the executor.
+
+The index types of the indexed meshes and the @p atLeast parameter are
+expected to not be implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT void compressIndicesInPlace(Containers::ArrayView<Trade::MeshData> meshes, MeshIndexType atLeast = MeshIndexType::UnsignedShort, const Executor& executor = {});
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Compress vertex indices
@@ -26,14 +26,100 @@
 
 #include "Concatenate.h"
 
+#include <cstring>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/MeshTools/GenerateIndices.h"
 #include "Magnum/MeshTools/Implementation/remapAttributeData.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+/* Copies indices and attributes of a single mesh into `out`, with the indices
+   written to `indices` at `indexOffset` and adjusted for `vertexOffset`. The
+   `indexOffset` is updated, `vertexOffset` is expected to be updated by the
+   caller. The `i` is used only for assertion messages. Returns false if an
+   assertion fired, which can only happen in a graceful assert build. */
+bool concatenateOneInto(Trade::MeshData& out, const Containers::ArrayView<UnsignedInt> indices, std::size_t& indexOffset, const std::size_t vertexOffset, const Trade::MeshData& mesh, const std::size_t i, const char* const assertPrefix) {
+    #if defined(CORRADE_NO_ASSERT) || defined(CORRADE_STANDARD_ASSERT)
+    static_cast<void>(i);
+    static_cast<void>(assertPrefix);
+    #endif
+
+    /* This won't fire for i == ~std::size_t{}, as that's where
+       out.primitive() comes from */
+    CORRADE_ASSERT(mesh.primitive() == out.primitive(),
+        assertPrefix << "expected" << out.primitive() << "but got" << mesh.primitive() << "in mesh" << i,
+        false);
+
+    /* If the mesh is indexed, copy the indices over, expanded to 32bit */
+    if(mesh.isIndexed()) {
+        CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+            assertPrefix << "mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+            false);
+
+        Containers::ArrayView<UnsignedInt> dst = indices.slice(indexOffset, indexOffset + mesh.indexCount());
+        mesh.indicesInto(dst);
+        indexOffset += mesh.indexCount();
+
+        /* Adjust indices for current vertex offset */
+        for(UnsignedInt& index: dst) index += vertexOffset;
+
+    /* Otherwise, if we need an index buffer (meaning at least one of the
+       meshes is indexed), generate a trivial index buffer */
+    } else if(!indices.isEmpty()) {
+        MeshTools::generateTrivialIndicesInto(indices.sliceSize(indexOffset, mesh.vertexCount()), vertexOffset);
+        indexOffset += mesh.vertexCount();
+    }
+
+    /* Copy attributes to their destination, skipping ones that don't have
+       any equivalent in the destination mesh */
+    for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
+        /* Try to find a matching attribute in the destination mesh (same
+           name, same set, same morph target ID). Skip if no such attribute
+           is found. This is a O(m + n) complexity (linear lookup in both
+           the source and the output mesh), but given the assumption that
+           meshes rarely have more than 8-16 attributes it should still be
+           faster than building a hashmap first and then doing a complex
+           lookup in it (which is how it used to be before, using
+           std::unordered_multimap). */
+        const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
+        if(!dst)
+            continue;
+
+        /* Check format compatibility. This won't fire for i == 0, as
+           that's where out.primitive() comes from */
+        CORRADE_ASSERT(out.attributeFormat(*dst) == mesh.attributeFormat(src),
+            assertPrefix << "expected" << out.attributeFormat(*dst) << "for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeFormat(src) << "in mesh" << i << "attribute" << src,
+            false);
+        CORRADE_ASSERT(!out.attributeArraySize(*dst) == !mesh.attributeArraySize(src),
+            assertPrefix << "attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ")" << (out.attributeArraySize(*dst) ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << i << (mesh.attributeArraySize(src) ? "is" : "isn't"),
+            false);
+        CORRADE_ASSERT(out.attributeArraySize(*dst) >= mesh.attributeArraySize(src),
+            assertPrefix << "expected array size" << out.attributeArraySize(*dst) << "or less for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << i << "attribute" << src,
+            false);
+
+        const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
+        const Containers::StridedArrayView2D<char> dstAttribute = out.mutableAttribute(*dst);
+
+        /* Copy the data to a slice of the output. For non-array attributes
+           the second dimension should be matching (because the format is
+           matching), for array attributes we may be copying to just a
+           prefix of the elements in dstAttribute. */
+        CORRADE_INTERNAL_ASSERT(out.attributeArraySize(*dst) || srcAttribute.size()[1] == dstAttribute.size()[1]);
+        Utility::copy(srcAttribute, dstAttribute.sliceSize(
+            {vertexOffset, 0},
+            {mesh.vertexCount(), srcAttribute.size()[1]}));
+    }
+
+    return true;
+}
+
+}
+
 namespace Implementation {
 
 Containers::Pair<UnsignedInt, UnsignedInt> concatenateIndexVertexCount(const Containers::Iterable<const Trade::MeshData>& meshes) {
@@ -92,76 +178,11 @@ Trade::MeshData concatenate(Containers::Array<char>&& indexData, const UnsignedI
     std::size_t indexOffset = 0;
     std::size_t vertexOffset = 0;
     for(std::size_t i = 0; i != meshes.size(); ++i) {
-        const Trade::MeshData& mesh = meshes[i];
-
-        /* This won't fire for i == ~std::size_t{}, as that's where
-           out.primitive() comes from */
-        CORRADE_ASSERT(mesh.primitive() == out.primitive(),
-            assertPrefix << "expected" << out.primitive() << "but got" << mesh.primitive() << "in mesh" << i,
-            (Trade::MeshData{MeshPrimitive{}, 0}));
-
-        /* If the mesh is indexed, copy the indices over, expanded to 32bit */
-        if(mesh.isIndexed()) {
-            CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
-                assertPrefix << "mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-
-            Containers::ArrayView<UnsignedInt> dst = indices.slice(indexOffset, indexOffset + mesh.indexCount());
-            mesh.indicesInto(dst);
-            indexOffset += mesh.indexCount();
-
-            /* Adjust indices for current vertex offset */
-            for(UnsignedInt& index: dst) index += vertexOffset;
-
-        /* Otherwise, if we need an index buffer (meaning at least one of the
-           meshes is indexed), generate a trivial index buffer */
-        } else if(!indices.isEmpty()) {
-            MeshTools::generateTrivialIndicesInto(indices.sliceSize(indexOffset, mesh.vertexCount()), vertexOffset);
-            indexOffset += mesh.vertexCount();
-        }
-
-        /* Copy attributes to their destination, skipping ones that don't have
-           any equivalent in the destination mesh */
-        for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
-            /* Try to find a matching attribute in the destination mesh (same
-               name, same set, same morph target ID). Skip if no such attribute
-               is found. This is a O(m + n) complexity (linear lookup in both
-               the source and the output mesh), but given the assumption that
-               meshes rarely have more than 8-16 attributes it should still be
-               faster than building a hashmap first and then doing a complex
-               lookup in it (which is how it used to be before, using
-               std::unordered_multimap). */
-            const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
-            if(!dst)
-                continue;
-
-            /* Check format compatibility. This won't fire for i == 0, as
-               that's where out.primitive() comes from */
-            CORRADE_ASSERT(out.attributeFormat(*dst) == mesh.attributeFormat(src),
-                assertPrefix << "expected" << out.attributeFormat(*dst) << "for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeFormat(src) << "in mesh" << i << "attribute" << src,
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-            CORRADE_ASSERT(!out.attributeArraySize(*dst) == !mesh.attributeArraySize(src),
-                assertPrefix << "attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ")" << (out.attributeArraySize(*dst) ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << i << (mesh.attributeArraySize(src) ? "is" : "isn't"),
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-            CORRADE_ASSERT(out.attributeArraySize(*dst) >= mesh.attributeArraySize(src),
-                assertPrefix << "expected array size" << out.attributeArraySize(*dst) << "or less for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << i << "attribute" << src,
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-
-            const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
-            const Containers::StridedArrayView2D<char> dstAttribute = out.mutableAttribute(*dst);
-
-            /* Copy the data to a slice of the output. For non-array attributes
-               the second dimension should be matching (because the format is
-               matching), for array attributes we may be copying to just a
-               prefix of the elements in dstAttribute. */
-            CORRADE_INTERNAL_ASSERT(out.attributeArraySize(*dst) || srcAttribute.size()[1] == dstAttribute.size()[1]);
-            Utility::copy(srcAttribute, dstAttribute.sliceSize(
-                {vertexOffset, 0},
-                {mesh.vertexCount(), srcAttribute.size()[1]}));
-        }
+        if(!concatenateOneInto(out, indices, indexOffset, vertexOffset, meshes[i], i, assertPrefix))
+            return Trade::MeshData{MeshPrimitive{}, 0}; /* LCOV_EXCL_LINE */
 
         /* Update vertex offset for the next mesh */
-        vertexOffset += mesh.vertexCount();
+        vertexOffset += meshes[i].vertexCount();
     }
 
     return out;
@@ -207,4 +228,155 @@ Trade::MeshData concatenate(const Containers::Iterable<const Trade::MeshData>& m
     return Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenate():");
 }
 
+namespace {
+
+/* Grows the array to at least given size, at least doubling the size to
+   amortize repeated calls. Contents past the original size are left
+   uninitialized. */
+void growAtLeast(Containers::Array<char>& data, const std::size_t size) {
+    if(data.size() >= size) return;
+    arrayResize(data, NoInit, Math::max(size, 2*data.size()));
+}
+
+}
+
+Concatenator::Concatenator(const Trade::MeshData& layout, const InterleaveFlags flags): Concatenator{layout, nullptr, nullptr, flags} {}
+
+Concatenator::Concatenator(const Trade::MeshData& layout, Containers::Array<char>&& indexData, Containers::Array<char>&& vertexData, const InterleaveFlags flags): _primitive{layout.primitive()}, _indexed{}, _vertexStride{}, _meshCount{}, _indexCount{}, _vertexCount{}, _indexData{Utility::move(indexData)}, _vertexData{Utility::move(vertexData)} {
+    /* Only list primitives are supported currently, same as in
+       concatenate() */
+    CORRADE_ASSERT(
+        layout.primitive() != MeshPrimitive::LineStrip &&
+        layout.primitive() != MeshPrimitive::LineLoop &&
+        layout.primitive() != MeshPrimitive::TriangleStrip &&
+        layout.primitive() != MeshPrimitive::TriangleFan,
+        "MeshTools::Concatenator:" << layout.primitive() << "is not supported, turn it into a plain indexed mesh first", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != layout.attributeCount(); ++i) {
+        const VertexFormat format = layout.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::Concatenator: attribute" << i << "of the layout mesh has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), );
+    }
+    #endif
+
+    /* Calculate the attribute stride and offsets the same way as
+       concatenate() does. The result is offset-only with a zero vertex count,
+       which gets turned into absolute views on every add() and release(). */
+    if(layout.attributeCount())
+        _attributeData = Implementation::interleavedLayout(Trade::MeshData{layout.primitive(),
+            {}, layout.vertexData(),
+            Trade::meshAttributeDataNonOwningArray(layout.attributeData())}, {}, flags);
+    else _attributeData =
+        Implementation::interleavedLayout(Trade::MeshData{layout.primitive(),
+            layout.vertexCount()}, {}, flags);
+    if(!_attributeData.isEmpty())
+        _vertexStride = _attributeData[0].stride();
+}
+
+Concatenator::Concatenator(Concatenator&&) noexcept = default;
+
+Concatenator::~Concatenator() = default;
+
+Concatenator& Concatenator::operator=(Concatenator&&) noexcept = default;
+
+Containers::ArrayView<const char> Concatenator::indexData() const {
+    return _indexData.prefix(_indexCount*sizeof(UnsignedInt));
+}
+
+Containers::ArrayView<const char> Concatenator::vertexData() const {
+    return _vertexData.prefix(std::size_t(_vertexCount)*_vertexStride);
+}
+
+Concatenator& Concatenator::reserve(const UnsignedInt indexCount, const UnsignedInt vertexCount) {
+    growAtLeast(_indexData, indexCount*sizeof(UnsignedInt));
+    growAtLeast(_vertexData, std::size_t(vertexCount)*_vertexStride);
+    return *this;
+}
+
+Concatenator& Concatenator::add(const Trade::MeshData& mesh) {
+    /* Calculate the new index count. If this is the first indexed mesh, all
+       previous meshes will have a trivial index buffer generated for all their
+       vertices, if some earlier mesh was indexed and this one isn't, it'll
+       get a trivial index buffer generated for its vertices. Same as in
+       Implementation::concatenateIndexVertexCount(). */
+    const bool indexed = _indexed || mesh.isIndexed();
+    std::size_t indexOffset = !indexed ? 0 :
+        _indexed ? _indexCount : _vertexCount;
+    const UnsignedInt indexCount = !indexed ? 0 : indexOffset +
+        (mesh.isIndexed() ? mesh.indexCount() : mesh.vertexCount());
+    const UnsignedInt vertexCount = _vertexCount + mesh.vertexCount();
+
+    growAtLeast(_indexData, indexCount*sizeof(UnsignedInt));
+    growAtLeast(_vertexData, std::size_t(vertexCount)*_vertexStride);
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(_indexData.prefix(indexCount*sizeof(UnsignedInt)));
+    const Containers::ArrayView<char> vertexData = _vertexData.prefix(std::size_t(vertexCount)*_vertexStride);
+
+    /* If this is the first indexed mesh, generate a trivial index buffer for
+       all previous vertices. If the add() fails below, this gets overwritten
+       by the next indexed mesh again. */
+    if(!_indexed && indexed)
+        generateTrivialIndicesInto(indices.prefix(_vertexCount));
+
+    /* The new vertex range might have holes if the mesh doesn't have all
+       attributes or the stride has padding, zero-initialize it */
+    if(const std::size_t size = std::size_t(mesh.vertexCount())*_vertexStride)
+        std::memset(vertexData.exceptPrefix(std::size_t(_vertexCount)*_vertexStride).data(), 0, size);
+
+    /* Make a mutable non-owning mesh view on the output so far to copy the
+       mesh data into */
+    Containers::Array<Trade::MeshAttributeData> attributeData{NoInit, _attributeData.size()};
+    for(std::size_t i = 0; i != _attributeData.size(); ++i)
+        attributeData[i] = Implementation::remapAttributeData(_attributeData[i], vertexCount, _vertexData, vertexData);
+    Trade::MeshData out{_primitive,
+        Trade::DataFlag::Mutable, vertexData,
+        Utility::move(attributeData), vertexCount};
+
+    /* Commit the new counts only if the copy succeeded, in a graceful assert
+       build the instance is left in the previous state otherwise */
+    if(!concatenateOneInto(out, indices, indexOffset, _vertexCount, mesh, _meshCount, "MeshTools::Concatenator::add():"))
+        return *this; /* LCOV_EXCL_LINE */
+
+    CORRADE_INTERNAL_ASSERT(indexOffset == indexCount);
+    _indexed = indexed;
+    _indexCount = indexCount;
+    _vertexCount = vertexCount;
+    ++_meshCount;
+    return *this;
+}
+
+Trade::MeshData Concatenator::release() {
+    /* Convert the attributes from offset-only and zero vertex count to
+       absolute, referencing the vertex data array. The offset-only variant is
+       kept for subsequent use. */
+    Containers::Array<Trade::MeshAttributeData> attributeData{NoInit, _attributeData.size()};
+    for(std::size_t i = 0; i != _attributeData.size(); ++i)
+        attributeData[i] = Implementation::remapAttributeData(_attributeData[i], _vertexCount, _vertexData, _vertexData);
+
+    /* If the index count is zero, we're creating a non-indexed mesh (not an
+       indexed mesh with zero indices), same as concatenate() */
+    Containers::Array<char> indexData;
+    Trade::MeshIndexData indices;
+    if(_indexCount) {
+        indexData = Utility::move(_indexData);
+        indices = Trade::MeshIndexData{Containers::arrayCast<UnsignedInt>(indexData.prefix(_indexCount*sizeof(UnsignedInt)))};
+    }
+
+    /* Not passing any vertex data if there are no attributes */
+    Containers::Array<char> vertexData;
+    if(!attributeData.isEmpty())
+        vertexData = Utility::move(_vertexData);
+
+    Trade::MeshData out{_primitive,
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributeData), _vertexCount};
+
+    /* Reset to a newly-constructed state */
+    _indexData = {};
+    _vertexData = {};
+    _indexed = false;
+    _meshCount = _indexCount = _vertexCount = 0;
+
+    return out;
+}
+
 }}
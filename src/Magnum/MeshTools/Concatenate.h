@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto()
+ * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto(), class @ref Magnum::MeshTools::Concatenator
  * @m_since{2020,06}
  */
 
@@ -93,6 +93,9 @@ description.
 If an index buffer is needed, @ref MeshIndexType::UnsignedInt is always used.
 Call @ref compressIndices(const Trade::MeshData&, MeshIndexType) on the result
 to compress it to a smaller type, if desired.
+
+All input meshes have to be in memory at the same time. If that's not
+feasible, use the @ref Concatenator class, which takes the meshes one by one.
 @see @ref concatenateInto(), @ref isMeshIndexTypeImplementationSpecific(),
     @ref isVertexFormatImplementationSpecific(),
     @ref SceneTools::flattenMeshHierarchy2D(),
@@ -154,6 +157,181 @@ template<template<class> class Allocator = Containers::ArrayAllocator> void conc
     destination = Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenateInto():");
 }
 
+/**
+@brief Incremental mesh concatenator
+@m_since_latest
+
+Produces the same output as @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags),
+but takes the meshes one at a time, copying each directly into the output so
+the input mesh can be discarded right after. Compared to @ref concatenate(),
+where all input meshes have to be in memory together with the output, peak
+memory use is thus just the output size plus the size of the largest input
+mesh. Example usage, concatenating all meshes of an importer without having
+them all imported at once:
+
+@snippet MeshTools.cpp Concatenator
+
+The primitive and attribute layout is taken from a mesh passed to the
+constructor, the same way as @ref concatenate() takes it from the first mesh,
+and the same restrictions apply to meshes passed to @ref add(). The output
+arrays are grown as needed, but to avoid reallocations it's possible to
+either call @ref reserve() with the total index and vertex count, if known,
+or pass preallocated arrays to the constructor --- for example a
+memory-mapped file. In both cases the output has exactly the layout described
+by @ref indexData() and @ref vertexData(), so the arrays can be used directly
+without going through @ref release().
+
+If the first meshes passed to @ref add() are not indexed and a later mesh is,
+a trivial index buffer is generated for the previous meshes, like with
+@ref concatenate(). As that requires the index buffer to cover all vertices
+added so far, it's advised to have either all meshes indexed or none of them.
+*/
+class MAGNUM_MESHTOOLS_EXPORT Concatenator {
+    public:
+        /**
+         * @brief Constructor
+         * @param layout        Mesh to take the primitive and attribute layout
+         *      from
+         * @param flags         Flags to pass to @ref interleavedLayout()
+         *
+         * Only the primitive and attribute metadata are taken from
+         * @p layout, its data aren't copied --- pass it to @ref add() as
+         * well if it should be a part of the output. Expects that the
+         * primitive isn't @ref MeshPrimitive::LineStrip,
+         * @relativeref{MeshPrimitive,LineLoop},
+         * @relativeref{MeshPrimitive,TriangleStrip} or
+         * @relativeref{MeshPrimitive,TriangleFan} and that none of the
+         * attributes have an implementation-specific format.
+         */
+        explicit Concatenator(const Trade::MeshData& layout, InterleaveFlags flags = InterleaveFlag::PreserveInterleavedAttributes);
+
+        /**
+         * @brief Construct with preallocated output
+         * @param layout        Mesh to take the primitive and attribute layout
+         *      from
+         * @param indexData     Memory to put the indices to
+         * @param vertexData    Memory to put the vertices to
+         * @param flags         Flags to pass to @ref interleavedLayout()
+         *
+         * Like @ref Concatenator(const Trade::MeshData&, InterleaveFlags),
+         * but the output is written to @p indexData and @p vertexData, which
+         * can have an arbitrary deleter. As long as the total index count
+         * times 4 and the total vertex count times @ref vertexStride() fit
+         * into their sizes, no reallocation happens. Otherwise they get
+         * reallocated to a growable array and the original memory is
+         * released.
+         */
+        explicit Concatenator(const Trade::MeshData& layout, Containers::Array<char>&& indexData, Containers::Array<char>&& vertexData, InterleaveFlags flags = InterleaveFlag::PreserveInterleavedAttributes);
+
+        /** @brief Copying is not allowed */
+        Concatenator(const Concatenator&) = delete;
+
+        /** @brief Move constructor */
+        Concatenator(Concatenator&&) noexcept;
+
+        ~Concatenator();
+
+        /** @brief Copying is not allowed */
+        Concatenator& operator=(const Concatenator&) = delete;
+
+        /** @brief Move assignment */
+        Concatenator& operator=(Concatenator&&) noexcept;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /**
+         * @brief Vertex stride
+         *
+         * Size of a single vertex in the output vertex data. Can be used to
+         * calculate the size of preallocated vertex data passed to
+         * @ref Concatenator(const Trade::MeshData&, Containers::Array<char>&&, Containers::Array<char>&&, InterleaveFlags).
+         */
+        UnsignedInt vertexStride() const { return _vertexStride; }
+
+        /** @brief Count of meshes added so far */
+        UnsignedInt meshCount() const { return _meshCount; }
+
+        /**
+         * @brief Whether the output is indexed
+         *
+         * Becomes @cpp true @ce with the first indexed mesh passed to
+         * @ref add().
+         */
+        bool isIndexed() const { return _indexed; }
+
+        /** @brief Count of indices added so far */
+        UnsignedInt indexCount() const { return _indexCount; }
+
+        /** @brief Count of vertices added so far */
+        UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /**
+         * @brief Index data added so far
+         *
+         * Contains @ref indexCount() @ref MeshIndexType::UnsignedInt
+         * indices. Empty if the output isn't indexed.
+         */
+        Containers::ArrayView<const char> indexData() const;
+
+        /**
+         * @brief Vertex data added so far
+         *
+         * Contains @ref vertexCount() vertices with a @ref vertexStride()
+         * stride.
+         */
+        Containers::ArrayView<const char> vertexData() const;
+
+        /**
+         * @brief Reserve memory for given index and vertex count
+         * @return Reference to self (for method chaining)
+         *
+         * Grows the output arrays to fit @p indexCount indices and
+         * @p vertexCount vertices in total, if they aren't large enough
+         * already. Calling this function isn't required, but avoids
+         * repeated reallocations in @ref add() if the total size is known
+         * upfront. Pass @cpp 0 @ce for @p indexCount if none of the meshes
+         * are indexed.
+         */
+        Concatenator& reserve(UnsignedInt indexCount, UnsignedInt vertexCount);
+
+        /**
+         * @brief Add a mesh
+         * @return Reference to self (for method chaining)
+         *
+         * Copies indices and attributes of @p mesh to the output. Attributes
+         * that are not present in the layout are ignored, layout attributes
+         * not present in @p mesh are zero-filled. Expects that @p mesh has
+         * the same primitive as the layout, its index type isn't
+         * implementation-specific and that matching attributes have the same
+         * format and the same or smaller array size. See
+         * @ref concatenate() for details.
+         */
+        Concatenator& add(const Trade::MeshData& mesh);
+
+        /**
+         * @brief Release the concatenated mesh
+         *
+         * Returns a mesh with index and vertex data added so far, the
+         * instance is then reset to a state equivalent to a newly constructed
+         * instance with the same layout. The returned index and vertex data
+         * flags always have both @ref Trade::DataFlag::Owned and
+         * @ref Trade::DataFlag::Mutable. The data arrays may be larger than
+         * the actual index and vertex count if they were grown or were
+         * preallocated larger.
+         */
+        Trade::MeshData release();
+
+    private:
+        MeshPrimitive _primitive;
+        bool _indexed;
+        UnsignedInt _vertexStride;
+        UnsignedInt _meshCount, _indexCount, _vertexCount;
+        Containers::Array<char> _indexData, _vertexData;
+        /* Offset-only attributes with zero vertex count */
+        Containers::Array<Trade::MeshAttributeData> _attributeData;
+};
+
 }}
 
 #endif
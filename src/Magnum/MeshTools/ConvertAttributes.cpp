@@ -0,0 +1,274 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ConvertAttributes.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/MeshTools/Filter.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Implementation/alignedLayout.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Vertices are converted in blocks of this size through a scratch buffer,
+   which for the common four-component attributes stays well inside L1 */
+constexpr std::size_t ConvertBlockSize = 256;
+
+bool isIntegerComponentFormat(const VertexFormat format) {
+    return format == VertexFormat::UnsignedByte ||
+           format == VertexFormat::Byte ||
+           format == VertexFormat::UnsignedShort ||
+           format == VertexFormat::Short ||
+           format == VertexFormat::UnsignedInt ||
+           format == VertexFormat::Int;
+}
+
+/* The source and destination views are bytes of all components of a single
+   vertex in the second dimension, including all array elements. That
+   dimension is contiguous so they can be directly cast to the component
+   type. */
+void unpackFloatInto(const VertexFormat componentFormat, const bool normalized, const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    if(componentFormat == VertexFormat::Float)
+        Math::castInto(Containers::arrayCast<2, const Float>(src), dst);
+    else if(componentFormat == VertexFormat::Half)
+        Math::unpackHalfInto(Containers::arrayCast<2, const UnsignedShort>(src), dst);
+    else if(componentFormat == VertexFormat::Double)
+        Math::castInto(Containers::arrayCast<2, const Double>(src), dst);
+    else if(componentFormat == VertexFormat::UnsignedByte && normalized)
+        Math::unpackInto(Containers::arrayCast<2, const UnsignedByte>(src), dst);
+    else if(componentFormat == VertexFormat::UnsignedByte)
+        Math::castInto(Containers::arrayCast<2, const UnsignedByte>(src), dst);
+    else if(componentFormat == VertexFormat::Byte && normalized)
+        Math::unpackInto(Containers::arrayCast<2, const Byte>(src), dst);
+    else if(componentFormat == VertexFormat::Byte)
+        Math::castInto(Containers::arrayCast<2, const Byte>(src), dst);
+    else if(componentFormat == VertexFormat::UnsignedShort && normalized)
+        Math::unpackInto(Containers::arrayCast<2, const UnsignedShort>(src), dst);
+    else if(componentFormat == VertexFormat::UnsignedShort)
+        Math::castInto(Containers::arrayCast<2, const UnsignedShort>(src), dst);
+    else if(componentFormat == VertexFormat::Short && normalized)
+        Math::unpackInto(Containers::arrayCast<2, const Short>(src), dst);
+    else if(componentFormat == VertexFormat::Short)
+        Math::castInto(Containers::arrayCast<2, const Short>(src), dst);
+    else if(componentFormat == VertexFormat::UnsignedInt)
+        Math::castInto(Containers::arrayCast<2, const UnsignedInt>(src), dst);
+    else if(componentFormat == VertexFormat::Int)
+        Math::castInto(Containers::arrayCast<2, const Int>(src), dst);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Math::packInto() doesn't clamp, so the values get clamped in the scratch
+   buffer first */
+void clampInPlace(const Containers::StridedArrayView2D<Float>& data, const Float min, const Float max) {
+    for(std::size_t i = 0; i != data.size()[0]; ++i)
+        for(std::size_t j = 0; j != data.size()[1]; ++j)
+            data[i][j] = Math::clamp(data[i][j], min, max);
+}
+
+void packFloatInto(const Containers::StridedArrayView2D<Float>& src, const VertexFormat componentFormat, const bool normalized, const Containers::StridedArrayView2D<char>& dst) {
+    if(normalized) clampInPlace(src,
+        componentFormat == VertexFormat::Byte ||
+        componentFormat == VertexFormat::Short ? -1.0f : 0.0f, 1.0f);
+
+    if(componentFormat == VertexFormat::Float)
+        Math::castInto(src, Containers::arrayCast<2, Float>(dst));
+    else if(componentFormat == VertexFormat::Half)
+        Math::packHalfInto(src, Containers::arrayCast<2, UnsignedShort>(dst));
+    else if(componentFormat == VertexFormat::Double)
+        Math::castInto(src, Containers::arrayCast<2, Double>(dst));
+    else if(componentFormat == VertexFormat::UnsignedByte && normalized)
+        Math::packInto(src, Containers::arrayCast<2, UnsignedByte>(dst));
+    else if(componentFormat == VertexFormat::UnsignedByte)
+        Math::castInto(src, Containers::arrayCast<2, UnsignedByte>(dst));
+    else if(componentFormat == VertexFormat::Byte && normalized)
+        Math::packInto(src, Containers::arrayCast<2, Byte>(dst));
+    else if(componentFormat == VertexFormat::Byte)
+        Math::castInto(src, Containers::arrayCast<2, Byte>(dst));
+    else if(componentFormat == VertexFormat::UnsignedShort && normalized)
+        Math::packInto(src, Containers::arrayCast<2, UnsignedShort>(dst));
+    else if(componentFormat == VertexFormat::UnsignedShort)
+        Math::castInto(src, Containers::arrayCast<2, UnsignedShort>(dst));
+    else if(componentFormat == VertexFormat::Short && normalized)
+        Math::packInto(src, Containers::arrayCast<2, Short>(dst));
+    else if(componentFormat == VertexFormat::Short)
+        Math::castInto(src, Containers::arrayCast<2, Short>(dst));
+    else if(componentFormat == VertexFormat::UnsignedInt)
+        Math::castInto(src, Containers::arrayCast<2, UnsignedInt>(dst));
+    else if(componentFormat == VertexFormat::Int)
+        Math::castInto(src, Containers::arrayCast<2, Int>(dst));
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Integer to integer conversions go through a 64-bit intermediate instead of
+   a float in order to not lose precision for 32-bit values. The PackingBatch
+   APIs don't provide all combinations, so these are plain loops. */
+template<class T> void widenIntegers(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<Long>& dst) {
+    const Containers::StridedArrayView2D<const T> srcTyped = Containers::arrayCast<2, const T>(src);
+    for(std::size_t i = 0; i != dst.size()[0]; ++i)
+        for(std::size_t j = 0; j != dst.size()[1]; ++j)
+            dst[i][j] = srcTyped[i][j];
+}
+
+template<class T> void narrowIntegers(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<char>& dst) {
+    const Containers::StridedArrayView2D<T> dstTyped = Containers::arrayCast<2, T>(dst);
+    for(std::size_t i = 0; i != src.size()[0]; ++i)
+        for(std::size_t j = 0; j != src.size()[1]; ++j)
+            dstTyped[i][j] = T(src[i][j]);
+}
+
+void widenIntegersInto(const VertexFormat componentFormat, const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<Long>& dst) {
+    if(componentFormat == VertexFormat::UnsignedByte)
+        widenIntegers<UnsignedByte>(src, dst);
+    else if(componentFormat == VertexFormat::Byte)
+        widenIntegers<Byte>(src, dst);
+    else if(componentFormat == VertexFormat::UnsignedShort)
+        widenIntegers<UnsignedShort>(src, dst);
+    else if(componentFormat == VertexFormat::Short)
+        widenIntegers<Short>(src, dst);
+    else if(componentFormat == VertexFormat::UnsignedInt)
+        widenIntegers<UnsignedInt>(src, dst);
+    else if(componentFormat == VertexFormat::Int)
+        widenIntegers<Int>(src, dst);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void narrowIntegersInto(const Containers::StridedArrayView2D<const Long>& src, const VertexFormat componentFormat, const Containers::StridedArrayView2D<char>& dst) {
+    if(componentFormat == VertexFormat::UnsignedByte)
+        narrowIntegers<UnsignedByte>(src, dst);
+    else if(componentFormat == VertexFormat::Byte)
+        narrowIntegers<Byte>(src, dst);
+    else if(componentFormat == VertexFormat::UnsignedShort)
+        narrowIntegers<UnsignedShort>(src, dst);
+    else if(componentFormat == VertexFormat::Short)
+        narrowIntegers<Short>(src, dst);
+    else if(componentFormat == VertexFormat::UnsignedInt)
+        narrowIntegers<UnsignedInt>(src, dst);
+    else if(componentFormat == VertexFormat::Int)
+        narrowIntegers<Int>(src, dst);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+Trade::MeshData convertAttributes(const Trade::MeshData& mesh, const Containers::ArrayView<const Containers::Pair<Trade::MeshAttribute, VertexFormat>> conversions) {
+    /* Copy original attributes to a mutable array and replace the ones that
+       get converted with an empty placeholder, same as in quantize() */
+    Containers::Array<Trade::MeshAttributeData> attributes{mesh.attributeCount()};
+    std::size_t maxComponentCount = 0;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        attributes[i] = mesh.attributeData(i);
+
+        /* If the name is listed multiple times, the last one wins */
+        const Trade::MeshAttribute name = mesh.attributeName(i);
+        VertexFormat targetFormat{};
+        for(const Containers::Pair<Trade::MeshAttribute, VertexFormat>& conversion: conversions)
+            if(conversion.first() == name)
+                targetFormat = conversion.second();
+
+        const VertexFormat format = mesh.attributeFormat(i);
+        if(targetFormat == VertexFormat{} || targetFormat == format)
+            continue;
+
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::convertAttributes(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(targetFormat),
+            "MeshTools::convertAttributes(): can't convert" << name << "to an implementation-specific format" << Debug::hex << vertexFormatUnwrap(targetFormat),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        CORRADE_ASSERT(vertexFormatVectorCount(format) == 1 && vertexFormatVectorCount(targetFormat) == 1,
+            "MeshTools::convertAttributes(): can't convert" << name << "from" << format << "to" << targetFormat << Debug::nospace << ", matrix formats are not supported",
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        CORRADE_ASSERT(vertexFormatComponentCount(format) == vertexFormatComponentCount(targetFormat),
+            "MeshTools::convertAttributes(): can't convert" << name << "from" << format << "to" << targetFormat << "with a different component count",
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        CORRADE_ASSERT(Trade::Implementation::isVertexFormatCompatibleWithAttribute(name, targetFormat),
+            "MeshTools::convertAttributes():" << targetFormat << "is not a valid format for" << name,
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+
+        const UnsignedShort arraySize = mesh.attributeArraySize(i);
+        attributes[i] = Trade::MeshAttributeData{name, targetFormat, nullptr, arraySize, mesh.attributeMorphTargetId(i)};
+        maxComponentCount = Math::max(maxComponentCount, std::size_t(vertexFormatComponentCount(format)*Math::max(arraySize, UnsignedShort(1))));
+    }
+
+    /* Create the output mesh with each attribute aligned to the size of its
+       component type and the stride to four bytes, same as in quantize().
+       The attributes that aren't converted get copied in the process. */
+    Trade::MeshData out = interleave(filterOnlyAttributes(mesh, Containers::ArrayView<const Trade::MeshAttribute>{}), Implementation::alignedLayout(attributes), {});
+    if(!maxComponentCount) return out;
+
+    /* Convert the placeholders block by block through a scratch buffer. Only
+       one of the two is used for a particular attribute. */
+    Containers::Array<Float> floatScratch{NoInit, ConvertBlockSize*maxComponentCount};
+    Containers::Array<Long> integerScratch{NoInit, ConvertBlockSize*maxComponentCount};
+    const std::size_t vertexCount = mesh.vertexCount();
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        const VertexFormat targetFormat = out.attributeFormat(i);
+        if(format == targetFormat) continue;
+
+        const VertexFormat componentFormat = vertexFormatComponentFormat(format);
+        const VertexFormat targetComponentFormat = vertexFormatComponentFormat(targetFormat);
+        const bool normalized = isVertexFormatNormalized(format);
+        const bool targetNormalized = isVertexFormatNormalized(targetFormat);
+        const bool integer =
+            isIntegerComponentFormat(componentFormat) && !normalized &&
+            isIntegerComponentFormat(targetComponentFormat) && !targetNormalized;
+        const std::size_t componentCount = vertexFormatComponentCount(format)*Math::max(mesh.attributeArraySize(i), UnsignedShort(1));
+
+        const Containers::StridedArrayView2D<const char> src = mesh.attribute(i);
+        const Containers::StridedArrayView2D<char> dst = out.mutableAttribute(i);
+        for(std::size_t begin = 0; begin < vertexCount; begin += ConvertBlockSize) {
+            const std::size_t size = Math::min(ConvertBlockSize, vertexCount - begin);
+            const Containers::StridedArrayView2D<const char> srcBlock = src.sliceSize({begin, 0}, {size, src.size()[1]});
+            const Containers::StridedArrayView2D<char> dstBlock = dst.sliceSize({begin, 0}, {size, dst.size()[1]});
+
+            if(integer) {
+                const Containers::StridedArrayView2D<Long> scratch{integerScratch.prefix(size*componentCount), {size, componentCount}};
+                widenIntegersInto(componentFormat, srcBlock, scratch);
+                narrowIntegersInto(scratch, targetComponentFormat, dstBlock);
+            } else {
+                const Containers::StridedArrayView2D<Float> scratch{floatScratch.prefix(size*componentCount), {size, componentCount}};
+                unpackFloatInto(componentFormat, normalized, srcBlock, scratch);
+                packFloatInto(scratch, targetComponentFormat, targetNormalized, dstBlock);
+            }
+        }
+    }
+
+    return out;
+}
+
+Trade::MeshData convertAttributes(const Trade::MeshData& mesh, const std::initializer_list<Containers::Pair<Trade::MeshAttribute, VertexFormat>> conversions) {
+    return convertAttributes(mesh, Containers::arrayView(conversions));
+}
+
+}}
@@ -0,0 +1,95 @@
+#ifndef Magnum_MeshTools_ConvertAttributes_h
+#define Magnum_MeshTools_ConvertAttributes_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::convertAttributes()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Convert mesh attributes to different vertex formats
+@param mesh         Input mesh
+@param conversions  Attribute names and formats to convert them to
+@m_since_latest
+
+Each attribute whose name is listed in @p conversions is converted to the
+corresponding format, including all its morph targets and all its instances
+if the mesh has more than one, such as several texture coordinate sets. If a
+name is listed more than once, the last occurrence is used. Names that aren't
+present in the mesh are ignored, so the same list can be applied to all meshes
+in a scene. The remaining attributes, the index buffer and the primitive are
+passed through unchanged.
+
+The output is interleaved with
+@ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&)
+without @ref InterleaveFlag::PreserveInterleavedAttributes, with each
+attribute aligned to the size of its component type and the vertex stride
+rounded up to a multiple of four bytes, as required by Vulkan and Metal, same
+as in @ref quantize(). Converted
+attributes are unpacked to floats in blocks of vertices and packed directly
+into the output using @ref Math::unpackInto(), @ref Math::packInto(),
+@ref Math::unpackHalfInto(), @ref Math::packHalfInto() and
+@ref Math::castInto(), with no full-mesh temporary copies. For array
+attributes, all array elements are converted the same way.
+
+-   Floating-point, normalized and integer formats can be converted to each
+    other. Values converted to normalized formats are clamped to the
+    @f$ [0, 1] @f$ or @f$ [-1, 1] @f$ range, values converted to
+    non-normalized integer formats aren't clamped, and out-of-range values
+    have an unspecified result.
+-   Conversions between two non-normalized integer formats are done without
+    a floating-point intermediate and are exact for values representable in
+    the target type.
+
+Expects that neither the converted attributes nor the target formats are
+implementation-specific or matrix formats, that the component count of each
+converted attribute matches the target format and that the target format is
+valid for given attribute.
+@see @ref quantize(), @ref isVertexFormatImplementationSpecific(),
+    @ref vertexFormatComponentCount(), @ref vertexFormatVectorCount()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData convertAttributes(const Trade::MeshData& mesh, Containers::ArrayView<const Containers::Pair<Trade::MeshAttribute, VertexFormat>> conversions);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData convertAttributes(const Trade::MeshData& mesh, std::initializer_list<Containers::Pair<Trade::MeshAttribute, VertexFormat>> conversions);
+
+}}
+
+#endif
@@ -0,0 +1,605 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Encode.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Increased every time the encoded data layout changes in an incompatible
+   way, stored in the first byte of the data */
+constexpr UnsignedByte VertexBufferVersion = 1;
+constexpr UnsignedByte IndexBufferVersion = 1;
+
+/* Vertices are processed in blocks of this size to keep the scratch memory
+   used by the decoder small, bytes of each block are then split into groups
+   of 16 that each get their own bit width */
+constexpr std::size_t VertexBlockSize = 256;
+constexpr std::size_t VertexGroupSize = 16;
+
+/* Maps small negative and positive differences to small unsigned values, so
+   e.g. -1 becomes 1 and 1 becomes 2 */
+inline UnsignedByte zigzag(const UnsignedByte value) {
+    return UnsignedByte((value << 1)^UnsignedByte(Byte(value) >> 7));
+}
+
+inline UnsignedByte unzigzag(const UnsignedByte value) {
+    return UnsignedByte((value >> 1)^-(value & 1));
+}
+
+inline UnsignedInt zigzag(const Int value) {
+    return (UnsignedInt(value) << 1)^UnsignedInt(value >> 31);
+}
+
+inline Int unzigzag(const UnsignedInt value) {
+    return Int(value >> 1)^-Int(value & 1);
+}
+
+/* Writes a group of 16 zigzagged differences with the smallest bit width
+   that can represent all of them, returning the bit width index */
+UnsignedByte encodeVertexGroup(Containers::Array<char>& out, const UnsignedByte* const differences) {
+    UnsignedByte max = 0;
+    for(std::size_t i = 0; i != VertexGroupSize; ++i)
+        max |= differences[i];
+
+    if(max == 0)
+        return 0;
+    if(max < 4) {
+        for(std::size_t i = 0; i != VertexGroupSize; i += 4)
+            arrayAppend(out, char(differences[i]|differences[i + 1] << 2|differences[i + 2] << 4|differences[i + 3] << 6));
+        return 1;
+    }
+    if(max < 16) {
+        for(std::size_t i = 0; i != VertexGroupSize; i += 2)
+            arrayAppend(out, char(differences[i]|differences[i + 1] << 4));
+        return 2;
+    }
+    arrayAppend(out, Containers::arrayView(reinterpret_cast<const char*>(differences), VertexGroupSize));
+    return 3;
+}
+
+/* Decodes a group of 16 bytes with given bit width index, undoes the zigzag
+   and accumulates the differences on top of the previous value. Returns
+   nullptr if there's not enough data. */
+const UnsignedByte* decodeVertexGroup(const UnsignedByte* in, const UnsignedByte* const end, const UnsignedInt bits, UnsignedByte& previous, UnsignedByte* const out) {
+    #ifdef CORRADE_TARGET_SSE2
+    __m128i v;
+    if(bits == 0) {
+        v = _mm_setzero_si128();
+    } else if(bits == 1) {
+        if(end - in < 4) return nullptr;
+        Int packed;
+        std::memcpy(&packed, in, 4);
+        in += 4;
+        /* Spread each 2-bit value into its own byte, then interleave so the
+           order matches the encoder */
+        const __m128i x = _mm_cvtsi32_si128(packed);
+        const __m128i mask = _mm_set1_epi8(0x03);
+        const __m128i a = _mm_and_si128(x, mask);
+        const __m128i b = _mm_and_si128(_mm_srli_epi16(x, 2), mask);
+        const __m128i c = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+        const __m128i d = _mm_and_si128(_mm_srli_epi16(x, 6), mask);
+        v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(a, b), _mm_unpacklo_epi8(c, d));
+    } else if(bits == 2) {
+        if(end - in < 8) return nullptr;
+        const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in));
+        in += 8;
+        const __m128i mask = _mm_set1_epi8(0x0f);
+        v = _mm_unpacklo_epi8(_mm_and_si128(x, mask), _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+    } else {
+        if(end - in < 16) return nullptr;
+        v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        in += 16;
+    }
+
+    /* Undo the zigzag. There's no 8-bit shift, so shift 16-bit lanes and mask
+       away what got shifted in from the neighbor byte. */
+    v = _mm_xor_si128(
+        _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi8(0x7f)),
+        _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(v, _mm_set1_epi8(1))));
+
+    /* Prefix sum in log2(16) steps, then add the previous value to all */
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 1));
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 2));
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 4));
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 8));
+    v = _mm_add_epi8(v, _mm_set1_epi8(char(previous)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+    previous = UnsignedByte(_mm_extract_epi16(v, 7) >> 8);
+    return in;
+    #else
+    if(bits == 0) {
+        for(std::size_t i = 0; i != VertexGroupSize; ++i)
+            out[i] = previous;
+        return in;
+    }
+
+    UnsignedByte differences[VertexGroupSize];
+    if(bits == 1) {
+        if(end - in < 4) return nullptr;
+        for(std::size_t i = 0; i != VertexGroupSize; ++i)
+            differences[i] = (in[i/4] >> ((i%4)*2)) & 0x03;
+        in += 4;
+    } else if(bits == 2) {
+        if(end - in < 8) return nullptr;
+        for(std::size_t i = 0; i != VertexGroupSize; ++i)
+            differences[i] = (in[i/2] >> ((i%2)*4)) & 0x0f;
+        in += 8;
+    } else {
+        if(end - in < 16) return nullptr;
+        std::memcpy(differences, in, 16);
+        in += 16;
+    }
+
+    for(std::size_t i = 0; i != VertexGroupSize; ++i) {
+        previous += unzigzag(differences[i]);
+        out[i] = previous;
+    }
+    return in;
+    #endif
+}
+
+}
+
+Containers::Array<char> encodeVertexBuffer(const Containers::StridedArrayView2D<const char>& vertices) {
+    CORRADE_ASSERT(vertices.isContiguous<1>(),
+        "MeshTools::encodeVertexBuffer(): second view dimension is not contiguous", {});
+
+    const std::size_t vertexCount = vertices.size()[0];
+    const std::size_t vertexSize = vertices.size()[1];
+
+    Containers::Array<char> out;
+    /* Most data compress at least a bit, reserve for the worst case to avoid
+       reallocations in the common case */
+    arrayReserve(out, 1 + vertexCount*vertexSize + vertexCount*vertexSize/64 + vertexSize);
+    arrayAppend(out, char(VertexBufferVersion));
+
+    /* Last value of each byte from the previous block */
+    Containers::Array<UnsignedByte> last{ValueInit, vertexSize};
+    UnsignedByte differences[VertexBlockSize];
+    for(std::size_t blockBegin = 0; blockBegin < vertexCount; blockBegin += VertexBlockSize) {
+        const std::size_t blockSize = Math::min(VertexBlockSize, vertexCount - blockBegin);
+        const std::size_t groupCount = (blockSize + VertexGroupSize - 1)/VertexGroupSize;
+        const Containers::StridedArrayView2D<const char> block = vertices.sliceSize(blockBegin, blockSize);
+
+        for(std::size_t k = 0; k != vertexSize; ++k) {
+            /* Zigzagged differences to the previous vertex, with the last
+               group padded with zeros */
+            const Containers::StridedArrayView1D<const char> column = block.transposed<0, 1>()[k];
+            UnsignedByte previous = last[k];
+            for(std::size_t i = 0; i != blockSize; ++i) {
+                const UnsignedByte value = column[i];
+                differences[i] = zigzag(UnsignedByte(value - previous));
+                previous = value;
+            }
+            for(std::size_t i = blockSize; i != groupCount*VertexGroupSize; ++i)
+                differences[i] = 0;
+            last[k] = previous;
+
+            /* Each four groups are prefixed with a byte containing their bit
+               widths */
+            for(std::size_t g = 0; g < groupCount; g += 4) {
+                const std::size_t headerOffset = out.size();
+                arrayAppend(out, '\0');
+                UnsignedByte header = 0;
+                for(std::size_t j = 0; j != 4 && g + j != groupCount; ++j)
+                    header |= UnsignedByte(encodeVertexGroup(out, differences + (g + j)*VertexGroupSize) << j*2);
+                out[headerOffset] = char(header);
+            }
+        }
+    }
+
+    /* Convert back to a default deleter to make the returned array usable
+       with plugins */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+bool decodeVertexBufferInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& vertices) {
+    CORRADE_ASSERT(vertices.isContiguous<1>(),
+        "MeshTools::decodeVertexBufferInto(): second view dimension is not contiguous", {});
+
+    if(data.isEmpty()) {
+        Error{} << "MeshTools::decodeVertexBufferInto(): the data are empty";
+        return false;
+    }
+    if(UnsignedByte(data[0]) != VertexBufferVersion) {
+        Error{} << "MeshTools::decodeVertexBufferInto(): unsupported version" << UnsignedInt(UnsignedByte(data[0]));
+        return false;
+    }
+
+    const std::size_t vertexCount = vertices.size()[0];
+    const std::size_t vertexSize = vertices.size()[1];
+    const std::ptrdiff_t vertexStride = vertices.stride()[0];
+    const UnsignedByte* in = reinterpret_cast<const UnsignedByte*>(data.data()) + 1;
+    const UnsignedByte* const end = reinterpret_cast<const UnsignedByte*>(data.end());
+
+    /* Each byte of the vertex is first decoded into a contiguous plane and
+       the planes are then transposed back to the vertex layout */
+    Containers::Array<UnsignedByte> last{ValueInit, vertexSize};
+    Containers::Array<UnsignedByte> planes{NoInit, vertexSize*VertexBlockSize};
+    for(std::size_t blockBegin = 0; blockBegin < vertexCount; blockBegin += VertexBlockSize) {
+        const std::size_t blockSize = Math::min(VertexBlockSize, vertexCount - blockBegin);
+        const std::size_t groupCount = (blockSize + VertexGroupSize - 1)/VertexGroupSize;
+
+        for(std::size_t k = 0; k != vertexSize; ++k) {
+            UnsignedByte* const plane = planes + k*VertexBlockSize;
+            UnsignedByte previous = last[k];
+            for(std::size_t g = 0; g < groupCount; g += 4) {
+                if(in == end) {
+                    Error{} << "MeshTools::decodeVertexBufferInto(): unexpected end of data";
+                    return false;
+                }
+                const UnsignedByte header = *in++;
+                for(std::size_t j = 0; j != 4 && g + j != groupCount; ++j) {
+                    in = decodeVertexGroup(in, end, (header >> j*2) & 0x03, previous, plane + (g + j)*VertexGroupSize);
+                    if(!in) {
+                        Error{} << "MeshTools::decodeVertexBufferInto(): unexpected end of data";
+                        return false;
+                    }
+                }
+            }
+            last[k] = plane[blockSize - 1];
+        }
+
+        char* const blockOut = static_cast<char*>(vertices.data()) + blockBegin*vertexStride;
+        std::size_t k = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        /* Transpose four planes at a time, writing four bytes of sixteen
+           vertices in each step */
+        for(; k + 4 <= vertexSize; k += 4) {
+            const UnsignedByte* const plane = planes + k*VertexBlockSize;
+            for(std::size_t i = 0; i < blockSize; i += VertexGroupSize) {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + VertexBlockSize + i));
+                const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + 2*VertexBlockSize + i));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + 3*VertexBlockSize + i));
+                const __m128i ab0 = _mm_unpacklo_epi8(a, b);
+                const __m128i ab1 = _mm_unpackhi_epi8(a, b);
+                const __m128i cd0 = _mm_unpacklo_epi8(c, d);
+                const __m128i cd1 = _mm_unpackhi_epi8(c, d);
+                alignas(16) UnsignedInt transposed[VertexGroupSize];
+                _mm_store_si128(reinterpret_cast<__m128i*>(transposed + 0), _mm_unpacklo_epi16(ab0, cd0));
+                _mm_store_si128(reinterpret_cast<__m128i*>(transposed + 4), _mm_unpackhi_epi16(ab0, cd0));
+                _mm_store_si128(reinterpret_cast<__m128i*>(transposed + 8), _mm_unpacklo_epi16(ab1, cd1));
+                _mm_store_si128(reinterpret_cast<__m128i*>(transposed + 12), _mm_unpackhi_epi16(ab1, cd1));
+
+                char* groupOut = blockOut + i*vertexStride + k;
+                for(std::size_t j = 0, jMax = Math::min(VertexGroupSize, blockSize - i); j != jMax; ++j) {
+                    std::memcpy(groupOut, transposed + j, 4);
+                    groupOut += vertexStride;
+                }
+            }
+        }
+        #endif
+        for(; k != vertexSize; ++k) {
+            const UnsignedByte* const plane = planes + k*VertexBlockSize;
+            char* planeOut = blockOut + k;
+            for(std::size_t i = 0; i != blockSize; ++i) {
+                *planeOut = char(plane[i]);
+                planeOut += vertexStride;
+            }
+        }
+    }
+
+    if(in != end) {
+        Error{} << "MeshTools::decodeVertexBufferInto(): expected" << (in - reinterpret_cast<const UnsignedByte*>(data.data())) << "bytes but got" << data.size();
+        return false;
+    }
+
+    return true;
+}
+
+namespace {
+
+/* Count of most recently encoded triangle edges an edge of a new triangle is
+   looked up in. Has to fit into four bits of the triangle control byte. */
+constexpr UnsignedInt EdgeFifoSize = 16;
+
+/* State shared by the index encoder and decoder, updated the same way on
+   both sides */
+struct IndexState {
+    explicit IndexState() {
+        for(UnsignedInt (&edge)[2]: edges)
+            edge[0] = edge[1] = ~UnsignedInt{};
+    }
+
+    void pushTriangle(const UnsignedInt(&triangle)[3]) {
+        /* The next triangle sharing an edge with this one has the edge in the
+           opposite direction, assuming consistent winding */
+        pushEdge(triangle[1], triangle[0]);
+        pushEdge(triangle[2], triangle[1]);
+        pushEdge(triangle[0], triangle[2]);
+    }
+
+    void pushEdge(const UnsignedInt a, const UnsignedInt b) {
+        edges[edgeOffset][0] = a;
+        edges[edgeOffset][1] = b;
+        edgeOffset = (edgeOffset + 1) % EdgeFifoSize;
+    }
+
+    /* Distance 0 is the most recently pushed edge */
+    const UnsignedInt* edge(const UnsignedInt distance) const {
+        return edges[(edgeOffset + EdgeFifoSize - 1 - distance) % EdgeFifoSize];
+    }
+
+    void useIndex(const UnsignedInt index) {
+        if(index >= next) next = index + 1;
+        last = index;
+    }
+
+    UnsignedInt edges[EdgeFifoSize][2];
+    UnsignedInt edgeOffset = 0;
+    /* One more than the largest index seen so far, which is what a new
+       vertex is usually going to be */
+    UnsignedInt next = 0;
+    UnsignedInt last = 0;
+};
+
+void appendVarint(Containers::Array<char>& out, UnsignedInt value) {
+    while(value >= 0x80) {
+        arrayAppend(out, char(value|0x80));
+        value >>= 7;
+    }
+    arrayAppend(out, char(value));
+}
+
+bool readVarint(const UnsignedByte*& in, const UnsignedByte* const end, UnsignedInt& value) {
+    value = 0;
+    for(UnsignedInt shift = 0; shift < 35; shift += 7) {
+        if(in == end) return false;
+        const UnsignedByte byte = *in++;
+        value |= UnsignedInt(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+/* If the index is the predicted next one, writes nothing and returns true,
+   otherwise writes a difference to the previous index */
+bool encodeIndex(Containers::Array<char>& out, IndexState& state, const UnsignedInt index) {
+    const bool isNext = index == state.next;
+    if(!isNext)
+        appendVarint(out, zigzag(Int(index - state.last)));
+    state.useIndex(index);
+    return isNext;
+}
+
+bool decodeIndex(const UnsignedByte*& in, const UnsignedByte* const end, IndexState& state, const bool isNext, UnsignedInt& index) {
+    if(isNext)
+        index = state.next;
+    else {
+        UnsignedInt difference;
+        if(!readVarint(in, end, difference)) return false;
+        index = state.last + UnsignedInt(unzigzag(difference));
+    }
+    state.useIndex(index);
+    return true;
+}
+
+/* Control byte layout. If a shared edge was found, the low four bits are the
+   edge distance in the FIFO, the next two bits are the triangle rotation
+   that makes the edge its first two indices and the seventh bit is set if the
+   remaining index is the predicted next one. Otherwise the rotation bits are
+   all set and the low three bits mark which of the three indices are the
+   predicted next one. */
+constexpr UnsignedByte NoSharedEdge = 3 << 4;
+
+template<class T> Containers::Array<char> encodeIndexBufferImplementation(const Containers::StridedArrayView1D<const T>& indices) {
+    Containers::Array<char> out;
+    arrayReserve(out, 1 + indices.size());
+    arrayAppend(out, char(IndexBufferVersion));
+
+    IndexState state;
+    Containers::Array<char> differences;
+    const std::size_t triangleCount = indices.size()/3;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const UnsignedInt triangle[]{
+            indices[i*3 + 0],
+            indices[i*3 + 1],
+            indices[i*3 + 2]
+        };
+
+        /* Find the most recent edge that's shared with the triangle */
+        UnsignedInt distance = EdgeFifoSize, rotation = 0;
+        for(UnsignedInt e = 0; e != EdgeFifoSize && distance == EdgeFifoSize; ++e) {
+            const UnsignedInt* const edge = state.edge(e);
+            for(UnsignedInt r = 0; r != 3; ++r) {
+                if(edge[0] == triangle[r] && edge[1] == triangle[(r + 1) % 3]) {
+                    distance = e;
+                    rotation = r;
+                    break;
+                }
+            }
+        }
+
+        arrayClear(differences);
+        UnsignedByte control;
+        if(distance != EdgeFifoSize) {
+            const bool isNext = encodeIndex(differences, state, triangle[(rotation + 2) % 3]);
+            control = UnsignedByte(distance|rotation << 4|UnsignedInt(isNext) << 6);
+        } else {
+            control = NoSharedEdge;
+            for(UnsignedInt j = 0; j != 3; ++j)
+                control |= UnsignedByte(UnsignedInt(encodeIndex(differences, state, triangle[j])) << j);
+        }
+
+        arrayAppend(out, char(control));
+        arrayAppend(out, differences);
+        state.pushTriangle(triangle);
+    }
+
+    /* Remaining indices that don't form a full triangle */
+    for(std::size_t i = triangleCount*3; i != indices.size(); ++i) {
+        appendVarint(out, zigzag(Int(UnsignedInt(indices[i]) - state.last)));
+        state.last = indices[i];
+    }
+
+    /* Convert back to a default deleter to make the returned array usable
+       with plugins */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+template<class T> bool decodeIndexBufferIntoImplementation(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<T>& indices) {
+    if(data.isEmpty()) {
+        Error{} << "MeshTools::decodeIndexBufferInto(): the data are empty";
+        return false;
+    }
+    if(UnsignedByte(data[0]) != IndexBufferVersion) {
+        Error{} << "MeshTools::decodeIndexBufferInto(): unsupported version" << UnsignedInt(UnsignedByte(data[0]));
+        return false;
+    }
+
+    const UnsignedByte* in = reinterpret_cast<const UnsignedByte*>(data.data()) + 1;
+    const UnsignedByte* const end = reinterpret_cast<const UnsignedByte*>(data.end());
+    /* Caching the max value to avoid function calls in debug builds */
+    constexpr UnsignedInt max = T(~T{});
+
+    IndexState state;
+    const std::size_t triangleCount = indices.size()/3;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        if(in == end) {
+            Error{} << "MeshTools::decodeIndexBufferInto(): unexpected end of data";
+            return false;
+        }
+
+        const UnsignedByte control = *in++;
+        const UnsignedInt rotation = (control >> 4) & 0x03;
+        UnsignedInt triangle[3];
+        bool success = true;
+        if(rotation != 3) {
+            const UnsignedInt* const edge = state.edge(control & 0x0f);
+            triangle[rotation] = edge[0];
+            triangle[(rotation + 1) % 3] = edge[1];
+            success = decodeIndex(in, end, state, control & (1 << 6), triangle[(rotation + 2) % 3]);
+        } else for(UnsignedInt j = 0; j != 3 && success; ++j)
+            success = decodeIndex(in, end, state, control & (1 << j), triangle[j]);
+
+        if(!success) {
+            Error{} << "MeshTools::decodeIndexBufferInto(): unexpected end of data";
+            return false;
+        }
+
+        for(UnsignedInt j = 0; j != 3; ++j) {
+            if(triangle[j] > max) {
+                Error{} << "MeshTools::decodeIndexBufferInto(): index" << triangle[j] << "doesn't fit into" << sizeof(T)*8 << "bits";
+                return false;
+            }
+            indices[i*3 + j] = T(triangle[j]);
+        }
+
+        state.pushTriangle(triangle);
+    }
+
+    /* Remaining indices that don't form a full triangle */
+    for(std::size_t i = triangleCount*3; i != indices.size(); ++i) {
+        UnsignedInt difference;
+        if(!readVarint(in, end, difference)) {
+            Error{} << "MeshTools::decodeIndexBufferInto(): unexpected end of data";
+            return false;
+        }
+
+        const UnsignedInt index = state.last + UnsignedInt(unzigzag(difference));
+        if(index > max) {
+            Error{} << "MeshTools::decodeIndexBufferInto(): index" << index << "doesn't fit into" << sizeof(T)*8 << "bits";
+            return false;
+        }
+        indices[i] = T(index);
+        state.last = index;
+    }
+
+    if(in != end) {
+        Error{} << "MeshTools::decodeIndexBufferInto(): expected" << (in - reinterpret_cast<const UnsignedByte*>(data.data())) << "bytes but got" << data.size();
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedInt>& indices) {
+    return encodeIndexBufferImplementation(indices);
+}
+
+Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedShort>& indices) {
+    return encodeIndexBufferImplementation(indices);
+}
+
+Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedByte>& indices) {
+    return encodeIndexBufferImplementation(indices);
+}
+
+Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView2D<const char>& indices) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::encodeIndexBuffer(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return encodeIndexBufferImplementation(Containers::arrayCast<1, const UnsignedInt>(indices));
+    else if(indices.size()[1] == 2)
+        return encodeIndexBufferImplementation(Containers::arrayCast<1, const UnsignedShort>(indices));
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::encodeIndexBuffer(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return encodeIndexBufferImplementation(Containers::arrayCast<1, const UnsignedByte>(indices));
+    }
+}
+
+bool decodeIndexBufferInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    return decodeIndexBufferIntoImplementation(data, indices);
+}
+
+bool decodeIndexBufferInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedShort>& indices) {
+    return decodeIndexBufferIntoImplementation(data, indices);
+}
+
+bool decodeIndexBufferInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedByte>& indices) {
+    return decodeIndexBufferIntoImplementation(data, indices);
+}
+
+bool decodeIndexBufferInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& indices) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::decodeIndexBufferInto(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return decodeIndexBufferIntoImplementation(data, Containers::arrayCast<1, UnsignedInt>(indices));
+    else if(indices.size()[1] == 2)
+        return decodeIndexBufferIntoImplementation(data, Containers::arrayCast<1, UnsignedShort>(indices));
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::decodeIndexBufferInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return decodeIndexBufferIntoImplementation(data, Containers::arrayCast<1, UnsignedByte>(indices));
+    }
+}
+
+}}
@@ -0,0 +1,173 @@
+#ifndef Magnum_MeshTools_Encode_h
+#define Magnum_MeshTools_Encode_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::encodeVertexBuffer(), @ref Magnum::MeshTools::decodeVertexBufferInto(), @ref Magnum::MeshTools::encodeIndexBuffer(), @ref Magnum::MeshTools::decodeIndexBufferInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Losslessly compress a vertex buffer
+@param vertices     Vertex data. First dimension is vertices, second is bytes
+    of a single vertex.
+@m_since_latest
+
+Meant for reducing the size of vertex data stored on disk or transferred over
+a network. The vertices are processed in blocks of 256, each byte of the vertex
+is encoded separately as a difference to the same byte of the previous vertex,
+and the differences are then bit-packed in groups of 16, using either 0, 2, 4
+or 8 bits for each. Interleaved vertex data with smoothly changing attributes
+such as quantized positions, normals or texture coordinates thus compress
+well, while noisy data such as low mantissa bytes of 32-bit floats gain little.
+For best results, quantize the attributes with @ref quantize() and reorder the
+vertices with @ref optimizeVertexFetchInPlace() first.
+
+The encoded data don't store the vertex count or size, pass the original
+dimensions to @ref decodeVertexBufferInto() when decoding. Expects that the
+second dimension of @p vertices is contiguous.
+@see @ref encodeIndexBuffer()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeVertexBuffer(const Containers::StridedArrayView2D<const char>& vertices);
+
+/**
+@brief Decode a vertex buffer
+@param data         Data produced by @ref encodeVertexBuffer()
+@param vertices     Where to put the decoded vertex data. First dimension is
+    vertices, second is bytes of a single vertex.
+@m_since_latest
+
+Inverse of @ref encodeVertexBuffer(). Expects that the second dimension of
+@p vertices is contiguous and that @p vertices have the same size as was
+passed to @ref encodeVertexBuffer(). If @p data are truncated, have trailing
+bytes or were produced by an unknown version of the encoder, prints a message
+to @relativeref{Magnum,Error} and returns @cpp false @ce, in which case
+contents of @p vertices are unspecified.
+
+If Magnum is compiled with @ref CORRADE_TARGET_SSE2 enabled, groups of 16
+values are unpacked and accumulated using SSE2 instructions and the decoded
+values are transposed back into the vertex layout four bytes at a time.
+@see @ref decodeIndexBufferInto()
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeVertexBufferInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& vertices);
+
+/**
+@brief Losslessly compress a triangle index buffer
+@param indices      Index data
+@m_since_latest
+
+Meant for reducing the size of index data stored on disk or transferred over
+a network. Each triangle is encoded with a single control byte, referencing
+either an edge shared with one of the 16 most recently encoded triangles, or
+storing all three indices. Index values that aren't one larger than the largest
+index seen so far are stored as a variable-length difference to the previously
+encoded index. With triangles ordered for vertex cache locality, for example
+with @ref optimizeVertexCacheInPlace(), and vertices then reordered with
+@ref optimizeVertexFetchInPlace(), the encoded size is commonly two to three
+bytes per triangle.
+
+The triangle order as well as order of indices in each triangle is preserved
+exactly, i.e. the decoded data are bit-identical to the input. If the @p indices
+size isn't divisible by @cpp 3 @ce, the remaining indices are stored as plain
+differences. The encoded data don't store the index count, pass the original
+size to @ref decodeIndexBufferInto() when decoding.
+@see @ref encodeVertexBuffer()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedInt>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedShort>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedByte>& indices);
+
+/**
+@brief Losslessly compress a type-erased triangle index buffer
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref encodeIndexBuffer(const Containers::StridedArrayView1D<const UnsignedInt>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndexBuffer(const Containers::StridedArrayView2D<const char>& indices);
+
+/**
+@brief Decode a triangle index buffer
+@param data         Data produced by @ref encodeIndexBuffer()
+@param indices      Where to put the decoded indices
+@m_since_latest
+
+Inverse of @ref encodeIndexBuffer(). Expects that @p indices have the same
+size as was passed to @ref encodeIndexBuffer(). If @p data are truncated,
+have trailing bytes, were produced by an unknown version of the encoder or
+decode to an index that doesn't fit into the destination type, prints a
+message to @relativeref{Magnum,Error} and returns @cpp false @ce, in which
+case contents of @p indices are unspecified.
+@see @ref decodeVertexBufferInto()
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndexBufferInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndexBufferInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedShort>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndexBufferInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedByte>& indices);
+
+/**
+@brief Decode a triangle index buffer into a type-erased view
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref decodeIndexBufferInto(Containers::ArrayView<const char>, const Containers::StridedArrayView1D<UnsignedInt>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndexBufferInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& indices);
+
+}}
+
+#endif
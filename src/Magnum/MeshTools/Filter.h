@@ -50,7 +50,7 @@ set. The index buffer, if present, is left untouched. The size of
 
 This function only operates on the attribute metadata --- if you'd like to have
 the vertex data repacked to contain just the remaining attributes as well, pass
-the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags) "interleave()"
+the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&) "interleave()"
 without @ref InterleaveFlag::PreserveInterleavedAttributes set.
 @see @ref reference(), @ref filterOnlyAttributes(),
     @ref filterExceptAttributes(), @ref meshtools-attributes-filter
@@ -87,7 +87,7 @@ pick attributes by their IDs instead.
 
 This function only operates on the attribute metadata --- if you'd like to have
 the vertex data repacked to contain just the remaining attributes as well, pass
-the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags) "interleave()"
+the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&) "interleave()"
 without @ref InterleaveFlag::PreserveInterleavedAttributes set.
 @see @ref reference(), @ref filterExceptAttributes(),
     @ref meshtools-attributes-filter
@@ -136,7 +136,7 @@ pick attributes by their IDs instead.
 
 This function only operates on the attribute metadata --- if you'd like to have
 the vertex mesh repacked to contain just the remaining attributes as well, pass
-the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags) "interleave()"
+the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&) "interleave()"
 without @ref InterleaveFlag::PreserveInterleavedAttributes set.
 @see @ref reference(), @ref filterOnlyAttributes(),
     @ref meshtools-attributes-filter
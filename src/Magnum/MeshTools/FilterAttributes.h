@@ -59,7 +59,7 @@ than @ref Trade::MeshData::attributeCount() const.
 
 This function only operates on the attribute metadata --- if you'd like to have
 the vertex data repacked to contain just the remaining attributes as well, pass
-the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags) "interleave()"
+the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&) "interleave()"
 without @ref InterleaveFlag::PreserveInterleavedAttributes set.
 @see @ref reference()
 */
@@ -86,7 +86,7 @@ behavior is equivalent to @ref reference().
 
 This function only operates on the attribute metadata --- if you'd like to have
 the vertex data repacked to contain just the remaining attributes as well, pass
-the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags) "interleave()"
+the output to @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&) "interleave()"
 without @ref InterleaveFlag::PreserveInterleavedAttributes set.
 */
 CORRADE_DEPRECATED("use filterAttributes() instead") MAGNUM_MESHTOOLS_EXPORT Trade::MeshData filterExceptAttributes(const Trade::MeshData& mesh, Containers::ArrayView<const UnsignedInt> attributes);
@@ -0,0 +1,234 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMeshlets.h"
+
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Bounding sphere from all meshlet vertices and normal cone from all meshlet
+   triangles. The scratch arrays are sized for the max vertex and triangle
+   count and reused across meshlets to avoid allocations. */
+MeshletBounds meshletBounds(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<const UnsignedInt> vertices, const Containers::ArrayView<const UnsignedByte> indices, const Containers::ArrayView<Vector3> scratchPositions, const Containers::ArrayView<Vector3> scratchNormals) {
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        scratchPositions[i] = positions[vertices[i]];
+    const Containers::Pair<Vector3, Float> sphere = boundingSphereBouncingBubble(scratchPositions.prefix(vertices.size()));
+
+    MeshletBounds out;
+    out.center = sphere.first();
+    out.radius = sphere.second();
+
+    /* Average of normalized triangle normals, with degenerate triangles
+       ignored */
+    const std::size_t triangleCount = indices.size()/3;
+    Vector3 normalSum;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const Vector3& a = scratchPositions[indices[i*3 + 0]];
+        const Vector3& b = scratchPositions[indices[i*3 + 1]];
+        const Vector3& c = scratchPositions[indices[i*3 + 2]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        const Float length = normal.length();
+        scratchNormals[i] = length == 0.0f ? Vector3{} : normal/length;
+        normalSum += scratchNormals[i];
+    }
+
+    /* Smallest angle between the axis and the triangle normals. If it's too
+       large (or all triangles are degenerate, or the normals cancel out), the
+       cone would be so wide that it's practically never culled and the apex
+       would be too far away to be numerically stable, so mark it as not
+       usable instead. */
+    const Float normalSumLength = normalSum.length();
+    Float minDot = 1.0f;
+    if(normalSumLength != 0.0f) {
+        const Vector3 axis = normalSum/normalSumLength;
+        for(std::size_t i = 0; i != triangleCount; ++i)
+            if(!scratchNormals[i].isZero())
+                minDot = Math::min(minDot, Math::dot(axis, scratchNormals[i]));
+        out.coneAxis = axis;
+    }
+    if(normalSumLength == 0.0f || minDot <= 0.1f) {
+        out.coneApex = out.center;
+        out.coneAxis = {};
+        out.coneCutoff = 1.0f;
+        return out;
+    }
+
+    /* Move the apex back along the axis so that it's behind the planes of all
+       triangles. Then any camera position inside the cone sees only their
+       back sides. */
+    Float maxDistance = 0.0f;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        if(scratchNormals[i].isZero()) continue;
+        const Vector3& a = scratchPositions[indices[i*3]];
+        maxDistance = Math::max(maxDistance,
+            Math::dot(out.center - a, scratchNormals[i])/Math::dot(out.coneAxis, scratchNormals[i]));
+    }
+    out.coneApex = out.center - out.coneAxis*maxDistance;
+    out.coneCutoff = Math::sqrt(1.0f - minDot*minDot);
+    return out;
+}
+
+template<class T> MeshletData generateMeshletsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateMeshlets(): index count not divisible by 3, got" << indices.size(), {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256,
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256, got" << maxVertexCount, {});
+    CORRADE_ASSERT(maxTriangleCount,
+        "MeshTools::generateMeshlets(): max triangle count can't be zero", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(std::size_t(indices[i]) < positions.size(),
+            "MeshTools::generateMeshlets(): index" << UnsignedInt(indices[i]) << "out of range for" << positions.size() << "vertices", {});
+    #endif
+
+    MeshletData out;
+    arrayReserve(out.vertices, indices.size());
+    arrayReserve(out.indices, indices.size());
+
+    /* Position of each vertex in the current meshlet, or ~UnsignedInt{} if
+       it's not there yet */
+    Containers::Array<UnsignedInt> localIndex{DirectInit, positions.size(), ~UnsignedInt{}};
+    Containers::Array<Vector3> scratchPositions{NoInit, maxVertexCount};
+    Containers::Array<Vector3> scratchNormals{NoInit, maxTriangleCount};
+
+    Meshlet current{};
+    const auto finishMeshlet = [&]() {
+        const Containers::ArrayView<const UnsignedInt> vertices = out.vertices.sliceSize(current.vertexOffset, current.vertexCount);
+        for(const UnsignedInt vertex: vertices)
+            localIndex[vertex] = ~UnsignedInt{};
+        arrayAppend(out.meshlets, current);
+        arrayAppend(out.bounds, meshletBounds(positions, vertices, out.indices.sliceSize(current.indexOffset, current.triangleCount*3), scratchPositions, scratchNormals));
+
+        current.vertexOffset += current.vertexCount;
+        current.indexOffset += current.triangleCount*3;
+        current.vertexCount = 0;
+        current.triangleCount = 0;
+    };
+
+    for(std::size_t i = 0, iMax = indices.size()/3; i != iMax; ++i) {
+        const UnsignedInt a = indices[i*3 + 0];
+        const UnsignedInt b = indices[i*3 + 1];
+        const UnsignedInt c = indices[i*3 + 2];
+
+        /* Count of vertices that are not in the meshlet yet, taking
+           degenerate triangles into account */
+        const UnsignedInt newVertexCount =
+            (localIndex[a] == ~UnsignedInt{}) +
+            (localIndex[b] == ~UnsignedInt{} && b != a) +
+            (localIndex[c] == ~UnsignedInt{} && c != a && c != b);
+        if(current.vertexCount + newVertexCount > maxVertexCount ||
+           current.triangleCount == maxTriangleCount)
+            finishMeshlet();
+
+        const UnsignedInt triangle[]{a, b, c};
+        for(const UnsignedInt vertex: triangle) {
+            if(localIndex[vertex] == ~UnsignedInt{}) {
+                localIndex[vertex] = current.vertexCount++;
+                arrayAppend(out.vertices, vertex);
+            }
+            arrayAppend(out.indices, UnsignedByte(localIndex[vertex]));
+        }
+        ++current.triangleCount;
+    }
+
+    if(current.triangleCount)
+        finishMeshlet();
+
+    /* Convert the growable arrays back to ones with a default deleter so the
+       result doesn't depend on the growable allocator */
+    arrayShrink(out.meshlets, DefaultInit);
+    arrayShrink(out.bounds, DefaultInit);
+    arrayShrink(out.vertices, DefaultInit);
+    arrayShrink(out.indices, DefaultInit);
+    return out;
+}
+
+}
+
+MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+MeshletData generateMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateMeshlets(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return generateMeshlets(Containers::arrayCast<1, const UnsignedInt>(indices), positions, maxVertexCount, maxTriangleCount);
+    else if(indices.size()[1] == 2)
+        return generateMeshlets(Containers::arrayCast<1, const UnsignedShort>(indices), positions, maxVertexCount, maxTriangleCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateMeshlets(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return generateMeshlets(Containers::arrayCast<1, const UnsignedByte>(indices), positions, maxVertexCount, maxTriangleCount);
+    }
+}
+
+MeshletData generateMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateMeshlets(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(), {});
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::generateMeshlets(): the mesh is not indexed", {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateMeshlets(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::generateMeshlets(): the mesh has no positions", {});
+
+    return generateMeshlets(mesh.indices(), mesh.positions3DAsArray(), maxVertexCount, maxTriangleCount);
+}
+
+void cullMeshletConesInto(const Containers::StridedArrayView1D<const Vector3>& coneApices, const Containers::StridedArrayView1D<const Vector3>& coneAxes, const Containers::StridedArrayView1D<const Float>& coneCutoffs, const Vector3& cameraPosition, const Containers::MutableBitArrayView culled) {
+    CORRADE_ASSERT(coneAxes.size() == coneApices.size() && coneCutoffs.size() == coneApices.size() && culled.size() == coneApices.size(),
+        "MeshTools::cullMeshletConesInto(): expected cone apex, axis, cutoff and output views to have the same size, got" << coneApices.size() << Debug::nospace << "," << coneAxes.size() << Debug::nospace << "," << coneCutoffs.size() << "and" << culled.size(), );
+
+    /* No branches and no divisions in the loop, so the compiler can vectorize
+       at least the arithmetic */
+    for(std::size_t i = 0; i != coneApices.size(); ++i) {
+        const Vector3 direction = coneApices[i] - cameraPosition;
+        culled.set(i, Math::dot(direction, coneAxes[i]) > coneCutoffs[i]*direction.length());
+    }
+}
+
+void cullMeshletConesInto(const Containers::StridedArrayView1D<const MeshletBounds>& bounds, const Vector3& cameraPosition, const Containers::MutableBitArrayView culled) {
+    cullMeshletConesInto(bounds.slice(&MeshletBounds::coneApex), bounds.slice(&MeshletBounds::coneAxis), bounds.slice(&MeshletBounds::coneCutoff), cameraPosition, culled);
+}
+
+}}
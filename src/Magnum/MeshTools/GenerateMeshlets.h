@@ -0,0 +1,244 @@
+#ifndef Magnum_MeshTools_GenerateMeshlets_h
+#define Magnum_MeshTools_GenerateMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, @ref Magnum::MeshTools::MeshletBounds, @ref Magnum::MeshTools::MeshletData, function @ref Magnum::MeshTools::generateMeshlets(), @ref Magnum::MeshTools::cullMeshletConesInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+@m_since_latest
+
+Describes a single meshlet produced by @ref generateMeshlets(). The layout
+matches what's commonly expected by mesh shader pipelines, so the
+@ref MeshletData::meshlets array can be uploaded directly.
+*/
+struct Meshlet {
+    /** @brief Offset of the first vertex in @ref MeshletData::vertices */
+    UnsignedInt vertexOffset;
+
+    /** @brief Offset of the first index in @ref MeshletData::indices */
+    UnsignedInt indexOffset;
+
+    /** @brief Count of unique vertices referenced by the meshlet */
+    UnsignedInt vertexCount;
+
+    /** @brief Count of triangles in the meshlet */
+    UnsignedInt triangleCount;
+};
+
+/**
+@brief Meshlet bounds
+@m_since_latest
+
+Bounding sphere and normal cone of a single meshlet produced by
+@ref generateMeshlets().
+@see @ref cullMeshletConesInto()
+*/
+struct MeshletBounds {
+    /**
+     * @brief Bounding sphere center
+     *
+     * Calculated with @ref boundingSphereBouncingBubble() from positions of
+     * all vertices referenced by the meshlet.
+     */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone apex
+     *
+     * A point from which all triangles of the meshlet are facing away if the
+     * view direction is inside the cone.
+     */
+    Vector3 coneApex;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average of the triangle normals. A zero vector if the
+     * triangles are facing in too different directions for the cone to be
+     * useful for culling.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the cone half-angle, or @cpp 1.0f @ce if the cone is not
+     * usable for culling. The meshlet is backfacing for a camera at a
+     * position @f$ \boldsymbol{p} @f$ if
+     * @f$ (\boldsymbol{a} - \boldsymbol{p}) \cdot \boldsymbol{n} > c |\boldsymbol{a} - \boldsymbol{p}| @f$,
+     * where @f$ \boldsymbol{a} @f$ is @ref coneApex, @f$ \boldsymbol{n} @f$
+     * is @ref coneAxis and @f$ c @f$ is the cutoff.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Meshlet data
+@m_since_latest
+
+Returned from @ref generateMeshlets().
+*/
+struct MeshletData {
+    /** @brief Meshlets */
+    Containers::Array<Meshlet> meshlets;
+
+    /**
+     * @brief Meshlet bounds
+     *
+     * Has the same size as @ref meshlets.
+     */
+    Containers::Array<MeshletBounds> bounds;
+
+    /**
+     * @brief Vertex remap
+     *
+     * For each meshlet, @ref Meshlet::vertexCount indices into the original
+     * vertex data starting at @ref Meshlet::vertexOffset.
+     */
+    Containers::Array<UnsignedInt> vertices;
+
+    /**
+     * @brief Meshlet-local triangle indices
+     *
+     * For each meshlet, @cpp 3*triangleCount @ce indices starting at
+     * @ref Meshlet::indexOffset, indexing the meshlet's range of
+     * @ref vertices.
+     */
+    Containers::Array<UnsignedByte> indices;
+};
+
+/**
+@brief Split a mesh into meshlets
+@param indices          Triangle index array
+@param positions        Vertex positions
+@param maxVertexCount   Max count of unique vertices in a meshlet
+@param maxTriangleCount Max count of triangles in a meshlet
+@m_since_latest
+
+Walks through the triangles in order, adding them to the current meshlet until
+either @p maxVertexCount or @p maxTriangleCount would be exceeded, at which
+point a new meshlet is started. The quality of the result thus depends on
+locality of the input --- for best results, run @ref optimizeVertexCacheInPlace()
+on the index buffer first. Each meshlet gets a list of original vertex indices
+it references and a list of 8-bit indices into that list, together with a
+bounding sphere and a normal cone usable for cluster culling with
+@ref cullMeshletConesInto(). Commonly used limits are @cpp 64 @ce vertices and
+@cpp 124 @ce or @cpp 126 @ce triangles.
+
+Expects that @p indices size is divisible by @cpp 3 @ce, all indices are less
+than @p positions size, @p maxVertexCount is between @cpp 3 @ce and
+@cpp 256 @ce and @p maxTriangleCount is not zero.
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+
+/**
+@brief Split a mesh with a type-erased index array into meshlets
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+
+/**
+@brief Split mesh data into meshlets
+@m_since_latest
+
+Calls @ref generateMeshlets(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+with the index data and positions taken from the first
+@ref Trade::MeshAttribute::Position attribute. Expects that the mesh is
+indexed with @ref MeshPrimitive::Triangles, the index type is not
+implementation-specific and the mesh has a
+@ref Trade::MeshAttribute::Position attribute, which can be two- or
+three-dimensional.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref Trade::MeshData::positions3DAsArray()
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+
+/**
+@brief Cull meshlets based on their normal cones
+@param[in]  coneApices      Normal cone apices
+@param[in]  coneAxes        Normal cone axes
+@param[in]  coneCutoffs     Normal cone cutoffs
+@param[in]  cameraPosition  Camera position
+@param[out] culled          Where to put the result
+@m_since_latest
+
+Sets a bit in @p culled for every meshlet that's entirely backfacing when
+viewed from @p cameraPosition, resets it otherwise. See
+@ref MeshletBounds::coneCutoff for the actual condition. The views are
+expected to be of the same size. The calculation doesn't branch, which makes it
+possible for the compiler to vectorize it. Use
+@ref cullMeshletConesInto(const Containers::StridedArrayView1D<const MeshletBounds>&, const Vector3&, Containers::MutableBitArrayView)
+to pass the @ref MeshletData::bounds array directly.
+*/
+MAGNUM_MESHTOOLS_EXPORT void cullMeshletConesInto(const Containers::StridedArrayView1D<const Vector3>& coneApices, const Containers::StridedArrayView1D<const Vector3>& coneAxes, const Containers::StridedArrayView1D<const Float>& coneCutoffs, const Vector3& cameraPosition, Containers::MutableBitArrayView culled);
+
+/**
+@brief Cull meshlets based on their normal cones
+@m_since_latest
+
+Calls @ref cullMeshletConesInto(const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Float>&, const Vector3&, Containers::MutableBitArrayView)
+with the @ref MeshletBounds::coneApex, @ref MeshletBounds::coneAxis and
+@ref MeshletBounds::coneCutoff members of @p bounds.
+*/
+MAGNUM_MESHTOOLS_EXPORT void cullMeshletConesInto(const Containers::StridedArrayView1D<const MeshletBounds>& bounds, const Vector3& cameraPosition, Containers::MutableBitArrayView culled);
+
+}}
+
+#endif
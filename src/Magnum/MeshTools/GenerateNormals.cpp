@@ -30,9 +30,19 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 
+#ifdef CORRADE_TARGET_AVX
+#include <immintrin.h>
+#elif defined(CORRADE_TARGET_SSE2)
+#include <emmintrin.h>
+#elif defined(CORRADE_TARGET_NEON) && !defined(CORRADE_TARGET_32BIT)
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace MeshTools {
 
 void generateFlatNormalsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
@@ -55,15 +65,220 @@ Containers::Array<Vector3> generateFlatNormals(const Containers::StridedArrayVie
 
 namespace {
 
-#if defined(CORRADE_TARGET_MSVC) && !defined(CORRADE_MSVC_COMPATIBILITY) && _MSC_VER >= 1920 && _MSC_VER < 1930
-/* When using /permissive- with MSVC2019, using namespace inside the function
-   below FOR SOME REASON gets lost when instantiating the template. That's
-   stupid but what can we do -- the only way to work around that is to move it
-   outside the function. */
-using namespace Math::Literals;
+/* Triangles are processed in blocks of this size. Positions of each block are
+   first gathered into a SoA layout, which then allows the compiler to
+   vectorize the cross product and edge calculation, as there are no gathers
+   or branches in the loop anymore. */
+constexpr std::size_t TriangleBlockSize = 256;
+
+struct TriangleBlock {
+    /* [vertex][component][triangle] */
+    Float positions[3][3][TriangleBlockSize];
+    /* Squared edge lengths and dot products of edges adjacent to the first
+       and second vertex */
+    Float lengthSquared10[TriangleBlockSize];
+    Float lengthSquared20[TriangleBlockSize];
+    Float lengthSquared21[TriangleBlockSize];
+    Float dot0[TriangleBlockSize];
+    Float dot1[TriangleBlockSize];
+};
+
+/* The inner angle calculation is done with SIMD on AVX, SSE2 and 64-bit NEON
+   targets, where std::acos() is replaced with a polynomial approximation
+   from Abramowitz & Stegun, formula 4.4.46. For any input in [-1, 1] it's at
+   most 5e-7 radians off, which is about as far as a float std::acos() is
+   from an exact result. The square roots and divisions are IEEE-exact in all
+   cases so the cosines are the same as in the scalar variant. */
+#if defined(CORRADE_TARGET_AVX) || defined(CORRADE_TARGET_SSE2) || (defined(CORRADE_TARGET_NEON) && !defined(CORRADE_TARGET_32BIT))
+constexpr Float AcosCoefficients[]{
+    -0.0012624911f, 0.0066700901f, -0.0170881256f, 0.0308918810f,
+    -0.0501743046f, 0.0889789874f, -0.2145988016f, 1.5707963050f
+};
+#endif
+
+#ifdef CORRADE_TARGET_AVX
+constexpr std::size_t AngleLaneCount = 8;
+
+__m256 acosAvx(const __m256 x) {
+    const __m256 absX = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    __m256 polynomial = _mm256_set1_ps(AcosCoefficients[0]);
+    for(std::size_t i = 1; i != Containers::arraySize(AcosCoefficients); ++i)
+        polynomial = _mm256_add_ps(_mm256_mul_ps(polynomial, absX), _mm256_set1_ps(AcosCoefficients[i]));
+    const __m256 result = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), absX)), polynomial);
+    /* acos(-x) = pi - acos(x) */
+    return _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(Constants::pi()), result), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+}
+
+/* Calculates the inner angles for AngleLaneCount triangles starting at `i`,
+   putting them into `out` as [vertex][triangle] */
+void anglesAvx(const TriangleBlock& block, const std::size_t i, Float(&out)[3][AngleLaneCount]) {
+    const __m256 length10 = _mm256_sqrt_ps(_mm256_loadu_ps(block.lengthSquared10 + i));
+    const __m256 cos0 = _mm256_div_ps(_mm256_loadu_ps(block.dot0 + i), _mm256_mul_ps(length10, _mm256_sqrt_ps(_mm256_loadu_ps(block.lengthSquared20 + i))));
+    const __m256 cos1 = _mm256_div_ps(_mm256_loadu_ps(block.dot1 + i), _mm256_mul_ps(length10, _mm256_sqrt_ps(_mm256_loadu_ps(block.lengthSquared21 + i))));
+    const __m256 valid = _mm256_cmp_ps(cos0, cos1, _CMP_ORD_Q);
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 angle0 = _mm256_and_ps(valid, acosAvx(_mm256_min_ps(_mm256_max_ps(cos0, minusOne), one)));
+    const __m256 angle1 = _mm256_and_ps(valid, acosAvx(_mm256_min_ps(_mm256_max_ps(cos1, minusOne), one)));
+    _mm256_storeu_ps(out[0], angle0);
+    _mm256_storeu_ps(out[1], angle1);
+    _mm256_storeu_ps(out[2], _mm256_and_ps(valid, _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(Constants::pi()), angle0), angle1)));
+}
+#elif defined(CORRADE_TARGET_SSE2)
+constexpr std::size_t AngleLaneCount = 4;
+
+__m128 acosSse2(const __m128 x) {
+    const __m128 absX = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    __m128 polynomial = _mm_set1_ps(AcosCoefficients[0]);
+    for(std::size_t i = 1; i != Containers::arraySize(AcosCoefficients); ++i)
+        polynomial = _mm_add_ps(_mm_mul_ps(polynomial, absX), _mm_set1_ps(AcosCoefficients[i]));
+    const __m128 result = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), absX)), polynomial);
+    /* acos(-x) = pi - acos(x), SSE2 has no blend instruction */
+    const __m128 negative = _mm_cmplt_ps(x, _mm_setzero_ps());
+    return _mm_or_ps(_mm_and_ps(negative, _mm_sub_ps(_mm_set1_ps(Constants::pi()), result)), _mm_andnot_ps(negative, result));
+}
+
+/* Calculates the inner angles for AngleLaneCount triangles starting at `i`,
+   putting them into `out` as [vertex][triangle] */
+void anglesSse2(const TriangleBlock& block, const std::size_t i, Float(&out)[3][AngleLaneCount]) {
+    const __m128 length10 = _mm_sqrt_ps(_mm_loadu_ps(block.lengthSquared10 + i));
+    const __m128 cos0 = _mm_div_ps(_mm_loadu_ps(block.dot0 + i), _mm_mul_ps(length10, _mm_sqrt_ps(_mm_loadu_ps(block.lengthSquared20 + i))));
+    const __m128 cos1 = _mm_div_ps(_mm_loadu_ps(block.dot1 + i), _mm_mul_ps(length10, _mm_sqrt_ps(_mm_loadu_ps(block.lengthSquared21 + i))));
+    const __m128 valid = _mm_cmpord_ps(cos0, cos1);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 angle0 = _mm_and_ps(valid, acosSse2(_mm_min_ps(_mm_max_ps(cos0, minusOne), one)));
+    const __m128 angle1 = _mm_and_ps(valid, acosSse2(_mm_min_ps(_mm_max_ps(cos1, minusOne), one)));
+    _mm_storeu_ps(out[0], angle0);
+    _mm_storeu_ps(out[1], angle1);
+    _mm_storeu_ps(out[2], _mm_and_ps(valid, _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(Constants::pi()), angle0), angle1)));
+}
+#elif defined(CORRADE_TARGET_NEON) && !defined(CORRADE_TARGET_32BIT)
+constexpr std::size_t AngleLaneCount = 4;
+
+float32x4_t acosNeon(const float32x4_t x) {
+    const float32x4_t absX = vabsq_f32(x);
+    float32x4_t polynomial = vdupq_n_f32(AcosCoefficients[0]);
+    for(std::size_t i = 1; i != Containers::arraySize(AcosCoefficients); ++i)
+        polynomial = vaddq_f32(vmulq_f32(polynomial, absX), vdupq_n_f32(AcosCoefficients[i]));
+    const float32x4_t result = vmulq_f32(vsqrtq_f32(vsubq_f32(vdupq_n_f32(1.0f), absX)), polynomial);
+    /* acos(-x) = pi - acos(x) */
+    return vbslq_f32(vcltq_f32(x, vdupq_n_f32(0.0f)), vsubq_f32(vdupq_n_f32(Constants::pi()), result), result);
+}
+
+/* Calculates the inner angles for AngleLaneCount triangles starting at `i`,
+   putting them into `out` as [vertex][triangle] */
+void anglesNeon(const TriangleBlock& block, const std::size_t i, Float(&out)[3][AngleLaneCount]) {
+    const float32x4_t length10 = vsqrtq_f32(vld1q_f32(block.lengthSquared10 + i));
+    const float32x4_t cos0 = vdivq_f32(vld1q_f32(block.dot0 + i), vmulq_f32(length10, vsqrtq_f32(vld1q_f32(block.lengthSquared20 + i))));
+    const float32x4_t cos1 = vdivq_f32(vld1q_f32(block.dot1 + i), vmulq_f32(length10, vsqrtq_f32(vld1q_f32(block.lengthSquared21 + i))));
+    /* A NaN isn't equal to itself */
+    const uint32x4_t valid = vandq_u32(vceqq_f32(cos0, cos0), vceqq_f32(cos1, cos1));
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t angle0 = vreinterpretq_f32_u32(vandq_u32(valid, vreinterpretq_u32_f32(acosNeon(vminq_f32(vmaxq_f32(cos0, minusOne), one)))));
+    const float32x4_t angle1 = vreinterpretq_f32_u32(vandq_u32(valid, vreinterpretq_u32_f32(acosNeon(vminq_f32(vmaxq_f32(cos1, minusOne), one)))));
+    vst1q_f32(out[0], angle0);
+    vst1q_f32(out[1], angle1);
+    vst1q_f32(out[2], vreinterpretq_f32_u32(vandq_u32(valid, vreinterpretq_u32_f32(vsubq_f32(vsubq_f32(vdupq_n_f32(Constants::pi()), angle0), angle1)))));
+}
 #endif
 
-template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+/* Calculates cross products of the first `count` triangles in the block into
+   `crosses` and interior angles at each corner into `angles` */
+void crossAnglesForBlock(TriangleBlock& block, const std::size_t count, Vector3* const crosses, Float* const angles) {
+    const Float* const x0 = block.positions[0][0];
+    const Float* const y0 = block.positions[0][1];
+    const Float* const z0 = block.positions[0][2];
+    const Float* const x1 = block.positions[1][0];
+    const Float* const y1 = block.positions[1][1];
+    const Float* const z1 = block.positions[1][2];
+    const Float* const x2 = block.positions[2][0];
+    const Float* const y2 = block.positions[2][1];
+    const Float* const z2 = block.positions[2][2];
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float e10x = x1[i] - x0[i];
+        const Float e10y = y1[i] - y0[i];
+        const Float e10z = z1[i] - z0[i];
+        const Float e20x = x2[i] - x0[i];
+        const Float e20y = y2[i] - y0[i];
+        const Float e20z = z2[i] - z0[i];
+        const Float e21x = x2[i] - x1[i];
+        const Float e21y = y2[i] - y1[i];
+        const Float e21z = z2[i] - z1[i];
+
+        /* Cross product, the same as Math::cross(v2 - v1, v0 - v1) */
+        crosses[i] = {e21z*e10y - e21y*e10z,
+                      e21x*e10z - e21z*e10x,
+                      e21y*e10x - e21x*e10y};
+
+        block.lengthSquared10[i] = e10x*e10x + e10y*e10y + e10z*e10z;
+        block.lengthSquared20[i] = e20x*e20x + e20y*e20y + e20z*e20z;
+        block.lengthSquared21[i] = e21x*e21x + e21y*e21y + e21z*e21z;
+        block.dot0[i] = e10x*e20x + e10y*e20y + e10z*e20z;
+        block.dot1[i] = -e10x*e21x - e10y*e21y - e10z*e21z;
+    }
+
+    /* Inner angle at each vertex of the triangle. The last one can be
+       calculated as a remainder to 180°. Separate from the above to not have
+       the std::sqrt() and std::acos() calls prevent vectorization of the
+       rest. */
+    #if defined(CORRADE_TARGET_AVX) || defined(CORRADE_TARGET_SSE2) || (defined(CORRADE_TARGET_NEON) && !defined(CORRADE_TARGET_32BIT))
+    /* Zero-fill the remaining lanes of the last group, which makes the
+       cosines NaN and so the angles zero, and then process all triangles in
+       the block the same way. TriangleBlockSize is a multiple of the lane
+       count so this never goes past the block. */
+    const std::size_t paddedCount = (count + AngleLaneCount - 1)/AngleLaneCount*AngleLaneCount;
+    for(std::size_t i = count; i != paddedCount; ++i) {
+        block.lengthSquared10[i] = block.lengthSquared20[i] =
+            block.lengthSquared21[i] = block.dot0[i] = block.dot1[i] = 0.0f;
+    }
+    for(std::size_t i = 0; i != paddedCount; i += AngleLaneCount) {
+        Float out[3][AngleLaneCount];
+        #ifdef CORRADE_TARGET_AVX
+        anglesAvx(block, i, out);
+        #elif defined(CORRADE_TARGET_SSE2)
+        anglesSse2(block, i, out);
+        #else
+        anglesNeon(block, i, out);
+        #endif
+        for(std::size_t j = 0, jEnd = Math::min(AngleLaneCount, count - i); j != jEnd; ++j) {
+            angles[(i + j)*3 + 0] = out[0][j];
+            angles[(i + j)*3 + 1] = out[1][j];
+            angles[(i + j)*3 + 2] = out[2][j];
+        }
+    }
+    #else
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float length10 = std::sqrt(block.lengthSquared10[i]);
+        const Float cos0 = block.dot0[i]/(length10*std::sqrt(block.lengthSquared20[i]));
+        const Float cos1 = block.dot1[i]/(length10*std::sqrt(block.lengthSquared21[i]));
+
+        /* If any of the edges is zero, the cosine is a NaN. This happens also
+           when any of the original positions is NaN. If that's the case, the
+           triangle contributes with a zero total angle, effectively getting
+           ignored for normal calculation. As the edge v10 contributes to both
+           cosines and v20 and v21 to one of them, it's enough to check the
+           two. */
+        const bool valid = cos0 == cos0 && cos1 == cos1;
+        const Float angle0 = std::acos(Math::clamp(cos0, -1.0f, 1.0f));
+        const Float angle1 = std::acos(Math::clamp(cos1, -1.0f, 1.0f));
+        angles[i*3 + 0] = valid ? angle0 : 0.0f;
+        angles[i*3 + 1] = valid ? angle1 : 0.0f;
+        angles[i*3 + 2] = valid ? Constants::pi() - angle0 - angle1 : 0.0f;
+    }
+    #endif
+}
+
+/* Cross products and angles are calculated in tasks of BlocksPerTask blocks,
+   normals in tasks of VerticesPerTask vertices. Each triangle and each vertex
+   is handled by exactly one task, in the same order as in a serial loop, so
+   the output doesn't depend on the executor. */
+constexpr std::size_t BlocksPerTask = 16;
+constexpr std::size_t VerticesPerTask = 16384;
+
+template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor) {
     CORRADE_ASSERT(indices.size() % 3 == 0,
         "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
     CORRADE_ASSERT(normals.size() == positions.size(),
@@ -84,7 +299,7 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
 
     /* Turn that into a running offset array:
        triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
-       triangleOffset[i] is offset into an triangle ID array for vertex i */
+       triangleOffset[i] is offset into a corner ID array for vertex i */
     Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
     triangleOffset[0] = 0;
     for(std::size_t i = 0; i != triangleCount.size(); ++i)
@@ -92,101 +307,78 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
 
     CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
 
-    /* Gather triangle IDs for every vertex. For vertex i,
-       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
-       contains IDs of triangles that contain it. */
-    Containers::Array<T> triangleIds{NoInit, indices.size()};
+    /* Gather triangle corner IDs for every vertex. For vertex i,
+       cornerIds[triangleOffset[i]] until cornerIds[triangleOffset[i + 1]]
+       contains IDs of triangle corners that reference it, corner ID divided
+       by 3 is then the triangle ID. Compared to storing just triangle IDs
+       this doesn't need to search for the vertex in the triangle later. */
+    Containers::Array<UnsignedInt> cornerIds{NoInit, indices.size()};
     for(std::size_t i = 0; i != indices.size(); ++i) {
-        const T triangleId = i/3;
         const T vertexId = indices[i];
 
-        /* How many triangle IDs is still left to be written, which also means
+        /* How many corner IDs is still left to be written, which also means
            the offset where we put the ID. Decrement that for the next run. */
-        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
-        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
+        const std::size_t cornerIdsLeftForVertex = triangleCount[vertexId]--;
+        cornerIds[triangleOffset[vertexId + 1] - cornerIdsLeftForVertex] = UnsignedInt(i);
     }
 
     /* Now, triangleCount should be all zeros, we don't need it anymore and the
        underlying `normals` array is ready to get filled with real output. */
 
-    /* Precalculate cross product and interior angles of each face --- the loop
-       below would otherwise calculate it for every vertex, which is at least
-       3x as much work */
-    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
-        const Vector3 v0 = positions[indices[i*3 + 0]];
-        const Vector3 v1 = positions[indices[i*3 + 1]];
-        const Vector3 v2 = positions[indices[i*3 + 2]];
-
-        /* Cross product */
-        crossAngles[i].first() = Math::cross(v2 - v1, v0 - v1);
-
-        /* If any of the vectors is zero, the normalization would result in a
-           NaN and the angle calculation will assert. This happens also when
-           any of the original positions is NaN. If that's the case, skip the
-           rest. Given triangle will then contribute with a zero total angle,
-           effectively getting ignored for normal calculation.
-
-           If, however, an angle
-           */
-        const Vector3 v10n = (v1 - v0).normalized();
-        const Vector3 v20n = (v2 - v0).normalized();
-        const Vector3 v21n = (v2 - v1).normalized();
-        if(Math::isNan(v10n) || Math::isNan(v20n) || Math::isNan(v21n)) {
-            crossAngles[i].second() = Math::Vector3<Rad>{Math::ZeroInit};
-            continue;
+    /* Precalculate cross product of each face and interior angle of each
+       corner --- the loop below would otherwise calculate it for every
+       vertex, which is at least 3x as much work */
+    Containers::Array<Vector3> crosses{NoInit, indices.size()/3};
+    Containers::Array<Float> angles{NoInit, indices.size()};
+    constexpr std::size_t TrianglesPerTask = BlocksPerTask*TriangleBlockSize;
+    executor((crosses.size() + TrianglesPerTask - 1)/TrianglesPerTask, [&](const std::size_t task) {
+        /* Allocated on heap as it's over 10 kB */
+        Containers::Array<TriangleBlock> blockStorage{NoInit, 1};
+        TriangleBlock& block = blockStorage[0];
+        const std::size_t end = Math::min((task + 1)*TrianglesPerTask, crosses.size());
+        for(std::size_t offset = task*TrianglesPerTask; offset < end; offset += TriangleBlockSize) {
+            const std::size_t count = Math::min(TriangleBlockSize, end - offset);
+            for(std::size_t i = 0; i != count; ++i) {
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const Vector3& position = positions[indices[(offset + i)*3 + j]];
+                    block.positions[j][0][i] = position.x();
+                    block.positions[j][1][i] = position.y();
+                    block.positions[j][2][i] = position.z();
+                }
+            }
+
+            crossAnglesForBlock(block, count, crosses.data() + offset, angles.data() + offset*3);
         }
-
-        /* Inner angle at each vertex of the triangle. The last one can be
-           calculated as a remainder to 180°. */
-        /* This using namespace doesn't work with MSVC2019 with /permissive-
-           (it gets lost when instantiating?!), so it's duplicated above */
-        using namespace Math::Literals;
-        crossAngles[i].second()[0] = Math::angle(v10n, v20n);
-        crossAngles[i].second()[1] = Math::angle(-v10n, v21n);
-        crossAngles[i].second()[2] = Rad(180.0_degf)
-            - crossAngles[i].second()[0] - crossAngles[i].second()[1];
-    }
+    });
 
     /* For every vertex v, calculate normals from all faces it belongs to and
-       average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
-        /* normals are an external memory, ensure we accumulate from zero */
-        normals[v] = Vector3{Math::ZeroInit};
-
-        /* Go through all triangles sharing this vertex */
-        for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
-            const T v0i = indices[baseIndex + 0];
-            const T v1i = indices[baseIndex + 1];
-            const T v2i = indices[baseIndex + 2];
-
-            /* Cross product is a vector in direction of the normal with length
-               equal to size of the parallelogram */
-            const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
-
-            /* Angle between two sides of the triangle that share vertex `v`.
-               The shared vertex can be one of the three. */
-            Rad angle;
-            if(v == v0i) angle = crossAngle.second()[0];
-            else if(v == v1i) angle = crossAngle.second()[1];
-            else if(v == v2i) angle = crossAngle.second()[2];
-            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-
-            /* The normal is cross.normalized(), we need to multiply it it by
-               surface area which is cross.length()/2. Since normalization is
-               division by length, multiplying it by length again will be a
-               no-op. Then, since all normals are divided by 2, it doesn't
-               change their ratio for the final normalization so we can omit
-               that as well. Finally we need to weight by the angle, and in
-               that case only the ratio is important as well, so it doesn't
-               matter if degrees or radians. */
-            normals[v] += crossAngle.first()*Float(angle);
+       average them. Each vertex is independent of the others. */
+    executor((positions.size() + VerticesPerTask - 1)/VerticesPerTask, [&](const std::size_t task) {
+        for(std::size_t v = task*VerticesPerTask, end = Math::min(v + VerticesPerTask, positions.size()); v != end; ++v) {
+            Vector3 normal{Math::ZeroInit};
+
+            /* Go through all triangle corners referencing this vertex */
+            for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
+                const UnsignedInt cornerId = cornerIds[t];
+
+                /* The cross product is a vector in direction of the normal
+                   with length equal to size of the parallelogram. The
+                   normal is cross.normalized(), we need to multiply it it by
+                   surface area which is cross.length()/2. Since
+                   normalization is division by length, multiplying it by
+                   length again will be a no-op. Then, since all normals are
+                   divided by 2, it doesn't change their ratio for the final
+                   normalization so we can omit that as well. Finally we
+                   need to weight by the angle between the two sides sharing
+                   vertex `v`, and in that case only the ratio is important
+                   as well, so it doesn't matter if degrees or radians. */
+                normal += crosses[cornerId/3]*angles[cornerId];
+            }
+
+            /* Normalize the accumulated direction */
+            normals[v] = normal.normalized();
         }
-
-        /* Normalize the accumulated direction */
-        normals[v] = normals[v].normalized();
-    }
+    });
 }
 
 }
@@ -194,25 +386,25 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
 /* If not done this way but with templates instead, C++ wouldn't be able to
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
-void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, executor);
 }
-void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, executor);
 }
-void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, executor);
 }
 
-void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateSmoothNormalsInto(): second index view dimension is not contiguous", );
     if(indices.size()[1] == 4)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, executor);
     else if(indices.size()[1] == 2)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, executor);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, executor);
     }
 }
 
@@ -30,6 +30,7 @@
  * @brief Function @ref Magnum::MeshTools::generateFlatNormals(), @ref Magnum::MeshTools::generateFlatNormalsInto(), @ref Magnum::MeshTools::generateSmoothNormals(), @ref Magnum::MeshTools::generateSmoothNormalsInto()
  */
 
+#include "Magnum/Executor.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
 
@@ -89,6 +90,16 @@ vertex; hard edges are preserved where adjacent triangles don't share vertices.
 Triangles with zero area or triangles containing invalid positions (NaNs) don't
 contribute to calculated vertex normals.
 
+If Magnum is compiled with @ref CORRADE_TARGET_AVX, @ref CORRADE_TARGET_SSE2
+or @ref CORRADE_TARGET_NEON on a 64-bit target, the angle weights are
+calculated for eight or four triangles at once, with @ref std::acos()
+replaced by a polynomial approximation. The angles are at most
+@cpp 5.0e-7f @ce radians off, which is comparable to the error of a
+single-precision @ref std::acos(), and the resulting normals differ from the
+scalar variant by at most @cpp 1.0e-6f @ce in each component. Only meshes
+where the weighted normals of adjacent triangles nearly cancel each other out
+can have the difference larger.
+
 Implementation is based on the article
 [Weighted Vertex Normals](http://www.bytehazard.com/articles/vertnorm.html) by
 Martijn Buijs.
@@ -125,13 +136,21 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const C
 @param[in] indices      Triangle face indices
 @param[in] positions    Triangle vertex positions
 @param[out] normals     Where to put the generated normals
+@param[in] executor     Executor to run the calculation with
 @m_since{2019,10}
 
 A variant of @ref generateSmoothNormals() that fills existing memory instead of
 allocating a new array. The @p normals array is expected to have the same size
 as @p positions. Note that even with the output array this function isn't fully
-allocation-free --- it still allocates three additional internal arrays for
-adjacent face calculation.
+allocation-free --- it still allocates additional internal arrays for adjacent
+face calculation and per-face cross products and angles, in total about
+@cpp 4*positions.size() + 12*indices.size() @ce bytes.
+
+With a non-serial @p executor, the per-triangle cross products and angles are
+calculated in tasks of 4096 triangles and the per-vertex normals in tasks of
+16384 vertices, each task additionally allocating about 10 kB of temporary
+storage. Finding the triangles adjacent to each vertex is done serially. The
+output is the same regardless of the executor.
 
 Useful when you need to interface for example with STL containers --- in that
 case @cpp #include @ce @ref Corrade/Containers/ArrayViewStl.h to get implicit
@@ -141,19 +160,19 @@ conversions:
 
 @see @ref generateFlatNormalsInto()
 */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor = {});
 
 /**
  * @overload
  * @m_since{2019,10}
  */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor = {});
 
 /**
  * @overload
  * @m_since{2019,10}
  */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor = {});
 
 /**
 @brief Generate smooth normals into an existing array using a type-erased index array
@@ -162,10 +181,10 @@ MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::Strided
 Expects that @p normals has the same size as @p positions and that the second
 dimension of @p indices is contiguous and represents the actual 1/2/4-byte
 index type. Based on its size then calls one of the
-@ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&)
+@ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, const Executor&)
 etc. overloads.
 */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor = {});
 
 }}
 
@@ -0,0 +1,303 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateTangents.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Filter.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Normalizes the vector if it's not zero, keeps it zero otherwise. Same as
+   what MikkTSpace does in its VNotZero() + Normalize() combo. */
+inline Vector3 normalizedOrZero(const Vector3& vector) {
+    const Float lengthSquared = vector.dot();
+    return lengthSquared > 0.0f ? vector/std::sqrt(lengthSquared) : vector;
+}
+
+/* Projects a vector onto a plane given by a normalized normal */
+inline Vector3 projected(const Vector3& vector, const Vector3& normal) {
+    return vector - normal*Math::dot(normal, vector);
+}
+
+/* Adds contribution of a single triangle to those of its vertices that are in
+   the [vertexBegin, vertexEnd) range in `tangents`, which are assumed to be
+   zero-initialized. The triangle tangent is projected onto the normal of each
+   vertex and weighted by the angle of the vertex corner, the handedness is
+   accumulated into the fourth component, weighted by the angle as well. */
+inline void accumulateTriangle(const UnsignedInt (&triangle)[3], const UnsignedInt vertexBegin, const UnsignedInt vertexEnd, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents) {
+    const Vector3 p0 = positions[triangle[0]];
+    const Vector3 p1 = positions[triangle[1]];
+    const Vector3 p2 = positions[triangle[2]];
+    const Vector2 t21 = textureCoordinates[triangle[1]] - textureCoordinates[triangle[0]];
+    const Vector2 t31 = textureCoordinates[triangle[2]] - textureCoordinates[triangle[0]];
+
+    /* Signed area of the triangle in texture space, times two. If it's zero,
+       the tangent direction is undefined and the triangle doesn't
+       contribute. This also catches NaNs. */
+    const Float signedArea = Math::cross(t21, t31);
+    if(!(signedArea > 0.0f || signedArea < 0.0f)) return;
+
+    /* Direction of the U axis in object space, with the 1/signedArea factor
+       omitted as the vector gets normalized anyway. Only its sign is
+       important, which is the same as the orientation. */
+    const Float orientation = signedArea > 0.0f ? 1.0f : -1.0f;
+    const Vector3 faceTangent = normalizedOrZero((p1 - p0)*t31.y() - (p2 - p0)*t21.y())*orientation;
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        const UnsignedInt vertex = triangle[i];
+        if(vertex < vertexBegin || vertex >= vertexEnd) continue;
+
+        const Vector3 normal = normals[vertex];
+        const Vector3 position = positions[vertex];
+
+        /* Angle at the corner, calculated from edges projected onto the
+           vertex normal plane. A zero edge results in a zero vector and thus
+           a 90° angle, which is again consistent with MikkTSpace. */
+        const Vector3 edge1 = normalizedOrZero(projected(positions[triangle[(i + 1) % 3]] - position, normal));
+        const Vector3 edge2 = normalizedOrZero(projected(positions[triangle[(i + 2) % 3]] - position, normal));
+        const Float angle = std::acos(Math::clamp(Math::dot(edge1, edge2), -1.0f, 1.0f));
+
+        tangents[vertex] += Vector4{normalizedOrZero(projected(faceTangent, normal))*angle, orientation*angle};
+    }
+}
+
+/* Normalizes the accumulated tangents in the [begin, end) range and turns the
+   accumulated orientation into a handedness sign */
+void finalizeTangents(const std::size_t begin, const std::size_t end, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents) {
+    for(std::size_t i = begin; i != end; ++i) {
+        Vector4& tangent = tangents[i];
+        const Float lengthSquared = tangent.xyz().dot();
+
+        /* If nothing contributed to this vertex, or the contributions
+           cancelled out, pick an arbitrary direction perpendicular to the
+           normal so the tangent frame is still valid. Start from the X axis
+           unless the normal is close to it. */
+        if(!(lengthSquared > 0.0f)) {
+            const Vector3& normal = normals[i];
+            tangent.xyz() = normalizedOrZero(projected(
+                Math::abs(normal.x()) < 0.9f ? Vector3::xAxis() : Vector3::yAxis(), normal));
+        } else tangent.xyz() /= std::sqrt(lengthSquared);
+
+        tangent.w() = tangent.w() < 0.0f ? -1.0f : 1.0f;
+    }
+}
+
+/* With a non-serial executor, an indexed mesh is split into at most
+   MaxTaskCount ranges of at least MinVerticesPerTask vertices. Each task goes
+   through all triangles and accumulates only into vertices in its range, so
+   the tasks don't need any synchronization or extra memory, and every vertex
+   gets the contributions in the same order as in the serial case. A
+   non-indexed mesh is split into ranges of MinVerticesPerTask vertices
+   directly, as no vertices are shared. */
+constexpr std::size_t MaxTaskCount = 16;
+constexpr std::size_t MinVerticesPerTask = 16384;
+
+template<class T> void generateTangentsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateTangentsInto(): index count not divisible by 3, got" << indices.size(), );
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoordinates.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): expected" << positions.size() << "normals and texture coordinates but got" << normals.size() << "and" << textureCoordinates.size(), );
+    CORRADE_ASSERT(tangents.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): bad output size, expected" << positions.size() << "but got" << tangents.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(std::size_t(indices[i]) < positions.size(),
+            "MeshTools::generateTangentsInto(): index" << indices[i] << "out of range for" << positions.size() << "elements", );
+    #endif
+
+    const std::size_t taskCount = executor.isSerial() ? 1 :
+        Math::max(std::size_t{1}, Math::min(MaxTaskCount, positions.size()/MinVerticesPerTask));
+    const std::size_t verticesPerTask = (positions.size() + taskCount - 1)/taskCount;
+    executor(taskCount, [&](const std::size_t task) {
+        const std::size_t begin = Math::min(task*verticesPerTask, positions.size());
+        const std::size_t end = Math::min(begin + verticesPerTask, positions.size());
+
+        /* The output is used as the accumulator, ensure it starts from zero */
+        for(std::size_t i = begin; i != end; ++i) tangents[i] = {};
+
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            const UnsignedInt triangle[]{indices[i + 0], indices[i + 1], indices[i + 2]};
+            accumulateTriangle(triangle, begin, end, positions, normals, textureCoordinates, tangents);
+        }
+
+        finalizeTangents(begin, end, normals, tangents);
+    });
+}
+
+}
+
+/* If not done this way but with templates instead, C++ wouldn't be able to
+   figure out on its own which overload to use when indices are not already a
+   strided arrray view */
+void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor) {
+    generateTangentsIntoImplementation(indices, positions, normals, textureCoordinates, tangents, executor);
+}
+void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor) {
+    generateTangentsIntoImplementation(indices, positions, normals, textureCoordinates, tangents, executor);
+}
+void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor) {
+    generateTangentsIntoImplementation(indices, positions, normals, textureCoordinates, tangents, executor);
+}
+
+void generateTangentsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTangentsInto(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return generateTangentsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, textureCoordinates, tangents, executor);
+    else if(indices.size()[1] == 2)
+        return generateTangentsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, textureCoordinates, tangents, executor);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateTangentsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return generateTangentsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, textureCoordinates, tangents, executor);
+    }
+}
+
+void generateTangentsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor) {
+    CORRADE_ASSERT(positions.size() % 3 == 0,
+        "MeshTools::generateTangentsInto(): position count not divisible by 3, got" << positions.size(), );
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoordinates.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): expected" << positions.size() << "normals and texture coordinates but got" << normals.size() << "and" << textureCoordinates.size(), );
+    CORRADE_ASSERT(tangents.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): bad output size, expected" << positions.size() << "but got" << tangents.size(), );
+
+    /* Each vertex belongs to exactly one triangle, so the ranges only need to
+       be a multiple of 3 to not split any triangle */
+    constexpr std::size_t VerticesPerTask = MinVerticesPerTask/3*3;
+    executor((positions.size() + VerticesPerTask - 1)/VerticesPerTask, [&](const std::size_t task) {
+        const UnsignedInt begin = task*VerticesPerTask;
+        const UnsignedInt end = Math::min(begin + VerticesPerTask, positions.size());
+
+        for(UnsignedInt i = begin; i != end; ++i) tangents[i] = {};
+
+        for(UnsignedInt i = begin; i != end; i += 3) {
+            const UnsignedInt triangle[]{i + 0, i + 1, i + 2};
+            accumulateTriangle(triangle, begin, end, positions, normals, textureCoordinates, tangents);
+        }
+
+        finalizeTangents(begin, end, normals, tangents);
+    });
+}
+
+namespace {
+
+template<class T> inline Containers::Array<Vector4> generateTangentsImplementation(const T& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates) {
+    Containers::Array<Vector4> out{NoInit, positions.size()};
+    generateTangentsInto(indices, positions, normals, textureCoordinates, out);
+    return out;
+}
+
+}
+
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates);
+}
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates);
+}
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates);
+}
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates);
+}
+
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates) {
+    Containers::Array<Vector4> out{NoInit, positions.size()};
+    generateTangentsInto(positions, normals, textureCoordinates, out);
+    return out;
+}
+
+Trade::MeshData generateTangents(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateTangents(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateTangents(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    const Trade::MeshAttribute requiredAttributes[]{
+        Trade::MeshAttribute::Position,
+        Trade::MeshAttribute::Normal,
+        Trade::MeshAttribute::TextureCoordinates
+    };
+    for(const Trade::MeshAttribute attribute: requiredAttributes) {
+        const Containers::Optional<UnsignedInt> id = mesh.findAttributeId(attribute);
+        CORRADE_ASSERT(id,
+            "MeshTools::generateTangents(): the mesh has no" << attribute,
+            (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(mesh.attributeFormat(*id)),
+            "MeshTools::generateTangents():" << attribute << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(mesh.attributeFormat(*id)),
+            (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    }
+    #endif
+
+    /* Drop the existing tangents and bitangents, if any, and interleave a
+       new tangent attribute in */
+    const Trade::MeshAttributeData tangentAttribute{Trade::MeshAttribute::Tangent, VertexFormat::Vector4, nullptr};
+    Trade::MeshData out = interleave(
+        filterExceptAttributes(mesh, {Trade::MeshAttribute::Tangent, Trade::MeshAttribute::Bitangent}),
+        {tangentAttribute});
+
+    /* Use the attributes directly if they're already in the format the
+       calculation needs, and convert them to a temporary array only
+       otherwise, so the common case doesn't allocate anything apart from the
+       output mesh */
+    Containers::Array<Vector3> positionStorage;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    if(mesh.attributeFormat(Trade::MeshAttribute::Position) == VertexFormat::Vector3)
+        positions = mesh.attribute<Vector3>(Trade::MeshAttribute::Position);
+    else positions = positionStorage = mesh.positions3DAsArray();
+    Containers::Array<Vector3> normalStorage;
+    Containers::StridedArrayView1D<const Vector3> normals;
+    if(mesh.attributeFormat(Trade::MeshAttribute::Normal) == VertexFormat::Vector3)
+        normals = mesh.attribute<Vector3>(Trade::MeshAttribute::Normal);
+    else normals = normalStorage = mesh.normalsAsArray();
+    Containers::Array<Vector2> textureCoordinateStorage;
+    Containers::StridedArrayView1D<const Vector2> textureCoordinates;
+    if(mesh.attributeFormat(Trade::MeshAttribute::TextureCoordinates) == VertexFormat::Vector2)
+        textureCoordinates = mesh.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates);
+    else textureCoordinates = textureCoordinateStorage = mesh.textureCoordinates2DAsArray();
+
+    const Containers::StridedArrayView1D<Vector4> tangents = out.mutableAttribute<Vector4>(Trade::MeshAttribute::Tangent);
+    if(mesh.isIndexed())
+        generateTangentsInto(mesh.indices(), positions, normals, textureCoordinates, tangents);
+    else
+        generateTangentsInto(positions, normals, textureCoordinates, tangents);
+
+    return out;
+}
+
+}}
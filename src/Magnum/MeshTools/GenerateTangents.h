@@ -0,0 +1,206 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents(), @ref Magnum::MeshTools::generateTangentsInto()
+ * @m_since_latest
+ */
+
+#include "Magnum/Executor.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate tangents for an indexed mesh
+@param indices              Triangle face indices
+@param positions            Triangle vertex positions
+@param normals              Per-vertex normals
+@param textureCoordinates   Per-vertex texture coordinates
+@return Per-vertex tangents, with the fourth component being the bitangent
+    handedness
+@m_since_latest
+
+For each triangle calculates a direction of the tangent from the texture
+coordinate derivatives, then for each vertex projects the tangents of all
+triangles that share it onto the plane given by the vertex normal and averages
+them, weighted by the angle at given vertex. Faces with zero texture coordinate
+area don't contribute to the result.
+
+The fourth component of the output is @cpp 1.0f @ce or @cpp -1.0f @ce,
+depending on whether the texture coordinate mapping preserves orientation. In
+the common convention, which is also what glTF and
+@ref Shaders::PhongGL::Flag::NormalTexture expect, the bitangent is then
+calculated as @cpp Math::cross(normal, tangent.xyz())*tangent.w() @ce.
+
+The calculation follows [MikkTSpace](http://www.mikktspace.com/) and gives
+the same results for meshes where all triangles sharing a vertex have the same
+texture coordinate orientation. Compared to MikkTSpace the vertices aren't
+split if the orientation differs, because the output is expected to have the
+same size as the input --- instead, the orientation that contributes with a
+larger total angle is used. Vertices to which no face contributes get an
+arbitrary vector perpendicular to the normal.
+
+Expects that the index count is divisible by 3, all indices are in range for
+@p positions and that @p normals and @p textureCoordinates have the same size
+as @p positions. The @p normals are expected to be normalized.
+@see @ref generateTangentsInto(), @ref generateSmoothNormals()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates);
+
+/**
+@brief Generate tangents for an indexed mesh using a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates);
+
+/**
+@brief Generate tangents for a non-indexed mesh
+@param positions            Triangle vertex positions
+@param normals              Per-vertex normals
+@param textureCoordinates   Per-vertex texture coordinates
+@return Per-vertex tangents, with the fourth component being the bitangent
+    handedness
+@m_since_latest
+
+Like @ref generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&),
+but with each three consecutive vertices forming a triangle. As no vertices
+are shared, each vertex gets the tangent of its triangle projected onto the
+vertex normal. Expects that the position count is divisible by 3 and that
+@p normals and @p textureCoordinates have the same size as @p positions.
+@see @ref generateTangentsInto(const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&, const Containers::StridedArrayView1D<Vector4>&, const Executor&)
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates);
+
+/**
+@brief Generate tangents for an indexed mesh into an existing array
+@param[in]  indices             Triangle face indices
+@param[in]  positions           Triangle vertex positions
+@param[in]  normals             Per-vertex normals
+@param[in]  textureCoordinates  Per-vertex texture coordinates
+@param[out] tangents            Where to put the generated tangents
+@param[in]  executor            Executor to run the calculation with
+@m_since_latest
+
+A variant of @ref generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&)
+that fills existing memory instead of allocating a new array. The @p tangents
+array is expected to have the same size as @p positions. The output array is
+used for accumulating the intermediate results, so unlike
+@ref generateSmoothNormalsInto() this function doesn't allocate.
+
+With a non-serial @p executor, the vertices are split into up to 16 ranges of
+at least 16384 vertices. Each task goes through all triangles but calculates
+and accumulates the contributions only for vertices in its range, so the work
+still doesn't need any temporary memory, at the cost of every task reading
+the whole index array. The output is the same regardless of the executor.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor = {});
+
+/**
+@brief Generate tangents for an indexed mesh into an existing array using a type-erased index array
+@m_since_latest
+
+Expects that @p tangents has the same size as @p positions and that the
+second dimension of @p indices is contiguous and represents the actual 1/2/4-byte
+index type. Based on its size then calls one of the
+@ref generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&, const Containers::StridedArrayView1D<Vector4>&, const Executor&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor = {});
+
+/**
+@brief Generate tangents for a non-indexed mesh into an existing array
+@param[in]  positions           Triangle vertex positions
+@param[in]  normals             Per-vertex normals
+@param[in]  textureCoordinates  Per-vertex texture coordinates
+@param[out] tangents            Where to put the generated tangents
+@param[in]  executor            Executor to run the calculation with
+@m_since_latest
+
+A variant of @ref generateTangents(const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&)
+that fills existing memory instead of allocating a new array. The @p tangents
+array is expected to have the same size as @p positions. Doesn't allocate.
+
+With a non-serial @p executor, the triangles are processed in tasks of 5461
+triangles. The output is the same regardless of the executor.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const Executor& executor = {});
+
+/**
+@brief Generate tangents for a mesh
+@m_since_latest
+
+Expects that the mesh is a @ref MeshPrimitive::Triangles, has a
+@ref Trade::MeshAttribute::Position, @ref Trade::MeshAttribute::Normal and
+@ref Trade::MeshAttribute::TextureCoordinates, none of them in an
+implementation-specific format, and if it's indexed, the index type isn't
+implementation-specific either. Calls @ref generateTangentsInto() with the
+first attribute of each and returns a copy of the mesh with a
+@ref Trade::MeshAttribute::Tangent in @ref VertexFormat::Vector4 added. Any
+existing @ref Trade::MeshAttribute::Tangent and
+@ref Trade::MeshAttribute::Bitangent attributes are removed, as the bitangent
+can be calculated from the normal, tangent and its handedness. The output is
+interleaved with @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&)
+and the index buffer, if any, is preserved.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData generateTangents(const Trade::MeshData& mesh);
+
+}}
+
+#endif
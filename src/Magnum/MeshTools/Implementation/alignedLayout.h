@@ -0,0 +1,71 @@
+#ifndef Magnum_MeshTools_Implementation_alignedLayout_h
+#define Magnum_MeshTools_Implementation_alignedLayout_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+/* Common helper used by quantize() and convertAttributes().
+
+   Puts explicit padding between the attributes so each is aligned to the size
+   of its component type, and at the end so the vertex stride is a multiple of
+   four bytes, as Vulkan and Metal require. The result is meant to be passed to
+   interleave() without InterleaveFlag::PreserveInterleavedAttributes.
+   Attributes in an implementation-specific format are passed through as-is
+   without affecting the padding, as their size isn't known, and interleave()
+   then fails on them. */
+inline Containers::Array<Trade::MeshAttributeData> alignedLayout(const Containers::ArrayView<const Trade::MeshAttributeData> attributes) {
+    Containers::Array<Trade::MeshAttributeData> layout;
+    arrayReserve(layout, 2*attributes.size() + 1);
+    std::size_t offset = 0;
+    for(const Trade::MeshAttributeData& attribute: attributes) {
+        if(isVertexFormatImplementationSpecific(attribute.format())) {
+            arrayAppend(layout, attribute);
+            continue;
+        }
+
+        const std::size_t alignment = vertexFormatSize(vertexFormatComponentFormat(attribute.format()));
+        if(const std::size_t padding = (alignment - offset % alignment) % alignment) {
+            arrayAppend(layout, InPlaceInit, Int(padding));
+            offset += padding;
+        }
+        arrayAppend(layout, attribute);
+        offset += vertexFormatSize(attribute.format())*Math::max(attribute.arraySize(), UnsignedShort{1});
+    }
+    if(const std::size_t padding = (4 - offset % 4) % 4)
+        arrayAppend(layout, InPlaceInit, Int(padding));
+
+    return layout;
+}
+
+}}}
+
+#endif
@@ -45,6 +45,40 @@ inline std::size_t attributeSize(const Trade::MeshData& mesh, UnsignedInt i) {
 inline std::size_t attributeSize(const Trade::MeshAttributeData& mesh) {
     return vertexFormatSize(mesh.format())*Math::max(mesh.arraySize(), UnsignedShort{1});
 }
+
+struct AttributeCopy {
+    Containers::StridedArrayView2D<const char> source;
+    Containers::StridedArrayView2D<char> destination;
+};
+
+/* Size of a block of the interleaved output that's filled with all attributes
+   before continuing to the next one. Should fit into L1 together with the
+   corresponding parts of the source attributes. */
+constexpr std::size_t InterleaveBlockSize = 8192;
+
+/* With a non-serial executor, the blocks are copied in tasks of this many
+   blocks. The blocks don't overlap so the tasks are independent. */
+constexpr std::size_t InterleaveBlocksPerTask = 64;
+
+/* Copies the attributes in blocks of vertices across all attributes at once.
+   Copying one attribute at a time would go through the whole output for every
+   attribute, and with large meshes each cache line of it gets evicted and
+   loaded again several times before it's fully written. */
+void copyAttributesBlocked(const Containers::ArrayView<const AttributeCopy> copies, const std::size_t vertexCount, const std::size_t vertexStride, const Executor& executor) {
+    const std::size_t blockVertexCount = Math::max(InterleaveBlockSize/Math::max(vertexStride, std::size_t{1}), std::size_t{1});
+    const std::size_t taskVertexCount = blockVertexCount*InterleaveBlocksPerTask;
+    executor((vertexCount + taskVertexCount - 1)/taskVertexCount, [&](const std::size_t task) {
+        const std::size_t end = Math::min((task + 1)*taskVertexCount, vertexCount);
+        for(std::size_t begin = task*taskVertexCount; begin < end; begin += blockVertexCount) {
+            const std::size_t size = Math::min(blockVertexCount, end - begin);
+            for(const AttributeCopy& copy: copies)
+                Utility::copy(
+                    copy.source.sliceSize({begin, 0}, {size, copy.source.size()[1]}),
+                    copy.destination.sliceSize({begin, 0}, {size, copy.destination.size()[1]}));
+        }
+    });
+}
+
 Containers::Optional<Containers::StridedArrayView2D<const char>> interleavedDataInternal(const Trade::MeshData& mesh) {
     /* There is no attributes, return a zero-sized view to indicate a success */
     if(!mesh.attributeCount())
@@ -277,7 +311,7 @@ Trade::MeshData interleavedLayout(const Trade::MeshData& mesh, const UnsignedInt
     return interleavedLayout(mesh, vertexCount, Containers::arrayView(extra), flags);
 }
 
-Trade::MeshData interleave(Trade::MeshData&& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> extra, const InterleaveFlags flags) {
+Trade::MeshData interleave(Trade::MeshData&& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> extra, const InterleaveFlags flags, const Executor& executor) {
     /* Transfer the indices unchanged, in case the mesh is indexed */
     Containers::Array<char> indexData;
     Trade::MeshIndexData indices;
@@ -353,9 +387,12 @@ Trade::MeshData interleave(Trade::MeshData&& mesh, const Containers::ArrayView<c
             return Trade::MeshData{MeshPrimitive::Points, 0};
         #endif
 
-        /* Copy existing attributes to new locations */
+        /* Gather the existing attributes and their new locations, the copy
+           is then done for all attributes at once below */
+        Containers::Array<AttributeCopy> copies{ValueInit, mesh.attributeCount() + extra.size()};
+        std::size_t copyCount = 0;
         for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
-            Utility::copy(mesh.attribute(i), layout.mutableAttribute(i));
+            copies[copyCount++] = {mesh.attribute(i), layout.mutableAttribute(i)};
 
         /* Mix in the extra attributes */
         UnsignedInt attributeIndex = mesh.attributeCount();
@@ -375,14 +412,17 @@ Trade::MeshData interleave(Trade::MeshData&& mesh, const Containers::ArrayView<c
                 CORRADE_ASSERT(extra[i].data().size() == vertexCount,
                     "MeshTools::interleave(): extra attribute" << i << "expected to have" << vertexCount << "items but got" << extra[i].data().size(),
                     (Trade::MeshData{MeshPrimitive::Triangles, 0}));
-                const Containers::StridedArrayView2D<const char> attribute =
-                    Containers::arrayCast<2, const char>(extra[i].data(), vertexFormatSize(extra[i].format()));
-                Utility::copy(attribute, layout.mutableAttribute(attributeIndex));
+                copies[copyCount++] = {
+                    Containers::arrayCast<2, const char>(extra[i].data(), vertexFormatSize(extra[i].format())),
+                    layout.mutableAttribute(attributeIndex)};
             }
 
             ++attributeIndex;
         }
 
+        copyAttributesBlocked(copies.prefix(copyCount), vertexCount,
+            layout.attributeCount() ? layout.attributeStride(0) : 0, executor);
+
         /* Release the data from the layout to pack them into the output */
         vertexData = layout.releaseVertexData();
         attributeData = layout.releaseAttributeData();
@@ -392,18 +432,18 @@ Trade::MeshData interleave(Trade::MeshData&& mesh, const Containers::ArrayView<c
         Utility::move(vertexData), Utility::move(attributeData), vertexCount};
 }
 
-Trade::MeshData interleave(Trade::MeshData&& mesh, const std::initializer_list<Trade::MeshAttributeData> extra, const InterleaveFlags flags) {
-    return interleave(Utility::move(mesh), Containers::arrayView(extra), flags);
+Trade::MeshData interleave(Trade::MeshData&& mesh, const std::initializer_list<Trade::MeshAttributeData> extra, const InterleaveFlags flags, const Executor& executor) {
+    return interleave(Utility::move(mesh), Containers::arrayView(extra), flags, executor);
 }
 
-Trade::MeshData interleave(const Trade::MeshData& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> extra, const InterleaveFlags flags) {
+Trade::MeshData interleave(const Trade::MeshData& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> extra, const InterleaveFlags flags, const Executor& executor) {
     /* Pass through to the && overload, which then decides whether to reuse
        anything based on the DataFlags */
-    return interleave(reference(mesh), extra, flags);
+    return interleave(reference(mesh), extra, flags, executor);
 }
 
-Trade::MeshData interleave(const Trade::MeshData& mesh, const std::initializer_list<Trade::MeshAttributeData> extra, const InterleaveFlags flags) {
-    return interleave(Utility::move(mesh), Containers::arrayView(extra), flags);
+Trade::MeshData interleave(const Trade::MeshData& mesh, const std::initializer_list<Trade::MeshAttributeData> extra, const InterleaveFlags flags, const Executor& executor) {
+    return interleave(Utility::move(mesh), Containers::arrayView(extra), flags, executor);
 }
 
 Trade::MeshData interleave(const MeshPrimitive primitive, const Trade::MeshIndexData& indices, const Containers::ArrayView<const Trade::MeshAttributeData> attributes) {
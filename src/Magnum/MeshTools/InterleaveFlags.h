@@ -43,7 +43,7 @@ namespace Magnum { namespace MeshTools {
 
 @see @ref InterleaveFlags,
     @ref interleavedLayout(const Trade::MeshData&, UnsignedInt, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags),
-    @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags),
+    @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&),
     @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags)
 */
 enum class InterleaveFlag: UnsignedInt {
@@ -61,7 +61,7 @@ enum class InterleaveFlag: UnsignedInt {
     PreserveInterleavedAttributes = 1 << 0,
 
     /**
-     * If a mesh is indexed, makes @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags)
+     * If a mesh is indexed, makes @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&)
      * preserve the index buffer even if it's not tightly packed. Since such
      * data layouts are not commonly supported by GPU APIs, this flag is not
      * set by default.
@@ -85,7 +85,7 @@ enum class InterleaveFlag: UnsignedInt {
 @m_since_latest
 
 @see @ref interleavedLayout(const Trade::MeshData&, UnsignedInt, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags),
-    @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags),
+    @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&),
     @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags)
 */
 typedef Containers::EnumSet<InterleaveFlag> InterleaveFlags;
@@ -0,0 +1,224 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeOverdraw.h"
+
+#include <algorithm> /* std::stable_sort() */
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3, got" << indices.size(), );
+    CORRADE_ASSERT(cacheSize,
+        "MeshTools::optimizeOverdrawInPlace(): cache size can't be zero", );
+    CORRADE_ASSERT(threshold >= 1.0f,
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1, got" << threshold, );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(std::size_t(indices[i]) < positions.size(),
+            "MeshTools::optimizeOverdrawInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* FIFO cache simulation, same as in simulateVertexCache(). Advancing the
+       time by more than the cache size makes all vertices not present,
+       effectively resetting the cache. */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, positions.size()};
+    UnsignedInt time = cacheSize + 1;
+    const auto resetCache = [&]() {
+        time += cacheSize + 1;
+    };
+    const auto triangleMissCount = [&](const std::size_t triangle) {
+        UnsignedInt missCount = 0;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[triangle*3 + i];
+            if(time - timestamp[v] > cacheSize) {
+                timestamp[v] = time++;
+                ++missCount;
+            }
+        }
+        return missCount;
+    };
+
+    /* Hard cluster boundaries are at triangles that miss the cache with all
+       three vertices, i.e. where the optimizer had to start from scratch */
+    Containers::Array<UnsignedInt> hardClusters;
+    for(std::size_t i = 0; i != triangleCount; ++i)
+        if(triangleMissCount(i) == 3 || i == 0)
+            arrayAppend(hardClusters, UnsignedInt(i));
+
+    /* Split each hard cluster further. Starting with a cold cache, a new
+       cluster is started as soon as the ACMR of the triangles so far gets
+       below the threshold relative to ACMR of the whole hard cluster. */
+    Containers::Array<UnsignedInt> clusters;
+    for(std::size_t i = 0; i != hardClusters.size(); ++i) {
+        const std::size_t begin = hardClusters[i];
+        const std::size_t end = i + 1 == hardClusters.size() ?
+            triangleCount : hardClusters[i + 1];
+
+        resetCache();
+        UnsignedInt clusterMissCount = 0;
+        for(std::size_t j = begin; j != end; ++j)
+            clusterMissCount += triangleMissCount(j);
+        const Float clusterThreshold = threshold*Float(clusterMissCount)/Float(end - begin);
+
+        arrayAppend(clusters, UnsignedInt(begin));
+        resetCache();
+        UnsignedInt missCount = 0;
+        UnsignedInt count = 0;
+        for(std::size_t j = begin; j != end; ++j) {
+            missCount += triangleMissCount(j);
+            ++count;
+            if(j + 1 != end && Float(missCount)/Float(count) <= clusterThreshold) {
+                arrayAppend(clusters, UnsignedInt(j + 1));
+                resetCache();
+                missCount = 0;
+                count = 0;
+            }
+        }
+    }
+
+    /* Centroid of the whole mesh */
+    Vector3 meshCentroid;
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        meshCentroid += positions[indices[i]];
+    meshCentroid /= Float(indices.size());
+
+    /* Sort key for each cluster is the distance of its area-weighted
+       centroid from the mesh centroid along the average cluster normal.
+       Clusters facing outwards have the largest value and get drawn first
+       as they're most likely to occlude the rest. */
+    Containers::Array<Containers::Pair<Float, UnsignedInt>> sortKeys{NoInit, clusters.size()};
+    for(std::size_t i = 0; i != clusters.size(); ++i) {
+        const std::size_t begin = clusters[i];
+        const std::size_t end = i + 1 == clusters.size() ?
+            triangleCount : clusters[i + 1];
+
+        Vector3 centroid;
+        Vector3 normal;
+        Float area = 0.0f;
+        for(std::size_t j = begin; j != end; ++j) {
+            const Vector3& a = positions[indices[j*3 + 0]];
+            const Vector3& b = positions[indices[j*3 + 1]];
+            const Vector3& c = positions[indices[j*3 + 2]];
+            const Vector3 n = Math::cross(b - a, c - a);
+            const Float triangleArea = n.length();
+            centroid += (a + b + c)*(triangleArea/3.0f);
+            normal += n;
+            area += triangleArea;
+        }
+
+        /* Clusters made of only degenerate triangles or with the normals
+           cancelling out don't have any preferred position */
+        const Float normalLength = normal.length();
+        const Float key = area == 0.0f || normalLength == 0.0f ? 0.0f :
+            Math::dot(centroid/area - meshCentroid, normal/normalLength);
+        sortKeys[i] = {key, UnsignedInt(i)};
+    }
+
+    std::stable_sort(sortKeys.begin(), sortKeys.end(), [](const Containers::Pair<Float, UnsignedInt>& a, const Containers::Pair<Float, UnsignedInt>& b) {
+        return a.first() > b.first();
+    });
+
+    /* Emit the clusters in the sorted order */
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    std::size_t outputOffset = 0;
+    for(const Containers::Pair<Float, UnsignedInt>& key: sortKeys) {
+        const std::size_t begin = clusters[key.second()];
+        const std::size_t end = key.second() + 1 == clusters.size() ?
+            triangleCount : clusters[key.second() + 1];
+        const std::size_t size = (end - begin)*3;
+        Utility::copy(indices.sliceSize(begin*3, size), Containers::stridedArrayView(outputIndices).sliceSize(outputOffset, size));
+        outputOffset += size;
+    }
+    CORRADE_INTERNAL_ASSERT(outputOffset == indices.size());
+
+    Utility::copy(outputIndices, indices);
+}
+
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeOverdrawInPlace(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return optimizeOverdrawInPlace(Containers::arrayCast<1, UnsignedInt>(indices), positions, cacheSize, threshold);
+    else if(indices.size()[1] == 2)
+        return optimizeOverdrawInPlace(Containers::arrayCast<1, UnsignedShort>(indices), positions, cacheSize, threshold);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeOverdrawInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeOverdrawInPlace(Containers::arrayCast<1, UnsignedByte>(indices), positions, cacheSize, threshold);
+    }
+}
+
+Trade::MeshData optimizeOverdraw(const Trade::MeshData& mesh, const UnsignedInt cacheSize, const Float threshold) {
+    return optimizeOverdraw(copy(mesh), cacheSize, threshold);
+}
+
+Trade::MeshData optimizeOverdraw(Trade::MeshData&& mesh, const UnsignedInt cacheSize, const Float threshold) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::optimizeOverdraw(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeOverdraw(): the mesh is not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeOverdraw(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::optimizeOverdraw(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    Trade::MeshData owned = copy(Utility::move(mesh));
+    optimizeOverdrawInPlace(owned.mutableIndices(), owned.positions3DAsArray(), cacheSize, threshold);
+    return owned;
+}
+
+}}
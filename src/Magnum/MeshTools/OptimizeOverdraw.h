@@ -0,0 +1,127 @@
+#ifndef Magnum_MeshTools_OptimizeOverdraw_h
+#define Magnum_MeshTools_OptimizeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeOverdrawInPlace(), @ref Magnum::MeshTools::optimizeOverdraw()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Reorder triangles to reduce overdraw in-place
+@param[in,out] indices  Triangle index array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    Maximum allowed ACMR increase ratio
+@m_since_latest
+
+Meant to be used on an index buffer already optimized with
+@ref optimizeVertexCacheInPlace() or @ref tipsifyInPlace(). Splits the index
+buffer into clusters at points where the vertex cache gets completely flushed,
+then further splits them at points where the ACMR of the cluster would be at
+most @p threshold times the ACMR of the original cluster, and finally sorts the
+clusters so the ones facing outwards from the mesh centroid are drawn first,
+occluding the ones further inside. Algorithm used: *Pedro V. Sander, Diego
+Nehab, and Joshua Barczak --- Fast Triangle Reordering for Vertex Locality and
+Reduced Overdraw, SIGGRAPH 2007,
+https://gfx.cs.princeton.edu/pubs/Sander_2007_%3eTR/tipsy.pdf*.
+
+The @p threshold controls the tradeoff between the overdraw reduction and the
+vertex cache efficiency --- a value of @cpp 1.0f @ce keeps the clusters as
+large as possible, with the overall ACMR degrading only due to the cache being
+cold at cluster boundaries, while higher values result in smaller clusters that
+can be sorted more precisely. Use @ref simulateVertexCache() with the same
+@p cacheSize to check the effect.
+
+Winding of each triangle is preserved, only the order of triangles changes.
+Expects that @p indices size is divisible by @cpp 3 @ce, all indices are less
+than @p positions size, @p cacheSize is not zero and @p threshold is at least
+@cpp 1.0f @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt cacheSize, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt cacheSize, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt cacheSize, Float threshold = 1.05f);
+
+/**
+@brief Reorder triangles to reduce overdraw in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, Float)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt cacheSize, Float threshold = 1.05f);
+
+/**
+@brief Reorder mesh data triangles to reduce overdraw
+@m_since_latest
+
+Makes an owned copy of @p mesh using @ref copy(const Trade::MeshData&) and
+calls @ref optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, Float)
+on its index data, with positions taken from the first
+@ref Trade::MeshAttribute::Position attribute. The vertex data are left
+untouched. Expects that the mesh is indexed with
+@ref MeshPrimitive::Triangles, the index type is not implementation-specific
+and the mesh has a @ref Trade::MeshAttribute::Position attribute, which can
+be two- or three-dimensional.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref Trade::MeshData::positions3DAsArray()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeOverdraw(const Trade::MeshData& mesh, UnsignedInt cacheSize, Float threshold = 1.05f);
+
+/**
+@brief Reorder mesh data triangles to reduce overdraw
+@m_since_latest
+
+Compared to @ref optimizeOverdraw(const Trade::MeshData&, UnsignedInt, Float)
+this function uses @ref copy(Trade::MeshData&&), which means the index data
+are operated on directly and no copy is made if @p mesh owns its data.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeOverdraw(Trade::MeshData&& mesh, UnsignedInt cacheSize, Float threshold = 1.05f);
+
+}}
+
+#endif
@@ -0,0 +1,307 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexCache.h"
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Size of the LRU cache the vertex scoring is modeled after. It doesn't need
+   to match any actual hardware, the scoring just needs some notion of recency
+   and the paper found this to work well for FIFO caches of sizes anywhere
+   between 8 and 32. */
+constexpr UnsignedInt ScoringCacheSize = 32;
+
+/* Vertices with more live triangles than this get the score calculated
+   directly instead of taken from a table */
+constexpr UnsignedInt ValenceScoreTableSize = 32;
+
+template<class T> void optimizeVertexCacheInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3, got" << indices.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(UnsignedInt(indices[i]) < vertexCount,
+            "MeshTools::optimizeVertexCacheInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << vertexCount << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Score of a vertex depending on its position in the cache and on how many
+       triangles are still left to be emitted for it. The three most recently
+       used vertices get a fixed lower score so the triangle that was just
+       emitted isn't favored over its neighbors, the rest decays with the
+       position. Vertices with only few triangles left get a boost so they get
+       finished early and don't leave lonely triangles behind. */
+    Float cacheScores[ScoringCacheSize];
+    for(UnsignedInt i = 0; i != ScoringCacheSize; ++i)
+        cacheScores[i] = i < 3 ? 0.75f :
+            std::pow(1.0f - Float(i - 3)/Float(ScoringCacheSize - 3), 1.5f);
+    Float valenceScores[ValenceScoreTableSize];
+    valenceScores[0] = 0.0f;
+    for(UnsignedInt i = 1; i != ValenceScoreTableSize; ++i)
+        valenceScores[i] = 2.0f/std::sqrt(Float(i));
+    const auto vertexScore = [&](const Int cachePosition, const UnsignedInt liveTriangleCount) {
+        /* Vertices with no triangles left don't contribute to anything, the
+           value doesn't matter */
+        if(!liveTriangleCount) return 0.0f;
+        return (cachePosition == -1 ? 0.0f : cacheScores[cachePosition]) +
+            (liveTriangleCount < ValenceScoreTableSize ?
+                valenceScores[liveTriangleCount] :
+                2.0f/std::sqrt(Float(liveTriangleCount)));
+    };
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count.
+       Live triangles of vertex v are kept in the
+       [neighborOffset[v], neighborOffset[v] + liveTriangleCount[v]) range,
+       emitted triangles get swapped out of it. */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initial vertex and triangle scores, pick the best triangle to start
+       with */
+    Containers::Array<Float> vertexScores{NoInit, vertexCount};
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        vertexScores[i] = vertexScore(-1, liveTriangleCount[i]);
+    Containers::Array<Float> triangleScores{NoInit, triangleCount};
+    std::size_t bestTriangle = 0;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        triangleScores[i] =
+            vertexScores[indices[i*3 + 0]] +
+            vertexScores[indices[i*3 + 1]] +
+            vertexScores[indices[i*3 + 2]];
+        if(triangleScores[i] > triangleScores[bestTriangle])
+            bestTriangle = i;
+    }
+
+    /** @todo Have some bitset/staticbitset class for this */
+    Containers::Array<bool> emitted{triangleCount};
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+
+    /* Simulated LRU cache, with space for the three vertices that get pushed
+       to the front on every emitted triangle */
+    UnsignedInt cache[ScoringCacheSize + 3];
+    UnsignedInt newCache[ScoringCacheSize + 3];
+    std::size_t cacheCount = 0;
+
+    /* Cursor for finding a next triangle on a dead end */
+    std::size_t deadEndCursor = 0;
+
+    for(std::size_t out = 0; out != triangleCount; ++out) {
+        /* If no triangle adjacent to vertices in the cache is left, take the
+           next not yet emitted one in the original order */
+        if(bestTriangle == ~std::size_t{}) {
+            while(emitted[deadEndCursor]) ++deadEndCursor;
+            bestTriangle = deadEndCursor;
+        }
+
+        const std::size_t t = bestTriangle;
+        emitted[t] = true;
+
+        /* Emit the triangle and put its vertices to the front of the cache */
+        std::size_t newCacheCount = 0;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[t*3 + i];
+            outputIndices[out*3 + i] = T(v);
+
+            /* Remove the triangle from live triangles of the vertex by
+               swapping it with the last live one. For degenerate triangles
+               it's listed more than once, each occurrence gets removed by one
+               iteration. */
+            const UnsignedInt last = neighborOffset[v] + --liveTriangleCount[v];
+            for(UnsignedInt j = neighborOffset[v]; ; ++j) if(neighbors[j] == t) {
+                neighbors[j] = neighbors[last];
+                break;
+            }
+
+            bool present = false;
+            for(std::size_t j = 0; j != newCacheCount; ++j) if(newCache[j] == v) {
+                present = true;
+                break;
+            }
+            if(!present) newCache[newCacheCount++] = v;
+        }
+
+        /* Append the rest of the previous cache contents */
+        const std::size_t emittedVertexCount = newCacheCount;
+        for(std::size_t i = 0; i != cacheCount; ++i) {
+            const UnsignedInt v = cache[i];
+            bool present = false;
+            for(std::size_t j = 0; j != emittedVertexCount; ++j) if(newCache[j] == v) {
+                present = true;
+                break;
+            }
+            if(!present) newCache[newCacheCount++] = v;
+        }
+
+        /* Update scores of all vertices that changed position in the cache,
+           including the ones that fell out of it, and propagate the
+           difference to their live triangles */
+        for(std::size_t i = 0; i != newCacheCount; ++i) {
+            const UnsignedInt v = newCache[i];
+            const Float score = vertexScore(i < ScoringCacheSize ? Int(i) : -1, liveTriangleCount[v]);
+            const Float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+            for(UnsignedInt j = neighborOffset[v], jEnd = j + liveTriangleCount[v]; j != jEnd; ++j)
+                triangleScores[neighbors[j]] += delta;
+        }
+
+        /* Pick the next triangle among live triangles of vertices that stayed
+           in the cache. Not picking among all live triangles is what makes
+           the algorithm linear. */
+        cacheCount = Math::min(newCacheCount, std::size_t(ScoringCacheSize));
+        bestTriangle = ~std::size_t{};
+        Float bestScore = -1.0f;
+        for(std::size_t i = 0; i != cacheCount; ++i) {
+            const UnsignedInt v = newCache[i];
+            cache[i] = v;
+            for(UnsignedInt j = neighborOffset[v], jEnd = j + liveTriangleCount[v]; j != jEnd; ++j) {
+                if(triangleScores[neighbors[j]] > bestScore) {
+                    bestScore = triangleScores[neighbors[j]];
+                    bestTriangle = neighbors[j];
+                }
+            }
+        }
+    }
+
+    /* Copy the optimized index buffer back */
+    Utility::copy(outputIndices, indices);
+}
+
+template<class T> Containers::Pair<Float, Float> simulateVertexCacheImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simulateVertexCache(): index count not divisible by 3, got" << indices.size(), {});
+    CORRADE_ASSERT(cacheSize,
+        "MeshTools::simulateVertexCache(): cache size can't be zero", {});
+
+    if(indices.isEmpty()) return {0.0f, 0.0f};
+
+    /* Time at which each vertex entered the cache. A vertex is in a FIFO
+       cache if less than cacheSize other vertices entered it since, starting
+       the time at cacheSize + 1 makes all vertices initially not present,
+       same as in tipsifyInPlace(). A zero timestamp means the vertex wasn't
+       referenced yet. */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, vertexCount};
+    UnsignedInt time = cacheSize + 1;
+    UnsignedInt usedVertexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::simulateVertexCache(): index" << v << "out of range for" << vertexCount << "vertices", {});
+        if(time - timestamp[v] > cacheSize) {
+            if(!timestamp[v]) ++usedVertexCount;
+            timestamp[v] = time++;
+        }
+    }
+
+    const Float missCount = Float(time - cacheSize - 1);
+    return {missCount/Float(indices.size()/3), missCount/Float(usedVertexCount)};
+}
+
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return optimizeVertexCacheInPlace(Containers::arrayCast<1, UnsignedInt>(indices), vertexCount);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexCacheInPlace(Containers::arrayCast<1, UnsignedShort>(indices), vertexCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeVertexCacheInPlace(Containers::arrayCast<1, UnsignedByte>(indices), vertexCount);
+    }
+}
+
+Trade::MeshData optimizeVertexCache(const Trade::MeshData& mesh) {
+    return optimizeVertexCache(copy(mesh));
+}
+
+Trade::MeshData optimizeVertexCache(Trade::MeshData&& mesh) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::optimizeVertexCache(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeVertexCache(): the mesh is not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeVertexCache(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    Trade::MeshData owned = copy(Utility::move(mesh));
+    optimizeVertexCacheInPlace(owned.mutableIndices(), owned.vertexCount());
+    return owned;
+}
+
+Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    return simulateVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    return simulateVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    return simulateVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::simulateVertexCache(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return simulateVertexCache(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, cacheSize);
+    else if(indices.size()[1] == 2)
+        return simulateVertexCache(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, cacheSize);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::simulateVertexCache(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return simulateVertexCache(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, cacheSize);
+    }
+}
+
+}}
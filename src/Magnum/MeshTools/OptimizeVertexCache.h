@@ -0,0 +1,165 @@
+#ifndef Magnum_MeshTools_OptimizeVertexCache_h
+#define Magnum_MeshTools_OptimizeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCacheInPlace(), @ref Magnum::MeshTools::optimizeVertexCache(), @ref Magnum::MeshTools::simulateVertexCache()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize a triangle mesh for post-transform vertex cache in-place
+@param[in,out] indices  Triangle index array to operate on
+@param[in] vertexCount  Vertex count
+@m_since_latest
+
+Reorders triangles in @p indices to improve post-transform vertex cache
+utilization. Compared to @ref tipsifyInPlace(), which needs to be told the
+exact cache size and degrades quickly if the actual hardware cache is smaller,
+this function greedily picks triangles based on a score that takes into account
+how recently were their vertices used and how many triangles are still left
+to be emitted for each vertex, which gives good results across a wide range of
+cache sizes. The algorithm runs in time linear to the triangle count, it's
+based on *Tom Forsyth --- Linear-Speed Vertex Cache Optimisation, 2006,
+https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+
+Winding of each triangle is preserved, only the order of triangles changes.
+Expects that @p indices size is divisible by @cpp 3 @ce and all indices are
+less than @p vertexCount. Use @ref optimizeVertexFetchInPlace() afterwards to
+renumber the vertices to match the new triangle order, and
+@ref simulateVertexCache() to measure the effect. For fill-rate-bound
+scenarios, @ref optimizeOverdrawInPlace() can be used afterwards to reorder
+the triangles for less overdraw while keeping most of the vertex cache
+efficiency.
+@see @relativeref{Trade,MeshOptimizerSceneConverter}
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Optimize a triangle mesh for post-transform vertex cache in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Optimize mesh data for post-transform vertex cache
+@m_since_latest
+
+Makes an owned copy of @p mesh using @ref copy(const Trade::MeshData&) and
+calls @ref optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>&, UnsignedInt)
+on its index data. The vertex data are left untouched, pass the result to
+@ref optimizeVertexFetch() to make the vertex order match as well. Expects that
+the mesh is indexed with @ref MeshPrimitive::Triangles and the index type is
+not implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexCache(const Trade::MeshData& mesh);
+
+/**
+@brief Optimize mesh data for post-transform vertex cache
+@m_since_latest
+
+Compared to @ref optimizeVertexCache(const Trade::MeshData&) this function
+uses @ref copy(Trade::MeshData&&), which means the index data are operated on
+directly and no copy is made if @p mesh owns its data.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexCache(Trade::MeshData&& mesh);
+
+/**
+@brief Simulate a post-transform vertex cache
+@param indices      Triangle index array
+@param vertexCount  Vertex count
+@param cacheSize    Simulated cache size
+@return Average cache miss ratio (ACMR) and average transformed vertex ratio
+    (ATVR)
+@m_since_latest
+
+Runs @p indices through a FIFO cache of @p cacheSize entries, which is how
+most hardware post-transform caches behave. The ACMR is the count of cache
+misses divided by triangle count, ranging from @cpp 3.0f @ce in the worst case
+to about @cpp 0.5f @ce for an ideally ordered regular grid. The ATVR is the
+count of cache misses divided by the count of vertices actually referenced by
+@p indices, with @cpp 1.0f @ce being the optimum where each vertex is
+transformed exactly once. If @p indices are empty, returns zeros for both.
+
+Expects that @p indices size is divisible by @cpp 3 @ce, all indices are less
+than @p vertexCount and @p cacheSize is not zero.
+@see @ref optimizeVertexCacheInPlace(), @ref tipsifyInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+@brief Simulate a post-transform vertex cache on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref simulateVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> simulateVertexCache(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+}}
+
+#endif
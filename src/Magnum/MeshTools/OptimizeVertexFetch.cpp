@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexFetch.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount) {
+    /* New ID for each original vertex, ~0 for vertices not referenced yet */
+    Containers::Array<UnsignedInt> newIds{DirectInit, vertexCount, ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> mapping{NoInit, vertexCount};
+
+    /* Assign new IDs in order of first use. The new ID is never larger than
+       the original, so it always fits into the index type. */
+    UnsignedInt usedVertexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::optimizeVertexFetchInPlace(): index" << v << "out of range for" << vertexCount << "vertices", {});
+        if(newIds[v] == ~UnsignedInt{}) {
+            newIds[v] = usedVertexCount;
+            mapping[usedVertexCount++] = v;
+        }
+        indices[i] = T(newIds[v]);
+    }
+
+    /* Put the unreferenced vertices after, to make the mapping a complete
+       permutation */
+    UnsignedInt unusedVertexOffset = usedVertexCount;
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        if(newIds[i] == ~UnsignedInt{}) mapping[unusedVertexOffset++] = i;
+
+    return {Utility::move(mapping), usedVertexCount};
+}
+
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexCount);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexCount);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexCount);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return optimizeVertexFetchInPlace(Containers::arrayCast<1, UnsignedInt>(indices), vertexCount);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexFetchInPlace(Containers::arrayCast<1, UnsignedShort>(indices), vertexCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return optimizeVertexFetchInPlace(Containers::arrayCast<1, UnsignedByte>(indices), vertexCount);
+    }
+}
+
+Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeVertexFetch(): the mesh is not indexed",
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::optimizeVertexFetch(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+    }
+    #endif
+
+    /* Make an owned copy of the index data and renumber it */
+    const UnsignedInt indexSize = meshIndexTypeSize(mesh.indexType());
+    Containers::Array<char> indexData{NoInit, mesh.indexCount()*indexSize};
+    const Containers::StridedArrayView2D<char> indices{indexData, {mesh.indexCount(), indexSize}};
+    Utility::copy(mesh.indices(), indices);
+    const Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> mapping = optimizeVertexFetchInPlace(indices, mesh.vertexCount());
+
+    /* Gather the referenced vertices in the new order into a new layout */
+    const UnsignedInt vertexCount = UnsignedInt(mapping.second());
+    const Containers::StridedArrayView1D<const UnsignedInt> usedMapping = mapping.first().prefix(vertexCount);
+    Trade::MeshData out = interleavedLayout(mesh, vertexCount);
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        duplicateInto(usedMapping, mesh.attribute(i), out.mutableAttribute(i));
+
+    const Trade::MeshIndexData indexDataDescription{mesh.indexType(), indexData};
+    return Trade::MeshData{mesh.primitive(),
+        Utility::move(indexData), indexDataDescription,
+        out.releaseVertexData(), out.releaseAttributeData(), vertexCount};
+}
+
+}}
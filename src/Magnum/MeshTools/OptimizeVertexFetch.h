@@ -0,0 +1,119 @@
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetchInPlace(), @ref Magnum::MeshTools::optimizeVertexFetch()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Renumber vertices in order of first use in-place
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@return Mapping from new vertex IDs to the original ones and count of
+    vertices referenced by @p indices
+@m_since_latest
+
+Renumbers vertices referenced by @p indices so they're numbered in the order
+in which they're first referenced, which makes vertex data fetch during
+rendering access memory mostly sequentially. Useful especially after
+@ref optimizeVertexCacheInPlace() or @ref tipsifyInPlace(), which reorder
+triangles but don't touch the vertices. The returned mapping is a permutation
+of size @p vertexCount, with the first items being the referenced vertices in
+order of first use and the rest being the unreferenced vertices in their
+original order:
+
+@code{.cpp}
+// Original input, six vertices
+{4, 2, 5, 4, 5, 0}
+
+// After processing
+{0, 1, 2, 0, 2, 3}
+
+// Mapping from new to original vertex IDs and count of referenced vertices
+{{4, 2, 5, 0, 1, 3}, 4}
+@endcode
+
+Expects that all indices are less than @p vertexCount. Use
+@ref optimizeVertexFetch() to perform the operation including the vertex data
+permutation directly on a @ref Trade::MeshData instance.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Renumber vertices in order of first use in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Optimize mesh data for vertex fetch
+@m_since_latest
+
+Makes a copy of the index data, calls
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>&, UnsignedInt)
+on it and permutes all attributes according to the returned mapping. Vertices
+not referenced by the index buffer are dropped. The original index type is
+preserved, the resulting mesh is always interleaved and owned, if the input is
+already interleaved attribute offsets and paddings are preserved. Expects that
+the mesh is indexed, the index type is not implementation-specific and all
+attributes don't have an implementation-specific format.
+@see @ref optimizeVertexCache(),
+    @ref isMeshIndexTypeImplementationSpecific(),
+    @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh);
+
+}}
+
+#endif
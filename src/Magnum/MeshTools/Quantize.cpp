@@ -0,0 +1,216 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/MeshTools/Filter.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Implementation/alignedLayout.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Math::packInto() doesn't clamp, values outside of the representable range
+   would overflow, so clamp each component before packing */
+template<class T> void packClampedInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst, const Float min, const Float max) {
+    for(std::size_t i = 0; i != src.size()[0]; ++i)
+        for(std::size_t j = 0; j != src.size()[1]; ++j)
+            dst[i][j] = Math::pack<T>(Math::clamp(src[i][j], min, max));
+}
+
+/* The quantized attributes are all Vector2, Vector3 or Vector4, view them as
+   a 2D array of floats */
+Containers::StridedArrayView2D<const Float> floatComponents(const Trade::MeshData& mesh, const UnsignedInt id) {
+    const VertexFormat format = mesh.attributeFormat(id);
+    if(format == VertexFormat::Vector2)
+        return Containers::arrayCast<2, const Float>(mesh.attribute<Vector2>(id));
+    if(format == VertexFormat::Vector3)
+        return Containers::arrayCast<2, const Float>(mesh.attribute<Vector3>(id));
+    if(format == VertexFormat::Vector4)
+        return Containers::arrayCast<2, const Float>(mesh.attribute<Vector4>(id));
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Whether all values are in the [0, 1] range and can be thus stored in an
+   unsigned normalized format */
+bool isInUnitRange(const Containers::StridedArrayView2D<const Float>& src) {
+    for(Containers::StridedArrayView1D<const Float> component: src.transposed<0, 1>()) {
+        const Containers::Pair<Float, Float> minmax = Math::minmax(component);
+        if(minmax.first() < 0.0f || minmax.second() > 1.0f)
+            return false;
+    }
+    return true;
+}
+
+}
+
+Containers::Pair<Trade::MeshData, Matrix4> quantize(const Trade::MeshData& mesh, const QuantizeFlags flags) {
+    #ifndef CORRADE_NO_ASSERT
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::quantize(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Containers::Pair<Trade::MeshData, Matrix4>{Trade::MeshData{MeshPrimitive::Points, 0}, Matrix4{}}));
+    }
+    #endif
+
+    /* Positions get quantized only if all of them, including morph targets,
+       are 3D floats, as they all have to share the same dequantization
+       transformation */
+    bool quantizePositions = !(flags & QuantizeFlag::PreservePositions) &&
+        mesh.vertexCount() && mesh.hasAttribute(Trade::MeshAttribute::Position);
+    for(UnsignedInt i = 0; i != mesh.attributeCount() && quantizePositions; ++i)
+        if(mesh.attributeName(i) == Trade::MeshAttribute::Position && mesh.attributeFormat(i) != VertexFormat::Vector3)
+            quantizePositions = false;
+
+    /* Calculate a bounding range of all positions together. The components
+       where the range is zero are scaled by 1 instead of 0 to keep the
+       transformation invertible. */
+    Vector3 min{Constants::inf()};
+    Vector3 max{-Constants::inf()};
+    if(quantizePositions) for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        if(mesh.attributeName(i) != Trade::MeshAttribute::Position) continue;
+        const Containers::Pair<Vector3, Vector3> minmax = Math::minmax(mesh.attribute<Vector3>(i));
+        min = Math::min(min, minmax.first());
+        max = Math::max(max, minmax.second());
+    }
+    Vector3 size = max - min;
+    for(std::size_t i = 0; i != 3; ++i)
+        if(!(size[i] > 0.0f)) size[i] = 1.0f;
+
+    /* Copy original attributes to a mutable array and replace the ones that
+       get quantized with an empty placeholder that we'll pack the data into.
+       Not using Utility::copy() here as the view returned by attributeData()
+       might have offset-only attributes which interleave() doesn't want. */
+    const VertexFormat tangent3Format = flags & QuantizeFlag::ByteNormals ?
+        VertexFormat::Vector3bNormalized : VertexFormat::Vector3sNormalized;
+    const VertexFormat normalFormat = flags & QuantizeFlag::PerComponentNormals ? tangent3Format :
+        flags & QuantizeFlag::ByteNormals ?
+            VertexFormat::Vector2bNormalized : VertexFormat::Vector2sNormalized;
+    const VertexFormat tangent4Format = flags & QuantizeFlag::ByteNormals ?
+        VertexFormat::Vector4bNormalized : VertexFormat::Vector4sNormalized;
+    Containers::Array<Trade::MeshAttributeData> attributes{mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        attributes[i] = mesh.attributeData(i);
+        if(mesh.attributeArraySize(i)) continue;
+
+        const Trade::MeshAttribute name = mesh.attributeName(i);
+        const VertexFormat format = mesh.attributeFormat(i);
+        VertexFormat quantizedFormat{};
+        if(name == Trade::MeshAttribute::Position) {
+            if(quantizePositions)
+                quantizedFormat = VertexFormat::Vector3usNormalized;
+        } else if(name == Trade::MeshAttribute::Normal) {
+            if(format == VertexFormat::Vector3)
+                quantizedFormat = normalFormat;
+        } else if(name == Trade::MeshAttribute::Bitangent) {
+            if(format == VertexFormat::Vector3)
+                quantizedFormat = tangent3Format;
+        } else if(name == Trade::MeshAttribute::Tangent) {
+            if(format == VertexFormat::Vector3)
+                quantizedFormat = tangent3Format;
+            else if(format == VertexFormat::Vector4)
+                quantizedFormat = tangent4Format;
+        } else if(name == Trade::MeshAttribute::TextureCoordinates) {
+            if(format == VertexFormat::Vector2)
+                quantizedFormat = isInUnitRange(floatComponents(mesh, i)) ?
+                    VertexFormat::Vector2usNormalized : VertexFormat::Vector2h;
+        } else if(name == Trade::MeshAttribute::Color) {
+            if(format == VertexFormat::Vector3)
+                quantizedFormat = isInUnitRange(floatComponents(mesh, i)) ?
+                    VertexFormat::Vector3ubNormalized : VertexFormat::Vector3h;
+            else if(format == VertexFormat::Vector4)
+                quantizedFormat = isInUnitRange(floatComponents(mesh, i)) ?
+                    VertexFormat::Vector4ubNormalized : VertexFormat::Vector4h;
+        }
+
+        if(quantizedFormat != VertexFormat{})
+            attributes[i] = Trade::MeshAttributeData{name, quantizedFormat, nullptr, 0, mesh.attributeMorphTargetId(i)};
+    }
+
+    /* Create the output mesh with each attribute aligned to the size of its
+       component type and the stride to four bytes */
+    /** @todo isn't there some less silly way to take just the indices from the
+        mesh?! */
+    Trade::MeshData out = interleave(filterOnlyAttributes(mesh, Containers::ArrayView<const Trade::MeshAttribute>{}), Implementation::alignedLayout(attributes), {});
+
+    /* Pack the data into the placeholders */
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat quantizedFormat = out.attributeFormat(i);
+        if(mesh.attributeFormat(i) == quantizedFormat) continue;
+
+        const Containers::StridedArrayView2D<const Float> src = floatComponents(mesh, i);
+        if(quantizedFormat == VertexFormat::Vector3usNormalized) {
+            const Containers::StridedArrayView1D<const Vector3> positions = mesh.attribute<Vector3>(i);
+            const Containers::StridedArrayView1D<Vector3us> quantized = out.mutableAttribute<Vector3us>(i);
+            for(std::size_t j = 0; j != positions.size(); ++j)
+                quantized[j] = Math::pack<Vector3us>(Math::clamp((positions[j] - min)/size, 0.0f, 1.0f));
+        }
+        /* Normals are octahedral-encoded, which doesn't need clamping */
+        else if(quantizedFormat == VertexFormat::Vector2sNormalized)
+            Math::packOctahedralInto(src, Containers::arrayCast<2, Short>(out.mutableAttribute<Vector2s>(i)));
+        else if(quantizedFormat == VertexFormat::Vector2bNormalized)
+            Math::packOctahedralInto(src, Containers::arrayCast<2, Byte>(out.mutableAttribute<Vector2b>(i)));
+        else if(quantizedFormat == VertexFormat::Vector3sNormalized)
+            packClampedInto(src, Containers::arrayCast<2, Short>(out.mutableAttribute<Vector3s>(i)), -1.0f, 1.0f);
+        else if(quantizedFormat == VertexFormat::Vector4sNormalized)
+            packClampedInto(src, Containers::arrayCast<2, Short>(out.mutableAttribute<Vector4s>(i)), -1.0f, 1.0f);
+        else if(quantizedFormat == VertexFormat::Vector3bNormalized)
+            packClampedInto(src, Containers::arrayCast<2, Byte>(out.mutableAttribute<Vector3b>(i)), -1.0f, 1.0f);
+        else if(quantizedFormat == VertexFormat::Vector4bNormalized)
+            packClampedInto(src, Containers::arrayCast<2, Byte>(out.mutableAttribute<Vector4b>(i)), -1.0f, 1.0f);
+        /* The unit range was verified above, so no clamping needed for the
+           rest */
+        else if(quantizedFormat == VertexFormat::Vector2usNormalized)
+            Math::packInto(src, Containers::arrayCast<2, UnsignedShort>(out.mutableAttribute<Vector2us>(i)));
+        else if(quantizedFormat == VertexFormat::Vector3ubNormalized)
+            Math::packInto(src, Containers::arrayCast<2, UnsignedByte>(out.mutableAttribute<Vector3ub>(i)));
+        else if(quantizedFormat == VertexFormat::Vector4ubNormalized)
+            Math::packInto(src, Containers::arrayCast<2, UnsignedByte>(out.mutableAttribute<Vector4ub>(i)));
+        else if(quantizedFormat == VertexFormat::Vector2h)
+            Math::packHalfInto(src, Containers::arrayCast<2, UnsignedShort>(out.mutableAttribute<Vector2h>(i)));
+        else if(quantizedFormat == VertexFormat::Vector3h)
+            Math::packHalfInto(src, Containers::arrayCast<2, UnsignedShort>(out.mutableAttribute<Vector3h>(i)));
+        else if(quantizedFormat == VertexFormat::Vector4h)
+            Math::packHalfInto(src, Containers::arrayCast<2, UnsignedShort>(out.mutableAttribute<Vector4h>(i)));
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    return {Utility::move(out), quantizePositions ?
+        Matrix4::translation(min)*Matrix4::scaling(size) : Matrix4{}};
+}
+
+}}
@@ -0,0 +1,163 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantize(), enum @ref Magnum::MeshTools::QuantizeFlag, enum set @ref Magnum::MeshTools::QuantizeFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantization flag
+@m_since_latest
+
+@see @ref QuantizeFlags, @ref quantize()
+*/
+enum class QuantizeFlag: UnsignedInt {
+    /**
+     * Quantize normals to 8-bit @ref VertexFormat::Vector2bNormalized, or
+     * @relativeref{VertexFormat,Vector3bNormalized} with
+     * @ref QuantizeFlag::PerComponentNormals, and tangents and bitangents to
+     * @relativeref{VertexFormat,Vector3bNormalized} and
+     * @relativeref{VertexFormat,Vector4bNormalized} instead of 16-bit
+     * @relativeref{VertexFormat,Vector2sNormalized},
+     * @relativeref{VertexFormat,Vector3sNormalized} and
+     * @relativeref{VertexFormat,Vector4sNormalized}. Saves additional memory
+     * at the cost of a visible precision loss in specular highlights.
+     */
+    ByteNormals = 1 << 0,
+
+    /**
+     * Leave positions in their original format, returning an identity
+     * dequantization transformation. Useful in case the transformation can't
+     * be stored anywhere, such as when the mesh is saved without a scene.
+     */
+    PreservePositions = 1 << 1,
+
+    /**
+     * Quantize normals per component to
+     * @ref VertexFormat::Vector3sNormalized or
+     * @relativeref{VertexFormat,Vector3bNormalized} instead of
+     * octahedral-encoding them. Takes more memory, but unlike the octahedral
+     * representation it can be stored in file formats such as glTF.
+     */
+    PerComponentNormals = 1 << 2
+};
+
+/**
+@brief Quantization flags
+@m_since_latest
+
+@see @ref quantize()
+*/
+typedef Containers::EnumSet<QuantizeFlag> QuantizeFlags;
+
+CORRADE_ENUMSET_OPERATORS(QuantizeFlags)
+
+/**
+@brief Quantize mesh attributes to compact vertex formats
+@param mesh     Input mesh
+@param flags    Flags controlling the output formats
+@return The quantized mesh and a transformation that converts the quantized
+    positions back to the original space
+@m_since_latest
+
+Converts attributes in floating-point formats to smaller types, roughly halving
+the vertex data size for common meshes:
+
+-   @ref Trade::MeshAttribute::Position in @ref VertexFormat::Vector3 is
+    converted to @ref VertexFormat::Vector3usNormalized relative to a
+    @ref boundingRange() calculated from all position attributes, including
+    morph targets. The returned transformation is a translation to the range
+    minimum followed by a scaling to its size, and is meant to be applied as a
+    part of the object transformation. Components in which the range has a
+    zero size get scaled by @cpp 1.0f @ce. If there are no positions, the mesh
+    has no vertices, not all positions are in @ref VertexFormat::Vector3 or
+    @ref QuantizeFlag::PreservePositions is set, the positions are left
+    unchanged and the transformation is an identity.
+-   @ref Trade::MeshAttribute::Normal in @ref VertexFormat::Vector3 is
+    octahedral-encoded using @ref Math::packOctahedralInto() to
+    @relativeref{VertexFormat,Vector2sNormalized}, or to
+    @relativeref{VertexFormat,Vector2bNormalized} if
+    @ref QuantizeFlag::ByteNormals is set. The normals don't need to be
+    normalized, but are expected to be non-zero. Use
+    @ref Trade::MeshData::normalsAsArray() to decode them back. If
+    @ref QuantizeFlag::PerComponentNormals is set, they're converted to
+    @relativeref{VertexFormat,Vector3sNormalized} or
+    @relativeref{VertexFormat,Vector3bNormalized} the same way as
+    bitangents instead.
+-   @ref Trade::MeshAttribute::Bitangent in @ref VertexFormat::Vector3 and
+    @relativeref{Trade::MeshAttribute,Tangent} in
+    @relativeref{VertexFormat,Vector3} or @relativeref{VertexFormat,Vector4}
+    are converted to @relativeref{VertexFormat,Vector3sNormalized} and
+    @relativeref{VertexFormat,Vector4sNormalized}, or to the 8-bit variants if
+    @ref QuantizeFlag::ByteNormals is set. Values outside of the
+    @f$ [-1, 1] @f$ range are clamped.
+-   @ref Trade::MeshAttribute::TextureCoordinates in
+    @ref VertexFormat::Vector2 are converted to
+    @relativeref{VertexFormat,Vector2usNormalized} if all values are in the
+    @f$ [0, 1] @f$ range and to @relativeref{VertexFormat,Vector2h}
+    otherwise.
+-   @ref Trade::MeshAttribute::Color in @ref VertexFormat::Vector3 or
+    @relativeref{VertexFormat,Vector4} are converted to
+    @relativeref{VertexFormat,Vector3ubNormalized} or
+    @relativeref{VertexFormat,Vector4ubNormalized} if all values are in the
+    @f$ [0, 1] @f$ range and to @relativeref{VertexFormat,Vector3h} or
+    @relativeref{VertexFormat,Vector4h} otherwise.
+
+All other attributes, attributes in other formats and array attributes are
+passed through unchanged. The output is interleaved with
+@ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&)
+without @ref InterleaveFlag::PreserveInterleavedAttributes, with each
+attribute aligned to the size of its component type and the vertex stride
+rounded up to a multiple of four bytes, as required by Vulkan and Metal. The
+index buffer, if any, is preserved. Expects that the mesh doesn't contain any
+attributes in an implementation-specific format.
+
+Quantization is lossy, the positions get an error of up to
+@f$ \frac{1}{2} \cdot \frac{1}{65535} @f$ of the bounding range size and
+normals, tangents and bitangents an error of up to
+@f$ \frac{1}{2} \cdot \frac{1}{32767} @f$ in each component, or
+@f$ \frac{1}{2} \cdot \frac{1}{127} @f$ with @ref QuantizeFlag::ByteNormals.
+For octahedral-encoded normals the error applies to the octahedral
+representation, decoded normals are always normalized. The quantized tangents,
+bitangents and per-component normals are not exactly normalized.
+@see @ref transform3D(), @ref Math::pack(), @ref Math::packHalf()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Matrix4> quantize(const Trade::MeshData& mesh, QuantizeFlags flags = {});
+
+}}
+
+#endif
@@ -27,13 +27,10 @@
 #include "RemoveDuplicates.h"
 
 #include <cstring>
-#include <limits>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
@@ -45,27 +42,237 @@
 
 namespace Magnum { namespace MeshTools {
 
-struct ArrayEqual {
-    explicit ArrayEqual(std::size_t size): _size{size} {}
+namespace {
 
-    bool operator()(const void* a, const void* b) const {
-        return std::memcmp(a, b, _size) == 0;
+/* Word-wise hash of raw entry bytes, based on the MurmurHash64A mixing
+   function. Compared to Utility::MurmurHash2 it consumes the data eight bytes
+   at a time and doesn't go through a digest object, which matters as it's
+   called once for every item. The byte order doesn't matter as the hashes are
+   never stored or compared across platforms. */
+UnsignedLong hashEntry(const char* const data, const std::size_t size) {
+    constexpr UnsignedLong m = 0xc6a4a7935bd1e995ull;
+    UnsignedLong h = 0x9e3779b97f4a7c15ull ^ (size*m);
+
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        UnsignedLong k;
+        std::memcpy(&k, data + i, 8);
+        k *= m;
+        k ^= k >> 47;
+        k *= m;
+        h ^= k;
+        h *= m;
     }
 
-    private: std::size_t _size;
-};
+    /* Remaining bytes, if any, zero-extended to a whole word */
+    if(i != size) {
+        UnsignedLong k = 0;
+        std::memcpy(&k, data + i, size - i);
+        h ^= k;
+        h *= m;
+    }
 
-struct ArrayHash {
-    explicit ArrayHash(std::size_t size): _size{size} {}
+    h ^= h >> 47;
+    h *= m;
+    h ^= h >> 47;
+    return h;
+}
 
-    std::size_t operator()(const void* a) const {
-        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
+/* Hash of discretized grid cell coordinates for the fuzzy variant */
+std::size_t hashCell(const std::size_t* const cell, const std::size_t size) {
+    UnsignedLong h = 0x9e3779b97f4a7c15ull;
+    for(std::size_t i = 0; i != size; ++i) {
+        h ^= UnsignedLong(cell[i]);
+        h *= 0xc6a4a7935bd1e995ull;
+        h ^= h >> 47;
     }
+    return std::size_t(h ^ (h >> 32));
+}
+
+/* Flat open-addressing hash table with linear probing. Used instead of a
+   std::unordered_map to avoid a node allocation for every unique item and a
+   pointer chase on every probe. As the keys have a runtime size, they're not
+   stored in the table, only referenced by an index into a strided key array
+   that's passed to every insert() call. Each slot additionally contains the
+   upper half of the hash so most mismatches are rejected without comparing
+   the actual key data. */
+class DuplicateTable {
+    public:
+        /* The slot count is the smallest power of two that's at least 1.5x
+           larger than the max count of unique items, keeping the probe
+           sequences short even if all items are unique */
+        explicit DuplicateTable(const std::size_t capacity) {
+            std::size_t slotCount = 16;
+            while(slotCount < capacity + capacity/2) slotCount <<= 1;
+            _slots = Containers::Array<Slot>{NoInit, slotCount};
+            _mask = slotCount - 1;
+            clear();
+        }
+
+        std::size_t size() const { return _size; }
+
+        void clear() {
+            for(Slot& slot: _slots) slot.index = Empty;
+            _size = 0;
+        }
+
+        /* If an item equal to keys[index] is already present, returns the
+           index it was inserted with, otherwise inserts it and returns
+           `index`. Items that are already inserted are expected to stay at
+           the same location in `keys` and not be modified. */
+        UnsignedInt insert(const Containers::StridedArrayView2D<const char>& keys, const UnsignedInt index) {
+            return insert(keys, index, hashEntry(static_cast<const char*>(keys.data()) + std::ptrdiff_t(index)*keys.stride()[0], keys.size()[1]));
+        }
+
+        /* Same as above, but with a hash of keys[index] calculated
+           upfront */
+        UnsignedInt insert(const Containers::StridedArrayView2D<const char>& keys, const UnsignedInt index, const UnsignedLong hash) {
+            const char* const data = static_cast<const char*>(keys.data());
+            const std::ptrdiff_t stride = keys.stride()[0];
+            const std::size_t size = keys.size()[1];
+            const char* const key = data + std::ptrdiff_t(index)*stride;
+
+            const UnsignedInt hashHigh = UnsignedInt(hash >> 32);
+            for(std::size_t i = std::size_t(hash) & _mask; ; i = (i + 1) & _mask) {
+                Slot& slot = _slots[i];
+                if(slot.index == Empty) {
+                    slot.hashHigh = hashHigh;
+                    slot.index = index;
+                    ++_size;
+                    return index;
+                }
+
+                if(slot.hashHigh == hashHigh && std::memcmp(data + std::ptrdiff_t(slot.index)*stride, key, size) == 0)
+                    return slot.index;
+            }
+        }
+
+    private:
+        enum: UnsignedInt { Empty = ~UnsignedInt{} };
+
+        struct Slot {
+            UnsignedInt hashHigh;
+            UnsignedInt index;
+        };
 
-    private: std::size_t _size;
+        Containers::Array<Slot> _slots;
+        std::size_t _mask;
+        std::size_t _size;
 };
 
-std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+/* Once the table gets larger than what fits into the cache, nearly every
+   insert is a cache miss. Instead, for inputs of at least PartitionThreshold
+   items the data are first partitioned by upper bits of their hash into
+   partitions of PartitionSize items on average, and each partition is then
+   deduplicated with a small table that stays in the cache. Because equal items
+   have equal hashes, they always end up in the same partition. With a
+   non-serial executor the partitioned variant is used for any input with more
+   than PartitionSize items, as the partitions are what gets processed in
+   parallel. */
+constexpr std::size_t PartitionThreshold = 1 << 18;
+constexpr std::size_t PartitionSize = 1 << 13;
+
+/* Hashing and partitioning is done in chunks of at least ChunkSize items,
+   each chunk with its own per-partition counts. There's at most
+   MaxChunkCount chunks so the counts stay small compared to the data. Each
+   table used for deduplication handles PartitionsPerTask partitions in a
+   row, amortizing its allocation. The split depends only on the input size,
+   never on the executor. */
+constexpr std::size_t ChunkSize = 1 << 16;
+constexpr std::size_t MaxChunkCount = 256;
+constexpr std::size_t PartitionsPerTask = 16;
+
+/* Fills `indices` with an index of the first occurrence of each item in
+   `data`, returns the count of unique items. The items in each partition are
+   visited in their original order so the first occurrence is picked exactly
+   the same way as when going through a single table, making the output
+   identical. The partitions are fully independent of each other. */
+std::size_t removeDuplicatesPartitionedInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Executor& executor) {
+    const std::size_t dataSize = data.size()[0];
+    const char* const dataPointer = static_cast<const char*>(data.data());
+    const std::ptrdiff_t dataStride = data.stride()[0];
+
+    std::size_t partitionBits = 0;
+    while((dataSize >> partitionBits) > PartitionSize) ++partitionBits;
+    CORRADE_INTERNAL_ASSERT(partitionBits > 0 && partitionBits < 32);
+    const std::size_t partitionCount = std::size_t{1} << partitionBits;
+    const std::size_t partitionShift = 64 - partitionBits;
+
+    std::size_t chunkSize = ChunkSize;
+    while(chunkSize*MaxChunkCount < dataSize) chunkSize <<= 1;
+    const std::size_t chunkCount = (dataSize + chunkSize - 1)/chunkSize;
+
+    /* Calculate the hashes upfront and count the items in each partition,
+       separately for each chunk */
+    Containers::Array<UnsignedLong> hashes{NoInit, dataSize};
+    Containers::Array<UnsignedInt> chunkOffsets{ValueInit, chunkCount*partitionCount};
+    executor(chunkCount, [&](const std::size_t chunk) {
+        const Containers::ArrayView<UnsignedInt> counts = chunkOffsets.sliceSize(chunk*partitionCount, partitionCount);
+        for(std::size_t i = chunk*chunkSize, end = Math::min(i + chunkSize, dataSize); i != end; ++i) {
+            hashes[i] = hashEntry(dataPointer + std::ptrdiff_t(i)*dataStride, data.size()[1]);
+            ++counts[std::size_t(hashes[i] >> partitionShift)];
+        }
+    });
+
+    /* Turn the counts into offsets. In each partition the chunks are put
+       after each other, so the items in the partition stay in their original
+       order. */
+    Containers::Array<UnsignedInt> partitionOffsets{NoInit, partitionCount + 1};
+    std::size_t maxPartitionSize = 0;
+    UnsignedInt offset = 0;
+    for(std::size_t partition = 0; partition != partitionCount; ++partition) {
+        partitionOffsets[partition] = offset;
+        for(std::size_t chunk = 0; chunk != chunkCount; ++chunk) {
+            UnsignedInt& chunkOffset = chunkOffsets[chunk*partitionCount + partition];
+            const UnsignedInt count = chunkOffset;
+            chunkOffset = offset;
+            offset += count;
+        }
+        maxPartitionSize = Math::max(maxPartitionSize, std::size_t(offset - partitionOffsets[partition]));
+    }
+    partitionOffsets[partitionCount] = offset;
+
+    /* Put the item indices into partitions, each chunk advancing its own
+       cursors */
+    Containers::Array<UnsignedInt> partitioned{NoInit, dataSize};
+    executor(chunkCount, [&](const std::size_t chunk) {
+        const Containers::ArrayView<UnsignedInt> cursors = chunkOffsets.sliceSize(chunk*partitionCount, partitionCount);
+        for(std::size_t i = chunk*chunkSize, end = Math::min(i + chunkSize, dataSize); i != end; ++i)
+            partitioned[cursors[std::size_t(hashes[i] >> partitionShift)]++] = UnsignedInt(i);
+    });
+
+    /* Deduplicate each partition, reusing the same table for all partitions
+       in a task */
+    const std::size_t taskCount = (partitionCount + PartitionsPerTask - 1)/PartitionsPerTask;
+    Containers::Array<std::size_t> taskUniqueCounts{NoInit, taskCount};
+    executor(taskCount, [&](const std::size_t task) {
+        DuplicateTable table{maxPartitionSize};
+        std::size_t uniqueCount = 0;
+        for(std::size_t partition = task*PartitionsPerTask, partitionEnd = Math::min(partition + PartitionsPerTask, partitionCount); partition != partitionEnd; ++partition) {
+            table.clear();
+            for(std::size_t j = partitionOffsets[partition], jEnd = partitionOffsets[partition + 1]; j != jEnd; ++j) {
+                const UnsignedInt i = partitioned[j];
+                indices[i] = table.insert(data, i, hashes[i]);
+            }
+            uniqueCount += table.size();
+        }
+        taskUniqueCounts[task] = uniqueCount;
+    });
+
+    std::size_t uniqueCount = 0;
+    for(const std::size_t count: taskUniqueCounts)
+        uniqueCount += count;
+    return uniqueCount;
+}
+
+/* Whether to use removeDuplicatesPartitionedInto() for given input */
+bool usePartitioned(const std::size_t dataSize, const Executor& executor) {
+    return dataSize >= PartitionThreshold || (!executor.isSerial() && dataSize > PartitionSize);
+}
+
+}
+
+std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Executor& executor) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
     CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
@@ -75,25 +282,18 @@ std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
+    if(usePartitioned(dataSize, executor))
+        return removeDuplicatesPartitionedInto(data, indices, executor);
+
     /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
-
-    /* Go through all entries */
-    for(std::size_t i = 0; i != dataSize; ++i) {
-        /* Try to insert new entry into the table. The inserted index points
-           into the original unchanged data array. */
-        const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
-
-        /* Put the (either new or already existing) index into the output
-           index array */
-        indices[i] = result.first->second;
-    }
+       Sized as if each entry was unique. */
+    DuplicateTable table{dataSize};
+
+    /* Go through all entries. Try to insert each into the table, the inserted
+       index points into the original unchanged data array. Put the (either
+       new or already existing) index into the output index array. */
+    for(std::size_t i = 0; i != dataSize; ++i)
+        indices[i] = table.insert(data, UnsignedInt(i));
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
     return table.size();
@@ -105,7 +305,7 @@ Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(c
     return {Utility::move(indices), size};
 }
 
-std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Executor& executor) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
     CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
@@ -115,13 +315,34 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
+    /* For large inputs find the first occurrences using the partitioned
+       variant, and then go through the data in order, moving the first
+       occurrences to the unique prefix and replacing the first occurrence
+       indices with the unique indices. Data in [unique, i) are either already
+       moved or not first occurrences, so we aren't overwriting anything. The
+       moving is inherently serial. */
+    if(usePartitioned(dataSize, executor)) {
+        const std::size_t uniqueCount = removeDuplicatesPartitionedInto(data, indices, executor);
+
+        std::size_t unique = 0;
+        for(std::size_t i = 0; i != dataSize; ++i) {
+            if(indices[i] == i) {
+                if(i != unique)
+                    Utility::copy(data[i].asContiguous(), data[unique].asContiguous());
+                indices[i] = UnsignedInt(unique++);
+
+            /* The first occurrence was at a lower index, which means its index
+               was already replaced with the unique one */
+            } else indices[i] = indices[indices[i]];
+        }
+
+        CORRADE_INTERNAL_ASSERT(unique == uniqueCount);
+        return uniqueCount;
+    }
+
     /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+       Sized as if each entry was unique. */
+    DuplicateTable table{dataSize};
 
     /* Go through all entries and insert them into the table. Because the keys
        have runtime size, the table doesn't store a copy of the keys, only a
@@ -137,20 +358,17 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
            it fails the location isn't used as a key anywhere and so it can be
            reused next time for a different key.
 
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
+           Alternatively we could first do a lookup and only then conditionally
+           do a copy() and insert, but that means the hash & search would be
            performed twice, which is never faster than a plain memory copy. */
-        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
-        if(i != table.size())
-            Utility::copy(data[i].asContiguous(), dst);
-
-        /* Insert the new entry into the table. If it succeeds, dst is
-           guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
-
-        /* Put the (either new or already existing) index into the output index
-           array */
-        indices[i] = result.first->second;
+        const std::size_t unique = table.size();
+        if(i != unique)
+            Utility::copy(data[i].asContiguous(), data[unique].asContiguous());
+
+        /* Insert the new entry into the table. If it succeeds, the entry at
+           `unique` is guaranteed to not change anymore. Put the (either new or
+           already existing) index into the output index array. */
+        indices[i] = table.insert(data, UnsignedInt(unique));
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
@@ -209,134 +427,334 @@ std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<
 
 namespace {
 
-template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, T epsilon) {
-    /* Compared to the discrete version, we don't require the second dimension
-       to be contiguous, as we calculate the hash from a discretized contiguous
-       copy */
+/* Spatial hash grid for the fuzzy variant. The grid cells are twice the
+   epsilon in size, so for each vector only one neighbor cell in each
+   dimension has to be checked in addition to the cell the vector is in -- the
+   lower one if the vector is in the lower half of the cell and the upper one
+   otherwise. That's 2^n cells for n dimensions, so to keep the amount of cells
+   visited for each vector bounded, at most GridDimensions components are used
+   for the grid and the remaining are only compared when verifying the
+   candidates. Vectors from different cells can share a bucket, which is fine
+   as the candidates are always verified against the actual data. */
+constexpr std::size_t GridDimensions = 4;
+constexpr std::size_t GridCandidateCount = 1 << GridDimensions;
+
+template<class T> class FuzzyGrid {
+    public:
+        explicit FuzzyGrid(const Containers::StridedArrayView2D<T>& data, T epsilon): _offsets{NoInit, data.size()[1]} {
+            /* Get bounds across all dimensions. When NaNs appear, those will
+               get collapsed together when you're lucky, or cause the whole
+               data to disappear when you're not -- it needs a much more
+               specialized handling to be robust. */
+            const std::size_t vectorSize = data.size()[1];
+            T range = T(0.0);
+            Containers::Array<T> ranges{NoInit, vectorSize};
+            {
+                /** @todo this isn't really cache-efficient, do differently */
+                std::size_t i = 0;
+                for(Containers::StridedArrayView1D<T> dimension: data.template transposed<0, 1>()) {
+                    const Math::Range1D<T> minmax = Math::minmax(dimension);
+                    range = Math::max(minmax.size(), range);
+                    ranges[i] = minmax.size();
+                    _offsets[i++] = minmax.min();
+                }
+            }
 
-    /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
-       int(-1) instead of the type I want */
-    CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
-        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): a" << sizeof(IndexType) << Debug::nospace << "-byte index type is too small for" << data.size()[0] << "vertices", {});
+            /* Make the cell so large that std::size_t can index all vectors
+               inside the bounds */
+            _epsilon = Math::max(epsilon, range/T(~std::size_t{}));
+            _cellSize = _epsilon*T(2.0);
+
+            /* Pick the components with the largest range for the grid, as
+               those spread the vectors over the most cells. Components that
+               have the same value in all vectors would put everything into a
+               single cell, so they're not used at all. If the cell size is
+               zero, all data are the same and so they all can be in a single
+               cell. */
+            _gridSize = 0;
+            if(_cellSize != T(0.0)) for(; _gridSize != Math::min(vectorSize, GridDimensions); ++_gridSize) {
+                std::size_t largest = ~std::size_t{};
+                for(std::size_t vi = 0; vi != vectorSize; ++vi) {
+                    if(!(ranges[vi] > T(0.0))) continue;
+                    bool used = false;
+                    for(std::size_t gi = 0; gi != _gridSize; ++gi) if(_gridDimensions[gi] == vi) {
+                        used = true;
+                        break;
+                    }
+                    if(!used && (largest == ~std::size_t{} || ranges[vi] > ranges[largest]))
+                        largest = vi;
+                }
+                if(largest == ~std::size_t{}) break;
+                _gridDimensions[_gridSize] = largest;
+            }
+
+            /* The bucket count is a power of two at least as large as the
+               vector count, but at most MaxBucketCount, so the grid takes at
+               most 4 MB on top of a few integers per vector, independently of
+               the vector size */
+            constexpr std::size_t MaxBucketCount = 1 << 20;
+            std::size_t bucketCount = 16;
+            while(bucketCount < data.size()[0] && bucketCount < MaxBucketCount)
+                bucketCount <<= 1;
+            _bucketMask = bucketCount - 1;
+        }
+
+        T epsilon() const { return _epsilon; }
 
-    /* Get bounds across all dimensions. When NaNs appear, those will get
-       collapsed together when you're lucky, or cause the whole data to
-       disappear when you're not -- it needs a much more specialized handling
-       to be robust. */
-    const std::size_t vectorSize = data.size()[1];
-    T range = T(0.0);
-    Containers::Array<T> offsets{NoInit, vectorSize};
-    {
-        /** @todo this isn't really cache-efficient, do differently */
-        std::size_t i = 0;
-        for(Containers::StridedArrayView1D<T> dimension: data.template transposed<0, 1>()) {
-            const Math::Range1D<T> minmax = Math::minmax(dimension);
-            range = Math::max(minmax.size(), range);
-            offsets[i++] = minmax.min();
+        std::size_t bucketCount() const { return _bucketMask + 1; }
+
+        std::size_t candidateCount() const { return std::size_t{1} << _gridSize; }
+
+        /* Bucket of the cell the vector is in */
+        std::size_t bucket(const Containers::StridedArrayView1D<const T>& vector) const {
+            std::size_t cell[GridDimensions];
+            for(std::size_t gi = 0; gi != _gridSize; ++gi) {
+                const std::size_t vi = _gridDimensions[gi];
+                cell[gi] = std::size_t((vector[vi] - _offsets[vi])/_cellSize);
+            }
+            return hashCell(cell, _gridSize) & _bucketMask;
+        }
+
+        /* Buckets of all cells that can contain vectors within epsilon, the
+           first candidateCount() items get filled. The first one is always
+           the same as bucket(). */
+        void candidateBuckets(const Containers::StridedArrayView1D<const T>& vector, std::size_t(&buckets)[GridCandidateCount]) const {
+            std::size_t cell[GridDimensions];
+            std::size_t neighborCell[GridDimensions];
+            for(std::size_t gi = 0; gi != _gridSize; ++gi) {
+                const std::size_t vi = _gridDimensions[gi];
+                const T position = (vector[vi] - _offsets[vi])/_cellSize;
+                cell[gi] = std::size_t(position);
+                /* For the first cell the lower neighbor wraps around, but
+                   there are no vectors in it so it doesn't matter */
+                neighborCell[gi] = position - T(cell[gi]) < T(0.5) ?
+                    cell[gi] - 1 : cell[gi] + 1;
+            }
+
+            for(std::size_t combination = 0; combination != candidateCount(); ++combination) {
+                std::size_t combinationCell[GridDimensions];
+                for(std::size_t gi = 0; gi != _gridSize; ++gi)
+                    combinationCell[gi] = (combination & (std::size_t{1} << gi)) ? neighborCell[gi] : cell[gi];
+                buckets[combination] = hashCell(combinationCell, _gridSize) & _bucketMask;
+            }
+        }
+
+        /* Whether the two vectors are within epsilon in all dimensions */
+        bool equal(const Containers::StridedArrayView1D<const T>& candidate, const Containers::StridedArrayView1D<const T>& vector) const {
+            for(std::size_t vi = 0; vi != _offsets.size(); ++vi)
+                if(Math::abs(candidate[vi] - vector[vi]) > _epsilon)
+                    return false;
+            return true;
+        }
+
+    private:
+        Containers::Array<T> _offsets;
+        T _epsilon, _cellSize;
+        std::size_t _gridDimensions[GridDimensions];
+        std::size_t _gridSize;
+        std::size_t _bucketMask;
+};
+
+/* Moves the unique vectors to the front, fills `remapping` with unique index
+   of each vector and returns the unique count. Each bucket points to the last
+   unique vector inserted to it and `next` links to the previously inserted
+   vectors in the same bucket. */
+template<class T> std::size_t removeDuplicatesFuzzySerialInto(const FuzzyGrid<T>& grid, const Containers::StridedArrayView2D<T>& data, const Containers::ArrayView<UnsignedInt> remapping) {
+    const std::size_t dataSize = data.size()[0];
+    Containers::Array<UnsignedInt> buckets{DirectInit, grid.bucketCount(), ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> next{NoInit, dataSize};
+
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        const Containers::StridedArrayView1D<T> entry = data[i];
+
+        /* Go through the cell and neighbor cells and find the earliest unique
+           vector that's within epsilon in all dimensions */
+        std::size_t candidates[GridCandidateCount];
+        grid.candidateBuckets(entry, candidates);
+        UnsignedInt found = ~UnsignedInt{};
+        for(std::size_t c = 0; c != grid.candidateCount(); ++c) {
+            for(UnsignedInt j = buckets[candidates[c]]; j != ~UnsignedInt{}; j = next[j]) {
+                if(j >= found) continue;
+                if(grid.equal(data[j], entry)) found = j;
+            }
+        }
+
+        if(found != ~UnsignedInt{}) {
+            remapping[i] = found;
+            continue;
         }
+
+        /* If this is a new vector, copy the data to new (earlier) position in
+           the array. Data in [uniqueCount, i) are already present in the
+           [0, uniqueCount) range so we aren't overwriting anything. Then put
+           it into the bucket of its own cell. */
+        if(i != uniqueCount)
+            Utility::copy(entry, data[uniqueCount]);
+        UnsignedInt& bucket = buckets[candidates[0]];
+        next[uniqueCount] = bucket;
+        bucket = UnsignedInt(uniqueCount);
+        remapping[i] = UnsignedInt(uniqueCount);
+        ++uniqueCount;
     }
 
-    /* Make epsilon so large that std::size_t can index all vectors inside the
-       bounds. */
-    epsilon = Math::max(epsilon, range/T(~std::size_t{}));
-
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::size_t dataSize = data.size()[0];
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]*sizeof(std::size_t)},
-        ArrayEqual{data.size()[1]*sizeof(std::size_t)}};
-
-    /* Index array that'll be filled in each pass and then used for remapping
-       the `indices`; discretized storage for all map keys. */
-    Containers::Array<UnsignedInt> remapping{NoInit, dataSize};
-    Containers::Array<std::size_t> discretized{NoInit, dataSize*vectorSize};
+    return uniqueCount;
+}
 
-    /* First go with original coordinates, then move them by epsilon/2 in each
-       dimension. */
-    T moveAmount = T(0.0);
-    for(std::size_t moving = 0; moving <= vectorSize; ++moving) {
-        for(std::size_t i = 0; i != dataSize; ++i) {
-            /* Take the original vector and discretize it -- append the move
-               amount to given dimension, subtract the minmal offset and divide
-               by epsilon. */
+/* Same output as removeDuplicatesFuzzySerialInto(), but the expensive parts
+   are split into tasks for the executor. The serial variant compares each
+   vector only with unique vectors preceding it, which depends on the result
+   for all previous vectors. Instead, in parallel, the earliest vector within
+   epsilon is found among *all* preceding vectors in the candidate cells. If
+   there's none, the vector is unique, and if it's unique, it's the same one
+   the serial variant would find. Only when it's a duplicate itself, which
+   happens only if the duplicates are chained over more than an epsilon, the
+   candidates are serially searched again for the earliest unique one. */
+template<class T> std::size_t removeDuplicatesFuzzyParallelInto(const FuzzyGrid<T>& grid, const Containers::StridedArrayView2D<T>& data, const Containers::ArrayView<UnsignedInt> remapping, const Executor& executor) {
+    const std::size_t dataSize = data.size()[0];
+    const std::size_t chunkCount = (dataSize + ChunkSize - 1)/ChunkSize;
+
+    /* Bucket of the cell each vector is in */
+    Containers::Array<UnsignedInt> vectorBuckets{NoInit, dataSize};
+    executor(chunkCount, [&](const std::size_t chunk) {
+        for(std::size_t i = chunk*ChunkSize, end = Math::min(i + ChunkSize, dataSize); i != end; ++i)
+            vectorBuckets[i] = UnsignedInt(grid.bucket(data[i]));
+    });
+
+    /* List of vectors in each bucket, in their original order */
+    const std::size_t bucketCount = grid.bucketCount();
+    Containers::Array<UnsignedInt> bucketOffsets{ValueInit, bucketCount + 1};
+    for(const UnsignedInt bucket: vectorBuckets)
+        ++bucketOffsets[bucket + 1];
+    for(std::size_t i = 0; i != bucketCount; ++i)
+        bucketOffsets[i + 1] += bucketOffsets[i];
+    Containers::Array<UnsignedInt> bucketCursors{NoInit, bucketCount};
+    Utility::copy(bucketOffsets.prefix(bucketCount), bucketCursors);
+    Containers::Array<UnsignedInt> bucketVectors{NoInit, dataSize};
+    for(std::size_t i = 0; i != dataSize; ++i)
+        bucketVectors[bucketCursors[vectorBuckets[i]]++] = UnsignedInt(i);
+
+    /* Earliest preceding vector within epsilon. As the bucket lists are
+       sorted, it's the first one found in each bucket. */
+    Containers::Array<UnsignedInt> earliest{NoInit, dataSize};
+    executor(chunkCount, [&](const std::size_t chunk) {
+        for(std::size_t i = chunk*ChunkSize, end = Math::min(i + ChunkSize, dataSize); i != end; ++i) {
             const Containers::StridedArrayView1D<T> entry = data[i];
-            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(i*vectorSize, (i + 1)*vectorSize);
-            for(std::size_t vi = 0; vi != vectorSize; ++vi) {
-                T c = entry[vi];
-                /* In iteration `0` we're not moving in any dimension, in
-                   iteration `vectorSize` we're moving in `vectorSize - 1`
-                   dimension */
-                if(vi + 1 == moving) c += moveAmount;
-                discretizedEntry[vi] = (c - offsets[vi])/epsilon;
+            std::size_t candidates[GridCandidateCount];
+            grid.candidateBuckets(entry, candidates);
+            UnsignedInt found = ~UnsignedInt{};
+            for(std::size_t c = 0; c != grid.candidateCount(); ++c) {
+                for(std::size_t k = bucketOffsets[candidates[c]], kEnd = bucketOffsets[candidates[c] + 1]; k != kEnd; ++k) {
+                    const UnsignedInt j = bucketVectors[k];
+                    if(j >= found || j >= i) break;
+                    if(grid.equal(data[j], entry)) {
+                        found = j;
+                        break;
+                    }
+                }
             }
-
-            /* Try to insert new entry into the table. The inserted index
-               points into the new data array that has all duplicates removed.
-               This is a similar workflow to removeDuplicatesInPlaceInto() with
-               the only difference that we're remapping an existing index array
-               several times over instead of creating a new one */
-            const auto result = table.emplace(discretizedEntry, table.size());
-
-            /* Add the (either new or already existing) index into the array */
-            remapping[i] = result.first->second;
-
-            /* If this is a new combination, copy the data to new (earlier)
-               position in the array. Data in [table.size()-1, i) are already
-               present in the [0, table.size()-1) range from previous
-               iterations so we aren't overwriting anything. */
-            if(result.second && i != table.size() - 1)
-                Utility::copy(entry, data[table.size() - 1]);
+            earliest[i] = found;
         }
+    });
 
-        /* Remap the resulting index array */
-        for(auto& i: indices) i = remapping[i];
+    /* Pick the earliest unique vector for each, in order, putting its index
+       into `remapping`. Vectors that are unique point to themselves, the
+       duplicates always to a lower index. */
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        UnsignedInt found = earliest[i];
+        if(found != ~UnsignedInt{} && remapping[found] != found) {
+            const Containers::StridedArrayView1D<T> entry = data[i];
+            std::size_t candidates[GridCandidateCount];
+            grid.candidateBuckets(entry, candidates);
+            found = ~UnsignedInt{};
+            for(std::size_t c = 0; c != grid.candidateCount(); ++c) {
+                for(std::size_t k = bucketOffsets[candidates[c]], kEnd = bucketOffsets[candidates[c] + 1]; k != kEnd; ++k) {
+                    const UnsignedInt j = bucketVectors[k];
+                    if(j >= found || j >= i) break;
+                    if(remapping[j] == j && grid.equal(data[j], entry)) {
+                        found = j;
+                        break;
+                    }
+                }
+            }
+        }
 
-        /* Move vertex coordinates by epsilon/2 in the next dimension (which
-           is moving + 1 in the next loop iteration) */
-        moveAmount = epsilon/2;
+        remapping[i] = found == ~UnsignedInt{} ? UnsignedInt(i) : found;
+    }
 
-        /* Next time go only through the unique prefix; clear the table for the
-           next pass */
-        dataSize = table.size();
-        table.clear();
+    /* Move the unique vectors to the front and replace the indices with
+       unique ones. Data in [uniqueCount, i) are either already moved or
+       duplicates, so we aren't overwriting anything. */
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        if(remapping[i] == i) {
+            if(i != uniqueCount)
+                Utility::copy(data[i], data[uniqueCount]);
+            remapping[i] = UnsignedInt(uniqueCount++);
+
+        /* The unique vector was at a lower index, which means its index was
+           already replaced with the unique one */
+        } else remapping[i] = remapping[remapping[i]];
     }
 
-    CORRADE_INTERNAL_ASSERT(data.size()[0] >= dataSize);
-    return dataSize;
+    return uniqueCount;
+}
+
+template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon, const Executor& executor) {
+    /* Compared to the discrete version, we don't require the second dimension
+       to be contiguous, as we calculate the hash from discretized grid cell
+       coordinates */
+
+    /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
+       int(-1) instead of the type I want */
+    CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
+        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): a" << sizeof(IndexType) << Debug::nospace << "-byte index type is too small for" << data.size()[0] << "vertices", {});
+
+    const FuzzyGrid<T> grid{data, epsilon};
+
+    /* Index array that's used for remapping the `indices` at the end */
+    const std::size_t dataSize = data.size()[0];
+    Containers::Array<UnsignedInt> remapping{NoInit, dataSize};
+    const std::size_t uniqueCount = executor.isSerial() ?
+        removeDuplicatesFuzzySerialInto(grid, data, remapping) :
+        removeDuplicatesFuzzyParallelInto(grid, data, remapping, executor);
+
+    /* Remap the resulting index array */
+    for(auto& i: indices) i = remapping[i];
+
+    CORRADE_INTERNAL_ASSERT(dataSize >= uniqueCount);
+    return uniqueCount;
 }
 
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, Executor{});
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, Executor{});
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, Executor{});
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, Executor{});
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, Executor{});
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, Executor{});
 }
 
 namespace {
 
-template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon) {
+template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon, const Executor& executor) {
     CORRADE_ASSERT(indices.size() == data.size()[0],
         "MeshTools::removeDuplicatesFuzzyInPlaceInto(): output index array has" << indices.size() << "elements but expected" << data.size()[0], {});
 
@@ -346,13 +764,13 @@ template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(con
     UnsignedInt i = 0;
     for(UnsignedInt& index: indices) index = i++;
 
-    const std::size_t size = removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::stridedArrayView(indices), data, epsilon);
+    const std::size_t size = removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::stridedArrayView(indices), data, epsilon, executor);
     return size;
 }
 
 template<class T> Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon) {
     Containers::Array<UnsignedInt> indices{NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+    const std::size_t size = removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, Executor{});
     return {Utility::move(indices), size};
 }
 
@@ -366,12 +784,12 @@ Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFu
     return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon);
 }
 
-std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon) {
-    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon, const Executor& executor) {
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, executor);
 }
 
-std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon) {
-    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon, const Executor& executor) {
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, executor);
 }
 
 namespace {
@@ -379,12 +797,12 @@ namespace {
 template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, epsilon, Executor{});
     else if(indices.size()[1] == 2)
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, epsilon, Executor{});
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, epsilon, Executor{});
     }
 }
 
@@ -539,7 +957,7 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float f
                 attributeEpsilon = floatEpsilon*range;
             }
 
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], attributeEpsilon);
+            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], attributeEpsilon, Executor{});
 
         /* Doubles. No builtin attributes support those at the moment, so
            there's just the epsilon scaling based on attribute value range */
@@ -550,7 +968,7 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float f
             for(Containers::StridedArrayView1D<const Double> component: attribute.transposed<0, 1>())
                 range = Math::max(Range1Dd{Math::minmax(component)}.size(), range);
 
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], doubleEpsilon*range);
+            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], doubleEpsilon*range, Executor{});
 
         /* Other attributes (integer, packed, half floats). No fuzzy
            comparison */
@@ -30,6 +30,7 @@
  * @brief Function @ref Magnum::MeshTools::removeDuplicatesInPlace(), @ref Magnum::MeshTools::removeDuplicatesIndexedInPlace()
  */
 
+#include "Magnum/Executor.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/TypeTraits.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -96,15 +97,20 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::si
 @param[in,out] data     Data array, duplicate items will be cut away with order
     preserved
 @param[out]    indices  Where to put the resulting index array
+@param[in]     executor Executor to run the duplicate search with
 @return Size of unique prefix in the cleaned up @p data array
 @m_since{2020,06}
 
 Like @ref removeDuplicatesInPlace(), except that the index array is not
 allocated but put into @p indices instead. Expects that @p indices has the same
 size as @p data.
+
+The duplicates are found the same way as in @ref removeDuplicatesInto(),
+including the parallel processing with a non-serial @p executor. Moving the
+unique items to the front is done serially on the calling thread afterwards.
 @see @ref removeDuplicatesInto()
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Executor& executor = {});
 
 /**
 @brief Remove duplicate data from given array
@@ -137,14 +143,26 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::si
 @brief Remove duplicate data from given array into given output index array
 @param[in]  data    Data array
 @param[out] indices Where to put the resulting index array
+@param[in]  executor Executor to run the duplicate search with
 @return Count of unique items in the original @p data array
 @m_since{2020,06}
 
-Compared to @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&)
+Compared to @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Executor&)
 this function doesn't modify the input data array in any way but instead
 makes an index array pointing to original data locations.
+
+Inputs with at least 256k items are partitioned by hash first and each
+partition is then deduplicated separately with a table that fits into the
+cache. With a non-serial @p executor this is done for inputs with more than 8k
+items as well, and the hashing, partitioning and deduplication are split into
+tasks that run in parallel. The hashing and partitioning tasks process at
+least 64k items each and the deduplication tasks process 16 partitions of
+about 8k items each. The output is the same regardless of the executor, as
+each item is visited by a single task only and the partitions preserve the
+original item order. On top of the output, the partitioned variant allocates
+12 bytes per item and a few bytes per partition and task.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Executor& executor = {});
 
 /**
 @brief Remove duplicates from indexed data in-place
@@ -194,9 +212,10 @@ MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Contain
     @p data array
 @m_since{2020,06}
 
-Removes duplicate data from the array by collapsing them into buckets of size
-@p epsilon. First vector in given bucket is used, other ones are thrown away,
-no interpolation is done. Usage example:
+Removes duplicate data from the array by collapsing each item into the first
+preceding unique item that differs by at most @p epsilon in every component.
+The unique item is kept, the collapsed ones are thrown away, no interpolation
+is done. Usage example:
 
 @snippet MeshTools.cpp removeDuplicatesFuzzy
 
@@ -217,6 +236,24 @@ five:
 {{0, 1, 0, 2, 3, 3, 1, 4}, 5}
 @endcode
 
+The candidates are found in a single pass using a spatial hash grid with cells
+of twice the @p epsilon size, checking the cell the item is in and the nearest
+neighbor cell in each dimension. As that means visiting @f$ 2^n @f$ cells for
+@f$ n @f$ dimensions, the grid is built from at most four components with the
+largest range, remaining components are only compared when verifying the
+candidates. Apart from the unique prefix of the input, which is modified
+in-place, the function allocates two 32-bit integers per item for linking and
+remapping the items, and a grid with the item count rounded up to a power of
+two buckets, but at most 4 MB.
+
+On average the lookup is @f$ \mathcal{O}(1) @f$ per item. In the worst
+case, where all items fall into the same few grid cells --- for example when
+they differ only in components that aren't used for the grid --- each item is
+compared against all preceding unique items in the same cell and the
+complexity degrades to @f$ \mathcal{O}(n^2) @f$. Past about a million items
+the buckets get shared by more cells, making the lookups gradually slower as
+well. The result is the same in all cases.
+
 Note that this function is meant to be used for floating-point data (or
 generally with non-zero @p epsilon), for data where bit-exact matching is
 sufficient use @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&)
@@ -252,20 +289,32 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::si
 @param[out] indices Where to put the resulting index array
 @param[in] epsilon  Epsilon value, data closer than this distance will be
     deduplicated
+@param[in] executor Executor to run the duplicate search with
 @return Size of unique prefix in the cleaned up @p data array
 @m_since{2020,06}
 
 Like @ref removeDuplicatesFuzzyInPlace(), except that the index array is not
 allocated but put into @p indices instead. Expects that @p indices has the same
 size as @p data.
+
+With a non-serial @p executor, the grid cells of all items and then the
+earliest preceding item within @p epsilon for each item are calculated in
+parallel, in tasks of 64k items each. If the earliest item is itself a
+duplicate, which happens only if the duplicates are chained over more than
+@p epsilon, the earliest unique one is searched for again serially. Moving
+the unique items to the front is done serially as well. The output is the same
+regardless of the executor. Compared to the serial variant, the candidates
+include all preceding items in given cells, not just the unique ones, and
+the function allocates two more 32-bit integers per item and one more per
+grid bucket.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon(), const Executor& executor = {});
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon(), const Executor& executor = {});
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
@@ -0,0 +1,632 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm> /* std::stable_sort() */
+#include <utility> /* std::swap() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Topological kind of a vertex, deciding where it can collapse to */
+enum class Kind: UnsignedByte {
+    /* Not on a seam nor a border, can collapse anywhere */
+    Manifold,
+    /* On a border, can collapse only to a border vertex along the border */
+    Border,
+    /* On a seam with exactly two vertices sharing the position, can collapse
+       only to a seam vertex along the seam */
+    Seam,
+    /* Anything else, never collapsed */
+    Locked
+};
+
+constexpr bool CanCollapse[4][4]{
+    {true, true, true, true},
+    {false, true, false, false},
+    {false, false, true, false},
+    {false, false, false, false}
+};
+
+/* Whether an edge between two vertices of given kinds is present in both
+   directions, i.e. whether it should be considered only once */
+constexpr bool HasOpposite[4][4]{
+    {true, true, true, true},
+    {true, false, true, false},
+    {true, true, true, true},
+    {true, false, true, false}
+};
+
+/* Symmetric 4x4 quadric matrix together with a weight the error gets
+   normalized with */
+struct Quadric {
+    Float a00, a11, a22, a10, a20, a21, b0, b1, b2, c, w;
+};
+
+Quadric planeQuadric(const Vector3& normal, const Float distance, const Float weight) {
+    Quadric q;
+    q.a00 = weight*normal.x()*normal.x();
+    q.a11 = weight*normal.y()*normal.y();
+    q.a22 = weight*normal.z()*normal.z();
+    q.a10 = weight*normal.y()*normal.x();
+    q.a20 = weight*normal.z()*normal.x();
+    q.a21 = weight*normal.z()*normal.y();
+    q.b0 = weight*normal.x()*distance;
+    q.b1 = weight*normal.y()*distance;
+    q.b2 = weight*normal.z()*distance;
+    q.c = weight*distance*distance;
+    q.w = weight;
+    return q;
+}
+
+void addQuadric(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00;
+    a.a11 += b.a11;
+    a.a22 += b.a22;
+    a.a10 += b.a10;
+    a.a20 += b.a20;
+    a.a21 += b.a21;
+    a.b0 += b.b0;
+    a.b1 += b.b1;
+    a.b2 += b.b2;
+    a.c += b.c;
+    a.w += b.w;
+}
+
+Float quadricError(const Quadric& q, const Vector3& v) {
+    Float rx = q.b0 + q.a10*v.y() + q.a20*v.z();
+    Float ry = q.b1 + q.a21*v.z();
+    Float rz = q.b2;
+    rx = 2.0f*rx + q.a00*v.x();
+    ry = 2.0f*ry + q.a11*v.y();
+    rz = 2.0f*rz + q.a22*v.z();
+    const Float r = q.c + rx*v.x() + ry*v.y() + rz*v.z();
+    return q.w == 0.0f ? 0.0f : Math::abs(r)/q.w;
+}
+
+/* Quadric of the triangle plane, weighted by square root of its area so the
+   weight scales linearly with size, same as the edge quadrics below */
+Quadric triangleQuadric(const Vector3& a, const Vector3& b, const Vector3& c) {
+    Vector3 normal = Math::cross(b - a, c - a);
+    const Float area = normal.length();
+    if(area != 0.0f) normal /= area;
+    return planeQuadric(normal, -Math::dot(normal, a), Math::sqrt(area));
+}
+
+/* Quadric of a plane going through the a-b edge and perpendicular to the
+   triangle, keeping border and seam vertices from moving away from the
+   edge */
+Quadric edgeQuadric(const Vector3& a, const Vector3& b, const Vector3& c, const Float weight) {
+    Vector3 edge = b - a;
+    const Float length = edge.length();
+    if(length != 0.0f) edge /= length;
+    Vector3 normal = (c - a) - edge*Math::dot(c - a, edge);
+    const Float normalLength = normal.length();
+    if(normalLength != 0.0f) normal /= normalLength;
+    return planeQuadric(normal, -Math::dot(normal, a), length*weight);
+}
+
+/* Whether moving the c corner of an a-b-c triangle to d flips it */
+bool hasTriangleFlip(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d) {
+    const Vector3 ab = b - a;
+    return Math::dot(Math::cross(ab, c - a), Math::cross(ab, d - a)) <= 0.0f;
+}
+
+struct Collapse {
+    UnsignedInt from, to;
+    bool bidirectional;
+    Float error;
+};
+
+Containers::Pair<std::size_t, Float> simplifyImplementation(const Containers::ArrayView<UnsignedInt> indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, const std::size_t targetIndexCount, const Float maxError, const SimplifyFlags flags) {
+    const std::size_t vertexCount = positions.size();
+    std::size_t indexCount = indices.size();
+    if(indexCount <= targetIndexCount)
+        return {indexCount, 0.0f};
+
+    /* Positions scaled to a unit cube so the error is relative to the mesh
+       size */
+    Vector3 min{Constants::inf()};
+    Vector3 max{-Constants::inf()};
+    for(const Vector3& position: positions) {
+        min = Math::min(min, position);
+        max = Math::max(max, position);
+    }
+    const Float extent = (max - min).max();
+    const Float scale = extent > 0.0f ? 1.0f/extent : 1.0f;
+    Containers::Array<Vector3> scaledPositions{NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        scaledPositions[i] = (positions[i] - min)*scale;
+
+    /* For each vertex the first vertex with the same position, and a circular
+       list of all vertices sharing the same position */
+    Containers::Array<UnsignedInt> remap{NoInit, vertexCount};
+    Containers::Array<UnsignedInt> wedge{NoInit, vertexCount};
+    {
+        Containers::Array<UnsignedInt> unique{NoInit, vertexCount};
+        removeDuplicatesInto(Containers::arrayCast<2, const char>(positions), unique);
+        Containers::Array<UnsignedInt> first{DirectInit, vertexCount, ~UnsignedInt{}};
+        for(std::size_t i = 0; i != vertexCount; ++i) {
+            if(first[unique[i]] == ~UnsignedInt{})
+                first[unique[i]] = UnsignedInt(i);
+            remap[i] = first[unique[i]];
+            wedge[i] = UnsignedInt(i);
+        }
+        for(std::size_t i = 0; i != vertexCount; ++i) {
+            if(remap[i] == i) continue;
+            wedge[i] = wedge[remap[i]];
+            wedge[remap[i]] = i;
+        }
+    }
+
+    /* Vertex-triangle adjacency, used for finding open edges and later for
+       checking triangle flips */
+    Containers::Array<UnsignedInt> liveTriangleCount;
+    Containers::Array<UnsignedInt> neighborOffset;
+    Containers::Array<UnsignedInt> neighbors;
+    Implementation::buildAdjacency<UnsignedInt>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* For each vertex the next vertex along an open edge going out of it
+       (loop) and the previous vertex along an open edge going into it
+       (loopback). If there's more than one such edge, the vertex itself is
+       stored to mark it as not suitable for collapsing. */
+    Containers::Array<UnsignedInt> loop{DirectInit, vertexCount, ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> loopback{DirectInit, vertexCount, ~UnsignedInt{}};
+    const auto hasEdge = [&](const UnsignedInt a, const UnsignedInt b) {
+        for(std::size_t i = neighborOffset[a]; i != neighborOffset[a + 1]; ++i) {
+            const UnsignedInt triangle = neighbors[i];
+            for(std::size_t j = 0; j != 3; ++j)
+                if(indices[triangle*3 + j] == a && indices[triangle*3 + (j + 1) % 3] == b)
+                    return true;
+        }
+        return false;
+    };
+    for(std::size_t i = 0; i != indexCount; ++i) {
+        const UnsignedInt a = indices[i];
+        const UnsignedInt b = indices[i - i % 3 + (i + 1) % 3];
+        /* A degenerate triangle, lock the vertex */
+        if(a == b) {
+            loop[a] = loopback[a] = a;
+        } else if(!hasEdge(b, a)) {
+            loop[a] = loop[a] == ~UnsignedInt{} ? b : a;
+            loopback[b] = loopback[b] == ~UnsignedInt{} ? a : b;
+        }
+    }
+
+    /* Classify the vertices. All vertices with the same position get the same
+       kind. */
+    Containers::Array<Kind> kinds{NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i) {
+        if(remap[i] != i) {
+            kinds[i] = kinds[remap[i]];
+            continue;
+        }
+
+        /* Just one vertex at this position, if there are any open edges it's
+           a border */
+        if(wedge[i] == i) {
+            const UnsignedInt in = loopback[i];
+            const UnsignedInt out = loop[i];
+            if(in == ~UnsignedInt{} && out == ~UnsignedInt{})
+                kinds[i] = Kind::Manifold;
+            else if(in != ~UnsignedInt{} && in != i && out != ~UnsignedInt{} && out != i && !(flags & SimplifyFlag::LockBorder))
+                kinds[i] = Kind::Border;
+            else
+                kinds[i] = Kind::Locked;
+
+        /* Two vertices at this position, it's a seam if each has exactly one
+           open edge in and out and the edges connect to the same positions
+           on the other side */
+        } else if(wedge[wedge[i]] == i) {
+            const UnsignedInt w = wedge[i];
+            const UnsignedInt inI = loopback[i];
+            const UnsignedInt outI = loop[i];
+            const UnsignedInt inW = loopback[w];
+            const UnsignedInt outW = loop[w];
+            if(inI != ~UnsignedInt{} && inI != i &&
+               outI != ~UnsignedInt{} && outI != i &&
+               inW != ~UnsignedInt{} && inW != w &&
+               outW != ~UnsignedInt{} && outW != w &&
+               remap[inI] == remap[outW] &&
+               remap[outI] == remap[inW] &&
+               remap[inI] != remap[outI])
+                kinds[i] = Kind::Seam;
+            else
+                kinds[i] = Kind::Locked;
+
+        /* More than two, too complex */
+        } else kinds[i] = Kind::Locked;
+    }
+
+    /* Position quadrics, accumulated for the first vertex of given
+       position */
+    Containers::Array<Quadric> quadrics{ValueInit, vertexCount};
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        const Quadric q = triangleQuadric(
+            scaledPositions[indices[i + 0]],
+            scaledPositions[indices[i + 1]],
+            scaledPositions[indices[i + 2]]);
+        for(std::size_t j = 0; j != 3; ++j)
+            addQuadric(quadrics[remap[indices[i + j]]], q);
+    }
+    for(std::size_t i = 0; i != indexCount; ++i) {
+        const UnsignedInt a = indices[i];
+        const UnsignedInt b = indices[i - i % 3 + (i + 1) % 3];
+        const UnsignedInt c = indices[i - i % 3 + (i + 2) % 3];
+        const Kind kindA = kinds[a];
+        const Kind kindB = kinds[b];
+
+        /* Only edges that are on a border or a seam, including edges going
+           to a locked vertex, otherwise the border or seam end wouldn't be
+           constrained */
+        const bool edgeA = kindA == Kind::Border || kindA == Kind::Seam;
+        const bool edgeB = kindB == Kind::Border || kindB == Kind::Seam;
+        if(!edgeA && !edgeB) continue;
+        if(edgeA && loop[a] != b) continue;
+        if(edgeB && loopback[b] != a) continue;
+
+        /* Seam edges are present twice */
+        if(HasOpposite[UnsignedByte(kindA)][UnsignedByte(kindB)] && remap[b] > remap[a]) continue;
+
+        /* Borders are kept as much as possible, seams can move more
+           freely */
+        const Quadric q = edgeQuadric(scaledPositions[a], scaledPositions[b], scaledPositions[c], kindA == Kind::Border || kindB == Kind::Border ? 10.0f : 1.0f);
+        addQuadric(quadrics[remap[a]], q);
+        addQuadric(quadrics[remap[b]], q);
+    }
+
+    /* The other vertex of a seam pair to collapse together with `from` when
+       collapsing it to `to`, or ~UnsignedInt{} if there's no such vertex */
+    const auto seamTarget = [&](const UnsignedInt from, const UnsignedInt to) {
+        const UnsignedInt s = wedge[from];
+        const UnsignedInt target = loop[from] == to ? loopback[s] : loop[s];
+        return target < vertexCount && target != s && wedge[target] == to ? target : ~UnsignedInt{};
+    };
+    const auto attributeError = [&](const UnsignedInt a, const UnsignedInt b) {
+        Float error = 0.0f;
+        for(std::size_t i = 0; i != attributeWeights.size(); ++i) {
+            const Float difference = attributeWeights[i]*(attributes[a][i] - attributes[b][i]);
+            error += difference*difference;
+        }
+        return error;
+    };
+    const auto collapseError = [&](const UnsignedInt from, const UnsignedInt to) {
+        Float error = quadricError(quadrics[remap[from]], scaledPositions[to]) + attributeError(from, to);
+        if(kinds[from] == Kind::Seam) {
+            const UnsignedInt target = seamTarget(from, to);
+            if(target == ~UnsignedInt{}) return Constants::inf();
+            error += attributeError(wedge[from], target);
+        }
+        return error;
+    };
+
+    Containers::Array<Collapse> collapses{NoInit, indexCount};
+    Containers::Array<UnsignedInt> collapseOrder{NoInit, indexCount};
+    Containers::Array<UnsignedInt> collapseRemap{NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        collapseRemap[i] = UnsignedInt(i);
+    Containers::BitArray collapseLocked{ValueInit, vertexCount};
+    Containers::Array<UnsignedInt> positionIndices{NoInit, indexCount};
+
+    const auto remapEdgeLoops = [&](Containers::ArrayView<UnsignedInt> edges) {
+        for(std::size_t i = 0; i != vertexCount; ++i) {
+            if(edges[i] == ~UnsignedInt{}) continue;
+            const UnsignedInt next = edges[i];
+            const UnsignedInt target = collapseRemap[next];
+            edges[i] = target == i ? edges[next] : target;
+        }
+    };
+
+    const Float errorLimit = maxError*maxError;
+    Float resultError = 0.0f;
+    while(indexCount > targetIndexCount) {
+        /* Triangle adjacency in position space for the flip check */
+        for(std::size_t i = 0; i != indexCount; ++i)
+            positionIndices[i] = remap[indices[i]];
+        Implementation::buildAdjacency<UnsignedInt>(positionIndices.prefix(indexCount), vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+        /* Gather all edges that can be collapsed in at least one direction */
+        std::size_t collapseCount = 0;
+        for(std::size_t i = 0; i != indexCount; ++i) {
+            const UnsignedInt a = indices[i];
+            const UnsignedInt b = indices[i - i % 3 + (i + 1) % 3];
+            const UnsignedByte kindA = UnsignedByte(kinds[a]);
+            const UnsignedByte kindB = UnsignedByte(kinds[b]);
+            if(!CanCollapse[kindA][kindB] && !CanCollapse[kindB][kindA])
+                continue;
+
+            /* Edges with both directions present are considered only once */
+            if(HasOpposite[kindA][kindB] && remap[b] > remap[a])
+                continue;
+
+            /* Two vertices on a border or a seam but not connected by it,
+               such as vertices on opposite sides of a thin strip */
+            if(kindA == kindB && (kinds[a] == Kind::Border || kinds[a] == Kind::Seam) && loop[a] != b)
+                continue;
+
+            Collapse& collapse = collapses[collapseCount++];
+            if(CanCollapse[kindA][kindB] && CanCollapse[kindB][kindA]) {
+                collapse.from = a;
+                collapse.to = b;
+                collapse.bidirectional = true;
+            } else if(CanCollapse[kindA][kindB]) {
+                collapse.from = a;
+                collapse.to = b;
+                collapse.bidirectional = false;
+            } else {
+                collapse.from = b;
+                collapse.to = a;
+                collapse.bidirectional = false;
+            }
+        }
+
+        /* Calculate the error, for bidirectional edges pick the direction
+           with a lower one */
+        for(std::size_t i = 0; i != collapseCount; ++i) {
+            Collapse& collapse = collapses[i];
+            collapse.error = collapseError(collapse.from, collapse.to);
+            if(collapse.bidirectional) {
+                const Float reverseError = collapseError(collapse.to, collapse.from);
+                if(reverseError < collapse.error) {
+                    std::swap(collapse.from, collapse.to);
+                    collapse.error = reverseError;
+                }
+            }
+            collapseOrder[i] = UnsignedInt(i);
+        }
+        std::stable_sort(collapseOrder.begin(), collapseOrder.begin() + collapseCount, [&](const UnsignedInt a, const UnsignedInt b) {
+            return collapses[a].error < collapses[b].error;
+        });
+
+        /* Most collapses remove two triangles. Limit the pass to collapses
+           with an error not too much larger than the one at the estimated
+           count to not perform expensive collapses while cheap ones may
+           appear in the next pass. */
+        const std::size_t triangleCollapseGoal = (indexCount - targetIndexCount)/3;
+        const std::size_t edgeCollapseGoal = triangleCollapseGoal/2;
+        const Float errorGoal = edgeCollapseGoal < collapseCount ?
+            1.5f*collapses[collapseOrder[edgeCollapseGoal]].error :
+            Constants::inf();
+
+        collapseLocked.resetAll();
+        std::size_t performedCount = 0;
+        std::size_t triangleCollapseCount = 0;
+        for(std::size_t i = 0; i != collapseCount; ++i) {
+            const Collapse& collapse = collapses[collapseOrder[i]];
+            if(collapse.error > errorLimit)
+                break;
+            if(triangleCollapseCount >= triangleCollapseGoal)
+                break;
+            if(collapse.error > errorGoal && triangleCollapseCount > triangleCollapseGoal/10)
+                break;
+
+            const UnsignedInt from = collapse.from;
+            const UnsignedInt to = collapse.to;
+            const UnsignedInt fromPosition = remap[from];
+            const UnsignedInt toPosition = remap[to];
+
+            /* Each position can participate in just one collapse per pass,
+               as the adjacency would be stale otherwise */
+            if(collapseLocked[fromPosition] || collapseLocked[toPosition])
+                continue;
+
+            /* Skip collapses that would flip any of the remaining triangles
+               around the source position */
+            bool flips = false;
+            for(std::size_t j = neighborOffset[fromPosition]; j != neighborOffset[fromPosition + 1] && !flips; ++j) {
+                const UnsignedInt triangle = neighbors[j];
+                std::size_t corner = 0;
+                while(positionIndices[triangle*3 + corner] != fromPosition)
+                    ++corner;
+                const UnsignedInt a = positionIndices[triangle*3 + (corner + 1) % 3];
+                const UnsignedInt b = positionIndices[triangle*3 + (corner + 2) % 3];
+                /* Triangles that get removed by the collapse */
+                if(a == toPosition || b == toPosition)
+                    continue;
+                flips = hasTriangleFlip(scaledPositions[a], scaledPositions[b], scaledPositions[fromPosition], scaledPositions[toPosition]);
+            }
+            if(flips)
+                continue;
+
+            /* For seams, collapse the other vertex at the same position as
+               well */
+            if(kinds[from] == Kind::Seam) {
+                const UnsignedInt target = seamTarget(from, to);
+                if(target == ~UnsignedInt{})
+                    continue;
+                collapseRemap[wedge[from]] = target;
+            }
+            collapseRemap[from] = to;
+
+            addQuadric(quadrics[toPosition], quadrics[fromPosition]);
+            collapseLocked.set(fromPosition);
+            collapseLocked.set(toPosition);
+            triangleCollapseCount += kinds[from] == Kind::Border ? 1 : 2;
+            resultError = Math::max(resultError, collapse.error);
+            ++performedCount;
+        }
+
+        /* Nothing more can be collapsed within the error limit */
+        if(!performedCount)
+            break;
+
+        /* Update the index buffer, dropping triangles that became
+           degenerate */
+        std::size_t outputIndexCount = 0;
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            const UnsignedInt a = collapseRemap[indices[i + 0]];
+            const UnsignedInt b = collapseRemap[indices[i + 1]];
+            const UnsignedInt c = collapseRemap[indices[i + 2]];
+            if(a == b || a == c || b == c)
+                continue;
+            indices[outputIndexCount++] = a;
+            indices[outputIndexCount++] = b;
+            indices[outputIndexCount++] = c;
+        }
+        indexCount = outputIndexCount;
+
+        /* Update the border and seam loops. If the edge was collapsed against
+           the loop direction, the vertex skips the collapsed one. */
+        remapEdgeLoops(loop);
+        remapEdgeLoops(loopback);
+    }
+
+    return {indexCount, Math::sqrt(resultError)};
+}
+
+template<class T> Containers::Pair<std::size_t, Float> simplifyInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, const std::size_t targetIndexCount, const Float maxError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3, got" << indices.size(), {});
+    CORRADE_ASSERT(!attributes.size()[0] || attributes.size()[0] == positions.size(),
+        "MeshTools::simplifyInPlace(): expected" << positions.size() << "attribute items but got" << attributes.size()[0], {});
+    CORRADE_ASSERT(attributes.size()[1] == attributeWeights.size(),
+        "MeshTools::simplifyInPlace(): expected" << attributes.size()[1] << "attribute weights but got" << attributeWeights.size(), {});
+    CORRADE_ASSERT(maxError >= 0.0f,
+        "MeshTools::simplifyInPlace(): expected a non-negative max error, got" << maxError, {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(std::size_t(indices[i]) < positions.size(),
+            "MeshTools::simplifyInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << positions.size() << "vertices", {});
+    #endif
+
+    Containers::Array<UnsignedInt> indicesInt{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indicesInt[i] = indices[i];
+
+    const Containers::Pair<std::size_t, Float> out = simplifyImplementation(indicesInt, positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+    for(std::size_t i = 0; i != out.first(); ++i)
+        indices[i] = T(indicesInt[i]);
+    return out;
+}
+
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, const std::size_t targetIndexCount, const Float maxError, const SimplifyFlags flags) {
+    return simplifyInPlaceImplementation(indices, positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, const std::size_t targetIndexCount, const Float maxError, const SimplifyFlags flags) {
+    return simplifyInPlaceImplementation(indices, positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, const std::size_t targetIndexCount, const Float maxError, const SimplifyFlags flags) {
+    return simplifyInPlaceImplementation(indices, positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, const std::size_t targetIndexCount, const Float maxError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::simplifyInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return simplifyInPlace(Containers::arrayCast<1, UnsignedInt>(indices), positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+    else if(indices.size()[1] == 2)
+        return simplifyInPlace(Containers::arrayCast<1, UnsignedShort>(indices), positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return simplifyInPlace(Containers::arrayCast<1, UnsignedByte>(indices), positions, attributes, attributeWeights, targetIndexCount, maxError, flags);
+    }
+}
+
+Trade::MeshData simplify(const Trade::MeshData& mesh, const Float targetRatio, const Float maxError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::simplify(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::simplify(): the mesh is not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::simplify(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::simplify(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(targetRatio >= 0.0f && targetRatio <= 1.0f,
+        "MeshTools::simplify(): expected target ratio to be between 0 and 1, got" << targetRatio,
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    const UnsignedInt vertexCount = mesh.vertexCount();
+
+    /* Gather the attributes that affect the collapse error into a single
+       array */
+    const Containers::Optional<UnsignedInt> normalId = mesh.findAttributeId(Trade::MeshAttribute::Normal);
+    const Containers::Optional<UnsignedInt> textureCoordinateId = mesh.findAttributeId(Trade::MeshAttribute::TextureCoordinates);
+    const Containers::Optional<UnsignedInt> colorId = mesh.findAttributeId(Trade::MeshAttribute::Color);
+    const bool hasNormals = normalId && !isVertexFormatImplementationSpecific(mesh.attributeFormat(*normalId));
+    const bool hasTextureCoordinates = textureCoordinateId && !isVertexFormatImplementationSpecific(mesh.attributeFormat(*textureCoordinateId));
+    const bool hasColors = colorId && !isVertexFormatImplementationSpecific(mesh.attributeFormat(*colorId));
+    const std::size_t componentCount = (hasNormals ? 3 : 0) + (hasTextureCoordinates ? 2 : 0) + (hasColors ? 4 : 0);
+    Containers::Array<Float> attributeData{NoInit, vertexCount*componentCount};
+    Containers::Array<Float> attributeWeights{NoInit, componentCount};
+    const Containers::StridedArrayView2D<Float> attributes{attributeData, {vertexCount, componentCount}};
+    std::size_t offset = 0;
+    if(hasNormals) {
+        mesh.normalsInto(Containers::arrayCast<1, Vector3>(attributes.sliceSize({0, offset}, {vertexCount, 3})));
+        for(std::size_t i = 0; i != 3; ++i)
+            attributeWeights[offset++] = 0.5f;
+    }
+    if(hasTextureCoordinates) {
+        mesh.textureCoordinates2DInto(Containers::arrayCast<1, Vector2>(attributes.sliceSize({0, offset}, {vertexCount, 2})));
+        for(std::size_t i = 0; i != 2; ++i)
+            attributeWeights[offset++] = 1.0f;
+    }
+    if(hasColors) {
+        mesh.colorsInto(Containers::arrayCast<1, Color4>(attributes.sliceSize({0, offset}, {vertexCount, 4})));
+        for(std::size_t i = 0; i != 4; ++i)
+            attributeWeights[offset++] = 1.0f;
+    }
+    CORRADE_INTERNAL_ASSERT(offset == componentCount);
+
+    /* Simplify a copy of the index buffer and then copy just the used prefix
+       to a new index buffer */
+    Trade::MeshData owned = copy(mesh);
+    const std::size_t targetIndexCount = std::size_t(targetRatio*mesh.indexCount())/3*3;
+    const std::size_t indexCount = simplifyInPlace(owned.mutableIndices(), owned.positions3DAsArray(), attributes, attributeWeights, targetIndexCount, maxError, flags).first();
+
+    const MeshIndexType indexType = owned.indexType();
+    const std::size_t indexTypeSize = meshIndexTypeSize(indexType);
+    Containers::Array<char> indexData{NoInit, indexCount*indexTypeSize};
+    Utility::copy(owned.indices().prefix(indexCount), Containers::StridedArrayView2D<char>{indexData, {indexCount, indexTypeSize}});
+    const Trade::MeshIndexData indices{indexType, indexData};
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        Utility::move(indexData), indices,
+        owned.releaseVertexData(), owned.releaseAttributeData(),
+        vertexCount};
+}
+
+}}
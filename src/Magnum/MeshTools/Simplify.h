@@ -0,0 +1,169 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplifyInPlace(), @ref Magnum::MeshTools::simplify(), enum @ref Magnum::MeshTools::SimplifyFlag, enum set @ref Magnum::MeshTools::SimplifyFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Mesh simplification flag
+@m_since_latest
+
+@see @ref SimplifyFlags, @ref simplifyInPlace(), @ref simplify()
+*/
+enum class SimplifyFlag: UnsignedInt {
+    /**
+     * Don't move or remove any vertices on mesh borders, i.e. on edges that
+     * belong to just one triangle. Useful for meshes that are split into
+     * chunks, such as terrain tiles, where each chunk is simplified
+     * separately but the chunk edges have to match. If not set, border
+     * vertices can still only collapse along the border.
+     */
+    LockBorder = 1 << 0
+};
+
+/**
+@brief Mesh simplification flags
+@m_since_latest
+
+@see @ref simplifyInPlace(), @ref simplify()
+*/
+typedef Containers::EnumSet<SimplifyFlag> SimplifyFlags;
+
+CORRADE_ENUMSET_OPERATORS(SimplifyFlags)
+
+/**
+@brief Simplify a mesh in-place
+@param[in,out] indices      Triangle index array to operate on
+@param[in] positions        Vertex positions
+@param[in] attributes       Additional per-vertex attributes to take into
+    account. Can be empty.
+@param[in] attributeWeights Weights for each attribute component
+@param[in] targetIndexCount Desired index count
+@param[in] maxError         Max allowed error, relative to the mesh extent
+@param[in] flags            Flags
+@return Resulting index count and the error of the simplified mesh, relative
+    to the mesh extent
+@m_since_latest
+
+Iteratively collapses edges with the lowest quadric error until the index
+count gets to or below @p targetIndexCount or until the next collapse would
+result in an error larger than @p maxError. The first returned value is the
+resulting index count, the simplified index buffer is stored in a prefix of
+@p indices of that size. The vertex data aren't modified in any way, use
+@ref optimizeVertexFetchInPlace() to remove vertices that are no longer
+referenced. Algorithm used: *Michael Garland and Paul S. Heckbert --- Surface
+Simplification Using Quadric Error Metrics, SIGGRAPH 1997,
+https://www.cs.cmu.edu/~garland/Papers/quadrics.pdf*, with topology handling
+inspired by [meshoptimizer](https://github.com/zeux/meshoptimizer).
+
+Vertices that have bitwise equal positions but differ in other attributes are
+treated as a seam --- such vertices are only collapsed along the seam, all at
+once, so there are no cracks in the simplified mesh. Similarly, vertices on
+mesh borders are only collapsed along the border, unless
+@ref SimplifyFlag::LockBorder is set in which case they're not collapsed at
+all. Vertices where more than two seams or borders meet are never collapsed.
+Collapses that would flip a triangle are skipped.
+
+The @p attributes view is expected to have the first dimension either zero or
+equal to the @p positions size, with the second dimension being the same as
+@p attributeWeights size. For every collapse the squared difference of each
+attribute component between the two vertices, multiplied by the weight, is
+added to the collapse error, penalizing collapses that would distort the
+attributes.
+
+Expects that @p indices size is divisible by @cpp 3 @ce, all indices are less
+than @p positions size and @p maxError is not negative.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, std::size_t targetIndexCount, Float maxError, SimplifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, std::size_t targetIndexCount, Float maxError, SimplifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, std::size_t targetIndexCount, Float maxError, SimplifyFlags flags = {});
+
+/**
+@brief Simplify a mesh with a type-erased index array in-place
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView2D<const Float>&, const Containers::StridedArrayView1D<const Float>&, std::size_t, Float, SimplifyFlags)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView2D<const Float>& attributes, const Containers::StridedArrayView1D<const Float>& attributeWeights, std::size_t targetIndexCount, Float maxError, SimplifyFlags flags = {});
+
+/**
+@brief Simplify mesh data
+@param mesh         Input mesh
+@param targetRatio  Desired index count relative to the original index count
+@param maxError     Max allowed error, relative to the mesh extent
+@param flags        Flags
+@m_since_latest
+
+Calls @ref simplifyInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView2D<const Float>&, const Containers::StridedArrayView1D<const Float>&, std::size_t, Float, SimplifyFlags)
+on a copy of the index data, with positions taken from the first
+@ref Trade::MeshAttribute::Position attribute. The first
+@ref Trade::MeshAttribute::Normal,
+@relativeref{Trade::MeshAttribute,TextureCoordinates} and
+@relativeref{Trade::MeshAttribute,Color} attributes, if present and not in an
+implementation-specific format, are taken into account as well, with normals
+having a weight of @cpp 0.5f @ce and the others @cpp 1.0f @ce.
+
+The returned mesh has the same index type as @p mesh and shares the vertex
+data layout with it, including the vertices that are no longer referenced.
+Pass it to @ref optimizeVertexFetch() to remove them. Expects that the mesh is
+indexed with @ref MeshPrimitive::Triangles, the index type is not
+implementation-specific, the mesh has a @ref Trade::MeshAttribute::Position
+attribute, which can be two- or three-dimensional, and @p targetRatio is
+between @cpp 0.0f @ce and @cpp 1.0f @ce.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref isVertexFormatImplementationSpecific(),
+    @ref Trade::MeshData::positions3DAsArray()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(const Trade::MeshData& mesh, Float targetRatio, Float maxError, SimplifyFlags flags = {});
+
+}}
+
+#endif
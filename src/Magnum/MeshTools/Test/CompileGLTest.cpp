@@ -120,6 +120,7 @@ struct CompileGLTest: GL::OpenGLTester {
     void morphTargetAttributes();
     void customAttribute();
     void unsupportedAttribute();
+    void unsupportedOctahedralNormals();
     void unsupportedAttributeStride();
     void implementationSpecificAttributeFormat();
 
@@ -479,7 +480,8 @@ CompileGLTest::CompileGLTest() {
                        &CompileGLTest::unsupportedAttribute},
         Containers::arraySize(CustomAttributeWarningData));
 
-    addTests({&CompileGLTest::unsupportedAttributeStride});
+    addTests({&CompileGLTest::unsupportedOctahedralNormals,
+              &CompileGLTest::unsupportedAttributeStride});
 
     addInstancedTests({&CompileGLTest::implementationSpecificAttributeFormat},
         Containers::arraySize(CustomAttributeWarningData));
@@ -1634,6 +1636,18 @@ void CompileGLTest::unsupportedAttribute() {
     #endif
 }
 
+void CompileGLTest::unsupportedOctahedralNormals() {
+    Trade::MeshData data{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+            VertexFormat::Vector2sNormalized, nullptr}
+    }};
+
+    Containers::String out;
+    Warning redirectError{&out};
+    compile(data);
+    CORRADE_COMPARE(out, "MeshTools::compile(): ignoring octahedral-encoded normals in VertexFormat::Vector2sNormalized\n");
+}
+
 void CompileGLTest::unsupportedAttributeStride() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
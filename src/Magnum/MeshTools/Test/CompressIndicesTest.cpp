@@ -32,6 +32,7 @@
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/Endianness.h>
 
+#include "Magnum/Executor.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/Trade/MeshData.h"
@@ -59,17 +60,32 @@ struct CompressIndicesTest: TestSuite::Tester {
     void compressDeprecated();
     #endif
 
+    void compressInPlace();
+    void compressInPlaceKeepType();
+    void compressInPlaceInvalid();
+
     template<class T> void compressMeshData();
     void compressMeshDataMove();
+    void compressMeshDataMoveIndicesInPlace();
+    void compressMeshDataMoveIndicesInPlaceKeepSize();
     void compressMeshDataNonIndexed();
     void compressMeshDataImplementationSpecificIndexType();
     void compressMeshDataImplementationSpecificAtLeastIndexType();
+    void compressMeshDataBatch();
 
     #ifdef MAGNUM_BUILD_DEPRECATED
     void compressAsShort();
     #endif
 };
 
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
 CompressIndicesTest::CompressIndicesTest() {
     addTests({&CompressIndicesTest::compressUnsignedByte<UnsignedByte>,
               &CompressIndicesTest::compressUnsignedByte<UnsignedShort>,
@@ -88,13 +104,20 @@ CompressIndicesTest::CompressIndicesTest() {
               &CompressIndicesTest::compressDeprecated,
               #endif
 
+              &CompressIndicesTest::compressInPlace,
+              &CompressIndicesTest::compressInPlaceKeepType,
+              &CompressIndicesTest::compressInPlaceInvalid,
+
               &CompressIndicesTest::compressMeshData<UnsignedByte>,
               &CompressIndicesTest::compressMeshData<UnsignedShort>,
               &CompressIndicesTest::compressMeshData<UnsignedInt>,
               &CompressIndicesTest::compressMeshDataMove,
+              &CompressIndicesTest::compressMeshDataMoveIndicesInPlace,
+              &CompressIndicesTest::compressMeshDataMoveIndicesInPlaceKeepSize,
               &CompressIndicesTest::compressMeshDataNonIndexed,
               &CompressIndicesTest::compressMeshDataImplementationSpecificIndexType,
               &CompressIndicesTest::compressMeshDataImplementationSpecificAtLeastIndexType,
+              &CompressIndicesTest::compressMeshDataBatch,
 
               #ifdef MAGNUM_BUILD_DEPRECATED
               &CompressIndicesTest::compressAsShort
@@ -256,6 +279,51 @@ void CompressIndicesTest::compressDeprecated() {
 }
 #endif
 
+void CompressIndicesTest::compressInPlace() {
+    UnsignedInt indices[]{75000 + 1, 75000 + 256, 75000 + 0, 75000 + 5};
+    const Containers::StridedArrayView2D<char> view = Containers::arrayCast<2, char>(Containers::stridedArrayView(indices));
+
+    CORRADE_COMPARE(compressIndicesInPlace(view, MeshIndexType::UnsignedByte, 75000), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedShort>(Containers::arrayView(indices)).prefix(4),
+        Containers::arrayView<UnsignedShort>({1, 256, 0, 5}),
+        TestSuite::Compare::Container);
+
+    /* 16-bit to 8-bit */
+    UnsignedShort indicesShort[]{1000 + 1, 1000 + 200, 1000 + 0, 1000 + 5};
+    CORRADE_COMPARE(compressIndicesInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indicesShort)), MeshIndexType::UnsignedByte, 1000), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedByte>(Containers::arrayView(indicesShort)).prefix(4),
+        Containers::arrayView<UnsignedByte>({1, 200, 0, 5}),
+        TestSuite::Compare::Container);
+}
+
+void CompressIndicesTest::compressInPlaceKeepType() {
+    UnsignedByte indices[]{1, 2, 3, 0, 4};
+
+    /* The default is UnsignedShort, which can't be done in place */
+    CORRADE_COMPARE(compressIndicesInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices))), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedByte>({1, 2, 3, 0, 4}),
+        TestSuite::Compare::Container);
+}
+
+void CompressIndicesTest::compressInPlaceInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    compressIndicesInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 1}});
+    compressIndicesInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}});
+    compressIndicesInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}}, meshIndexTypeWrap(0xcaca));
+    compressIndicesInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}}, MeshIndexType::UnsignedShort, -75000);
+    CORRADE_COMPARE(out,
+        "MeshTools::compressIndicesInPlace(): the view is not contiguous\n"
+        "MeshTools::compressIndicesInPlace(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::compressIndicesInPlace(): can't compress to an implementation-specific index type 0xcaca\n"
+        "MeshTools::compressIndicesInPlace(): indices offset by -75000 need MeshIndexType::UnsignedInt which doesn't fit in place\n");
+}
+
 template<class T> void CompressIndicesTest::compressMeshData() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -340,6 +408,68 @@ void CompressIndicesTest::compressMeshDataMove() {
     CORRADE_VERIFY(compressed.vertexData().data() == positionView.data());
 }
 
+void CompressIndicesTest::compressMeshDataMoveIndicesInPlace() {
+    Vector2 positions[103]{};
+    /* The indices are not at the start of the array to verify they get moved
+       there */
+    Containers::Array<char> indexData{ValueInit, 8 + 5*4};
+    Containers::ArrayView<UnsignedInt> indexView = Containers::arrayCast<UnsignedInt>(indexData.exceptPrefix(8));
+    indexView[0] = 102;
+    indexView[1] = 101;
+    indexView[2] = 100;
+    indexView[3] = 101;
+    indexView[4] = 102;
+    const char* indexDataPointer = indexData.data();
+    Trade::MeshData data{MeshPrimitive::TriangleFan,
+        Utility::move(indexData), Trade::MeshIndexData{indexView},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    Trade::MeshData compressed = compressIndices(Utility::move(data));
+    CORRADE_COMPARE(compressed.indexCount(), 5);
+    CORRADE_COMPARE(compressed.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(compressed.indexOffset(), 0);
+    CORRADE_COMPARE_AS(compressed.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({2, 1, 0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(compressed.vertexCount(), 3);
+
+    /* The indices got narrower, so they're copied to an array of the exact
+       size after being compressed in place */
+    CORRADE_VERIFY(compressed.indexData().data() != indexDataPointer);
+    CORRADE_COMPARE(compressed.indexData().size(), 5*2);
+}
+
+void CompressIndicesTest::compressMeshDataMoveIndicesInPlaceKeepSize() {
+    Vector2 positions[103]{};
+    Containers::Array<char> indexData{ValueInit, 5*2};
+    Containers::ArrayView<UnsignedShort> indexView = Containers::arrayCast<UnsignedShort>(indexData);
+    indexView[0] = 102;
+    indexView[1] = 101;
+    indexView[2] = 100;
+    indexView[3] = 101;
+    indexView[4] = 102;
+    const char* indexDataPointer = indexData.data();
+    Trade::MeshData data{MeshPrimitive::TriangleFan,
+        Utility::move(indexData), Trade::MeshIndexData{indexView},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    Trade::MeshData compressed = compressIndices(Utility::move(data));
+    CORRADE_COMPARE(compressed.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(compressed.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({2, 1, 0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(compressed.vertexCount(), 3);
+
+    /* The type stays the same and there's nothing else in the array, so it's
+       transferred without any copy */
+    CORRADE_VERIFY(compressed.indexData().data() == indexDataPointer);
+    CORRADE_COMPARE(compressed.indexData().size(), 5*2);
+}
+
 void CompressIndicesTest::compressMeshDataNonIndexed() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -385,6 +515,63 @@ void CompressIndicesTest::compressMeshDataImplementationSpecificAtLeastIndexType
         "MeshTools::compressIndices(): can't compress to an implementation-specific index type 0xcaca\n");
 }
 
+void CompressIndicesTest::compressMeshDataBatch() {
+    Vector2 positions[103]{};
+
+    Containers::Array<char> indexDataInt{NoInit, 5*4};
+    Containers::ArrayView<UnsignedInt> indexViewInt = Containers::arrayCast<UnsignedInt>(indexDataInt);
+    indexViewInt[0] = 102;
+    indexViewInt[1] = 101;
+    indexViewInt[2] = 100;
+    indexViewInt[3] = 101;
+    indexViewInt[4] = 102;
+
+    Containers::Array<char> indexDataShort{NoInit, 3*2};
+    Containers::ArrayView<UnsignedShort> indexViewShort = Containers::arrayCast<UnsignedShort>(indexDataShort);
+    indexViewShort[0] = 3;
+    indexViewShort[1] = 1;
+    indexViewShort[2] = 2;
+
+    Trade::MeshData meshes[]{
+        Trade::MeshData{MeshPrimitive::Triangles,
+            Utility::move(indexDataInt), Trade::MeshIndexData{indexViewInt},
+            {}, positions, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+            }},
+        /* Non-indexed meshes are passed through */
+        Trade::MeshData{MeshPrimitive::Points,
+            {}, positions, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+            }},
+        Trade::MeshData{MeshPrimitive::Triangles,
+            Utility::move(indexDataShort), Trade::MeshIndexData{indexViewShort},
+            {}, positions, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+            }},
+    };
+
+    std::size_t calls = 0;
+    compressIndicesInPlace(meshes, MeshIndexType::UnsignedByte, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+
+    CORRADE_COMPARE(meshes[0].indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(meshes[0].indices<UnsignedByte>(),
+        Containers::arrayView<UnsignedByte>({2, 1, 0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(meshes[0].indexData().size(), 5);
+    CORRADE_COMPARE(meshes[0].vertexCount(), 3);
+
+    CORRADE_VERIFY(!meshes[1].isIndexed());
+    CORRADE_COMPARE(meshes[1].vertexCount(), 103);
+
+    CORRADE_COMPARE(meshes[2].indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(meshes[2].indices<UnsignedByte>(),
+        Containers::arrayView<UnsignedByte>({2, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(meshes[2].indexData().size(), 3);
+    CORRADE_COMPARE(meshes[2].vertexCount(), 102);
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void CompressIndicesTest::compressAsShort() {
     CORRADE_SKIP_IF_NO_ASSERT();
@@ -56,6 +56,17 @@ struct ConcatenateTest: TestSuite::Tester {
     void concatenateImplementationSpecificIndexType();
     void concatenateImplementationSpecificVertexFormat();
     void concatenateIntoNoMeshes();
+
+    void concatenator();
+    void concatenatorNotIndexed();
+    void concatenatorNoAttributes();
+    void concatenatorPreallocated();
+    void concatenatorReleaseReuse();
+
+    void concatenatorUnsupportedPrimitive();
+    void concatenatorImplementationSpecificVertexFormat();
+    void concatenatorAddInconsistentPrimitive();
+    void concatenatorAddImplementationSpecificIndexType();
 };
 
 const struct {
@@ -67,6 +78,16 @@ const struct {
     {"don't preserve layout", InterleaveFlags{}, false},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt reserveIndexCount, reserveVertexCount;
+} ConcatenatorData[]{
+    {"", 0, 0},
+    {"reserved", 9, 7},
+    {"reserved too little", 1, 1},
+    {"reserved too much", 1000, 1000},
+};
+
 ConcatenateTest::ConcatenateTest() {
     addInstancedTests({&ConcatenateTest::concatenate},
         Containers::arraySize(ConcatenateData));
@@ -88,6 +109,19 @@ ConcatenateTest::ConcatenateTest() {
               &ConcatenateTest::concatenateImplementationSpecificIndexType,
               &ConcatenateTest::concatenateImplementationSpecificVertexFormat,
               &ConcatenateTest::concatenateIntoNoMeshes});
+
+    addInstancedTests({&ConcatenateTest::concatenator},
+        Containers::arraySize(ConcatenatorData));
+
+    addTests({&ConcatenateTest::concatenatorNotIndexed,
+              &ConcatenateTest::concatenatorNoAttributes,
+              &ConcatenateTest::concatenatorPreallocated,
+              &ConcatenateTest::concatenatorReleaseReuse,
+
+              &ConcatenateTest::concatenatorUnsupportedPrimitive,
+              &ConcatenateTest::concatenatorImplementationSpecificVertexFormat,
+              &ConcatenateTest::concatenatorAddInconsistentPrimitive,
+              &ConcatenateTest::concatenatorAddImplementationSpecificIndexType});
 }
 
 /* MSVC 2015 doesn't like unnamed bitfields in local structs, so this has to
@@ -841,6 +875,398 @@ void ConcatenateTest::concatenateIntoNoMeshes() {
     CORRADE_COMPARE(out, "MeshTools::concatenateInto(): no meshes passed\n");
 }
 
+/* MSVC 2015 doesn't like unnamed bitfields in local structs, so this has to
+   be outside */
+struct ConcatenatorVertexA {
+    Vector3 position;
+    Int:32;
+    Vector2 textureCoordinates;
+};
+
+void ConcatenateTest::concatenator() {
+    auto&& data = ConcatenatorData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    using namespace Math::Literals;
+
+    /* First is non-indexed, its layout including the gap gets preserved */
+    const ConcatenatorVertexA vertexDataA[]{
+        {{1.0f, 2.0f, 3.0f}, {0.1f, 0.2f}},
+        {{4.0f, 5.0f, 6.0f}, {0.3f, 0.4f}}
+    };
+    Containers::StridedArrayView1D<const ConcatenatorVertexA> verticesA = vertexDataA;
+    Trade::MeshData a{MeshPrimitive::Triangles, {}, vertexDataA, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            verticesA.slice(&ConcatenatorVertexA::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            verticesA.slice(&ConcatenatorVertexA::textureCoordinates)}
+    }};
+
+    /* Second is indexed, has an extra color that gets ignored and no texture
+       coordinates, which get zero-filled */
+    const struct VertexB {
+        Color3 color;
+        Vector3 position;
+    } vertexDataB[]{
+        {0x112233_rgbf, {7.0f, 8.0f, 9.0f}},
+        {0x445566_rgbf, {1.5f, 2.5f, 3.5f}},
+        {0x778899_rgbf, {4.5f, 5.5f, 6.5f}},
+    };
+    Containers::StridedArrayView1D<const VertexB> verticesB = vertexDataB;
+    const UnsignedByte indicesB[]{2, 1, 0, 0, 1, 2};
+    Trade::MeshData b{MeshPrimitive::Triangles,
+        {}, indicesB, Trade::MeshIndexData{indicesB}, {}, vertexDataB, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Color,
+                verticesB.slice(&VertexB::color)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                verticesB.slice(&VertexB::position)}
+        }};
+
+    /* Third is again non-indexed */
+    const Vector3 positionsC[]{
+        {0.5f, 0.25f, 0.125f},
+        {0.25f, 0.125f, 0.5f}
+    };
+    Trade::MeshData c{MeshPrimitive::Triangles, {}, positionsC, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positionsC)}
+    }};
+
+    MeshTools::Concatenator concatenator{a};
+    CORRADE_COMPARE(concatenator.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(concatenator.vertexStride(), sizeof(ConcatenatorVertexA));
+    CORRADE_COMPARE(concatenator.meshCount(), 0);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexCount(), 0);
+    CORRADE_VERIFY(concatenator.indexData().isEmpty());
+    CORRADE_VERIFY(concatenator.vertexData().isEmpty());
+
+    if(data.reserveIndexCount || data.reserveVertexCount)
+        concatenator.reserve(data.reserveIndexCount, data.reserveVertexCount);
+
+    /* Non-indexed so far */
+    concatenator.add(a);
+    CORRADE_COMPARE(concatenator.meshCount(), 1);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexCount(), 2);
+    CORRADE_VERIFY(concatenator.indexData().isEmpty());
+    CORRADE_COMPARE(concatenator.vertexData().size(), 2*sizeof(ConcatenatorVertexA));
+
+    /* First indexed mesh generates trivial indices for the first */
+    concatenator
+        .add(b)
+        .add(c);
+    CORRADE_COMPARE(concatenator.meshCount(), 3);
+    CORRADE_VERIFY(concatenator.isIndexed());
+    CORRADE_COMPARE(concatenator.indexCount(), 10);
+    CORRADE_COMPARE(concatenator.vertexCount(), 7);
+    CORRADE_COMPARE(concatenator.indexData().size(), 10*4);
+    CORRADE_COMPARE(concatenator.vertexData().size(), 7*sizeof(ConcatenatorVertexA));
+
+    Trade::MeshData dst = concatenator.release();
+    CORRADE_COMPARE(dst.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(dst.indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(dst.vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(dst.vertexCount(), 7);
+    CORRADE_COMPARE(dst.attributeCount(), 2);
+    CORRADE_COMPARE(dst.attributeStride(0), sizeof(ConcatenatorVertexA));
+    CORRADE_COMPARE(dst.attributeOffset(0), 0);
+    CORRADE_COMPARE(dst.attributeOffset(1), sizeof(Vector3) + 4);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f},
+            {1.5f, 2.5f, 3.5f},
+            {4.5f, 5.5f, 6.5f},
+            {0.5f, 0.25f, 0.125f},
+            {0.25f, 0.125f, 0.5f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.1f, 0.2f},
+            {0.3f, 0.4f},
+            {}, {}, {}, /* Missing in the second mesh */
+            {}, {}      /* Missing in the third mesh */
+        }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(dst.isIndexed());
+    CORRADE_COMPARE(dst.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1,               /* implicit for the first nonindexed mesh */
+            4, 3, 2, 2, 3, 4,   /* offset for the second indexed mesh */
+            5, 6                /* implicit + offset for the third mesh */
+        }), TestSuite::Compare::Container);
+
+    /* The output should be the same as with concatenate() */
+    Trade::MeshData expected = MeshTools::concatenate({a, b, c});
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        expected.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        TestSuite::Compare::Container);
+
+    /* The instance is reset after release */
+    CORRADE_COMPARE(concatenator.meshCount(), 0);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexStride(), sizeof(ConcatenatorVertexA));
+}
+
+void ConcatenateTest::concatenatorNotIndexed() {
+    const Vector3 positionA[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f}
+    };
+    Trade::MeshData a{MeshPrimitive::Points, {}, positionA, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positionA)}
+    }};
+
+    const Vector3 positionB[]{
+        {1.5f, 2.5f, 3.5f},
+        {4.5f, 5.5f, 6.5f},
+        {7.5f, 8.5f, 9.5f},
+    };
+    Trade::MeshData b{MeshPrimitive::Points, {}, positionB, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positionB)}
+    }};
+
+    MeshTools::Concatenator concatenator{a};
+    concatenator
+        .add(a)
+        .add(b)
+        .add(b);
+    CORRADE_COMPARE(concatenator.meshCount(), 3);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexCount(), 8);
+
+    Trade::MeshData dst = concatenator.release();
+    CORRADE_COMPARE(dst.primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(dst.attributeCount(), 1);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {1.5f, 2.5f, 3.5f},
+            {4.5f, 5.5f, 6.5f},
+            {7.5f, 8.5f, 9.5f},
+            {1.5f, 2.5f, 3.5f},
+            {4.5f, 5.5f, 6.5f},
+            {7.5f, 8.5f, 9.5f}
+        }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(!dst.isIndexed());
+}
+
+void ConcatenateTest::concatenatorNoAttributes() {
+    const UnsignedShort indices[]{0, 1, 2, 1, 2, 3};
+    Trade::MeshData a{MeshPrimitive::Triangles, 3};
+    Trade::MeshData b{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 4};
+
+    MeshTools::Concatenator concatenator{b};
+    CORRADE_COMPARE(concatenator.vertexStride(), 0);
+
+    concatenator
+        .add(a)
+        .add(b);
+    Trade::MeshData dst = concatenator.release();
+    CORRADE_COMPARE(dst.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(dst.attributeCount(), 0);
+    CORRADE_COMPARE(dst.vertexCount(), 7);
+    CORRADE_VERIFY(dst.vertexData().isEmpty());
+    CORRADE_VERIFY(dst.isIndexed());
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 2,
+            3, 4, 5, 4, 5, 6
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorPreallocated() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f}
+    };
+    const UnsignedShort indices[]{2, 1, 0};
+    Trade::MeshData a{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(positions)}
+        }};
+
+    /* Deliberately having a custom deleter to verify it doesn't get
+       reallocated while it fits */
+    char indexStorage[4*6 + 3];
+    char vertexStorage[sizeof(Vector3)*6 + 5];
+    Containers::Array<char> indexData{indexStorage, sizeof(indexStorage), [](char*, std::size_t){}};
+    Containers::Array<char> vertexData{vertexStorage, sizeof(vertexStorage), [](char*, std::size_t){}};
+
+    MeshTools::Concatenator concatenator{a, Utility::move(indexData), Utility::move(vertexData)};
+    concatenator
+        .add(a)
+        .add(a);
+    CORRADE_COMPARE(concatenator.indexData().data(), static_cast<const void*>(indexStorage));
+    CORRADE_COMPARE(concatenator.vertexData().data(), static_cast<const void*>(vertexStorage));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(concatenator.indexData()),
+        Containers::arrayView<UnsignedInt>({
+            2, 1, 0, 5, 4, 3
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector3>(concatenator.vertexData()),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f},
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f}
+        }), TestSuite::Compare::Container);
+
+    /* Adding one more mesh reallocates */
+    concatenator.add(a);
+    CORRADE_VERIFY(concatenator.indexData().data() != static_cast<const void*>(indexStorage));
+    CORRADE_VERIFY(concatenator.vertexData().data() != static_cast<const void*>(vertexStorage));
+
+    Trade::MeshData dst = concatenator.release();
+    CORRADE_COMPARE(dst.vertexCount(), 9);
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            2, 1, 0, 5, 4, 3, 8, 7, 6
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f},
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f},
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorReleaseReuse() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f}
+    };
+    const UnsignedShort indices[]{1, 0};
+    Trade::MeshData a{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(positions)}
+        }};
+    Trade::MeshData b{MeshPrimitive::Lines, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+
+    MeshTools::Concatenator concatenator{a};
+    concatenator
+        .add(a)
+        .add(a);
+    Trade::MeshData first = concatenator.release();
+    CORRADE_VERIFY(first.isIndexed());
+    CORRADE_COMPARE(first.vertexCount(), 4);
+
+    /* After a release the instance starts from scratch, so adding a
+       non-indexed mesh results in a non-indexed output again */
+    concatenator.add(b);
+    Trade::MeshData second = concatenator.release();
+    CORRADE_VERIFY(!second.isIndexed());
+    CORRADE_COMPARE_AS(second.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+
+    /* The first mesh isn't affected by the reuse */
+    CORRADE_COMPARE_AS(first.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            1, 0, 3, 2
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorUnsupportedPrimitive() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData a{MeshPrimitive::TriangleStrip, 0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::Concatenator{a};
+    CORRADE_COMPARE(out, "MeshTools::Concatenator: MeshPrimitive::TriangleStrip is not supported, turn it into a plain indexed mesh first\n");
+}
+
+void ConcatenateTest::concatenatorImplementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData a{MeshPrimitive::Lines, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color,
+            vertexFormatWrap(0xcaca), nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::Concatenator{a};
+    CORRADE_COMPARE(out, "MeshTools::Concatenator: attribute 1 of the layout mesh has an implementation-specific format 0xcaca\n");
+}
+
+void ConcatenateTest::concatenatorAddInconsistentPrimitive() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData a{MeshPrimitive::Triangles, 3};
+    Trade::MeshData b{MeshPrimitive::Lines, 2};
+
+    MeshTools::Concatenator concatenator{a};
+    concatenator
+        .add(a)
+        .add(a);
+
+    Containers::String out;
+    Error redirectError{&out};
+    concatenator.add(b);
+    CORRADE_COMPARE(out, "MeshTools::Concatenator::add(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines in mesh 2\n");
+
+    /* The failed mesh isn't counted */
+    CORRADE_COMPARE(concatenator.meshCount(), 2);
+    CORRADE_COMPARE(concatenator.vertexCount(), 6);
+}
+
+void ConcatenateTest::concatenatorAddImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData a{MeshPrimitive::Lines, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+    }};
+    const Trade::MeshData b{MeshPrimitive::Lines,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                VertexFormat::Vector3, nullptr},
+        }};
+
+    MeshTools::Concatenator concatenator{a};
+
+    Containers::String out;
+    Error redirectError{&out};
+    concatenator.add(b);
+    CORRADE_COMPARE(out, "MeshTools::Concatenator::add(): mesh 0 has an implementation-specific index type 0xcaca\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ConcatenateTest)
@@ -0,0 +1,388 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/MeshTools/ConvertAttributes.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct ConvertAttributesTest: TestSuite::Tester {
+    explicit ConvertAttributesTest();
+
+    void convert();
+    void unpack();
+    void integers();
+    void morphTargets();
+    void arrayAttribute();
+    void multipleBlocks();
+    void passthrough();
+
+    void implementationSpecificFormat();
+    void invalidConversion();
+};
+
+using namespace Math::Literals;
+
+ConvertAttributesTest::ConvertAttributesTest() {
+    addTests({&ConvertAttributesTest::convert,
+              &ConvertAttributesTest::unpack,
+              &ConvertAttributesTest::integers,
+              &ConvertAttributesTest::morphTargets,
+              &ConvertAttributesTest::arrayAttribute,
+              &ConvertAttributesTest::multipleBlocks,
+              &ConvertAttributesTest::passthrough,
+
+              &ConvertAttributesTest::implementationSpecificFormat,
+              &ConvertAttributesTest::invalidConversion});
+}
+
+void ConvertAttributesTest::convert() {
+    const UnsignedShort indices[]{2, 1, 0, 1};
+    const struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Color4 color;
+    } vertices[]{
+        {{-1.0f, 2.0f, 5.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.5f, 1.0f}},
+        {{3.0f, 0.5f, -0.25f}, {0.6f, 0.8f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f}},
+        /* Out-of-range color values get clamped */
+        {{0.0f, 4.0f, 6.0f}, {0.0f, 1.0f, 0.0f}, {1.5f, -0.5f, 1.0f, 1.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::color)}
+        }};
+
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3h},
+        {Trade::MeshAttribute::Color, VertexFormat::Vector4ubNormalized}
+    });
+    CORRADE_COMPARE(out.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(out.isIndexed());
+    CORRADE_COMPARE(out.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(out.indices<UnsignedShort>(),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.vertexCount(), 3);
+    CORRADE_COMPARE(out.attributeCount(), 3);
+
+    /* The output has each attribute aligned to its component size, so the
+       float normal is padded after the half-float position */
+    CORRADE_COMPARE(out.attributeStride(0), 6 + 2 + 12 + 4);
+    CORRADE_COMPARE(out.vertexData().size(), 3*(6 + 2 + 12 + 4));
+    CORRADE_COMPARE(out.attributeOffset(0), 0);
+    CORRADE_COMPARE(out.attributeOffset(1), 8);
+    CORRADE_COMPARE(out.attributeOffset(2), 20);
+
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3h);
+    CORRADE_COMPARE_AS(out.attribute<Vector3h>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3h>({
+        {-1.0_h, 2.0_h, 5.0_h},
+        {3.0_h, 0.5_h, -0.25_h},
+        {0.0_h, 4.0_h, 6.0_h}
+    }), TestSuite::Compare::Container);
+
+    /* Attributes that aren't listed are copied unchanged */
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Normal), VertexFormat::Vector3);
+    CORRADE_COMPARE_AS(out.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        view.slice(&Vertex::normal),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Color), VertexFormat::Vector4ubNormalized);
+    CORRADE_COMPARE_AS(out.attribute<Color4ub>(Trade::MeshAttribute::Color), Containers::arrayView<Color4ub>({
+        {255, 0, 128, 255},
+        {0, 255, 0, 0},
+        {255, 0, 255, 255}
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::unpack() {
+    const struct Vertex {
+        Vector2s textureCoordinates;
+        Color3ub color;
+    } vertices[]{
+        {{0, 32767}, {255, 0, 51}},
+        {{-32767, 16384}, {0, 102, 255}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2sNormalized, view.slice(&Vertex::textureCoordinates)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color, VertexFormat::Vector3ubNormalized, view.slice(&Vertex::color)}
+    }};
+
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2},
+        {Trade::MeshAttribute::Color, VertexFormat::Vector3}
+    });
+    CORRADE_COMPARE(out.attributeStride(0), 8 + 12);
+    CORRADE_COMPARE_AS(out.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates), Containers::arrayView<Vector2>({
+        {0.0f, 1.0f},
+        {-1.0f, 0.500015f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<Color3>(Trade::MeshAttribute::Color), Containers::arrayView<Color3>({
+        {1.0f, 0.0f, 0.2f},
+        {0.0f, 0.4f, 1.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::integers() {
+    const struct Vertex {
+        UnsignedInt objectId;
+        Int custom;
+    } vertices[]{
+        /* Not representable in a 32-bit float, has to go through an integer
+           path to stay exact */
+        {16777217, -16777217},
+        {65535, 7},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId, view.slice(&Vertex::objectId)},
+        Trade::MeshAttributeData{Trade::meshAttributeCustom(0), view.slice(&Vertex::custom)}
+    }};
+
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::meshAttributeCustom(0), VertexFormat::Short},
+        {Trade::MeshAttribute::ObjectId, VertexFormat::UnsignedShort},
+        /* The last occurrence is used */
+        {Trade::meshAttributeCustom(0), VertexFormat::Int}
+    });
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::ObjectId), VertexFormat::UnsignedShort);
+    CORRADE_COMPARE_AS(out.attribute<UnsignedShort>(Trade::MeshAttribute::ObjectId), Containers::arrayView<UnsignedShort>({
+        1, 65535
+    }), TestSuite::Compare::Container);
+
+    /* Same format, passed through */
+    CORRADE_COMPARE(out.attributeFormat(Trade::meshAttributeCustom(0)), VertexFormat::Int);
+    CORRADE_COMPARE_AS(out.attribute<Int>(Trade::meshAttributeCustom(0)), Containers::arrayView<Int>({
+        -16777217, 7
+    }), TestSuite::Compare::Container);
+
+    Trade::MeshData outWide = MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::ObjectId, VertexFormat::UnsignedInt},
+        {Trade::meshAttributeCustom(0), VertexFormat::UnsignedInt}
+    });
+    CORRADE_COMPARE_AS(outWide.attribute<UnsignedInt>(Trade::meshAttributeCustom(0)), Containers::arrayView<UnsignedInt>({
+        4278190079u, 7
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::morphTargets() {
+    const struct Vertex {
+        Vector3 position;
+        Vector3 morphedPosition;
+        Vector3 morphedNormal;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {-2.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}},
+        {{1.0f, 1.0f, 1.0f}, {1.0f, 3.0f, 1.0f}, {0.0f, -1.0f, 0.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::morphedPosition), 0},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::morphedNormal), 0}
+    }};
+
+    /* All attributes of given name are converted, including morph targets */
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3h},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized}
+    });
+    CORRADE_COMPARE(out.attributeCount(), 3);
+    CORRADE_COMPARE(out.attributeMorphTargetId(0), -1);
+    CORRADE_COMPARE(out.attributeMorphTargetId(1), 0);
+    CORRADE_COMPARE(out.attributeMorphTargetId(2), 0);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3h);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Position, 0, 0), VertexFormat::Vector3h);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Normal, 0, 0), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE_AS(out.attribute<Vector3h>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3h>({
+        {0.0_h, 0.0_h, 0.0_h},
+        {1.0_h, 1.0_h, 1.0_h}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<Vector3h>(Trade::MeshAttribute::Position, 0, 0), Containers::arrayView<Vector3h>({
+        {-2.0_h, 0.0_h, 0.0_h},
+        {1.0_h, 3.0_h, 1.0_h}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<Vector3b>(Trade::MeshAttribute::Normal, 0, 0), Containers::arrayView<Vector3b>({
+        {0, 0, -127},
+        {0, -127, 0}
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::arrayAttribute() {
+    const struct Vertex {
+        Vector3 position;
+        Float weights[3];
+    } vertices[]{
+        {{1.0f, 2.0f, 3.0f}, {0.5f, 0.25f, 0.25f}},
+        {{4.0f, 5.0f, 6.0f}, {1.0f, 0.0f, 0.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::meshAttributeCustom(3), VertexFormat::Float, view.slice(&Vertex::weights), 3}
+    }};
+
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::meshAttributeCustom(3), VertexFormat::UnsignedByteNormalized}
+    });
+    /* The stride is rounded up to four bytes */
+    CORRADE_COMPARE(out.attributeStride(0), 12 + 3 + 1);
+    CORRADE_COMPARE(out.attributeFormat(1), VertexFormat::UnsignedByteNormalized);
+    CORRADE_COMPARE(out.attributeArraySize(1), 3);
+    CORRADE_COMPARE_AS(out.attribute<Vector3>(Trade::MeshAttribute::Position),
+        view.slice(&Vertex::position),
+        TestSuite::Compare::Container);
+
+    Containers::StridedArrayView2D<const UnsignedByte> weights = out.attribute<UnsignedByte[]>(1);
+    CORRADE_COMPARE_AS(weights[0], Containers::arrayView<UnsignedByte>({
+        128, 64, 64
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(weights[1], Containers::arrayView<UnsignedByte>({
+        255, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::multipleBlocks() {
+    /* More than one block of vertices, with the last one incomplete */
+    Containers::Array<Vector3> positions{NoInit, 1000};
+    Containers::Array<Vector3h> expected{NoInit, 1000};
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        positions[i] = {Float(i), -Float(i), 0.5f};
+        expected[i] = Vector3h{positions[i]};
+    }
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3h}
+    });
+    CORRADE_COMPARE(out.vertexCount(), 1000);
+    CORRADE_COMPARE_AS(out.attribute<Vector3h>(Trade::MeshAttribute::Position),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::passthrough() {
+    const Vector2 positions[]{
+        {1.0f, 2.0f},
+        {3.0f, 4.0f}
+    };
+
+    const Trade::MeshData mesh{MeshPrimitive::Lines, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    /* Attributes that aren't in the mesh are ignored, same format is a
+       no-op */
+    Trade::MeshData out = MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector2},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3sNormalized}
+    });
+    CORRADE_COMPARE(out.primitive(), MeshPrimitive::Lines);
+    CORRADE_VERIFY(!out.isIndexed());
+    CORRADE_COMPARE(out.attributeCount(), 1);
+    CORRADE_COMPARE(out.attributeFormat(0), VertexFormat::Vector2);
+    CORRADE_COMPARE_AS(out.attribute<Vector2>(0),
+        Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+}
+
+void ConvertAttributesTest::implementationSpecificFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[2]{};
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xdead), Containers::arrayView(positions)}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3}
+    });
+    MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, vertexFormatWrap(0xcafe)}
+    });
+    CORRADE_COMPARE(out,
+        "MeshTools::convertAttributes(): attribute 1 has an implementation-specific format 0xdead\n"
+        "MeshTools::convertAttributes(): can't convert Trade::MeshAttribute::Position to an implementation-specific format 0xcafe\n");
+}
+
+void ConvertAttributesTest::invalidConversion() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct Vertex {
+        Vector3 position;
+        Float matrix[6];
+    } vertices[2]{};
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::meshAttributeCustom(1), VertexFormat::Matrix3x2, view.slice(&Vertex::matrix)}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::convertAttributes(mesh, {
+        {Trade::meshAttributeCustom(1), VertexFormat::Vector3}
+    });
+    MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector4h}
+    });
+    MeshTools::convertAttributes(mesh, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3d}
+    });
+    CORRADE_COMPARE(out,
+        "MeshTools::convertAttributes(): can't convert Trade::MeshAttribute::Custom(1) from VertexFormat::Matrix3x2 to VertexFormat::Vector3, matrix formats are not supported\n"
+        "MeshTools::convertAttributes(): can't convert Trade::MeshAttribute::Position from VertexFormat::Vector3 to VertexFormat::Vector4h with a different component count\n"
+        "MeshTools::convertAttributes(): VertexFormat::Vector3d is not a valid format for Trade::MeshAttribute::Position\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ConvertAttributesTest)
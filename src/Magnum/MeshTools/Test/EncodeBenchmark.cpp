@@ -0,0 +1,236 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Encode.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct EncodeBenchmark: TestSuite::Tester {
+    explicit EncodeBenchmark();
+
+    void ratioBegin();
+    std::uint64_t ratioEnd();
+
+    void vertexBufferRatio();
+    void indexBufferRatio();
+
+    void encodeVertexBuffer();
+    void decodeVertexBuffer();
+    void encodeIndexBuffer();
+    void decodeIndexBuffer();
+
+    private:
+        std::size_t _originalSize, _encodedSize;
+};
+
+/* A 256x256 vertex grid with a sine wave displacement */
+constexpr UnsignedInt GridSize = 256;
+constexpr UnsignedInt VertexCount = GridSize*GridSize;
+constexpr UnsignedInt IndexCount = (GridSize - 1)*(GridSize - 1)*6;
+
+const struct {
+    const char* name;
+    bool quantized;
+} Data[]{
+    {"float positions, normals, texture coordinates", false},
+    {"quantized positions, normals, texture coordinates", true},
+};
+
+struct FloatVertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+
+struct QuantizedVertex {
+    Vector3us position;
+    Vector3b normal;
+    Byte padding;
+    Vector2us textureCoordinates;
+};
+
+Containers::Array<char> vertexData(bool quantized) {
+    Containers::Array<char> out{ValueInit, VertexCount*(quantized ? sizeof(QuantizedVertex) : sizeof(FloatVertex))};
+    for(UnsignedInt y = 0; y != GridSize; ++y) {
+        for(UnsignedInt x = 0; x != GridSize; ++x) {
+            const Vector2 position = Vector2{Vector2ui{x, y}}/Float(GridSize - 1);
+            const Float height = Math::sin(Rad(position.x()*8.0f))*Math::cos(Rad(position.y()*8.0f))*0.125f;
+            const Vector3 normal = Vector3{-height, height, 1.0f}.normalized();
+            const std::size_t i = y*GridSize + x;
+            if(quantized) {
+                QuantizedVertex& vertex = reinterpret_cast<QuantizedVertex*>(out.data())[i];
+                vertex.position = Math::pack<Vector3us>(Vector3{position, height*0.5f + 0.5f});
+                vertex.normal = Math::pack<Vector3b>(normal);
+                vertex.textureCoordinates = Math::pack<Vector2us>(position);
+            } else {
+                FloatVertex& vertex = reinterpret_cast<FloatVertex*>(out.data())[i];
+                vertex.position = Vector3{position, height};
+                vertex.normal = normal;
+                vertex.textureCoordinates = position;
+            }
+        }
+    }
+    return out;
+}
+
+/* Ordered as strips, which is close to what a vertex cache optimizer would
+   produce. Vertex order is unchanged, i.e. it's not optimized for fetch. */
+Containers::Array<UnsignedInt> indexData() {
+    Containers::Array<UnsignedInt> out{NoInit, IndexCount};
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != GridSize - 1; ++y) {
+        for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+            const UnsignedInt a = y*GridSize + x;
+            const UnsignedInt b = a + 1;
+            const UnsignedInt c = a + GridSize;
+            const UnsignedInt d = c + 1;
+            for(UnsignedInt index: {a, c, b, b, c, d})
+                out[i++] = index;
+        }
+    }
+    return out;
+}
+
+EncodeBenchmark::EncodeBenchmark() {
+    addCustomInstancedBenchmarks({&EncodeBenchmark::vertexBufferRatio}, 1,
+        Containers::arraySize(Data),
+        &EncodeBenchmark::ratioBegin,
+        &EncodeBenchmark::ratioEnd,
+        BenchmarkUnits::PercentageThousandths);
+
+    addCustomBenchmarks({&EncodeBenchmark::indexBufferRatio}, 1,
+        &EncodeBenchmark::ratioBegin,
+        &EncodeBenchmark::ratioEnd,
+        BenchmarkUnits::PercentageThousandths);
+
+    addInstancedBenchmarks({&EncodeBenchmark::encodeVertexBuffer,
+                            &EncodeBenchmark::decodeVertexBuffer}, 10,
+        Containers::arraySize(Data));
+
+    addBenchmarks({&EncodeBenchmark::encodeIndexBuffer,
+                   &EncodeBenchmark::decodeIndexBuffer}, 10);
+}
+
+void EncodeBenchmark::ratioBegin() {
+    setBenchmarkName("encoded size");
+    _originalSize = _encodedSize = 0;
+}
+
+std::uint64_t EncodeBenchmark::ratioEnd() {
+    /* If the test failed, exit early as continuing would cause a division by
+       zero. */
+    if(!_originalSize) return {};
+
+    return _encodedSize*100000ull/_originalSize;
+}
+
+void EncodeBenchmark::vertexBufferRatio() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> vertices = vertexData(data.quantized);
+    const Containers::StridedArrayView2D<const char> view{vertices, {VertexCount, vertices.size()/VertexCount}};
+    CORRADE_BENCHMARK(1) {
+        _encodedSize = MeshTools::encodeVertexBuffer(view).size();
+        _originalSize = vertices.size();
+    }
+}
+
+void EncodeBenchmark::indexBufferRatio() {
+    const Containers::Array<UnsignedInt> indices = indexData();
+    CORRADE_BENCHMARK(1) {
+        _encodedSize = MeshTools::encodeIndexBuffer(indices).size();
+        _originalSize = indices.size()*sizeof(UnsignedInt);
+    }
+}
+
+void EncodeBenchmark::encodeVertexBuffer() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> vertices = vertexData(data.quantized);
+    const Containers::StridedArrayView2D<const char> view{vertices, {VertexCount, vertices.size()/VertexCount}};
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += MeshTools::encodeVertexBuffer(view).size();
+
+    CORRADE_VERIFY(size);
+}
+
+void EncodeBenchmark::decodeVertexBuffer() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> vertices = vertexData(data.quantized);
+    const std::size_t vertexSize = vertices.size()/VertexCount;
+    const Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {VertexCount, vertexSize}});
+    Containers::Array<char> decoded{NoInit, vertices.size()};
+
+    bool success = true;
+    CORRADE_BENCHMARK(1)
+        success = success && MeshTools::decodeVertexBufferInto(encoded, Containers::StridedArrayView2D<char>{decoded, {VertexCount, vertexSize}});
+
+    CORRADE_VERIFY(success);
+    CORRADE_COMPARE_AS(decoded, vertices,
+        TestSuite::Compare::Container);
+}
+
+void EncodeBenchmark::encodeIndexBuffer() {
+    const Containers::Array<UnsignedInt> indices = indexData();
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += MeshTools::encodeIndexBuffer(indices).size();
+
+    CORRADE_VERIFY(size);
+}
+
+void EncodeBenchmark::decodeIndexBuffer() {
+    const Containers::Array<UnsignedInt> indices = indexData();
+    const Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(indices);
+    Containers::Array<UnsignedInt> decoded{NoInit, indices.size()};
+
+    bool success = true;
+    CORRADE_BENCHMARK(1)
+        success = success && MeshTools::decodeIndexBufferInto(encoded, decoded);
+
+    CORRADE_VERIFY(success);
+    CORRADE_COMPARE_AS(decoded, indices,
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::EncodeBenchmark)
@@ -0,0 +1,458 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/Encode.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct EncodeTest: TestSuite::Tester {
+    explicit EncodeTest();
+
+    void vertexBuffer();
+    void vertexBufferRoundtrip();
+    void vertexBufferRoundtripStrided();
+    void vertexBufferConstant();
+    void vertexBufferEmpty();
+    void vertexBufferNonContiguous();
+    void vertexBufferDecodeInvalid();
+    void vertexBufferDecodeUnsupportedVersion();
+    void vertexBufferDecodeTrailingData();
+
+    void indexBuffer();
+    template<class T> void indexBufferRoundtrip();
+    void indexBufferIncompleteTriangle();
+    void indexBufferErased();
+    void indexBufferErasedNonContiguous();
+    void indexBufferErasedWrongIndexSize();
+    void indexBufferDecodeOutOfRange();
+    void indexBufferDecodeInvalid();
+    void indexBufferDecodeUnsupportedVersion();
+    void indexBufferDecodeTrailingData();
+};
+
+const struct {
+    const char* name;
+    std::size_t vertexCount, vertexSize;
+} VertexBufferRoundtripData[]{
+    {"single vertex", 1, 12},
+    {"less than a group", 15, 12},
+    {"exactly a group", 16, 12},
+    {"one more than a group", 17, 12},
+    {"less than four groups", 50, 7},
+    {"exactly a block", 256, 16},
+    {"one more than a block", 257, 16},
+    {"many blocks", 1000, 32},
+    {"single byte", 600, 1},
+    {"three bytes", 600, 3},
+    {"odd size", 600, 13},
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+    const char* message;
+} VertexBufferDecodeInvalidData[]{
+    {"empty", 0,
+        "the data are empty\n"},
+    {"truncated header", 1,
+        "unexpected end of data\n"},
+    {"truncated group", 6,
+        "unexpected end of data\n"},
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+    const char* message;
+} IndexBufferDecodeInvalidData[]{
+    {"empty", 0,
+        "the data are empty\n"},
+    {"truncated control byte", 1,
+        "unexpected end of data\n"},
+    {"truncated index", 3,
+        "unexpected end of data\n"},
+};
+
+/* Every other byte changes slowly, like upper bytes of quantized positions,
+   the others are noise */
+Containers::Array<char> vertexData(std::size_t count, std::size_t size) {
+    Containers::Array<char> out{NoInit, count*size};
+    UnsignedInt seed = 1;
+    for(std::size_t i = 0; i != count; ++i) {
+        for(std::size_t k = 0; k != size; ++k) {
+            seed = seed*1103515245u + 12345u;
+            out[i*size + k] = k % 2 ?
+                char(seed >> 16) :
+                char(i*(k + 1)/3 + (seed >> 30));
+        }
+    }
+    return out;
+}
+
+/* A triangle grid ordered as strips, so each triangle except for the first
+   one in a row shares an edge with the previous one. Vertices are numbered in
+   order of first use, like after optimizeVertexFetchInPlace(). In the middle
+   there's a triangle referencing a far away vertex. */
+template<class T> Containers::Array<T> indexData(UnsignedInt gridSize, UnsignedInt farIndex) {
+    Containers::Array<T> out{NoInit, (gridSize - 1)*(gridSize - 1)*6 + 3};
+    Containers::Array<UnsignedInt> remap{DirectInit, gridSize*gridSize, ~UnsignedInt{}};
+    UnsignedInt vertexCount = 0;
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != gridSize - 1; ++y) {
+        for(UnsignedInt x = 0; x != gridSize - 1; ++x) {
+            const UnsignedInt a = y*gridSize + x;
+            const UnsignedInt b = a + 1;
+            const UnsignedInt c = a + gridSize;
+            const UnsignedInt d = c + 1;
+            for(UnsignedInt index: {a, c, b, b, c, d}) {
+                if(remap[index] == ~UnsignedInt{})
+                    remap[index] = vertexCount++;
+                out[i++] = T(remap[index]);
+            }
+        }
+
+        if(y == gridSize/2) {
+            out[i++] = T(farIndex);
+            out[i++] = T(0);
+            out[i++] = T(remap[y*gridSize]);
+        }
+    }
+    CORRADE_INTERNAL_ASSERT(i == out.size());
+    return out;
+}
+
+EncodeTest::EncodeTest() {
+    addTests({&EncodeTest::vertexBuffer});
+
+    addInstancedTests({&EncodeTest::vertexBufferRoundtrip,
+                       &EncodeTest::vertexBufferRoundtripStrided},
+        Containers::arraySize(VertexBufferRoundtripData));
+
+    addTests({&EncodeTest::vertexBufferConstant,
+              &EncodeTest::vertexBufferEmpty,
+              &EncodeTest::vertexBufferNonContiguous});
+
+    addInstancedTests({&EncodeTest::vertexBufferDecodeInvalid},
+        Containers::arraySize(VertexBufferDecodeInvalidData));
+
+    addTests({&EncodeTest::vertexBufferDecodeUnsupportedVersion,
+              &EncodeTest::vertexBufferDecodeTrailingData});
+
+    addTests({&EncodeTest::indexBuffer,
+              &EncodeTest::indexBufferRoundtrip<UnsignedByte>,
+              &EncodeTest::indexBufferRoundtrip<UnsignedShort>,
+              &EncodeTest::indexBufferRoundtrip<UnsignedInt>,
+              &EncodeTest::indexBufferIncompleteTriangle,
+              &EncodeTest::indexBufferErased,
+              &EncodeTest::indexBufferErasedNonContiguous,
+              &EncodeTest::indexBufferErasedWrongIndexSize,
+              &EncodeTest::indexBufferDecodeOutOfRange});
+
+    addInstancedTests({&EncodeTest::indexBufferDecodeInvalid},
+        Containers::arraySize(IndexBufferDecodeInvalidData));
+
+    addTests({&EncodeTest::indexBufferDecodeUnsupportedVersion,
+              &EncodeTest::indexBufferDecodeTrailingData});
+}
+
+void EncodeTest::vertexBuffer() {
+    /* Differences 1 and 2, zigzagged to 2 and 4, fitting into four bits. The
+       group is padded with zero differences. */
+    const char vertices[]{1, 3};
+    Containers::Array<char> out = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {2, 1}});
+    CORRADE_COMPARE_AS(out, Containers::arrayView<char>({
+        '\x01',             /* version */
+        '\x02',             /* one group with four-bit values */
+        '\x42', 0, 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+
+    char decoded[2];
+    CORRADE_VERIFY(MeshTools::decodeVertexBufferInto(out, Containers::StridedArrayView2D<char>{decoded, {2, 1}}));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(vertices),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::vertexBufferRoundtrip() {
+    auto&& data = VertexBufferRoundtripData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> vertices = vertexData(data.vertexCount, data.vertexSize);
+    Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {data.vertexCount, data.vertexSize}});
+
+    Containers::Array<char> decoded{ValueInit, vertices.size()};
+    CORRADE_VERIFY(MeshTools::decodeVertexBufferInto(encoded, Containers::StridedArrayView2D<char>{decoded, {data.vertexCount, data.vertexSize}}));
+    CORRADE_COMPARE_AS(decoded, vertices,
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::vertexBufferRoundtripStrided() {
+    auto&& data = VertexBufferRoundtripData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Encoding from and decoding to a view with padding between vertices,
+       which shouldn't get touched */
+    const std::size_t stride = data.vertexSize + 3;
+    const Containers::Array<char> vertices = vertexData(data.vertexCount, stride);
+    Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {data.vertexCount, data.vertexSize}, {std::ptrdiff_t(stride), 1}});
+
+    Containers::Array<char> decoded{DirectInit, vertices.size(), '\xcd'};
+    CORRADE_VERIFY(MeshTools::decodeVertexBufferInto(encoded, Containers::StridedArrayView2D<char>{decoded, {data.vertexCount, data.vertexSize}, {std::ptrdiff_t(stride), 1}}));
+    for(std::size_t i = 0; i != data.vertexCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(decoded.sliceSize(i*stride, data.vertexSize),
+            vertices.sliceSize(i*stride, data.vertexSize),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(decoded.sliceSize(i*stride + data.vertexSize, 3),
+            Containers::arrayView({'\xcd', '\xcd', '\xcd'}),
+            TestSuite::Compare::Container);
+    }
+}
+
+void EncodeTest::vertexBufferConstant() {
+    /* Constant data should encode to just the bit width headers, one byte
+       for each four of the 16 groups of each vertex byte */
+    Containers::Array<char> vertices{DirectInit, 256*4, '\x00'};
+    Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {256, 4}});
+    CORRADE_COMPARE(encoded.size(), 1 + 4*4);
+
+    Containers::Array<char> decoded{DirectInit, vertices.size(), '\xff'};
+    CORRADE_VERIFY(MeshTools::decodeVertexBufferInto(encoded, Containers::StridedArrayView2D<char>{decoded, {256, 4}}));
+    CORRADE_COMPARE_AS(decoded, vertices,
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::vertexBufferEmpty() {
+    Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{nullptr, {0, 12}});
+    CORRADE_COMPARE_AS(encoded, Containers::arrayView({'\x01'}),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(MeshTools::decodeVertexBufferInto(encoded, Containers::StridedArrayView2D<char>{nullptr, {0, 12}}));
+}
+
+void EncodeTest::vertexBufferNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char vertices[12]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {3, 2}, {4, 2}});
+    MeshTools::decodeVertexBufferInto(Containers::arrayView({'\x01'}), Containers::StridedArrayView2D<char>{vertices, {3, 2}, {4, 2}});
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeVertexBuffer(): second view dimension is not contiguous\n"
+        "MeshTools::decodeVertexBufferInto(): second view dimension is not contiguous\n");
+}
+
+void EncodeTest::vertexBufferDecodeInvalid() {
+    auto&& data = VertexBufferDecodeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const char vertices[]{1, 3};
+    Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {2, 1}});
+    CORRADE_COMPARE(encoded.size(), 10);
+
+    char decoded[2];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeVertexBufferInto(encoded.prefix(data.size), Containers::StridedArrayView2D<char>{decoded, {2, 1}}));
+    CORRADE_COMPARE(out, Utility::format("MeshTools::decodeVertexBufferInto(): {}", data.message));
+}
+
+void EncodeTest::vertexBufferDecodeUnsupportedVersion() {
+    char decoded[1];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeVertexBufferInto(Containers::arrayView({'\x02', '\x00'}), Containers::StridedArrayView2D<char>{decoded, {1, 1}}));
+    CORRADE_COMPARE(out, "MeshTools::decodeVertexBufferInto(): unsupported version 2\n");
+}
+
+void EncodeTest::vertexBufferDecodeTrailingData() {
+    const char vertices[]{1, 3};
+    Containers::Array<char> encoded = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{vertices, {2, 1}});
+    arrayAppend(encoded, '\x00');
+
+    char decoded[2];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeVertexBufferInto(encoded, Containers::StridedArrayView2D<char>{decoded, {2, 1}}));
+    CORRADE_COMPARE(out, "MeshTools::decodeVertexBufferInto(): expected 10 bytes but got 11\n");
+}
+
+void EncodeTest::indexBuffer() {
+    /* The first triangle has all three indices predicted, the second shares
+       the 2-1 edge with the first and its remaining index is predicted as
+       well */
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+    Containers::Array<char> out = MeshTools::encodeIndexBuffer(indices);
+    CORRADE_COMPARE_AS(out, Containers::arrayView<char>({
+        '\x01',             /* version */
+        '\x37',             /* no shared edge, all three predicted */
+        '\x41'              /* second most recent edge, rotation 0,
+                               predicted */
+    }), TestSuite::Compare::Container);
+
+    UnsignedInt decoded[6];
+    CORRADE_VERIFY(MeshTools::decodeIndexBufferInto(out, decoded));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void EncodeTest::indexBufferRoundtrip() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const Containers::Array<T> indices = indexData<T>(sizeof(T) == 1 ? 15 : 100, T(~T{}));
+    Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(Containers::stridedArrayView(indices));
+
+    /* Most triangles reuse an edge and half of them have the remaining index
+       predicted as well, so it should be less than the original size even
+       for 8-bit indices */
+    CORRADE_COMPARE_AS(encoded.size(), indices.size()*sizeof(T),
+        TestSuite::Compare::Less);
+
+    Containers::Array<T> decoded{ValueInit, indices.size()};
+    CORRADE_VERIFY(MeshTools::decodeIndexBufferInto(encoded, Containers::stridedArrayView(decoded)));
+    CORRADE_COMPARE_AS(decoded, indices,
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indexBufferIncompleteTriangle() {
+    const UnsignedInt indices[]{0, 1, 2, 70000, 5};
+    Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(indices);
+
+    UnsignedInt decoded[5];
+    CORRADE_VERIFY(MeshTools::decodeIndexBufferInto(encoded, decoded));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indexBufferErased() {
+    const Containers::Array<UnsignedShort> indices = indexData<UnsignedShort>(20, 65535);
+    Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)));
+    CORRADE_COMPARE_AS(encoded,
+        MeshTools::encodeIndexBuffer(Containers::stridedArrayView(indices)),
+        TestSuite::Compare::Container);
+
+    Containers::Array<UnsignedShort> decoded{ValueInit, indices.size()};
+    CORRADE_VERIFY(MeshTools::decodeIndexBufferInto(encoded, Containers::arrayCast<2, char>(Containers::stridedArrayView(decoded))));
+    CORRADE_COMPARE_AS(decoded, indices,
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indexBufferErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::encodeIndexBuffer(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}});
+    MeshTools::decodeIndexBufferInto(Containers::arrayView({'\x01'}), Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}});
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeIndexBuffer(): second index view dimension is not contiguous\n"
+        "MeshTools::decodeIndexBufferInto(): second index view dimension is not contiguous\n");
+}
+
+void EncodeTest::indexBufferErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::encodeIndexBuffer(Containers::StridedArrayView2D<const char>{indices, {6, 3}});
+    MeshTools::decodeIndexBufferInto(Containers::arrayView({'\x01'}), Containers::StridedArrayView2D<char>{indices, {6, 3}});
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeIndexBuffer(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::decodeIndexBufferInto(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void EncodeTest::indexBufferDecodeOutOfRange() {
+    const UnsignedInt indices[]{0, 1, 300, 2, 1, 70000};
+    Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(indices);
+
+    UnsignedByte decodedBytes[6];
+    UnsignedShort decodedShorts[6];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeIndexBufferInto(encoded, decodedBytes));
+    CORRADE_VERIFY(!MeshTools::decodeIndexBufferInto(encoded, decodedShorts));
+    CORRADE_COMPARE(out,
+        "MeshTools::decodeIndexBufferInto(): index 300 doesn't fit into 8 bits\n"
+        "MeshTools::decodeIndexBufferInto(): index 70000 doesn't fit into 16 bits\n");
+}
+
+void EncodeTest::indexBufferDecodeInvalid() {
+    auto&& data = IndexBufferDecodeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The second triangle isn't predicted so it has a two-byte varint
+       stored */
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 1000};
+    Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(indices);
+    CORRADE_COMPARE(encoded.size(), 5);
+
+    UnsignedInt decoded[6];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeIndexBufferInto(encoded.prefix(data.size), decoded));
+    CORRADE_COMPARE(out, Utility::format("MeshTools::decodeIndexBufferInto(): {}", data.message));
+}
+
+void EncodeTest::indexBufferDecodeUnsupportedVersion() {
+    UnsignedInt decoded[3];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeIndexBufferInto(Containers::arrayView({'\x00', '\x37'}), decoded));
+    CORRADE_COMPARE(out, "MeshTools::decodeIndexBufferInto(): unsupported version 0\n");
+}
+
+void EncodeTest::indexBufferDecodeTrailingData() {
+    const UnsignedInt indices[]{0, 1, 2};
+    Containers::Array<char> encoded = MeshTools::encodeIndexBuffer(indices);
+    arrayAppend(encoded, '\x00');
+
+    UnsignedInt decoded[3];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshTools::decodeIndexBufferInto(encoded, decoded));
+    CORRADE_COMPARE(out, "MeshTools::decodeIndexBufferInto(): expected 2 bytes but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::EncodeTest)
@@ -0,0 +1,451 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct GenerateMeshletsTest: TestSuite::Tester {
+    explicit GenerateMeshletsTest();
+
+    template<class T> void generateMeshlets();
+    void generateMeshletsLimits();
+    void generateMeshletsEmpty();
+    void generateMeshletsBounds();
+    void generateMeshletsBoundsCone();
+    void generateMeshletsBoundsDegenerate();
+    void generateMeshletsInvalid();
+    template<class T> void generateMeshletsErased();
+    void generateMeshletsErasedNonContiguous();
+    void generateMeshletsErasedWrongIndexSize();
+
+    void generateMeshletsMeshData();
+    void generateMeshletsMeshDataInvalid();
+
+    void cullMeshletCones();
+    void cullMeshletConesInvalid();
+};
+
+/* A flat strip of four quads facing +Z, ordered for the vertex cache */
+constexpr Vector3 StripPositions[]{
+    {0.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {2.0f, 0.0f, 0.0f},
+    {2.0f, 1.0f, 0.0f},
+    {3.0f, 0.0f, 0.0f},
+    {3.0f, 1.0f, 0.0f},
+    {4.0f, 0.0f, 0.0f},
+    {4.0f, 1.0f, 0.0f}
+};
+
+constexpr UnsignedInt StripIndices[]{
+    0, 2, 3, 0, 3, 1,
+    2, 4, 5, 2, 5, 3,
+    4, 6, 7, 4, 7, 5,
+    6, 8, 9, 6, 9, 7
+};
+
+/* With at most 6 vertices and 4 triangles, the strip is split into two
+   meshlets of two quads each, both with the same local index layout */
+constexpr Meshlet StripMeshlets[]{
+    {0, 0, 6, 4},
+    {6, 12, 6, 4}
+};
+
+constexpr UnsignedInt StripMeshletVertices[]{
+    0, 2, 3, 1, 4, 5,
+    4, 6, 7, 5, 8, 9
+};
+
+constexpr UnsignedByte StripMeshletIndices[]{
+    0, 1, 2, 0, 2, 3, 1, 4, 5, 1, 5, 2,
+    0, 1, 2, 0, 2, 3, 1, 4, 5, 1, 5, 2
+};
+
+const struct {
+    const char* name;
+    UnsignedInt maxVertexCount, maxTriangleCount;
+    UnsignedInt expectedVertexOffsets[5];
+    UnsignedInt expectedTriangleCounts[5];
+    std::size_t expectedMeshletCount;
+    std::size_t expectedVertexCount;
+} LimitsData[]{
+    {"vertex count limited", 4, 126,
+        {0, 4, 8, 12}, {2, 2, 2, 2}, 4, 16},
+    {"triangle count limited", 256, 3,
+        {0, 6, 12}, {3, 3, 2}, 3, 16},
+    {"everything in one", 64, 124,
+        {0}, {8}, 1, 10},
+    /* A fifth triangle would fit but the two new vertices it needs
+       wouldn't */
+    {"vertex count limited before triangle count", 7, 5,
+        {0, 6}, {4, 4}, 2, 12},
+};
+
+/* A roof with two slopes at 45 degrees, ridge at the top */
+constexpr Vector3 RoofPositions[]{
+    {-1.0f, 0.0f, 0.0f},
+    { 0.0f, 0.0f, 1.0f},
+    { 1.0f, 0.0f, 0.0f},
+    {-1.0f, 1.0f, 0.0f},
+    { 0.0f, 1.0f, 1.0f},
+    { 1.0f, 1.0f, 0.0f}
+};
+
+constexpr UnsignedInt RoofIndices[]{
+    0, 1, 3, 1, 4, 3,
+    1, 2, 5, 1, 5, 4
+};
+
+GenerateMeshletsTest::GenerateMeshletsTest() {
+    addTests({&GenerateMeshletsTest::generateMeshlets<UnsignedByte>,
+              &GenerateMeshletsTest::generateMeshlets<UnsignedShort>,
+              &GenerateMeshletsTest::generateMeshlets<UnsignedInt>});
+
+    addInstancedTests({&GenerateMeshletsTest::generateMeshletsLimits},
+        Containers::arraySize(LimitsData));
+
+    addTests({&GenerateMeshletsTest::generateMeshletsEmpty,
+              &GenerateMeshletsTest::generateMeshletsBounds,
+              &GenerateMeshletsTest::generateMeshletsBoundsCone,
+              &GenerateMeshletsTest::generateMeshletsBoundsDegenerate,
+              &GenerateMeshletsTest::generateMeshletsInvalid,
+              &GenerateMeshletsTest::generateMeshletsErased<UnsignedByte>,
+              &GenerateMeshletsTest::generateMeshletsErased<UnsignedShort>,
+              &GenerateMeshletsTest::generateMeshletsErased<UnsignedInt>,
+              &GenerateMeshletsTest::generateMeshletsErasedNonContiguous,
+              &GenerateMeshletsTest::generateMeshletsErasedWrongIndexSize,
+
+              &GenerateMeshletsTest::generateMeshletsMeshData,
+              &GenerateMeshletsTest::generateMeshletsMeshDataInvalid,
+
+              &GenerateMeshletsTest::cullMeshletCones,
+              &GenerateMeshletsTest::cullMeshletConesInvalid});
+}
+
+template<class T> void GenerateMeshletsTest::generateMeshlets() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(StripIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(StripIndices); ++i)
+        indices[i] = StripIndices[i];
+
+    MeshletData out = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), StripPositions, 6, 4);
+    CORRADE_COMPARE(out.meshlets.size(), 2);
+    CORRADE_COMPARE(out.bounds.size(), 2);
+    for(std::size_t i = 0; i != out.meshlets.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out.meshlets[i].vertexOffset, StripMeshlets[i].vertexOffset);
+        CORRADE_COMPARE(out.meshlets[i].indexOffset, StripMeshlets[i].indexOffset);
+        CORRADE_COMPARE(out.meshlets[i].vertexCount, StripMeshlets[i].vertexCount);
+        CORRADE_COMPARE(out.meshlets[i].triangleCount, StripMeshlets[i].triangleCount);
+    }
+    CORRADE_COMPARE_AS(out.vertices,
+        Containers::arrayView(StripMeshletVertices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.indices,
+        Containers::arrayView(StripMeshletIndices),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsLimits() {
+    auto&& data = LimitsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    MeshletData out = MeshTools::generateMeshlets(Containers::stridedArrayView(StripIndices), StripPositions, data.maxVertexCount, data.maxTriangleCount);
+    CORRADE_COMPARE(out.meshlets.size(), data.expectedMeshletCount);
+    CORRADE_COMPARE(out.vertices.size(), data.expectedVertexCount);
+    CORRADE_COMPARE(out.indices.size(), Containers::arraySize(StripIndices));
+    for(std::size_t i = 0; i != out.meshlets.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out.meshlets[i].vertexOffset, data.expectedVertexOffsets[i]);
+        CORRADE_COMPARE(out.meshlets[i].triangleCount, data.expectedTriangleCounts[i]);
+        CORRADE_COMPARE_AS(out.meshlets[i].vertexCount, data.maxVertexCount,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(out.meshlets[i].triangleCount, data.maxTriangleCount,
+            TestSuite::Compare::LessOrEqual);
+    }
+
+    /* Mapping the local indices back should give the original index buffer */
+    std::size_t index = 0;
+    for(const Meshlet& meshlet: out.meshlets) {
+        for(std::size_t i = 0; i != meshlet.triangleCount*3; ++i) {
+            CORRADE_ITERATION(index);
+            CORRADE_COMPARE(out.vertices[meshlet.vertexOffset + out.indices[meshlet.indexOffset + i]], StripIndices[index]);
+            ++index;
+        }
+    }
+    CORRADE_COMPARE(index, Containers::arraySize(StripIndices));
+}
+
+void GenerateMeshletsTest::generateMeshletsEmpty() {
+    MeshletData out = MeshTools::generateMeshlets(Containers::StridedArrayView1D<const UnsignedInt>{}, {}, 64, 124);
+    CORRADE_COMPARE(out.meshlets.size(), 0);
+    CORRADE_COMPARE(out.bounds.size(), 0);
+    CORRADE_COMPARE(out.vertices.size(), 0);
+    CORRADE_COMPARE(out.indices.size(), 0);
+}
+
+void GenerateMeshletsTest::generateMeshletsBounds() {
+    MeshletData out = MeshTools::generateMeshlets(Containers::stridedArrayView(StripIndices), StripPositions, 6, 4);
+    CORRADE_COMPARE(out.bounds.size(), 2);
+
+    for(std::size_t i = 0; i != out.meshlets.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const Meshlet& meshlet = out.meshlets[i];
+        const MeshletBounds& bounds = out.bounds[i];
+
+        /* The sphere is calculated from the meshlet vertices in the order
+           they're referenced */
+        Vector3 positions[6];
+        for(std::size_t j = 0; j != meshlet.vertexCount; ++j)
+            positions[j] = StripPositions[out.vertices[meshlet.vertexOffset + j]];
+        const Containers::Pair<Vector3, Float> sphere = boundingSphereBouncingBubble(Containers::arrayView(positions).prefix(meshlet.vertexCount));
+        CORRADE_COMPARE(bounds.center, sphere.first());
+        CORRADE_COMPARE(bounds.radius, sphere.second());
+
+        /* All triangles face +Z, so the cone is a half-space with an apex
+           in the plane */
+        CORRADE_COMPARE(bounds.coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(bounds.coneCutoff, 0.0f);
+        CORRADE_COMPARE(bounds.coneApex, bounds.center);
+    }
+}
+
+void GenerateMeshletsTest::generateMeshletsBoundsCone() {
+    MeshletData out = MeshTools::generateMeshlets(Containers::stridedArrayView(RoofIndices), RoofPositions, 64, 124);
+    CORRADE_COMPARE(out.bounds.size(), 1);
+
+    /* The normals are 45 degrees from the vertical axis, the cone thus has
+       a 45 degree half-angle */
+    CORRADE_COMPARE(out.bounds[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(out.bounds[0].coneCutoff, Constants::sqrtHalf());
+}
+
+void GenerateMeshletsTest::generateMeshletsBoundsDegenerate() {
+    /* Two triangles in the same place but facing in opposite directions,
+       and one with zero area */
+    const UnsignedInt indices[]{
+        0, 2, 3,
+        0, 3, 2,
+        0, 2, 4
+    };
+
+    MeshletData out = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), StripPositions, 64, 124);
+    CORRADE_COMPARE(out.bounds.size(), 1);
+    CORRADE_COMPARE(out.bounds[0].coneAxis, Vector3{});
+    CORRADE_COMPARE(out.bounds[0].coneCutoff, 1.0f);
+    CORRADE_COMPARE(out.bounds[0].coneApex, out.bounds[0].center);
+}
+
+void GenerateMeshletsTest::generateMeshletsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices), StripPositions, 64, 124);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices).prefix(3), StripPositions, 2, 124);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices).prefix(3), StripPositions, 257, 124);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices).prefix(3), StripPositions, 64, 0);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices).prefix(3), Containers::arrayView(StripPositions).prefix(2), 64, 124);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): index count not divisible by 3, got 4\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256, got 2\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256, got 257\n"
+        "MeshTools::generateMeshlets(): max triangle count can't be zero\n"
+        "MeshTools::generateMeshlets(): index 2 out of range for 2 vertices\n");
+}
+
+template<class T> void GenerateMeshletsTest::generateMeshletsErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(StripIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(StripIndices); ++i)
+        indices[i] = StripIndices[i];
+
+    MeshletData out = MeshTools::generateMeshlets(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), StripPositions, 6, 4);
+    CORRADE_COMPARE(out.meshlets.size(), 2);
+    CORRADE_COMPARE_AS(out.vertices,
+        Containers::arrayView(StripMeshletVertices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.indices,
+        Containers::arrayView(StripMeshletIndices),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, StripPositions, 64, 124);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): second index view dimension is not contiguous\n");
+}
+
+void GenerateMeshletsTest::generateMeshletsErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, StripPositions, 64, 124);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void GenerateMeshletsTest::generateMeshletsMeshData() {
+    UnsignedShort indices[Containers::arraySize(StripIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(StripIndices); ++i)
+        indices[i] = StripIndices[i];
+
+    /* Two-dimensional positions to verify they get expanded */
+    Vector2 positions[Containers::arraySize(StripPositions)];
+    for(std::size_t i = 0; i != Containers::arraySize(StripPositions); ++i)
+        positions[i] = StripPositions[i].xy();
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(positions)}
+    }};
+
+    MeshletData out = MeshTools::generateMeshlets(mesh, 6, 4);
+    CORRADE_COMPARE(out.meshlets.size(), 2);
+    CORRADE_COMPARE_AS(out.vertices,
+        Containers::arrayView(StripMeshletVertices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.indices,
+        Containers::arrayView(StripMeshletIndices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.bounds[0].coneAxis, Vector3::zAxis());
+}
+
+void GenerateMeshletsTest::generateMeshletsMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Lines, 2}, 64, 124);
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles, 3}, 64, 124);
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1}, 64, 124);
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 1}, 64, 124);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::generateMeshlets(): the mesh is not indexed\n"
+        "MeshTools::generateMeshlets(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::generateMeshlets(): the mesh has no positions\n");
+}
+
+void GenerateMeshletsTest::cullMeshletCones() {
+    /* First is the flat strip facing +Z, second the roof, third a degenerate
+       meshlet that can never be culled */
+    const UnsignedInt degenerateIndices[]{0, 2, 3, 0, 3, 2};
+    MeshletBounds bounds[]{
+        MeshTools::generateMeshlets(Containers::stridedArrayView(StripIndices), StripPositions, 64, 124).bounds[0],
+        MeshTools::generateMeshlets(Containers::stridedArrayView(RoofIndices), RoofPositions, 64, 124).bounds[0],
+        MeshTools::generateMeshlets(Containers::stridedArrayView(degenerateIndices), StripPositions, 64, 124).bounds[0]
+    };
+
+    Containers::BitArray culled{ValueInit, 3};
+
+    /* From above everything is visible */
+    MeshTools::cullMeshletConesInto(bounds, {0.5f, 0.5f, 10.0f}, culled);
+    CORRADE_VERIFY(!culled[0]);
+    CORRADE_VERIFY(!culled[1]);
+    CORRADE_VERIFY(!culled[2]);
+
+    /* From below both the strip and the roof are backfacing */
+    MeshTools::cullMeshletConesInto(bounds, {0.5f, 0.5f, -10.0f}, culled);
+    CORRADE_VERIFY(culled[0]);
+    CORRADE_VERIFY(culled[1]);
+    CORRADE_VERIFY(!culled[2]);
+
+    /* From the side and slightly below the strip is still backfacing but one
+       slope of the roof isn't */
+    MeshTools::cullMeshletConesInto(bounds, {-10.0f, 0.5f, -1.0f}, culled);
+    CORRADE_VERIFY(culled[0]);
+    CORRADE_VERIFY(!culled[1]);
+    CORRADE_VERIFY(!culled[2]);
+
+    /* Passing the members separately does the same */
+    Containers::StridedArrayView1D<const MeshletBounds> boundsView = bounds;
+    MeshTools::cullMeshletConesInto(
+        boundsView.slice(&MeshletBounds::coneApex),
+        boundsView.slice(&MeshletBounds::coneAxis),
+        boundsView.slice(&MeshletBounds::coneCutoff),
+        {0.5f, 0.5f, -10.0f}, culled);
+    CORRADE_VERIFY(culled[0]);
+    CORRADE_VERIFY(culled[1]);
+    CORRADE_VERIFY(!culled[2]);
+}
+
+void GenerateMeshletsTest::cullMeshletConesInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 apices[3]{};
+    const Vector3 axes[2]{};
+    const Float cutoffs[3]{};
+    Containers::BitArray culled{ValueInit, 3};
+    Containers::BitArray culledDifferent{ValueInit, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::cullMeshletConesInto(apices, axes, cutoffs, {}, culled);
+    MeshTools::cullMeshletConesInto(apices, Containers::arrayView(axes).prefix(2), Containers::arrayView(cutoffs).prefix(2), {}, culledDifferent);
+    CORRADE_COMPARE(out,
+        "MeshTools::cullMeshletConesInto(): expected cone apex, axis, cutoff and output views to have the same size, got 3, 2, 3 and 3\n"
+        "MeshTools::cullMeshletConesInto(): expected cone apex, axis, cutoff and output views to have the same size, got 3, 2, 2 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateMeshletsTest)
@@ -30,7 +30,9 @@
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 
+#include "Magnum/Executor.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Duplicate.h"
@@ -51,8 +53,11 @@ struct GenerateNormalsTest: TestSuite::Tester {
     void smoothCube();
     void smoothBeveledCube();
     void smoothCylinder();
+    void smoothCylinderMultipleBlocks();
     void smoothZeroAreaTriangle();
     void smoothNanPosition();
+    void smoothAgainstScalar();
+    void smoothExecutor();
     void smoothWrongCount();
     void smoothOutOfRange();
     void smoothIntoWrongSize();
@@ -63,8 +68,17 @@ struct GenerateNormalsTest: TestSuite::Tester {
 
     void benchmarkFlat();
     void benchmarkSmooth();
+    void benchmarkSmoothLarge();
 };
 
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
 GenerateNormalsTest::GenerateNormalsTest() {
     addTests({&GenerateNormalsTest::flat,
               &GenerateNormalsTest::flatWrongCount,
@@ -76,8 +90,11 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothCube,
               &GenerateNormalsTest::smoothBeveledCube,
               &GenerateNormalsTest::smoothCylinder,
+              &GenerateNormalsTest::smoothCylinderMultipleBlocks,
               &GenerateNormalsTest::smoothZeroAreaTriangle,
               &GenerateNormalsTest::smoothNanPosition,
+              &GenerateNormalsTest::smoothAgainstScalar,
+              &GenerateNormalsTest::smoothExecutor,
               &GenerateNormalsTest::smoothWrongCount,
               &GenerateNormalsTest::smoothOutOfRange,
               &GenerateNormalsTest::smoothIntoWrongSize,
@@ -89,7 +106,8 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothErasedWrongIndexSize});
 
     addBenchmarks({&GenerateNormalsTest::benchmarkFlat,
-                   &GenerateNormalsTest::benchmarkSmooth}, 150);
+                   &GenerateNormalsTest::benchmarkSmooth,
+                   &GenerateNormalsTest::benchmarkSmoothLarge}, 150);
 }
 
 /* Two vertices connected by one edge, each wound in another direction */
@@ -310,6 +328,19 @@ void GenerateNormalsTest::smoothCylinder() {
         TestSuite::Compare::Container);
 }
 
+void GenerateNormalsTest::smoothCylinderMultipleBlocks() {
+    /* Triangles are internally processed in blocks of 256, verify that
+       non-multiple-of-the-block-size counts above it work as well */
+    const Trade::MeshData data = Primitives::cylinderSolid(4, 37, 1.0f);
+    CORRADE_COMPARE(data.indexCount()/3, 296);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(generateSmoothNormals(
+        data.indices(),
+        data.attribute<Vector3>(Trade::MeshAttribute::Position))),
+        data.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+}
+
 void GenerateNormalsTest::smoothZeroAreaTriangle() {
     constexpr Vector3 positions[] {
         {-1.0f, 0.0f, 0.0f},
@@ -345,13 +376,72 @@ void GenerateNormalsTest::smoothNanPosition() {
         0, 1, 2, 1, 2, 3
     };
 
-    Containers::Array<Vector3> generated = generateSmoothNormals(indices, positions);
+    Containers::Array<Vector3> generated = generateSmoothNormals(Containers::stridedArrayView(indices), Containers::stridedArrayView(positions));
     CORRADE_COMPARE(generated[0], Vector3::zAxis());
     CORRADE_VERIFY(Math::isNan(generated[1]).all());
     CORRADE_VERIFY(Math::isNan(generated[2]).all());
     CORRADE_VERIFY(Math::isNan(generated[3]).all());
 }
 
+void GenerateNormalsTest::smoothAgainstScalar() {
+    /* A cylinder with jittered positions so the triangles have all kinds of
+       inner angles, and with a triangle count that's neither a multiple of
+       the block size nor of the SIMD lane count */
+    const Trade::MeshData data = Primitives::cylinderSolid(7, 41, 1.0f);
+    CORRADE_COMPARE(data.indexCount()/3, 574);
+    Containers::Array<UnsignedInt> indices = data.indicesAsArray();
+    Containers::Array<Vector3> positions = data.positions3DAsArray();
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] += Vector3{std::sin(i*1.3f), std::sin(i*2.1f), std::sin(i*0.7f)}*0.05f;
+
+    /* Reference calculated the straightforward way, with std::acos() */
+    Containers::Array<Vector3> expected{ValueInit, positions.size()};
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 v0 = positions[indices[i + 0]];
+        const Vector3 v1 = positions[indices[i + 1]];
+        const Vector3 v2 = positions[indices[i + 2]];
+        const Vector3 cross = Math::cross(v2 - v1, v0 - v1);
+        const Float angle0 = std::acos(Math::dot((v1 - v0).normalized(), (v2 - v0).normalized()));
+        const Float angle1 = std::acos(Math::dot((v0 - v1).normalized(), (v2 - v1).normalized()));
+        expected[indices[i + 0]] += cross*angle0;
+        expected[indices[i + 1]] += cross*angle1;
+        expected[indices[i + 2]] += cross*(Constants::pi() - angle0 - angle1);
+    }
+    for(Vector3& i: expected) i = i.normalized();
+
+    /* The SIMD paths use an approximated acos(), the difference is
+       documented to be at most 1.0e-6f per component */
+    const Containers::Array<Vector3> normals = generateSmoothNormals(Containers::stridedArrayView(indices), Containers::stridedArrayView(positions));
+    for(std::size_t i = 0; i != normals.size(); ++i) {
+        CORRADE_ITERATION(i);
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_COMPARE_WITH(normals[i][j], expected[i][j],
+                TestSuite::Compare::around(1.0e-6f));
+    }
+}
+
+void GenerateNormalsTest::smoothExecutor() {
+    /* Large enough to be split into more than one task for both the
+       per-triangle and the per-vertex calculation */
+    const Trade::MeshData data = Primitives::cylinderSolid(128, 256, 1.0f);
+    CORRADE_COMPARE_AS(data.indexCount()/3, 4096u,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(data.vertexCount(), 16384u,
+        TestSuite::Compare::Greater);
+    const Containers::StridedArrayView1D<const Vector3> positions = data.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Containers::Array<Vector3> expected{NoInit, positions.size()};
+    generateSmoothNormalsInto(data.indices(), positions, expected);
+
+    /* The output is the same regardless of the executor */
+    std::size_t calls = 0;
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    generateSmoothNormalsInto(data.indices(), positions, normals, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 2);
+    CORRADE_COMPARE_AS(normals, expected,
+        TestSuite::Compare::Container);
+}
+
 void GenerateNormalsTest::smoothWrongCount() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -360,7 +450,7 @@ void GenerateNormalsTest::smoothWrongCount() {
 
     const UnsignedByte indices[7]{};
     const Vector3 positions[1];
-    generateSmoothNormals(indices, positions);
+    generateSmoothNormals(Containers::stridedArrayView(indices), Containers::stridedArrayView(positions));
     CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3\n");
 }
 
@@ -372,7 +462,7 @@ void GenerateNormalsTest::smoothOutOfRange() {
 
     const Vector3 positions[2];
     const UnsignedInt indices[] { 0, 1, 2 };
-    generateSmoothNormals(indices, positions);
+    generateSmoothNormals(Containers::stridedArrayView(indices), Containers::stridedArrayView(positions));
     CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): index 2 out of range for 2 elements\n");
 }
 
@@ -411,6 +501,20 @@ void GenerateNormalsTest::benchmarkSmooth() {
     CORRADE_COMPARE(Math::min(normals), (Vector3{-0.996072f, -0.997808f, -0.996072f}));
 }
 
+void GenerateNormalsTest::benchmarkSmoothLarge() {
+    const Trade::MeshData data = Primitives::cylinderSolid(256, 256, 1.0f);
+    const Containers::StridedArrayView1D<const Vector3> positions = data.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(data.indices(), positions, normals);
+    }
+
+    CORRADE_COMPARE_AS(Containers::arrayView(normals),
+        data.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void GenerateNormalsTest::smoothErased() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
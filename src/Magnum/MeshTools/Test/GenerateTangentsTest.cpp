@@ -0,0 +1,534 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct GenerateTangentsTest: TestSuite::Tester {
+    explicit GenerateTangentsTest();
+
+    template<class T> void indexed();
+    void indexedSmooth();
+    void indexedWrongCount();
+    void indexedOutOfRange();
+    template<class T> void indexedErased();
+    void indexedErasedNonContiguous();
+    void indexedErasedWrongIndexSize();
+    void indexedExecutor();
+
+    void nonIndexed();
+    void nonIndexedWrongCount();
+    void nonIndexedExecutor();
+
+    void textureCoordinateOrientation();
+    void projectedToNormal();
+    void degenerateTextureCoordinates();
+    void wrongAttributeCount();
+    void intoWrongSize();
+
+    void meshData();
+    void meshDataNotIndexed();
+    void meshDataInvalid();
+};
+
+const struct {
+    const char* name;
+    Vector2 textureCoordinates[4];
+    Vector4 expected;
+    /* Direction in which the V coordinate increases */
+    Vector3 expectedBitangent;
+} TextureCoordinateOrientationData[]{
+    {"identity", {
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}
+    }, {1.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},
+    /* U goes in the opposite direction, so the bitangent has to be flipped to
+       point in the same direction as V */
+    {"mirrored", {
+        {1.0f, 0.0f}, {0.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}
+    }, {-1.0f, 0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}},
+    /* U goes in the direction of Y, V in the direction of -X, which is still
+       right-handed */
+    {"rotated", {
+        {0.0f, 1.0f}, {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}
+    }, {0.0f, 1.0f, 0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},
+    {"scaled", {
+        {0.0f, 0.0f}, {0.25f, 0.0f}, {0.25f, 3.0f}, {0.0f, 3.0f}
+    }, {1.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},
+};
+
+const struct {
+    const char* name;
+    Primitives::GridFlags flags;
+} MeshDataData[]{
+    {"", Primitives::GridFlag::Normals|Primitives::GridFlag::TextureCoordinates},
+    {"existing tangents", Primitives::GridFlag::Normals|Primitives::GridFlag::TextureCoordinates|Primitives::GridFlag::Tangents},
+};
+
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
+/* A grid large enough to be split into several tasks, with the texture
+   coordinates distorted so the tangents aren't all the same */
+Trade::MeshData executorGrid() {
+    Trade::MeshData grid = Primitives::grid3DSolid({254, 254}, Primitives::GridFlag::Normals|Primitives::GridFlag::TextureCoordinates);
+    CORRADE_INTERNAL_ASSERT(grid.vertexCount() == 65536);
+    const Containers::StridedArrayView1D<Vector2> textureCoordinates = grid.mutableAttribute<Vector2>(Trade::MeshAttribute::TextureCoordinates);
+    for(std::size_t i = 0; i != textureCoordinates.size(); ++i)
+        textureCoordinates[i] += Vector2{std::sin(i*0.37f), std::cos(i*0.11f)}*0.001f;
+    return grid;
+}
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addTests({
+        &GenerateTangentsTest::indexed<UnsignedByte>,
+        &GenerateTangentsTest::indexed<UnsignedShort>,
+        &GenerateTangentsTest::indexed<UnsignedInt>,
+        &GenerateTangentsTest::indexedSmooth,
+        &GenerateTangentsTest::indexedWrongCount,
+        &GenerateTangentsTest::indexedOutOfRange,
+        &GenerateTangentsTest::indexedErased<UnsignedByte>,
+        &GenerateTangentsTest::indexedErased<UnsignedShort>,
+        &GenerateTangentsTest::indexedErased<UnsignedInt>,
+        &GenerateTangentsTest::indexedErasedNonContiguous,
+        &GenerateTangentsTest::indexedErasedWrongIndexSize,
+        &GenerateTangentsTest::indexedExecutor,
+
+        &GenerateTangentsTest::nonIndexed,
+        &GenerateTangentsTest::nonIndexedWrongCount,
+        &GenerateTangentsTest::nonIndexedExecutor});
+
+    addInstancedTests({&GenerateTangentsTest::textureCoordinateOrientation},
+        Containers::arraySize(TextureCoordinateOrientationData));
+
+    addTests({&GenerateTangentsTest::projectedToNormal,
+              &GenerateTangentsTest::degenerateTextureCoordinates,
+              &GenerateTangentsTest::wrongAttributeCount,
+              &GenerateTangentsTest::intoWrongSize});
+
+    addInstancedTests({&GenerateTangentsTest::meshData,
+                       &GenerateTangentsTest::meshDataNotIndexed},
+        Containers::arraySize(MeshDataData));
+
+    addTests({&GenerateTangentsTest::meshDataInvalid});
+}
+
+/* A unit quad in the XY plane with the texture coordinates matching the
+   positions
+
+    3--2
+    | /|
+    |/ |
+    0--1 */
+constexpr Vector3 QuadPositions[]{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f}
+};
+constexpr Vector3 QuadNormals[]{
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f}
+};
+constexpr Vector2 QuadTextureCoordinates[]{
+    {0.0f, 0.0f},
+    {1.0f, 0.0f},
+    {1.0f, 1.0f},
+    {0.0f, 1.0f}
+};
+
+template<class T> void GenerateTangentsTest::indexed() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 0, 2, 3};
+    CORRADE_COMPARE_AS(generateTangents(indices, QuadPositions, QuadNormals, QuadTextureCoordinates),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::indexedSmooth() {
+    /* The mapping isn't affine across the two triangles, so the first
+       triangle has the tangent in direction of X and the second in direction
+       of {4, 1}. The two shared vertices get an average weighted by the
+       angle, the other two get the tangent of their triangle. */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {2.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+    const Vector2 textureCoordinates[]{
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 2.0f}
+    };
+    const UnsignedInt indices[]{0, 1, 2, 0, 2, 3};
+
+    CORRADE_COMPARE_AS(generateTangents(indices, positions, QuadNormals, textureCoordinates),
+        Containers::arrayView<Vector4>({
+            {0.985094f, 0.172019f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {0.997402f, 0.0720374f, 0.0f, 1.0f},
+            {0.970143f, 0.242536f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::indexedWrongCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedByte indices[7]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(indices, QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): index count not divisible by 3, got 7\n");
+}
+
+void GenerateTangentsTest::indexedOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 3, 4, 0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(indices, QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): index 4 out of range for 4 elements\n");
+}
+
+template<class T> void GenerateTangentsTest::indexedErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 0, 2, 3};
+    CORRADE_COMPARE_AS(generateTangents(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), QuadPositions, QuadNormals, QuadTextureCoordinates),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::indexedErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): second index view dimension is not contiguous\n");
+}
+
+void GenerateTangentsTest::indexedErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Containers::StridedArrayView2D<const char>{indices, {6, 3}}.every({1, 2}), QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void GenerateTangentsTest::indexedExecutor() {
+    const Trade::MeshData grid = executorGrid();
+    const Containers::StridedArrayView1D<const Vector3> positions = grid.attribute<Vector3>(Trade::MeshAttribute::Position);
+    const Containers::StridedArrayView1D<const Vector3> normals = grid.attribute<Vector3>(Trade::MeshAttribute::Normal);
+    const Containers::StridedArrayView1D<const Vector2> textureCoordinates = grid.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates);
+
+    Containers::Array<Vector4> expected{NoInit, grid.vertexCount()};
+    generateTangentsInto(grid.indices(), positions, normals, textureCoordinates, expected);
+
+    /* The vertices get split into four ranges, with triangles on the range
+       boundaries contributing to more than one. The output is the same
+       regardless of the executor. */
+    std::size_t calls = 0;
+    Containers::Array<Vector4> tangents{NoInit, grid.vertexCount()};
+    generateTangentsInto(grid.indices(), positions, normals, textureCoordinates, tangents, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE_AS(tangents, expected,
+        TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::nonIndexed() {
+    /* The quad from above, with the second triangle having the texture
+       coordinates mirrored */
+    const Vector3 positions[]{
+        QuadPositions[0], QuadPositions[1], QuadPositions[2],
+        QuadPositions[0], QuadPositions[2], QuadPositions[3]
+    };
+    const Vector3 normals[]{
+        Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis(),
+        Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis()
+    };
+    const Vector2 textureCoordinates[]{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f},
+        {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}
+    };
+
+    CORRADE_COMPARE_AS(generateTangents(positions, normals, textureCoordinates),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::nonIndexedWrongCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): position count not divisible by 3, got 4\n");
+}
+
+void GenerateTangentsTest::nonIndexedExecutor() {
+    const Trade::MeshData grid = duplicate(executorGrid());
+    const Containers::StridedArrayView1D<const Vector3> positions = grid.attribute<Vector3>(Trade::MeshAttribute::Position);
+    const Containers::StridedArrayView1D<const Vector3> normals = grid.attribute<Vector3>(Trade::MeshAttribute::Normal);
+    const Containers::StridedArrayView1D<const Vector2> textureCoordinates = grid.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates);
+
+    Containers::Array<Vector4> expected{NoInit, positions.size()};
+    generateTangentsInto(positions, normals, textureCoordinates, expected);
+
+    /* The output is the same regardless of the executor */
+    std::size_t calls = 0;
+    Containers::Array<Vector4> tangents{NoInit, positions.size()};
+    generateTangentsInto(positions, normals, textureCoordinates, tangents, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE_AS(tangents, expected,
+        TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::textureCoordinateOrientation() {
+    auto&& data = TextureCoordinateOrientationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UnsignedInt indices[]{0, 1, 2, 0, 2, 3};
+    Containers::Array<Vector4> tangents = generateTangents(indices, QuadPositions, QuadNormals, data.textureCoordinates);
+    CORRADE_COMPARE_AS(tangents,
+        Containers::arrayView<Vector4>({
+            data.expected,
+            data.expected,
+            data.expected,
+            data.expected
+        }), TestSuite::Compare::Container);
+
+    /* The bitangent calculated from the tangent and its handedness should
+       point in the direction of the V coordinate */
+    CORRADE_COMPARE(Math::cross(QuadNormals[0], tangents[0].xyz())*tangents[0].w(), data.expectedBitangent);
+}
+
+void GenerateTangentsTest::projectedToNormal() {
+    /* The normals are tilted towards the tangent direction, so the generated
+       tangent has to be tilted away to stay perpendicular */
+    const Vector3 normals[]{
+        {0.6f, 0.0f, 0.8f},
+        {0.6f, 0.0f, 0.8f},
+        {0.6f, 0.0f, 0.8f}
+    };
+    const UnsignedInt indices[]{0, 1, 2};
+
+    CORRADE_COMPARE_AS(generateTangents(indices,
+        Containers::arrayView(QuadPositions).prefix(3),
+        normals,
+        Containers::arrayView(QuadTextureCoordinates).prefix(3)),
+        Containers::arrayView<Vector4>({
+            {0.8f, 0.0f, -0.6f, 1.0f},
+            {0.8f, 0.0f, -0.6f, 1.0f},
+            {0.8f, 0.0f, -0.6f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::degenerateTextureCoordinates() {
+    /* All texture coordinates are the same, so the tangent direction is
+       undefined. The output should still be a valid tangent frame. */
+    const Vector3 normals[]{
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.6f, 0.8f},
+        {0.0f, 0.0f, -1.0f}
+    };
+    const Vector2 textureCoordinates[4]{};
+    const UnsignedInt indices[]{0, 1, 2, 0, 2, 3};
+
+    CORRADE_COMPARE_AS(generateTangents(indices, QuadPositions, normals, textureCoordinates),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            /* The normal is X, so Y is picked instead */
+            {0.0f, 1.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::wrongAttributeCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+    Vector4 tangents[4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(indices, QuadPositions, Containers::arrayView(QuadNormals).prefix(3), QuadTextureCoordinates);
+    generateTangentsInto(Containers::arrayView(QuadPositions).prefix(3), Containers::arrayView(QuadNormals).prefix(3), QuadTextureCoordinates, tangents);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateTangentsInto(): expected 4 normals and texture coordinates but got 3 and 4\n"
+        "MeshTools::generateTangentsInto(): expected 3 normals and texture coordinates but got 3 and 4\n");
+}
+
+void GenerateTangentsTest::intoWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+    Vector4 tangents[5];
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangentsInto(indices, QuadPositions, QuadNormals, QuadTextureCoordinates, tangents);
+    generateTangentsInto(Containers::arrayView(QuadPositions).prefix(3), Containers::arrayView(QuadNormals).prefix(3), Containers::arrayView(QuadTextureCoordinates).prefix(3), tangents);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateTangentsInto(): bad output size, expected 4 but got 5\n"
+        "MeshTools::generateTangentsInto(): bad output size, expected 3 but got 5\n");
+}
+
+void GenerateTangentsTest::meshData() {
+    auto&& data = MeshDataData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({3, 2}, data.flags);
+
+    Trade::MeshData out = generateTangents(grid);
+    CORRADE_COMPARE(out.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(out.isIndexed());
+    CORRADE_COMPARE_AS(out.indicesAsArray(),
+        grid.indicesAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.attributeCount(), 4);
+    CORRADE_COMPARE_AS(out.attribute<Vector3>(Trade::MeshAttribute::Position),
+        grid.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        grid.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        grid.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.attributeCount(Trade::MeshAttribute::Tangent), 1);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Tangent), VertexFormat::Vector4);
+
+    /* Same as what the grid primitive generates */
+    const Vector4 expected{1.0f, 0.0f, 0.0f, 1.0f};
+    for(const Vector4& i: out.attribute<Vector4>(Trade::MeshAttribute::Tangent)) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(i, expected);
+    }
+}
+
+void GenerateTangentsTest::meshDataNotIndexed() {
+    auto&& data = MeshDataData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData grid = duplicate(Primitives::grid3DSolid({3, 2}, data.flags));
+    CORRADE_VERIFY(!grid.isIndexed());
+
+    Trade::MeshData out = generateTangents(grid);
+    CORRADE_VERIFY(!out.isIndexed());
+    CORRADE_COMPARE(out.vertexCount(), grid.vertexCount());
+    CORRADE_COMPARE(out.attributeCount(), 4);
+    CORRADE_COMPARE(out.attributeCount(Trade::MeshAttribute::Tangent), 1);
+
+    const Vector4 expected{1.0f, 0.0f, 0.0f, 1.0f};
+    for(const Vector4& i: out.attribute<Vector4>(Trade::MeshAttribute::Tangent)) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(i, expected);
+    }
+}
+
+void GenerateTangentsTest::meshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    } vertices[3]{};
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Trade::MeshData{MeshPrimitive::Lines, 2});
+    generateTangents(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1});
+    generateTangents(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    generateTangents(Trade::MeshData{MeshPrimitive::Triangles, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+    }});
+    generateTangents(Trade::MeshData{MeshPrimitive::Triangles, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xdead), view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+    }});
+    CORRADE_COMPARE(out,
+        "MeshTools::generateTangents(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::generateTangents(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::generateTangents(): the mesh has no Trade::MeshAttribute::Position\n"
+        "MeshTools::generateTangents(): the mesh has no Trade::MeshAttribute::TextureCoordinates\n"
+        "MeshTools::generateTangents(): Trade::MeshAttribute::Normal has an implementation-specific format 0xdead\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
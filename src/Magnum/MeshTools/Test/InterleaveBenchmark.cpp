@@ -0,0 +1,240 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct InterleaveBenchmark: TestSuite::Tester {
+    explicit InterleaveBenchmark();
+
+    void interleave();
+    void interleavePerAttribute();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void interleaveThreads();
+    #endif
+};
+
+/* Large enough for the output to not fit into the cache */
+constexpr UnsignedInt VertexCount = 1 << 18;
+
+struct Attribute {
+    Trade::MeshAttribute name;
+    VertexFormat format;
+    UnsignedShort arraySize;
+};
+
+/* Typical layouts coming from glTF files, where each attribute is in a
+   separate buffer view */
+const struct {
+    const char* name;
+    std::size_t attributeCount;
+    Attribute attributes[12];
+} Data[]{
+    {"position, normal, texture coordinates", 3, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2, 0},
+    }},
+    {"position, normal, tangent, texture coordinates", 4, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::Tangent, VertexFormat::Vector4, 0},
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2, 0},
+    }},
+    {"quantized position, normal, tangent, texture coordinates", 4, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3us, 0},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, 0},
+        {Trade::MeshAttribute::Tangent, VertexFormat::Vector4bNormalized, 0},
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2usNormalized, 0},
+    }},
+    {"skinned, position, normal, texture coordinates", 5, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2, 0},
+        {Trade::MeshAttribute::JointIds, VertexFormat::UnsignedByte, 4},
+        {Trade::MeshAttribute::Weights, VertexFormat::Float, 4},
+    }},
+    {"twelve attributes", 12, {
+        {Trade::MeshAttribute::Position, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::Normal, VertexFormat::Vector3, 0},
+        {Trade::MeshAttribute::Tangent, VertexFormat::Vector4, 0},
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2, 0},
+        {Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2, 0},
+        {Trade::MeshAttribute::Color, VertexFormat::Vector4, 0},
+        {Trade::MeshAttribute::Color, VertexFormat::Vector4ubNormalized, 0},
+        {Trade::MeshAttribute::JointIds, VertexFormat::UnsignedByte, 4},
+        {Trade::MeshAttribute::Weights, VertexFormat::Float, 4},
+        {Trade::MeshAttribute::JointIds, VertexFormat::UnsignedByte, 4},
+        {Trade::MeshAttribute::Weights, VertexFormat::Float, 4},
+        {Trade::MeshAttribute::ObjectId, VertexFormat::UnsignedInt, 0},
+    }},
+};
+
+/* Emscripten builds don't have threads enabled by default */
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} ThreadData[]{
+    {"serial", 0},
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8},
+};
+
+/* Spawns given count of threads for each call, each picking the next task
+   that wasn't taken yet. The thread creation is included in the measured
+   time, as it would be for an application not having a thread pool. */
+void threadExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != *static_cast<std::size_t*>(userData); ++i)
+        threads.emplace_back([&]{
+            for(std::size_t id; (id = next++) < count; )
+                task(id, state);
+        });
+    for(std::thread& thread: threads) thread.join();
+}
+#endif
+
+InterleaveBenchmark::InterleaveBenchmark() {
+    addInstancedBenchmarks({&InterleaveBenchmark::interleave,
+                            &InterleaveBenchmark::interleavePerAttribute}, 5,
+        Containers::arraySize(Data));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addInstancedBenchmarks({&InterleaveBenchmark::interleaveThreads}, 5,
+        Containers::arraySize(ThreadData));
+    #endif
+}
+
+/* Non-interleaved mesh with attributes placed one after another and filled
+   with a byte pattern */
+template<class T> Trade::MeshData mesh(const T& data) {
+    std::size_t vertexSize = 0;
+    for(std::size_t i = 0; i != data.attributeCount; ++i)
+        vertexSize += vertexFormatSize(data.attributes[i].format)*Math::max(data.attributes[i].arraySize, UnsignedShort{1});
+
+    Containers::Array<char> vertexData{NoInit, vertexSize*VertexCount};
+    for(std::size_t i = 0; i != vertexData.size(); ++i)
+        vertexData[i] = char(i*37);
+
+    Containers::Array<Trade::MeshAttributeData> attributeData{data.attributeCount};
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i != data.attributeCount; ++i) {
+        const Attribute& attribute = data.attributes[i];
+        const std::size_t size = vertexFormatSize(attribute.format)*Math::max(attribute.arraySize, UnsignedShort{1});
+        attributeData[i] = Trade::MeshAttributeData{attribute.name, attribute.format, offset, VertexCount, std::ptrdiff_t(size), attribute.arraySize};
+        offset += size*VertexCount;
+    }
+
+    return Trade::MeshData{MeshPrimitive::Triangles, Utility::move(vertexData), Utility::move(attributeData)};
+}
+
+bool attributesEqual(const Trade::MeshData& a, const Trade::MeshData& b) {
+    if(a.attributeCount() != b.attributeCount()) return false;
+    for(UnsignedInt i = 0; i != a.attributeCount(); ++i) {
+        const Containers::StridedArrayView2D<const char> aAttribute = a.attribute(i);
+        const Containers::StridedArrayView2D<const char> bAttribute = b.attribute(i);
+        for(std::size_t j = 0; j != aAttribute.size()[0]; ++j)
+            for(std::size_t k = 0; k != aAttribute.size()[1]; ++k)
+                if(aAttribute[j][k] != bAttribute[j][k]) return false;
+    }
+    return true;
+}
+
+void InterleaveBenchmark::interleave() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData input = mesh(data);
+
+    Trade::MeshData out{MeshPrimitive::Triangles, 0};
+    CORRADE_BENCHMARK(1)
+        out = MeshTools::interleave(input);
+
+    CORRADE_VERIFY(MeshTools::isInterleaved(out));
+    CORRADE_VERIFY(attributesEqual(out, input));
+}
+
+void InterleaveBenchmark::interleavePerAttribute() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData input = mesh(data);
+
+    /* The original implementation, copying one attribute after another */
+    Trade::MeshData out{MeshPrimitive::Triangles, 0};
+    CORRADE_BENCHMARK(1) {
+        out = MeshTools::interleavedLayout(input, input.vertexCount());
+        for(UnsignedInt i = 0; i != input.attributeCount(); ++i)
+            Utility::copy(input.attribute(i), out.mutableAttribute(i));
+    }
+
+    CORRADE_VERIFY(MeshTools::isInterleaved(out));
+    CORRADE_VERIFY(attributesEqual(out, input));
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void InterleaveBenchmark::interleaveThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The layout with most attributes */
+    const Trade::MeshData input = mesh(Data[Containers::arraySize(Data) - 1]);
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    Trade::MeshData out{MeshPrimitive::Triangles, 0};
+    CORRADE_BENCHMARK(1)
+        out = MeshTools::interleave(input, {}, InterleaveFlag::PreserveInterleavedAttributes, executor);
+
+    CORRADE_VERIFY(MeshTools::isInterleaved(out));
+    CORRADE_VERIFY(attributesEqual(out, input));
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveBenchmark)
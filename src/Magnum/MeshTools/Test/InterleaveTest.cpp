@@ -33,6 +33,7 @@
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Executor.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/Trade/MeshData.h"
@@ -92,6 +93,8 @@ struct InterleaveTest: Corrade::TestSuite::Tester {
     void interleaveMeshDataImplementationSpecificIndexType();
     void interleaveMeshDataImplementationSpecificVertexFormat();
     void interleaveMeshDataExtra();
+    void interleaveMeshDataMultipleBlocks();
+    void interleaveMeshDataExecutor();
     void interleaveMeshDataExtraEmpty();
     void interleaveMeshDataExtraOriginalEmpty();
     void interleaveMeshDataExtraWrongCount();
@@ -187,6 +190,8 @@ InterleaveTest::InterleaveTest() {
     addTests({&InterleaveTest::interleaveMeshDataImplementationSpecificIndexType,
               &InterleaveTest::interleaveMeshDataImplementationSpecificVertexFormat,
               &InterleaveTest::interleaveMeshDataExtra,
+              &InterleaveTest::interleaveMeshDataMultipleBlocks,
+              &InterleaveTest::interleaveMeshDataExecutor,
               &InterleaveTest::interleaveMeshDataExtraEmpty,
               &InterleaveTest::interleaveMeshDataExtraOriginalEmpty,
               &InterleaveTest::interleaveMeshDataExtraWrongCount,
@@ -1400,6 +1405,97 @@ void InterleaveTest::interleaveMeshDataExtra() {
         TestSuite::Compare::Container);
 }
 
+void InterleaveTest::interleaveMeshDataMultipleBlocks() {
+    /* The attributes are copied in blocks of 8 kB of the output, which is 256
+       vertices here. Test that the data are copied correctly for all of them
+       including the last incomplete block, with both original and extra
+       attributes. */
+    Containers::Array<Vector3> positions{NoInit, 1000};
+    Containers::Array<Vector2> textureCoordinates{NoInit, 1000};
+    Containers::Array<Vector3> normals{NoInit, 1000};
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        positions[i] = {Float(i), Float(i*2), Float(i*3)};
+        textureCoordinates[i] = {Float(i), -Float(i)};
+        normals[i] = {-Float(i), Float(i*4), Float(i*5)};
+    }
+
+    Containers::Array<char> vertexData{NoInit, positions.size()*(sizeof(Vector3) + sizeof(Vector2))};
+    Containers::ArrayView<Vector3> dataPositions = Containers::arrayCast<Vector3>(vertexData.prefix(positions.size()*sizeof(Vector3)));
+    Containers::ArrayView<Vector2> dataTextureCoordinates = Containers::arrayCast<Vector2>(vertexData.exceptPrefix(positions.size()*sizeof(Vector3)));
+    Utility::copy(positions, dataPositions);
+    Utility::copy(textureCoordinates, dataTextureCoordinates);
+    Trade::MeshData data{MeshPrimitive::Points, Utility::move(vertexData), {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, dataPositions},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, dataTextureCoordinates}
+    }};
+
+    Trade::MeshData interleaved = MeshTools::interleave(data, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(normals)}
+    });
+    CORRADE_VERIFY(MeshTools::isInterleaved(interleaved));
+    CORRADE_COMPARE(interleaved.vertexCount(), 1000);
+    CORRADE_COMPARE(interleaved.attributeCount(), 3);
+    CORRADE_COMPARE(interleaved.attributeStride(0), 32);
+    CORRADE_COMPARE_AS(interleaved.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::stridedArrayView(positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(interleaved.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        Containers::stridedArrayView(textureCoordinates),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(interleaved.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        Containers::stridedArrayView(normals),
+        TestSuite::Compare::Container);
+}
+
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
+void InterleaveTest::interleaveMeshDataExecutor() {
+    /* With the 32-byte stride a task is 64 blocks of 256 vertices, so this is
+       three tasks with the last one incomplete */
+    Containers::Array<Vector3> positions{NoInit, 40000};
+    Containers::Array<Vector2> textureCoordinates{NoInit, 40000};
+    Containers::Array<Vector3> normals{NoInit, 40000};
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        positions[i] = {Float(i), Float(i*2), Float(i*3)};
+        textureCoordinates[i] = {Float(i), -Float(i)};
+        normals[i] = {-Float(i), Float(i*4), Float(i*5)};
+    }
+
+    Containers::Array<char> vertexData{NoInit, positions.size()*(sizeof(Vector3) + sizeof(Vector2))};
+    Containers::ArrayView<Vector3> dataPositions = Containers::arrayCast<Vector3>(vertexData.prefix(positions.size()*sizeof(Vector3)));
+    Containers::ArrayView<Vector2> dataTextureCoordinates = Containers::arrayCast<Vector2>(vertexData.exceptPrefix(positions.size()*sizeof(Vector3)));
+    Utility::copy(positions, dataPositions);
+    Utility::copy(textureCoordinates, dataTextureCoordinates);
+    Trade::MeshData data{MeshPrimitive::Points, Utility::move(vertexData), {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, dataPositions},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, dataTextureCoordinates}
+    }};
+
+    std::size_t calls = 0;
+    Trade::MeshData interleaved = MeshTools::interleave(data, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(normals)}
+    }, InterleaveFlag::PreserveInterleavedAttributes, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_VERIFY(MeshTools::isInterleaved(interleaved));
+    CORRADE_COMPARE(interleaved.vertexCount(), 40000);
+    CORRADE_COMPARE(interleaved.attributeStride(0), 32);
+    CORRADE_COMPARE_AS(interleaved.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::stridedArrayView(positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(interleaved.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        Containers::stridedArrayView(textureCoordinates),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(interleaved.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        Containers::stridedArrayView(normals),
+        TestSuite::Compare::Container);
+}
+
 void InterleaveTest::interleaveMeshDataExtraEmpty() {
     Vector2 positions[]{{1.3f, 0.3f}, {0.87f, 1.1f}, {1.0f, -0.5f}};
     Trade::MeshData data{MeshPrimitive::TriangleFan,
@@ -0,0 +1,288 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/OptimizeOverdraw.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeOverdrawTest: TestSuite::Tester {
+    explicit OptimizeOverdrawTest();
+
+    template<class T> void optimizeOverdraw();
+    void optimizeOverdrawThreshold();
+    void optimizeOverdrawEmpty();
+    void optimizeOverdrawInvalid();
+    template<class T> void optimizeOverdrawErased();
+    void optimizeOverdrawErasedNonContiguous();
+    void optimizeOverdrawErasedWrongIndexSize();
+
+    void optimizeOverdrawMeshData();
+    void optimizeOverdrawMeshDataInvalid();
+};
+
+/* Two parallel quads facing +Z, the one further along +Z is listed second.
+   Switching from one to the other flushes the cache, so each is a separate
+   cluster. */
+constexpr Vector3 QuadPositions[]{
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f},
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f}
+};
+
+constexpr UnsignedInt QuadIndices[]{
+    0, 1, 2, 0, 2, 3,
+    4, 5, 6, 4, 6, 7
+};
+
+/* The outer quad, which occludes the inner one, should get drawn first */
+constexpr UnsignedInt QuadIndicesOptimized[]{
+    4, 5, 6, 4, 6, 7,
+    0, 1, 2, 0, 2, 3
+};
+
+/* A strip of four quads bent upwards along a parabola, ordered for the vertex
+   cache. It's a single cluster unless the threshold allows to split it. */
+constexpr Vector3 StripPositions[]{
+    {0.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {1.0f, 0.0f, 0.5f},
+    {1.0f, 1.0f, 0.5f},
+    {2.0f, 0.0f, 2.0f},
+    {2.0f, 1.0f, 2.0f},
+    {3.0f, 0.0f, 4.5f},
+    {3.0f, 1.0f, 4.5f},
+    {4.0f, 0.0f, 8.0f},
+    {4.0f, 1.0f, 8.0f}
+};
+
+constexpr UnsignedInt StripIndices[]{
+    0, 2, 3, 0, 3, 1,
+    2, 4, 5, 2, 5, 3,
+    4, 6, 7, 4, 7, 5,
+    6, 8, 9, 6, 9, 7
+};
+
+const struct {
+    const char* name;
+    Float threshold;
+    UnsignedInt expected[24];
+} ThresholdData[]{
+    {"1.0, single cluster", 1.0f, {
+        0, 2, 3, 0, 3, 1,
+        2, 4, 5, 2, 5, 3,
+        4, 6, 7, 4, 7, 5,
+        6, 8, 9, 6, 9, 7
+    }},
+    /* ACMR of the whole strip is 1.25, the first two triangles have an ACMR
+       of 2, which is within the 2.5 threshold. So are all the following
+       pairs after the cache reset, leading to a cluster for each quad. The
+       flattest quad at the bottom is the most inward-facing. */
+    {"2.0, cluster per quad", 2.0f, {
+        4, 6, 7, 4, 7, 5,
+        2, 4, 5, 2, 5, 3,
+        6, 8, 9, 6, 9, 7,
+        0, 2, 3, 0, 3, 1
+    }}
+};
+
+OptimizeOverdrawTest::OptimizeOverdrawTest() {
+    addTests({&OptimizeOverdrawTest::optimizeOverdraw<UnsignedByte>,
+              &OptimizeOverdrawTest::optimizeOverdraw<UnsignedShort>,
+              &OptimizeOverdrawTest::optimizeOverdraw<UnsignedInt>});
+
+    addInstancedTests({&OptimizeOverdrawTest::optimizeOverdrawThreshold},
+        Containers::arraySize(ThresholdData));
+
+    addTests({&OptimizeOverdrawTest::optimizeOverdrawEmpty,
+              &OptimizeOverdrawTest::optimizeOverdrawInvalid,
+              &OptimizeOverdrawTest::optimizeOverdrawErased<UnsignedByte>,
+              &OptimizeOverdrawTest::optimizeOverdrawErased<UnsignedShort>,
+              &OptimizeOverdrawTest::optimizeOverdrawErased<UnsignedInt>,
+              &OptimizeOverdrawTest::optimizeOverdrawErasedNonContiguous,
+              &OptimizeOverdrawTest::optimizeOverdrawErasedWrongIndexSize,
+
+              &OptimizeOverdrawTest::optimizeOverdrawMeshData,
+              &OptimizeOverdrawTest::optimizeOverdrawMeshDataInvalid});
+}
+
+template<class T> void OptimizeOverdrawTest::optimizeOverdraw() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(QuadIndices)];
+    T expected[Containers::arraySize(QuadIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(QuadIndices); ++i) {
+        indices[i] = QuadIndices[i];
+        expected[i] = QuadIndicesOptimized[i];
+    }
+
+    MeshTools::optimizeOverdrawInPlace(indices, QuadPositions, 16);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawThreshold() {
+    auto&& data = ThresholdData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    UnsignedInt indices[Containers::arraySize(StripIndices)];
+    Utility::copy(Containers::arrayView(StripIndices), Containers::arrayView(indices));
+    MeshTools::optimizeOverdrawInPlace(indices, StripPositions, 16, data.threshold);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(data.expected),
+        TestSuite::Compare::Container);
+
+    /* The cache is large enough to hold the whole strip, so the ACMR stays
+       the same */
+    CORRADE_COMPARE(MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), Containers::arraySize(StripPositions), 16).first(), 1.25f);
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawEmpty() {
+    /* Shouldn't crash or do anything */
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, {}, 16);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(indices, QuadPositions, 16);
+    MeshTools::optimizeOverdrawInPlace(Containers::arrayView(indices).prefix(3), QuadPositions, 0);
+    MeshTools::optimizeOverdrawInPlace(Containers::arrayView(indices).prefix(3), QuadPositions, 16, 0.9f);
+    MeshTools::optimizeOverdrawInPlace(Containers::arrayView(indices).prefix(3), Containers::arrayView(QuadPositions).prefix(2), 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3, got 4\n"
+        "MeshTools::optimizeOverdrawInPlace(): cache size can't be zero\n"
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1, got 0.9\n"
+        "MeshTools::optimizeOverdrawInPlace(): index 2 out of range for 2 vertices\n");
+}
+
+template<class T> void OptimizeOverdrawTest::optimizeOverdrawErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(QuadIndices)];
+    T expected[Containers::arraySize(QuadIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(QuadIndices); ++i) {
+        indices[i] = QuadIndices[i];
+        expected[i] = QuadIndicesOptimized[i];
+    }
+
+    MeshTools::optimizeOverdrawInPlace(Containers::arrayCast<2, char>(Containers::arrayView(indices)), QuadPositions, 16);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, QuadPositions, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, QuadPositions, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawMeshData() {
+    /* Deliberately not owned and with an 8-bit index type to verify the index
+       data get copied and all types work */
+    UnsignedByte indices[Containers::arraySize(QuadIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(QuadIndices); ++i)
+        indices[i] = QuadIndices[i];
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, QuadPositions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(QuadPositions)}
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeOverdraw(mesh, 16);
+    CORRADE_COMPARE(optimized.indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(optimized.indicesAsArray(),
+        Containers::arrayView(QuadIndicesOptimized),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(optimized.vertexCount(), 8);
+
+    /* The original data is untouched */
+    CORRADE_COMPARE(indices[0], 0);
+}
+
+void OptimizeOverdrawTest::optimizeOverdrawMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdraw(Trade::MeshData{MeshPrimitive::Lines, 2}, 16);
+    MeshTools::optimizeOverdraw(Trade::MeshData{MeshPrimitive::Triangles, 3}, 16);
+    MeshTools::optimizeOverdraw(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1}, 16);
+    MeshTools::optimizeOverdraw(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 1}, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdraw(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::optimizeOverdraw(): the mesh is not indexed\n"
+        "MeshTools::optimizeOverdraw(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::optimizeOverdraw(): the mesh has no positions\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeOverdrawTest)
@@ -0,0 +1,391 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeVertexCacheTest: TestSuite::Tester {
+    explicit OptimizeVertexCacheTest();
+
+    template<class T> void optimizeVertexCache();
+    void optimizeVertexCacheEmpty();
+    void optimizeVertexCacheOneDegenerateTriangle();
+    void optimizeVertexCacheInvalid();
+    template<class T> void optimizeVertexCacheErased();
+    void optimizeVertexCacheErasedNonContiguous();
+    void optimizeVertexCacheErasedWrongIndexSize();
+
+    void optimizeVertexCacheMeshData();
+    void optimizeVertexCacheMeshDataRvalue();
+    void optimizeVertexCacheMeshDataInvalid();
+
+    template<class T> void simulateVertexCache();
+    void simulateVertexCacheEmpty();
+    void simulateVertexCacheInvalid();
+    template<class T> void simulateVertexCacheErased();
+    void simulateVertexCacheErasedWrongIndexSize();
+};
+
+/* Same mesh as in TipsifyTest
+
+ 0 ----- 1 ----- 2 ----- 3
+  \ 0  /  \ 7  /  \ 2  /  \
+   \  / 11 \  / 13 \  / 12 \
+    4 ----- 5 ----- 6 ----- 7
+   /  \ 3  /  \ 8  /  \ 5  /
+  / 14 \  / 9  \  / 15 \  /
+ 8 ----- 9 ---- 10 ---- 11          18 ---- 17
+  \ 4  /  \ 1  /  \ 17 /  \           \ 18  /
+   \  / 16 \  / 10 \  / 6  \           \  /
+    12 ---- 13 ---- 14 ---- 15          16
+
+*/
+
+constexpr UnsignedInt Indices[]{
+    4, 1, 0,
+    10, 9, 13,
+    6, 3, 2,
+    9, 5, 4,
+    12, 9, 8,
+    11, 7, 6,
+
+    14, 15, 11,
+    2, 1, 5,
+    10, 6, 5,
+    10, 5, 9,
+    13, 14, 10,
+    1, 4, 5,
+
+    7, 3, 6,
+    6, 2, 5,
+    9, 4, 8,
+    6, 10, 11,
+    13, 9, 12,
+    14, 11, 10,
+
+    16, 17, 18
+};
+
+constexpr UnsignedInt VertexCount = 19;
+
+constexpr UnsignedInt OptimizedIndices[]{
+    16, 17, 18, /* isolated triangle, its vertices have the lowest valence */
+    4, 1, 0,
+    1, 4, 5,
+    2, 1, 5,
+    9, 5, 4,
+    9, 4, 8,
+    12, 9, 8,
+    13, 9, 12,
+    10, 9, 13,
+    10, 5, 9,
+    13, 14, 10,
+    6, 2, 5,
+    10, 6, 5,
+    6, 3, 2,
+    7, 3, 6,
+    11, 7, 6,
+    6, 10, 11,
+    14, 11, 10,
+    14, 15, 11
+};
+
+OptimizeVertexCacheTest::OptimizeVertexCacheTest() {
+    addTests({&OptimizeVertexCacheTest::optimizeVertexCache<UnsignedByte>,
+              &OptimizeVertexCacheTest::optimizeVertexCache<UnsignedShort>,
+              &OptimizeVertexCacheTest::optimizeVertexCache<UnsignedInt>,
+              &OptimizeVertexCacheTest::optimizeVertexCacheEmpty,
+              &OptimizeVertexCacheTest::optimizeVertexCacheOneDegenerateTriangle,
+              &OptimizeVertexCacheTest::optimizeVertexCacheInvalid,
+              &OptimizeVertexCacheTest::optimizeVertexCacheErased<UnsignedByte>,
+              &OptimizeVertexCacheTest::optimizeVertexCacheErased<UnsignedShort>,
+              &OptimizeVertexCacheTest::optimizeVertexCacheErased<UnsignedInt>,
+              &OptimizeVertexCacheTest::optimizeVertexCacheErasedNonContiguous,
+              &OptimizeVertexCacheTest::optimizeVertexCacheErasedWrongIndexSize,
+
+              &OptimizeVertexCacheTest::optimizeVertexCacheMeshData,
+              &OptimizeVertexCacheTest::optimizeVertexCacheMeshDataRvalue,
+              &OptimizeVertexCacheTest::optimizeVertexCacheMeshDataInvalid,
+
+              &OptimizeVertexCacheTest::simulateVertexCache<UnsignedByte>,
+              &OptimizeVertexCacheTest::simulateVertexCache<UnsignedShort>,
+              &OptimizeVertexCacheTest::simulateVertexCache<UnsignedInt>,
+              &OptimizeVertexCacheTest::simulateVertexCacheEmpty,
+              &OptimizeVertexCacheTest::simulateVertexCacheInvalid,
+              &OptimizeVertexCacheTest::simulateVertexCacheErased<UnsignedByte>,
+              &OptimizeVertexCacheTest::simulateVertexCacheErased<UnsignedShort>,
+              &OptimizeVertexCacheTest::simulateVertexCacheErased<UnsignedInt>,
+              &OptimizeVertexCacheTest::simulateVertexCacheErasedWrongIndexSize});
+}
+
+template<class T> void OptimizeVertexCacheTest::optimizeVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+
+    /* The mesh has as many triangles as vertices, so ACMR and ATVR are the
+       same */
+    Containers::Pair<Float, Float> before = MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), VertexCount, 4);
+    CORRADE_COMPARE(before.first(), 2.736842f);
+    CORRADE_COMPARE(before.second(), 2.736842f);
+
+    T expected[Containers::arraySize(OptimizedIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(OptimizedIndices); ++i)
+        expected[i] = OptimizedIndices[i];
+
+    MeshTools::optimizeVertexCacheInPlace(indices, VertexCount);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    Containers::Pair<Float, Float> after = MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), VertexCount, 4);
+    CORRADE_COMPARE(after.first(), 1.473684f);
+    CORRADE_COMPARE(after.second(), 1.473684f);
+
+    /* The optimizer doesn't know the cache size, it should improve also for
+       larger caches */
+    CORRADE_COMPARE_AS(
+        MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), VertexCount, 8).first(),
+        MeshTools::simulateVertexCache(Containers::stridedArrayView(Indices), VertexCount, 8).first(),
+        TestSuite::Compare::Less);
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheEmpty() {
+    /* Shouldn't crash or do anything */
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, 0);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheOneDegenerateTriangle() {
+    /* The triangle is listed three times in the vertex adjacency, each
+       occurrence should get removed exactly once */
+    UnsignedInt indices[]{0, 0, 0, 1, 0, 0};
+    MeshTools::optimizeVertexCacheInPlace(indices, 2);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({1, 0, 0, 0, 0, 0}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(indices, 4);
+    MeshTools::optimizeVertexCacheInPlace(Containers::arrayView(indices).prefix(3), 2);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3, got 4\n"
+        "MeshTools::optimizeVertexCacheInPlace(): index 2 out of range for 2 vertices\n");
+}
+
+template<class T> void OptimizeVertexCacheTest::optimizeVertexCacheErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+
+    T expected[Containers::arraySize(OptimizedIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(OptimizedIndices); ++i)
+        expected[i] = OptimizedIndices[i];
+
+    MeshTools::optimizeVertexCacheInPlace(Containers::arrayCast<2, char>(Containers::arrayView(indices)), VertexCount);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheMeshData() {
+    /* Deliberately not owned to verify the index data get copied */
+    UnsignedInt indices[Containers::arraySize(Indices)];
+    Utility::copy(Containers::arrayView(Indices), Containers::arrayView(indices));
+    Vector3 positions[VertexCount];
+    for(UnsignedInt i = 0; i != VertexCount; ++i)
+        positions[i] = Vector3{Float(i)};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(positions)}
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexCache(mesh);
+    CORRADE_COMPARE(optimized.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(optimized.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedInt>(),
+        Containers::stridedArrayView(OptimizedIndices),
+        TestSuite::Compare::Container);
+
+    /* The original data is untouched */
+    CORRADE_COMPARE(indices[0], 4);
+
+    /* Vertex data are left as they were */
+    CORRADE_COMPARE(optimized.vertexCount(), VertexCount);
+    CORRADE_COMPARE(optimized.attributeCount(), 1);
+    CORRADE_COMPARE_AS(optimized.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheMeshDataRvalue() {
+    Containers::Array<char> indexData{sizeof(Indices)};
+    Utility::copy(Containers::arrayView(Indices), Containers::arrayCast<UnsignedInt>(indexData));
+    const void* indexDataPointer = indexData.data();
+
+    Trade::MeshIndexData indices{Containers::arrayCast<const UnsignedInt>(indexData)};
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        Utility::move(indexData), indices, VertexCount};
+
+    /* The index data should be operated on in-place */
+    Trade::MeshData optimized = MeshTools::optimizeVertexCache(Utility::move(mesh));
+    CORRADE_COMPARE(static_cast<const void*>(optimized.indexData().data()), indexDataPointer);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedInt>(),
+        Containers::stridedArrayView(OptimizedIndices),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexCacheTest::optimizeVertexCacheMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCache(Trade::MeshData{MeshPrimitive::Lines, 2});
+    MeshTools::optimizeVertexCache(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    MeshTools::optimizeVertexCache(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCache(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::optimizeVertexCache(): the mesh is not indexed\n"
+        "MeshTools::optimizeVertexCache(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+template<class T> void OptimizeVertexCacheTest::simulateVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Index 5 is not referenced and thus doesn't count into ATVR */
+    const T indices[]{0, 1, 2, 2, 1, 3, 0, 3, 4};
+
+    /* With a 3-element FIFO cache, 0 gets evicted by 3, 1 gets evicted by 0
+       when it gets fetched again, total 6 misses */
+    Containers::Pair<Float, Float> three = MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), 6, 3);
+    CORRADE_COMPARE(three.first(), 6.0f/3.0f);
+    CORRADE_COMPARE(three.second(), 6.0f/5.0f);
+
+    /* With a 4-element FIFO cache, each vertex is fetched just once */
+    Containers::Pair<Float, Float> four = MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), 6, 4);
+    CORRADE_COMPARE(four.first(), 5.0f/3.0f);
+    CORRADE_COMPARE(four.second(), 1.0f);
+}
+
+void OptimizeVertexCacheTest::simulateVertexCacheEmpty() {
+    Containers::Pair<Float, Float> out = MeshTools::simulateVertexCache(Containers::StridedArrayView1D<const UnsignedInt>{}, 5, 16);
+    CORRADE_COMPARE(out.first(), 0.0f);
+    CORRADE_COMPARE(out.second(), 0.0f);
+}
+
+void OptimizeVertexCacheTest::simulateVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simulateVertexCache(Containers::stridedArrayView(indices), 4, 16);
+    MeshTools::simulateVertexCache(Containers::stridedArrayView(indices).prefix(3), 4, 0);
+    MeshTools::simulateVertexCache(Containers::stridedArrayView(indices).prefix(3), 2, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::simulateVertexCache(): index count not divisible by 3, got 4\n"
+        "MeshTools::simulateVertexCache(): cache size can't be zero\n"
+        "MeshTools::simulateVertexCache(): index 2 out of range for 2 vertices\n");
+}
+
+template<class T> void OptimizeVertexCacheTest::simulateVertexCacheErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 2, 1, 3, 0, 3, 4};
+
+    Containers::Pair<Float, Float> out = MeshTools::simulateVertexCache(Containers::arrayCast<2, const char>(Containers::arrayView(indices)), 6, 3);
+    CORRADE_COMPARE(out.first(), 6.0f/3.0f);
+    CORRADE_COMPARE(out.second(), 6.0f/5.0f);
+}
+
+void OptimizeVertexCacheTest::simulateVertexCacheErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simulateVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, 1, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::simulateVertexCache(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexCacheTest)
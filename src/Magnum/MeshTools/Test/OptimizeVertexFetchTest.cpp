@@ -0,0 +1,242 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeVertexFetchTest: TestSuite::Tester {
+    explicit OptimizeVertexFetchTest();
+
+    template<class T> void optimizeVertexFetch();
+    void optimizeVertexFetchEmptyIndices();
+    void optimizeVertexFetchInvalid();
+    template<class T> void optimizeVertexFetchErased();
+    void optimizeVertexFetchErasedNonContiguous();
+    void optimizeVertexFetchErasedWrongIndexSize();
+
+    void optimizeVertexFetchMeshData();
+    void optimizeVertexFetchMeshDataInvalid();
+};
+
+OptimizeVertexFetchTest::OptimizeVertexFetchTest() {
+    addTests({&OptimizeVertexFetchTest::optimizeVertexFetch<UnsignedByte>,
+              &OptimizeVertexFetchTest::optimizeVertexFetch<UnsignedShort>,
+              &OptimizeVertexFetchTest::optimizeVertexFetch<UnsignedInt>,
+              &OptimizeVertexFetchTest::optimizeVertexFetchEmptyIndices,
+              &OptimizeVertexFetchTest::optimizeVertexFetchInvalid,
+              &OptimizeVertexFetchTest::optimizeVertexFetchErased<UnsignedByte>,
+              &OptimizeVertexFetchTest::optimizeVertexFetchErased<UnsignedShort>,
+              &OptimizeVertexFetchTest::optimizeVertexFetchErased<UnsignedInt>,
+              &OptimizeVertexFetchTest::optimizeVertexFetchErasedNonContiguous,
+              &OptimizeVertexFetchTest::optimizeVertexFetchErasedWrongIndexSize,
+
+              &OptimizeVertexFetchTest::optimizeVertexFetchMeshData,
+              &OptimizeVertexFetchTest::optimizeVertexFetchMeshDataInvalid});
+}
+
+template<class T> void OptimizeVertexFetchTest::optimizeVertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Same as in the docs */
+    T indices[]{4, 2, 5, 4, 5, 0};
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> out = MeshTools::optimizeVertexFetchInPlace(indices, 6);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<T>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first(),
+        Containers::arrayView<UnsignedInt>({4, 2, 5, 0, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.second(), 4);
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchEmptyIndices() {
+    /* All vertices are unused, the mapping should be an identity */
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> out = MeshTools::optimizeVertexFetchInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, 3);
+    CORRADE_COMPARE_AS(out.first(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.second(), 0);
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(indices, 3);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): index 3 out of range for 3 vertices\n");
+}
+
+template<class T> void OptimizeVertexFetchTest::optimizeVertexFetchErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[]{4, 2, 5, 4, 5, 0};
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> out = MeshTools::optimizeVertexFetchInPlace(Containers::arrayCast<2, char>(Containers::arrayView(indices)), 6);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<T>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first(),
+        Containers::arrayView<UnsignedInt>({4, 2, 5, 0, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.second(), 4);
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchMeshData() {
+    /* Deliberately not owned and not interleaved to verify that the function
+       will handle this. Vertex 1 isn't referenced by the index buffer. */
+    struct Vertex {
+        Vector2 positions[6]{
+            {0.0f, 0.5f},
+            {1.0f, 1.5f},
+            {2.0f, 2.5f},
+            {3.0f, 3.5f},
+            {4.0f, 4.5f},
+            {5.0f, 5.5f}
+        };
+        Short data[6][2]{
+            {0, 0},
+            {1, -1},
+            {2, -2},
+            {3, -3},
+            {4, -4},
+            {5, -5}
+        };
+    } vertexData[1];
+
+    const UnsignedShort indexData[]{4, 2, 5, 4, 5, 0, 3, 5, 0};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, Trade::MeshIndexData{indexData},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(vertexData->positions)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(42),
+                VertexFormat::Short,
+                Containers::stridedArrayView(vertexData->data), 2},
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(mesh);
+    CORRADE_COMPARE(optimized.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(optimized.isIndexed());
+    CORRADE_COMPARE(optimized.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 1, 2, 0, 2, 3, 4, 2, 3}),
+        TestSuite::Compare::Container);
+
+    /* The original index data is untouched */
+    CORRADE_COMPARE(indexData[0], 4);
+
+    CORRADE_COMPARE(optimized.vertexCount(), 5);
+    CORRADE_COMPARE(optimized.attributeCount(), 2);
+    CORRADE_COMPARE(optimized.attributeName(0), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(optimized.attributeFormat(0), VertexFormat::Vector2);
+    CORRADE_COMPARE_AS(optimized.attribute<Vector2>(0),
+        Containers::arrayView<Vector2>({
+            {4.0f, 4.5f},
+            {2.0f, 2.5f},
+            {5.0f, 5.5f},
+            {0.0f, 0.5f},
+            {3.0f, 3.5f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(optimized.attributeName(1), Trade::meshAttributeCustom(42));
+    CORRADE_COMPARE(optimized.attributeFormat(1), VertexFormat::Short);
+    CORRADE_COMPARE(optimized.attributeArraySize(1), 2);
+    CORRADE_COMPARE_AS((Containers::arrayCast<1, const Vector2s>(optimized.attribute<Short[]>(1))),
+        Containers::arrayView<Vector2s>({
+            {4, -4},
+            {2, -2},
+            {5, -5},
+            {0, 0},
+            {3, -3}
+        }), TestSuite::Compare::Container);
+
+    /* The output is interleaved */
+    CORRADE_COMPARE(optimized.attributeStride(0), sizeof(Vector2) + 2*sizeof(Short));
+    CORRADE_COMPARE(optimized.attributeStride(1), sizeof(Vector2) + 2*sizeof(Short));
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1});
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xcaca), nullptr}
+        }});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetch(): the mesh is not indexed\n"
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::optimizeVertexFetch(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexFetchTest)
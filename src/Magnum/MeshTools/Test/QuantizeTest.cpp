@@ -0,0 +1,439 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Quantize.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void quantize();
+    void outOfRange();
+    void degenerate();
+    void morphTargets();
+    void positionsNotQuantized();
+    void passthrough();
+    void noVertices();
+    void implementationSpecificFormat();
+};
+
+const struct {
+    const char* name;
+    QuantizeFlags flags;
+    VertexFormat expectedNormalFormat, expectedTangentFormat;
+    UnsignedInt expectedStride;
+} QuantizeData[]{
+    /* Stride is aligned to four bytes */
+    {"", {},
+        VertexFormat::Vector2sNormalized, VertexFormat::Vector4sNormalized,
+        6 + 4 + 8 + 4 + 4 + 2},
+    {"byte normals", QuantizeFlag::ByteNormals,
+        VertexFormat::Vector2bNormalized, VertexFormat::Vector4bNormalized,
+        6 + 2 + 4 + 4 + 4},
+    {"per-component normals", QuantizeFlag::PerComponentNormals,
+        VertexFormat::Vector3sNormalized, VertexFormat::Vector4sNormalized,
+        6 + 6 + 8 + 4 + 4},
+    /* Texture coordinates are aligned to two bytes */
+    {"per-component byte normals", QuantizeFlag::PerComponentNormals|QuantizeFlag::ByteNormals,
+        VertexFormat::Vector3bNormalized, VertexFormat::Vector4bNormalized,
+        6 + 3 + 4 + 1 + 4 + 4 + 2},
+};
+
+const struct {
+    const char* name;
+    QuantizeFlags flags;
+    VertexFormat positionFormat;
+    UnsignedInt expectedStride;
+} PositionsNotQuantizedData[]{
+    {"2D positions", {}, VertexFormat::Vector2, 8 + 4},
+    {"half positions", {}, VertexFormat::Vector3h, 6 + 4 + 2},
+    {"preserve positions", QuantizeFlag::PreservePositions, VertexFormat::Vector3, 12 + 4},
+};
+
+QuantizeTest::QuantizeTest() {
+    addInstancedTests({&QuantizeTest::quantize},
+        Containers::arraySize(QuantizeData));
+
+    addTests({&QuantizeTest::outOfRange,
+              &QuantizeTest::degenerate,
+              &QuantizeTest::morphTargets});
+
+    addInstancedTests({&QuantizeTest::positionsNotQuantized},
+        Containers::arraySize(PositionsNotQuantizedData));
+
+    addTests({&QuantizeTest::passthrough,
+              &QuantizeTest::noVertices,
+              &QuantizeTest::implementationSpecificFormat});
+}
+
+void QuantizeTest::quantize() {
+    auto&& data = QuantizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UnsignedShort indices[]{2, 1, 0, 1};
+    const struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector4 tangent;
+        Vector2 textureCoordinates;
+        Color4 color;
+    } vertices[]{
+        {{-1.0f, 2.0f, 5.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, -1.0f},
+         {0.0f, 0.0f}, {1.0f, 0.0f, 0.5f, 1.0f}},
+        {{3.0f, 2.0f, 5.0f}, {0.6f, 0.8f, 0.0f}, {0.0f, 1.0f, 0.0f, 1.0f},
+         {1.0f, 0.5f}, {0.0f, 1.0f, 0.0f, 0.0f}},
+        /* The normal isn't normalized, which doesn't matter for the
+           octahedral encoding */
+        {{3.0f, 4.0f, 6.0f}, {0.0f, 1.5f, 0.0f}, {0.0f, 0.0f, -1.0f, 1.0f},
+         {0.25f, 1.0f}, {0.0f, 0.0f, 1.0f, 1.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, view.slice(&Vertex::tangent)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::color)}
+        }};
+
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh, data.flags);
+    CORRADE_COMPARE(out.second(),
+        Matrix4::translation({-1.0f, 2.0f, 5.0f})*
+        Matrix4::scaling({4.0f, 2.0f, 1.0f}));
+
+    const Trade::MeshData& quantized = out.first();
+    CORRADE_COMPARE(quantized.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(quantized.isIndexed());
+    CORRADE_COMPARE(quantized.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(quantized.indices<UnsignedShort>(),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(quantized.vertexCount(), 3);
+    CORRADE_COMPARE(quantized.attributeCount(), 5);
+
+    /* The output is packed with each attribute aligned to its component
+       size and the stride to four bytes */
+    CORRADE_COMPARE(quantized.attributeStride(0), data.expectedStride);
+    CORRADE_COMPARE(quantized.vertexData().size(), 3*data.expectedStride);
+    for(UnsignedInt i = 0; i != quantized.attributeCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(quantized.attributeOffset(i) % vertexFormatSize(vertexFormatComponentFormat(quantized.attributeFormat(i))), 0);
+    }
+
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3usNormalized);
+    CORRADE_COMPARE_AS(quantized.attribute<Vector3us>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {65535, 0, 0},
+        {65535, 65535, 65535}
+    }), TestSuite::Compare::Container);
+
+    /* Transforming the unpacked positions gives back the original data. The
+       chosen values are all at the range edges, so there's no error. */
+    Containers::Array<Vector3> positions = quantized.positions3DAsArray();
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out.second().transformPoint(positions[i]), vertices[i].position);
+    }
+
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Normal), data.expectedNormalFormat);
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Tangent), data.expectedTangentFormat);
+    if(data.flags & QuantizeFlag::PerComponentNormals) {
+        /* Checked just through the decoded values below */
+    } else if(data.flags & QuantizeFlag::ByteNormals) {
+        CORRADE_COMPARE_AS(quantized.attribute<Vector2b>(Trade::MeshAttribute::Normal), Containers::arrayView<Vector2b>({
+            {0, 0},
+            {54, 73},
+            {0, 127}
+        }), TestSuite::Compare::Container);
+    } else {
+        CORRADE_COMPARE_AS(quantized.attribute<Vector2s>(Trade::MeshAttribute::Normal), Containers::arrayView<Vector2s>({
+            {0, 0},
+            {14043, 18724},
+            {0, 32767}
+        }), TestSuite::Compare::Container);
+    }
+    if(data.flags & QuantizeFlag::ByteNormals) {
+        CORRADE_COMPARE_AS(quantized.attribute<Vector4b>(Trade::MeshAttribute::Tangent), Containers::arrayView<Vector4b>({
+            {127, 0, 0, -127},
+            {0, 127, 0, 127},
+            {0, 0, -127, 127}
+        }), TestSuite::Compare::Container);
+    } else {
+        CORRADE_COMPARE_AS(quantized.attribute<Vector4s>(Trade::MeshAttribute::Tangent), Containers::arrayView<Vector4s>({
+            {32767, 0, 0, -32767},
+            {0, 32767, 0, 32767},
+            {0, 0, -32767, 32767}
+        }), TestSuite::Compare::Container);
+    }
+
+    /* The normals decode back to the original directions. The first and the
+       last are exactly representable, the middle one isn't. The last one
+       isn't normalized, which the octahedral encoding doesn't care about and
+       the per-component quantization clamps to the [-1, 1] range. */
+    Containers::Array<Vector3> normals = quantized.normalsAsArray();
+    CORRADE_COMPARE(normals[0], (Vector3{0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE_AS(Math::dot(normals[1], Vector3{0.6f, 0.8f, 0.0f}), 0.9999f,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(normals[2], (Vector3{0.0f, 1.0f, 0.0f}));
+
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::TextureCoordinates), VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE_AS(quantized.attribute<Vector2us>(Trade::MeshAttribute::TextureCoordinates), Containers::arrayView<Vector2us>({
+        {0, 0},
+        {65535, 32768},
+        {16384, 65535}
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Color), VertexFormat::Vector4ubNormalized);
+    CORRADE_COMPARE_AS(quantized.attribute<Color4ub>(Trade::MeshAttribute::Color), Containers::arrayView<Color4ub>({
+        {255, 0, 128, 255},
+        {0, 255, 0, 0},
+        {0, 0, 255, 255}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::outOfRange() {
+    const struct Vertex {
+        Vector2 textureCoordinates;
+        Color3 color;
+    } vertices[]{
+        {{-0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+        {{2.0f, 0.25f}, {4.0f, 0.5f, 0.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::color)}
+    }};
+
+    /* Values outside of the [0, 1] range are stored as halves instead. The
+       values are all exactly representable. */
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out.second(), Matrix4{});
+    CORRADE_COMPARE(out.first().attributeStride(0), 4 + 6 + 2);
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::TextureCoordinates), VertexFormat::Vector2h);
+    CORRADE_COMPARE_AS(out.first().textureCoordinates2DAsArray(), Containers::arrayView<Vector2>({
+        {-0.5f, 0.0f},
+        {2.0f, 0.25f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::Color), VertexFormat::Vector3h);
+    CORRADE_COMPARE_AS(out.first().colorsAsArray(), Containers::arrayView<Color4>({
+        {0.0f, 0.0f, 1.0f},
+        {4.0f, 0.5f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::degenerate() {
+    /* All positions are the same, the transformation should still be
+       invertible */
+    const Vector3 positions[]{
+        {1.0f, -2.0f, 3.0f},
+        {1.0f, -2.0f, 3.0f}
+    };
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out.second(), Matrix4::translation({1.0f, -2.0f, 3.0f}));
+    CORRADE_COMPARE_AS(out.first().attribute<Vector3us>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {0, 0, 0}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::morphTargets() {
+    const struct Vertex {
+        Vector3 position;
+        Vector3 morphedPosition;
+        Vector3 morphedNormal;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {-2.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}},
+        {{1.0f, 1.0f, 1.0f}, {1.0f, 3.0f, 1.0f}, {0.0f, -1.0f, 0.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::morphedPosition), 0},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::morphedNormal), 0}
+    }};
+
+    /* The bounding range is calculated from all position attributes
+       together */
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out.second(),
+        Matrix4::translation({-2.0f, 0.0f, 0.0f})*
+        Matrix4::scaling({3.0f, 3.0f, 1.0f}));
+
+    const Trade::MeshData& quantized = out.first();
+    CORRADE_COMPARE(quantized.attributeCount(), 3);
+    CORRADE_COMPARE(quantized.attributeMorphTargetId(1), 0);
+    CORRADE_COMPARE(quantized.attributeMorphTargetId(2), 0);
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Position, 0, 0), VertexFormat::Vector3usNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Normal, 0, 0), VertexFormat::Vector2sNormalized);
+    CORRADE_COMPARE_AS(quantized.attribute<Vector3us>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3us>({
+        {43690, 0, 0},
+        {65535, 21845, 65535}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.attribute<Vector3us>(Trade::MeshAttribute::Position, 0, 0), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {65535, 65535, 65535}
+    }), TestSuite::Compare::Container);
+    /* The lower hemisphere is folded over the diagonals */
+    CORRADE_COMPARE_AS(quantized.attribute<Vector2s>(Trade::MeshAttribute::Normal, 0, 0), Containers::arrayView<Vector2s>({
+        {32767, 32767},
+        {0, -32767}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::positionsNotQuantized() {
+    auto&& data = PositionsNotQuantizedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+        {{1.0f, 1.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    /* The type is only used for the format and size, the data are
+       reinterpreted */
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, data.positionFormat, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+    }};
+
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh, data.flags);
+    CORRADE_COMPARE(out.second(), Matrix4{});
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::Position), data.positionFormat);
+    CORRADE_COMPARE_AS(out.first().positions3DAsArray(),
+        mesh.positions3DAsArray(),
+        TestSuite::Compare::Container);
+
+    /* The normals get quantized regardless */
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::Normal), VertexFormat::Vector2sNormalized);
+    CORRADE_COMPARE(out.first().attributeStride(0), data.expectedStride);
+}
+
+void QuantizeTest::passthrough() {
+    const struct Vertex {
+        UnsignedInt objectId;
+        Float custom[2];
+        Vector2 textureCoordinates;
+        Vector4 weights;
+        Vector3b normal;
+    } vertices[]{
+        {15, {1.0f, 2.0f}, {0.5f, 0.25f}, {0.5f, 0.5f, 0.0f, 0.0f}, {0, 127, 0}},
+        {3, {3.0f, 4.0f}, {1.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}, {127, 0, 0}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId, view.slice(&Vertex::objectId)},
+        Trade::MeshAttributeData{Trade::meshAttributeCustom(3), VertexFormat::Float, view.slice(&Vertex::custom), 2},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Weights, VertexFormat::Float, view.slice(&Vertex::weights), 4},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, view.slice(&Vertex::normal)}
+    }};
+
+    /* Only the texture coordinates get quantized, everything else is kept
+       as-is, just repacked */
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh);
+    const Trade::MeshData& quantized = out.first();
+    CORRADE_COMPARE(quantized.attributeCount(), 5);
+    CORRADE_COMPARE(quantized.attributeStride(0), 4 + 8 + 4 + 16 + 3 + 1);
+
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Normal), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE_AS(quantized.attribute<Vector3b>(Trade::MeshAttribute::Normal),
+        view.slice(&Vertex::normal),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.attribute<UnsignedInt>(Trade::MeshAttribute::ObjectId),
+        view.slice(&Vertex::objectId),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::meshAttributeCustom(3)), VertexFormat::Float);
+    CORRADE_COMPARE(quantized.attributeArraySize(Trade::meshAttributeCustom(3)), 2);
+    CORRADE_COMPARE_AS((quantized.attribute<Float[]>(Trade::meshAttributeCustom(3)).transposed<0, 1>()[1]),
+        Containers::arrayView({2.0f, 4.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::TextureCoordinates), VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(Trade::MeshAttribute::Weights), VertexFormat::Float);
+    CORRADE_COMPARE(quantized.attributeArraySize(Trade::MeshAttribute::Weights), 4);
+}
+
+void QuantizeTest::noVertices() {
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3, nullptr}
+    }};
+
+    /* Positions are left as-is, as there's no bounding range to quantize
+       them to */
+    Containers::Pair<Trade::MeshData, Matrix4> out = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out.second(), Matrix4{});
+    CORRADE_COMPARE(out.first().vertexCount(), 0);
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3);
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::Normal), VertexFormat::Vector2sNormalized);
+}
+
+void QuantizeTest::implementationSpecificFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[2]{};
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xdead), Containers::arrayView(positions)}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out, "MeshTools::quantize(): attribute 1 has an implementation-specific format 0xdead\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
@@ -0,0 +1,383 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/Trade/MeshData.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct RemoveDuplicatesBenchmark: TestSuite::Tester {
+    explicit RemoveDuplicatesBenchmark();
+
+    void removeDuplicatesInto();
+    void removeDuplicatesIntoUnorderedMap();
+    void removeDuplicatesInPlaceInto();
+    void removeDuplicatesMeshData();
+
+    void removeDuplicatesIntoScaling();
+    void removeDuplicatesIntoScalingUnorderedMap();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void removeDuplicatesIntoThreads();
+    void removeDuplicatesInPlaceIntoThreads();
+    void removeDuplicatesFuzzyInPlaceIntoThreads();
+    #endif
+};
+
+/* A non-indexed triangle grid, so each vertex is on average present six
+   times, similarly to what a mesh imported from a triangle soup looks like */
+constexpr UnsignedInt GridSize = 128;
+constexpr UnsignedInt VertexCount = (GridSize - 1)*(GridSize - 1)*6;
+constexpr UnsignedInt UniqueVertexCount = GridSize*GridSize;
+
+const struct {
+    const char* name;
+    bool normals;
+    bool textureCoordinates;
+} Data[]{
+    {"positions", false, false},
+    {"positions + normals", true, false},
+    {"positions + normals + texture coordinates", true, true},
+};
+
+/* Going from sizes where the whole table fits into the cache to ones where
+   the hash-partitioned variant gets used */
+const struct {
+    const char* name;
+    UnsignedInt count;
+} ScalingData[]{
+    {"16k items", 1 << 14},
+    {"128k items", 1 << 17},
+    {"1M items", 1 << 20},
+    {"4M items", 1 << 22},
+};
+
+/* Emscripten builds don't have threads enabled by default */
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} ThreadData[]{
+    {"serial", 0},
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8},
+};
+
+constexpr UnsignedInt ThreadItemCount = 1 << 22;
+
+/* Spawns given count of threads for each call, each picking the next task
+   that wasn't taken yet. The thread creation is included in the measured
+   time, as it would be for an application not having a thread pool. */
+void threadExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != *static_cast<std::size_t*>(userData); ++i)
+        threads.emplace_back([&]{
+            for(std::size_t id; (id = next++) < count; )
+                task(id, state);
+        });
+    for(std::thread& thread: threads) thread.join();
+}
+#endif
+
+/* Same as the original implementation, for comparison */
+struct ArrayEqual {
+    explicit ArrayEqual(std::size_t size): _size{size} {}
+
+    bool operator()(const void* a, const void* b) const {
+        return std::memcmp(a, b, _size) == 0;
+    }
+
+    private: std::size_t _size;
+};
+
+struct ArrayHash {
+    explicit ArrayHash(std::size_t size): _size{size} {}
+
+    std::size_t operator()(const void* a) const {
+        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
+    }
+
+    private: std::size_t _size;
+};
+
+std::size_t removeDuplicatesIntoUnorderedMap(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
+        data.size()[0],
+        ArrayHash{data.size()[1]},
+        ArrayEqual{data.size()[1]}};
+
+    for(std::size_t i = 0; i != data.size()[0]; ++i)
+        indices[i] = table.emplace(data[i].asContiguous(), i).first->second;
+
+    return table.size();
+}
+
+Trade::MeshData gridMesh(bool normals, bool textureCoordinates) {
+    const std::size_t stride = sizeof(Vector3) + (normals ? sizeof(Vector3) : 0) + (textureCoordinates ? sizeof(Vector2) : 0);
+    Containers::Array<char> vertexData{ValueInit, VertexCount*stride};
+
+    const Containers::StridedArrayView1D<Vector3> positions{vertexData, reinterpret_cast<Vector3*>(vertexData.data()), VertexCount, std::ptrdiff_t(stride)};
+    Containers::StridedArrayView1D<Vector3> normalView;
+    Containers::StridedArrayView1D<Vector2> textureCoordinateView;
+    std::size_t offset = sizeof(Vector3);
+    std::size_t attributeCount = 1;
+    if(normals) {
+        normalView = Containers::StridedArrayView1D<Vector3>{vertexData, reinterpret_cast<Vector3*>(vertexData.data() + offset), VertexCount, std::ptrdiff_t(stride)};
+        offset += sizeof(Vector3);
+        ++attributeCount;
+    }
+    if(textureCoordinates) {
+        textureCoordinateView = Containers::StridedArrayView1D<Vector2>{vertexData, reinterpret_cast<Vector2*>(vertexData.data() + offset), VertexCount, std::ptrdiff_t(stride)};
+        ++attributeCount;
+    }
+
+    /* Two triangles for each grid cell */
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != GridSize - 1; ++y) {
+        for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+            for(const Vector2ui corner: {Vector2ui{0, 0}, Vector2ui{1, 0}, Vector2ui{1, 1},
+                                         Vector2ui{0, 0}, Vector2ui{1, 1}, Vector2ui{0, 1}}) {
+                const Vector2 position{Vector2ui{x, y} + corner};
+                positions[i] = Vector3{position, Math::sin(Rad(position.x()))*Math::cos(Rad(position.y()))};
+                if(normals) normalView[i] = Vector3{position/Float(GridSize), 1.0f}.normalized();
+                if(textureCoordinates) textureCoordinateView[i] = position/Float(GridSize - 1);
+                ++i;
+            }
+        }
+    }
+    CORRADE_INTERNAL_ASSERT(i == VertexCount);
+
+    Containers::Array<Trade::MeshAttributeData> attributeData{attributeCount};
+    std::size_t attribute = 0;
+    attributeData[attribute++] = Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions};
+    if(normals)
+        attributeData[attribute++] = Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normalView};
+    if(textureCoordinates)
+        attributeData[attribute++] = Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, textureCoordinateView};
+
+    return Trade::MeshData{MeshPrimitive::Triangles, Utility::move(vertexData), Utility::move(attributeData)};
+}
+
+/* Each item is present four times, with the duplicates scattered over the
+   whole array */
+Containers::Array<Vector3i> scalingData(UnsignedInt count) {
+    Containers::Array<Vector3i> out{NoInit, count};
+    for(UnsignedInt i = 0; i != count; ++i) {
+        const Int value = Int(UnsignedLong(i)*7919 % (count/4));
+        out[i] = {value, value ^ 0x5555, -value};
+    }
+    return out;
+}
+
+RemoveDuplicatesBenchmark::RemoveDuplicatesBenchmark() {
+    addInstancedBenchmarks({&RemoveDuplicatesBenchmark::removeDuplicatesInto,
+                            &RemoveDuplicatesBenchmark::removeDuplicatesIntoUnorderedMap,
+                            &RemoveDuplicatesBenchmark::removeDuplicatesInPlaceInto,
+                            &RemoveDuplicatesBenchmark::removeDuplicatesMeshData}, 5,
+        Containers::arraySize(Data));
+
+    addInstancedBenchmarks({&RemoveDuplicatesBenchmark::removeDuplicatesIntoScaling,
+                            &RemoveDuplicatesBenchmark::removeDuplicatesIntoScalingUnorderedMap}, 3,
+        Containers::arraySize(ScalingData));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addInstancedBenchmarks({&RemoveDuplicatesBenchmark::removeDuplicatesIntoThreads,
+                            &RemoveDuplicatesBenchmark::removeDuplicatesInPlaceIntoThreads,
+                            &RemoveDuplicatesBenchmark::removeDuplicatesFuzzyInPlaceIntoThreads}, 3,
+        Containers::arraySize(ThreadData));
+    #endif
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesInto() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = gridMesh(data.normals, data.textureCoordinates);
+    const Containers::StridedArrayView2D<const char> vertexData{mesh.vertexData(), {mesh.vertexCount(), std::size_t(mesh.attributeStride(0))}};
+    Containers::Array<UnsignedInt> indices{NoInit, mesh.vertexCount()};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(vertexData, indices);
+
+    CORRADE_COMPARE(count, UniqueVertexCount);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesIntoUnorderedMap() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = gridMesh(data.normals, data.textureCoordinates);
+    const Containers::StridedArrayView2D<const char> vertexData{mesh.vertexData(), {mesh.vertexCount(), std::size_t(mesh.attributeStride(0))}};
+    Containers::Array<UnsignedInt> indices{NoInit, mesh.vertexCount()};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = Test::removeDuplicatesIntoUnorderedMap(vertexData, indices);
+
+    CORRADE_COMPARE(count, UniqueVertexCount);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesInPlaceInto() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData mesh = gridMesh(data.normals, data.textureCoordinates);
+    const Containers::StridedArrayView2D<char> vertexData{mesh.mutableVertexData(), {mesh.vertexCount(), std::size_t(mesh.attributeStride(0))}};
+    Containers::Array<UnsignedInt> indices{NoInit, mesh.vertexCount()};
+
+    /* The data get reordered by the operation, but as the set of items stays
+       the same, repeated runs give the same unique count */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInPlaceInto(vertexData, indices);
+
+    CORRADE_COMPARE(count, UniqueVertexCount);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesMeshData() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = gridMesh(data.normals, data.textureCoordinates);
+
+    UnsignedInt count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicates(mesh).vertexCount();
+
+    CORRADE_COMPARE(count, UniqueVertexCount);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesIntoScaling() {
+    auto&& data = ScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Vector3i> items = scalingData(data.count);
+    Containers::Array<UnsignedInt> indices{NoInit, data.count};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(Containers::arrayCast<2, const char>(Containers::arrayView(items)), indices);
+
+    CORRADE_COMPARE(count, data.count/4);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesIntoScalingUnorderedMap() {
+    auto&& data = ScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Vector3i> items = scalingData(data.count);
+    Containers::Array<UnsignedInt> indices{NoInit, data.count};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = Test::removeDuplicatesIntoUnorderedMap(Containers::arrayCast<2, const char>(Containers::arrayView(items)), indices);
+
+    CORRADE_COMPARE(count, data.count/4);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void RemoveDuplicatesBenchmark::removeDuplicatesIntoThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Vector3i> items = scalingData(ThreadItemCount);
+    Containers::Array<UnsignedInt> indices{NoInit, ThreadItemCount};
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(Containers::arrayCast<2, const char>(Containers::arrayView(items)), indices, executor);
+
+    CORRADE_COMPARE(count, ThreadItemCount/4);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesInPlaceIntoThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Vector3i> items = scalingData(ThreadItemCount);
+    Containers::Array<UnsignedInt> indices{NoInit, ThreadItemCount};
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    /* The data get reordered by the operation, but as the set of items stays
+       the same, repeated runs give the same unique count */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInPlaceInto(Containers::arrayCast<2, char>(Containers::arrayView(items)), indices, executor);
+
+    CORRADE_COMPARE(count, ThreadItemCount/4);
+}
+
+void RemoveDuplicatesBenchmark::removeDuplicatesFuzzyInPlaceIntoThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Integer values converted to floats are far enough from each other to
+       not get collapsed with the default epsilon */
+    const Containers::Array<Vector3i> integers = scalingData(ThreadItemCount/4);
+    Containers::Array<Vector3> items{NoInit, integers.size()};
+    for(std::size_t i = 0; i != integers.size(); ++i)
+        items[i] = Vector3{integers[i]};
+    Containers::Array<UnsignedInt> indices{NoInit, items.size()};
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    /* Same as above, repeated runs give the same unique count */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesFuzzyInPlaceInto(Containers::arrayCast<2, Float>(Containers::arrayView(items)), indices, Math::TypeTraits<Float>::epsilon(), executor);
+
+    CORRADE_COMPARE(count, ThreadItemCount/16);
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesBenchmark)
@@ -31,6 +31,7 @@
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
@@ -43,6 +44,8 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     /* These test also the InPlace variant */
     void removeDuplicates();
+    void removeDuplicatesLarge();
+    void removeDuplicatesExecutor();
     void removeDuplicatesNonContiguous();
     void removeDuplicatesIntoWrongOutputSize();
 
@@ -56,7 +59,11 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     template<class T> void removeDuplicatesFuzzyInPlaceOneDimension();
     template<class T> void removeDuplicatesFuzzyInPlaceMoreDimensions();
+    template<class T> void removeDuplicatesFuzzyInPlaceCellBoundary();
+    template<class T> void removeDuplicatesFuzzyInPlaceManyDimensions();
+    template<class T> void removeDuplicatesFuzzyInPlaceConstantDimensions();
     template<class T> void removeDuplicatesFuzzyInPlaceInto();
+    template<class T> void removeDuplicatesFuzzyInPlaceIntoExecutor();
     void removeDuplicatesFuzzyInPlaceIntoWrongOutputSize();
     #ifdef MAGNUM_BUILD_DEPRECATED
     void removeDuplicatesFuzzyStl();
@@ -90,6 +97,15 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void benchmarkFuzzy();
 };
 
+const struct {
+    const char* name;
+    UnsignedInt count;
+    UnsignedInt uniqueCount;
+} ExecutorData[] {
+    {"below the partition threshold", 20000, 5003},
+    {"above the partition threshold", 1 << 19, 100003}
+};
+
 const struct {
     const char* name;
     bool indexed;
@@ -195,9 +211,22 @@ const struct {
     }), 0.0f, 1.0f, 0.0f, 9, false},
 };
 
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::removeDuplicates,
-              &RemoveDuplicatesTest::removeDuplicatesNonContiguous,
+              &RemoveDuplicatesTest::removeDuplicatesLarge});
+
+    addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesExecutor},
+        Containers::arraySize(ExecutorData));
+
+    addTests({&RemoveDuplicatesTest::removeDuplicatesNonContiguous,
               &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedByte>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedShort>,
@@ -215,8 +244,16 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceOneDimension<Double>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceMoreDimensions<Float>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceMoreDimensions<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceCellBoundary<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceCellBoundary<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceManyDimensions<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceManyDimensions<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceConstantDimensions<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceConstantDimensions<Double>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceInto<Float>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceInto<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoExecutor<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoExecutor<Double>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoWrongOutputSize,
               #ifdef MAGNUM_BUILD_DEPRECATED
               &RemoveDuplicatesTest::removeDuplicatesFuzzyStl,
@@ -284,6 +321,83 @@ void RemoveDuplicatesTest::removeDuplicates() {
         TestSuite::Compare::Container);
 }
 
+void RemoveDuplicatesTest::removeDuplicatesLarge() {
+    /* Large enough to go through the hash-partitioned code path. The value at
+       `i` is the same as at `i % UniqueCount` and the first `UniqueCount`
+       values are all different, so both the first occurrence and the unique
+       index of each item is `i % UniqueCount`. */
+    constexpr UnsignedInt Count = 1 << 19;
+    constexpr UnsignedInt UniqueCount = 100003;
+    Containers::Array<Vector3i> data{NoInit, Count};
+    Containers::Array<UnsignedInt> expected{NoInit, Count};
+    for(UnsignedInt i = 0; i != Count; ++i) {
+        const Int value = Int(UnsignedLong(i)*7919 % UniqueCount);
+        data[i] = {value, value*3, -value};
+        expected[i] = i % UniqueCount;
+    }
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicates(Containers::arrayCast<2, const char>(Containers::arrayView(data)));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second(), UniqueCount);
+
+    Containers::Array<Vector3i> expectedData{NoInit, UniqueCount};
+    Utility::copy(data.prefix(UniqueCount), expectedData);
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> resultInPlace =
+        MeshTools::removeDuplicatesInPlace(Containers::arrayCast<2, char>(Containers::arrayView(data)));
+    CORRADE_COMPARE_AS(Containers::arrayView(resultInPlace.first()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(resultInPlace.second(), UniqueCount);
+    CORRADE_COMPARE_AS(data.prefix(resultInPlace.second()),
+        Containers::arrayView(expectedData),
+        TestSuite::Compare::Container);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesExecutor() {
+    auto&& data = ExecutorData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Same as in removeDuplicatesLarge(), but the duplicates aren't
+       periodic */
+    Containers::Array<Vector3i> items{NoInit, data.count};
+    for(UnsignedInt i = 0; i != data.count; ++i) {
+        const Int value = Int(UnsignedLong(i)*7919 % data.uniqueCount);
+        items[i] = {value, value*3, -value};
+    }
+    const Containers::StridedArrayView2D<const char> view = Containers::arrayCast<2, const char>(Containers::arrayView(items));
+
+    Containers::Array<UnsignedInt> expected{NoInit, data.count};
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(view, expected), data.uniqueCount);
+
+    /* The executor gets used even below the partition threshold, and the
+       output is the same as with the serial one */
+    std::size_t calls = 0;
+    const Executor executor{reverseExecutor, &calls};
+    Containers::Array<UnsignedInt> indices{NoInit, data.count};
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(view, indices, executor), data.uniqueCount);
+    CORRADE_COMPARE(calls, 3);
+    CORRADE_COMPARE_AS(indices, expected,
+        TestSuite::Compare::Container);
+
+    /* Same for the in-place variant */
+    Containers::Array<Vector3i> expectedItems{NoInit, data.count};
+    Utility::copy(items, expectedItems);
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(Containers::arrayCast<2, char>(Containers::arrayView(expectedItems)), expected), data.uniqueCount);
+
+    calls = 0;
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(Containers::arrayCast<2, char>(Containers::arrayView(items)), indices, executor), data.uniqueCount);
+    CORRADE_COMPARE(calls, 3);
+    CORRADE_COMPARE_AS(indices, expected,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(items.prefix(data.uniqueCount),
+        expectedItems.prefix(data.uniqueCount),
+        TestSuite::Compare::Container);
+}
+
 void RemoveDuplicatesTest::removeDuplicatesNonContiguous() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -413,14 +527,13 @@ void RemoveDuplicatesTest::removeDuplicatesIndexedInPlaceErasedWrongIndexSize()
 template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceOneDimension() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
-    /* Numbers with distance <=1 should be merged. In the first iteration item
-       2 gets collapsed into item 1, in the second iteration item 3 gets
-       collapsed into item 1, reducing to 2 items in total. */
+    /* Numbers with distance <=1 should be merged. Item 2 gets collapsed into
+       item 0 and item 3 into item 1, reducing to 2 items in total. */
     T data[]{
-        T(1.0), /* bucket 0 in 1st iteration, bucket 1 in 2nd */
-        T(2.9), /* bucket 2 in 1st iteration, bucket 3 in 2nd */
-        T(0.0), /* bucket 0 in 1st iteration, bucket 0 in 2nd */
-        T(3.4)  /* bucket 3 in 1st iteration, bucket 3 in 2nd */
+        T(1.0),
+        T(2.9),
+        T(0.0),
+        T(3.4)
     };
 
     Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
@@ -460,6 +573,82 @@ template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceMoreDim
         TestSuite::Compare::Container);
 }
 
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceCellBoundary() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* With an epsilon of 1 the grid cells are 2 units large, starting at the
+       data minimum of {0.25, 2.25}. The first two items are in different
+       cells in both dimensions but still within the epsilon, so they should
+       get merged. The third is in the same cell as the first but farther than
+       the epsilon. */
+    Math::Vector2<T> data[]{
+        {T(1.75), T(3.75)},
+        {T(2.25), T(4.25)},
+        {T(0.25), T(2.25)},
+        {T(2.0), T(4.0)}
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyInPlace(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+            T(1.0));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 0, 1, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result.second()),
+        Containers::arrayView<Math::Vector2<T>>({{T(1.75), T(3.75)}, {T(0.25), T(2.25)}}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceManyDimensions() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Only four dimensions with the largest range are used for the grid,
+       here the last two and the first two. Items that differ only in the
+       remaining ones should still be kept. */
+    Math::Vector<6, T> data[]{
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(5.0), T(6.0)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(5.0), T(9.0)},
+        {T(1.5), T(2.5), T(3.5), T(4.5), T(5.5), T(6.5)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(8.0), T(6.0)},
+        {T(1.5), T(2.5), T(3.5), T(4.5), T(8.5), T(9.5)},
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyInPlace(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+            T(1.0));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second(), 4);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceConstantDimensions() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* The first four dimensions are the same for all items, so the grid
+       should be built only from the last one, not putting everything into a
+       single cell */
+    Math::Vector<5, T> data[]{
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(0.0)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(5.0)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(0.5)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(10.0)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(5.75)},
+        {T(1.0), T(2.0), T(3.0), T(4.0), T(9.0)},
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyInPlace(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+            T(1.0));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 2, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second(), 3);
+}
+
 template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceInto() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -483,6 +672,63 @@ template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceInto()
         TestSuite::Compare::Container);
 }
 
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoExecutor() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* The second item is a duplicate of the first, the third is within
+       epsilon only of the second, so it's unique, and it's the earliest item
+       within epsilon for the fourth. The executor variant has to pick the
+       third for it, not the first. */
+    {
+        T data[]{T(0.0), T(0.9), T(1.8), T(2.7), T(0.1)};
+
+        std::size_t calls = 0;
+        Containers::Array<UnsignedInt> indices{NoInit, Containers::arraySize(data)};
+        std::size_t result = MeshTools::removeDuplicatesFuzzyInPlaceInto(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+            indices, T(1.0), Executor{reverseExecutor, &calls});
+        CORRADE_COMPARE(calls, 2);
+        CORRADE_COMPARE_AS(indices,
+            Containers::arrayView<UnsignedInt>({0, 0, 1, 1, 0}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result),
+            Containers::arrayView<T>({T(0.0), T(1.8)}),
+            TestSuite::Compare::Container);
+    }
+
+    /* Many items spanning several tasks, with duplicates chained over more
+       than an epsilon in the first dimension. The output should be the same
+       as with the serial variant. */
+    {
+        constexpr UnsignedInt Count = 150000;
+        Containers::Array<Math::Vector3<T>> data{NoInit, Count};
+        for(UnsignedInt i = 0; i != Count; ++i) {
+            const UnsignedInt k = UnsignedInt(UnsignedLong(i)*7919 % 50000);
+            data[i] = {T(k)*T(0.75), T(k % 3)*T(0.5), T(i % 5)*T(0.2)};
+        }
+        Containers::Array<Math::Vector3<T>> expectedData{NoInit, Count};
+        Utility::copy(data, expectedData);
+
+        Containers::Array<UnsignedInt> expected{NoInit, Count};
+        const std::size_t expectedCount = MeshTools::removeDuplicatesFuzzyInPlaceInto(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(expectedData)),
+            expected, T(1.0));
+
+        std::size_t calls = 0;
+        Containers::Array<UnsignedInt> indices{NoInit, Count};
+        const std::size_t count = MeshTools::removeDuplicatesFuzzyInPlaceInto(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+            indices, T(1.0), Executor{reverseExecutor, &calls});
+        CORRADE_COMPARE(calls, 2);
+        CORRADE_COMPARE(count, expectedCount);
+        CORRADE_COMPARE_AS(indices, expected,
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(data.prefix(count),
+            expectedData.prefix(expectedCount),
+            TestSuite::Compare::Container);
+    }
+}
+
 void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoWrongOutputSize() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
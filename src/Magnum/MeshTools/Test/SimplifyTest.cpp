@@ -0,0 +1,436 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    template<class T> void simplify();
+    void simplifyLockBorder();
+    void simplifySeam();
+    void simplifyAttributes();
+    void simplifyErrorLimit();
+    void simplifyAlreadyBelowTarget();
+    void simplifyEmpty();
+    void simplifyInvalid();
+    template<class T> void simplifyErased();
+    void simplifyErasedNonContiguous();
+    void simplifyErasedWrongIndexSize();
+
+    void simplifyMeshData();
+    void simplifyMeshDataAttributes();
+    void simplifyMeshDataInvalid();
+};
+
+/* A flat 2x2 grid of quads, with vertices going row by row */
+constexpr Vector3 GridPositions[]{
+    {0.0f, 0.0f, 0.0f}, {0.5f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f},
+    {0.0f, 0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}, {1.0f, 0.5f, 0.0f},
+    {0.0f, 1.0f, 0.0f}, {0.5f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}
+};
+
+constexpr UnsignedInt GridIndices[]{
+    0, 1, 4, 0, 4, 3,
+    1, 2, 5, 1, 5, 4,
+    3, 4, 7, 3, 7, 6,
+    4, 5, 8, 4, 8, 7
+};
+
+/* The whole grid is a single planar quad */
+constexpr UnsignedInt GridIndicesSimplified[]{
+    0, 2, 8, 0, 8, 6
+};
+
+/* Generates a flat n*n grid of quads in a unit square. If seam is
+   non-negative, quads right of given column reference a separate copy of the
+   column vertices, which are appended at the end. */
+void grid(const UnsignedInt n, const Int seam, Containers::Array<Vector3>& positions, Containers::Array<UnsignedInt>& indices) {
+    positions = Containers::Array<Vector3>{NoInit, (n + 1)*(n + 1) + (seam >= 0 ? n + 1 : 0)};
+    indices = Containers::Array<UnsignedInt>{NoInit, n*n*6};
+    for(UnsignedInt y = 0; y <= n; ++y)
+        for(UnsignedInt x = 0; x <= n; ++x)
+            positions[y*(n + 1) + x] = {Float(x)/n, Float(y)/n, 0.0f};
+    if(seam >= 0) for(UnsignedInt y = 0; y <= n; ++y)
+        positions[(n + 1)*(n + 1) + y] = positions[y*(n + 1) + seam];
+
+    for(UnsignedInt y = 0; y != n; ++y) {
+        for(UnsignedInt x = 0; x != n; ++x) {
+            UnsignedInt a = y*(n + 1) + x;
+            const UnsignedInt b = a + 1;
+            const UnsignedInt c = b + n + 1;
+            UnsignedInt d = a + n + 1;
+            if(Int(x) == seam) {
+                a = (n + 1)*(n + 1) + y;
+                d = a + 1;
+            }
+            UnsignedInt* quad = indices + (y*n + x)*6;
+            quad[0] = a;
+            quad[1] = b;
+            quad[2] = c;
+            quad[3] = a;
+            quad[4] = c;
+            quad[5] = d;
+        }
+    }
+}
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::simplify<UnsignedByte>,
+              &SimplifyTest::simplify<UnsignedShort>,
+              &SimplifyTest::simplify<UnsignedInt>,
+              &SimplifyTest::simplifyLockBorder,
+              &SimplifyTest::simplifySeam,
+              &SimplifyTest::simplifyAttributes,
+              &SimplifyTest::simplifyErrorLimit,
+              &SimplifyTest::simplifyAlreadyBelowTarget,
+              &SimplifyTest::simplifyEmpty,
+              &SimplifyTest::simplifyInvalid,
+              &SimplifyTest::simplifyErased<UnsignedByte>,
+              &SimplifyTest::simplifyErased<UnsignedShort>,
+              &SimplifyTest::simplifyErased<UnsignedInt>,
+              &SimplifyTest::simplifyErasedNonContiguous,
+              &SimplifyTest::simplifyErasedWrongIndexSize,
+
+              &SimplifyTest::simplifyMeshData,
+              &SimplifyTest::simplifyMeshDataAttributes,
+              &SimplifyTest::simplifyMeshDataInvalid});
+}
+
+template<class T> void SimplifyTest::simplify() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(GridIndices)];
+    T expected[Containers::arraySize(GridIndicesSimplified)];
+    for(std::size_t i = 0; i != Containers::arraySize(GridIndices); ++i)
+        indices[i] = GridIndices[i];
+    for(std::size_t i = 0; i != Containers::arraySize(GridIndicesSimplified); ++i)
+        expected[i] = GridIndicesSimplified[i];
+
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), GridPositions, {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out.first(), 6);
+    CORRADE_COMPARE(out.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(out.first()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyLockBorder() {
+    UnsignedInt indices[Containers::arraySize(GridIndices)];
+    Utility::copy(Containers::arrayView(GridIndices), Containers::arrayView(indices));
+
+    /* Only the center vertex can be removed, the border needs at least six
+       triangles */
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), GridPositions, {}, {}, 0, 0.01f, SimplifyFlag::LockBorder);
+    CORRADE_COMPARE(out.first(), 18);
+    CORRADE_COMPARE(out.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(out.first()), Containers::arrayView<UnsignedInt>({
+        1, 2, 5, 1, 5, 0,
+        3, 0, 7, 3, 7, 6,
+        0, 5, 8, 0, 8, 7
+    }), TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifySeam() {
+    /* A 4x4 grid with a seam in the middle column. Vertices 25 to 29 are
+       copies of the vertices 2, 7, 12, 17 and 22. */
+    Containers::Array<Vector3> positions;
+    Containers::Array<UnsignedInt> indices;
+    grid(4, 2, positions, indices);
+
+    /* The seam got simplified the same way on both sides, without any
+       triangle crossing it */
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out.first(), 18);
+    CORRADE_COMPARE_AS(indices.prefix(out.first()), Containers::arrayView<UnsignedInt>({
+        0, 2, 7, 25, 4, 26,
+        26, 4, 24, 0, 7, 22,
+        0, 22, 20, 26, 24, 29
+    }), TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyAttributes() {
+    Containers::Array<Vector3> positions;
+    Containers::Array<UnsignedInt> indices;
+    grid(4, -1, positions, indices);
+
+    /* An attribute that changes along X prevents collapses in that
+       direction, so each column of quads stays */
+    Containers::Array<Float> attribute{NoInit, positions.size()};
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        attribute[i] = positions[i].x();
+    const Float weight[]{1.0f};
+
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, Containers::StridedArrayView2D<const Float>{attribute, {attribute.size(), 1}}, weight, 0, 0.01f);
+    CORRADE_COMPARE(out.first(), 24);
+    CORRADE_COMPARE_AS(indices.prefix(out.first()), Containers::arrayView<UnsignedInt>({
+        3, 4, 24, 0, 1, 21,
+        0, 21, 20, 1, 2, 22,
+        1, 22, 21, 2, 3, 23,
+        2, 23, 22, 3, 24, 23
+    }), TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyErrorLimit() {
+    /* A 16x16 grid with a bump in the middle */
+    Containers::Array<Vector3> positions;
+    Containers::Array<UnsignedInt> indices;
+    grid(16, -1, positions, indices);
+    for(Vector3& position: positions)
+        position.z() = 0.3f*Math::sin(Rad(position.x()*Constants::pi()))*Math::sin(Rad(position.y()*Constants::pi()));
+
+    /* With a large enough error the target is reached */
+    {
+        Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+        Utility::copy(indices, simplified);
+        Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, {}, {}, indices.size()/2, 1.0f);
+        CORRADE_COMPARE_AS(out.first(), indices.size()/2,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(out.second(), 0.0f,
+            TestSuite::Compare::Greater);
+    }
+
+    /* With a small error it stops way before */
+    {
+        Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+        Utility::copy(indices, simplified);
+        Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, {}, {}, 0, 0.001f);
+        CORRADE_COMPARE_AS(out.first(), indices.size()/2,
+            TestSuite::Compare::Greater);
+        CORRADE_COMPARE_AS(out.first(), indices.size(),
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(out.second(), 0.001f,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void SimplifyTest::simplifyAlreadyBelowTarget() {
+    UnsignedInt indices[Containers::arraySize(GridIndices)];
+    Utility::copy(Containers::arrayView(GridIndices), Containers::arrayView(indices));
+
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), GridPositions, {}, {}, Containers::arraySize(GridIndices), 0.01f);
+    CORRADE_COMPARE(out.first(), Containers::arraySize(GridIndices));
+    CORRADE_COMPARE(out.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(GridIndices),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyEmpty() {
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, {}, {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out.first(), 0);
+    CORRADE_COMPARE(out.second(), 0.0f);
+}
+
+void SimplifyTest::simplifyInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3};
+    const Float attributes[4*2]{};
+    const Float weights[2]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), GridPositions, {}, {}, 0, 0.01f);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(3), GridPositions, Containers::StridedArrayView2D<const Float>{attributes, {4, 2}}, weights, 0, 0.01f);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(3), Containers::arrayView(GridPositions).prefix(4), Containers::StridedArrayView2D<const Float>{attributes, {4, 2}}, Containers::arrayView(weights).prefix(1), 0, 0.01f);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(3), GridPositions, {}, {}, 0, -0.01f);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(3), Containers::arrayView(GridPositions).prefix(2), {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3, got 4\n"
+        "MeshTools::simplifyInPlace(): expected 9 attribute items but got 4\n"
+        "MeshTools::simplifyInPlace(): expected 2 attribute weights but got 1\n"
+        "MeshTools::simplifyInPlace(): expected a non-negative max error, got -0.01\n"
+        "MeshTools::simplifyInPlace(): index 2 out of range for 2 vertices\n");
+}
+
+template<class T> void SimplifyTest::simplifyErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(GridIndices)];
+    T expected[Containers::arraySize(GridIndicesSimplified)];
+    for(std::size_t i = 0; i != Containers::arraySize(GridIndices); ++i)
+        indices[i] = GridIndices[i];
+    for(std::size_t i = 0; i != Containers::arraySize(GridIndicesSimplified); ++i)
+        expected[i] = GridIndicesSimplified[i];
+
+    Containers::Pair<std::size_t, Float> out = MeshTools::simplifyInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), GridPositions, {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out.first(), 6);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(out.first()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, GridPositions, {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): second index view dimension is not contiguous\n");
+}
+
+void SimplifyTest::simplifyErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, GridPositions, {}, {}, 0, 0.01f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void SimplifyTest::simplifyMeshData() {
+    /* Deliberately not owned and with a 16-bit index type to verify the
+       index data get copied and the type preserved */
+    UnsignedShort indices[Containers::arraySize(GridIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(GridIndices); ++i)
+        indices[i] = GridIndices[i];
+
+    /* Normals are all the same, so they don't affect the result */
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    } vertices[Containers::arraySize(GridPositions)];
+    for(std::size_t i = 0; i != Containers::arraySize(GridPositions); ++i)
+        vertices[i] = {GridPositions[i], Vector3::zAxis()};
+
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+                view.slice(&Vertex::normal)}
+    }};
+
+    Trade::MeshData simplified = MeshTools::simplify(mesh, 0.0f, 0.01f);
+    CORRADE_COMPARE(simplified.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(simplified.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(simplified.indicesAsArray(),
+        Containers::arrayView(GridIndicesSimplified),
+        TestSuite::Compare::Container);
+
+    /* Vertex data are kept as they were */
+    CORRADE_COMPARE(simplified.vertexCount(), 9);
+    CORRADE_COMPARE(simplified.attributeCount(), 2);
+    CORRADE_COMPARE_AS(simplified.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView(GridPositions),
+        TestSuite::Compare::Container);
+
+    /* The original data is untouched */
+    CORRADE_COMPARE(indices[1], 1);
+}
+
+void SimplifyTest::simplifyMeshDataAttributes() {
+    Containers::Array<Vector3> positions;
+    Containers::Array<UnsignedInt> indices;
+    grid(4, -1, positions, indices);
+
+    /* Texture coordinates changing along X, same as in simplifyAttributes()
+       but with a 2D position to verify it gets expanded */
+    struct Vertex {
+        Vector2 position;
+        Vector2 textureCoordinates;
+    };
+    Containers::Array<Vertex> vertices{NoInit, positions.size()};
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        vertices[i] = {positions[i].xy(), {positions[i].x(), 0.0f}};
+
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+                view.slice(&Vertex::textureCoordinates)}
+    }};
+
+    Trade::MeshData simplified = MeshTools::simplify(mesh, 0.0f, 0.01f);
+    CORRADE_COMPARE(simplified.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(simplified.indicesAsArray(), Containers::arrayView<UnsignedInt>({
+        3, 4, 24, 0, 1, 21,
+        0, 21, 20, 1, 2, 22,
+        1, 22, 21, 2, 3, 23,
+        2, 23, 22, 3, 24, 23
+    }), TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[3]{};
+    const Vector3 positions[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Lines, 2}, 0.5f, 0.01f);
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles, 3}, 0.5f, 0.01f);
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1}, 0.5f, 0.01f);
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 1}, 0.5f, 0.01f);
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(positions)}
+        }}, 1.5f, 0.01f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplify(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::simplify(): the mesh is not indexed\n"
+        "MeshTools::simplify(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::simplify(): the mesh has no positions\n"
+        "MeshTools::simplify(): expected target ratio to be between 0 and 1, got 1.5\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cmath>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/StaticArray.h>
@@ -33,6 +34,7 @@
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Format.h>
 
+#include "Magnum/Executor.h"
 #include "Magnum/Math/Half.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Magnum.h"
@@ -77,10 +79,14 @@ struct TransformTest: TestSuite::Tester {
     void meshData3DRvaluePassthroughNoPosition();
     void meshData3DRvaluePassthroughWrongFormat();
     /* in-place variant called from the others and as such tested sufficiently,
-       except for the asserts below */
+       except for the asserts and the fused implementation specifics below */
     void meshData3DInPlaceNotMutable();
     void meshData3DInPlaceNoPosition();
     void meshData3DInPlaceWrongFormat();
+    void meshData3DInPlaceMatchesPerAttribute();
+    void meshData3DInPlaceNeighborsUntouched();
+    void meshData3DInPlaceNegativeZero();
+    void meshData3DInPlaceExecutor();
 
     template<class T> void meshDataTextureCoordinates2D();
     void meshDataTextureCoordinates2DNoCoordinates();
@@ -96,6 +102,9 @@ struct TransformTest: TestSuite::Tester {
     void meshDataTextureCoordinates2DInPlaceNotMutable();
     void meshDataTextureCoordinates2DInPlaceNoCoordinates();
     void meshDataTextureCoordinates2DInPlaceWrongFormat();
+
+    void benchmarkMeshData3DInPlace();
+    void benchmarkMeshData3DInPlacePerAttribute();
 };
 
 using namespace Math::Literals;
@@ -382,6 +391,11 @@ TransformTest::TransformTest() {
     addInstancedTests({&TransformTest::meshData3DInPlaceWrongFormat},
         Containers::arraySize(MeshData3DWrongFormatData));
 
+    addTests({&TransformTest::meshData3DInPlaceMatchesPerAttribute,
+              &TransformTest::meshData3DInPlaceNeighborsUntouched,
+              &TransformTest::meshData3DInPlaceNegativeZero,
+              &TransformTest::meshData3DInPlaceExecutor});
+
     addInstancedTests<TransformTest>({
         &TransformTest::meshDataTextureCoordinates2D<Float>,
         &TransformTest::meshDataTextureCoordinates2D<Half>
@@ -410,6 +424,9 @@ TransformTest::TransformTest() {
         Containers::arraySize(NoAttributeData));
 
     addTests({&TransformTest::meshDataTextureCoordinates2DInPlaceWrongFormat});
+
+    addBenchmarks({&TransformTest::benchmarkMeshData3DInPlace,
+                   &TransformTest::benchmarkMeshData3DInPlacePerAttribute}, 10);
 }
 
 constexpr Containers::Array2<Vector2> points2D{{
@@ -1444,6 +1461,178 @@ void TransformTest::meshData3DInPlaceWrongFormat() {
     CORRADE_COMPARE(out, data.message);
 }
 
+/* Interleaved vertex with all attributes transform3DInPlace() handles, the
+   normal being directly followed by another attribute to verify the
+   three-component stores don't overwrite it */
+struct TbnVertex {
+    Vector3 position;
+    Vector4 tangent;
+    Vector3 bitangent;
+    Vector3 normal;
+    Float somethingElse;
+};
+
+Trade::MeshData tbnMesh(Containers::ArrayView<TbnVertex> vertices) {
+    Containers::StridedArrayView1D<TbnVertex> view = vertices;
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        Trade::DataFlag::Mutable, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&TbnVertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, view.slice(&TbnVertex::tangent)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Bitangent, view.slice(&TbnVertex::bitangent)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&TbnVertex::normal)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(0), view.slice(&TbnVertex::somethingElse)}
+        }};
+}
+
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
+void TransformTest::meshData3DInPlaceMatchesPerAttribute() {
+    /* An odd count and arbitrary values to not hit just some special case.
+       The transformation has a non-uniform scaling to have a normal matrix
+       that's different from the rotation part. */
+    TbnVertex vertices[37];
+    for(std::size_t i = 0; i != Containers::arraySize(vertices); ++i) {
+        const Float f = Float(i);
+        vertices[i].position = {f*0.5f - 7.0f, 3.0f - f*0.25f, f*f*0.125f};
+        vertices[i].tangent = {Vector3{1.0f, f*0.1f, -0.5f}.normalized(), i % 2 ? 1.0f : -1.0f};
+        vertices[i].bitangent = Vector3{-f*0.1f, 1.0f, 0.25f}.normalized();
+        vertices[i].normal = Vector3{0.5f, -0.25f, 1.0f - f*0.05f}.normalized();
+        vertices[i].somethingElse = f;
+    }
+    const Matrix4 transformation =
+        Matrix4::translation({1.5f, -3.0f, 0.25f})*
+        Matrix4::rotation(37.0_degf, Vector3{1.0f, 2.0f, -0.5f}.normalized())*
+        Matrix4::scaling({2.0f, 0.5f, -1.0f});
+
+    /* What transform3DInPlace() did before it processed all attributes of a
+       vertex together */
+    TbnVertex expected[Containers::arraySize(vertices)];
+    Utility::copy(Containers::arrayView(vertices), Containers::arrayView(expected));
+    const Matrix3x3 normalMatrix = transformation.normalMatrix();
+    for(TbnVertex& vertex: expected) {
+        vertex.position = transformation.transformPoint(vertex.position);
+        vertex.tangent.xyz() = normalMatrix*vertex.tangent.xyz();
+        vertex.bitangent = normalMatrix*vertex.bitangent;
+        vertex.normal = normalMatrix*vertex.normal;
+    }
+
+    Trade::MeshData mesh = tbnMesh(vertices);
+    transform3DInPlace(mesh, transformation);
+
+    Containers::StridedArrayView1D<const TbnVertex> expectedView = expected;
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(Trade::MeshAttribute::Position),
+        expectedView.slice(&TbnVertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+        expectedView.slice(&TbnVertex::tangent),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(Trade::MeshAttribute::Bitangent),
+        expectedView.slice(&TbnVertex::bitangent),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        expectedView.slice(&TbnVertex::normal),
+        TestSuite::Compare::Container);
+}
+
+void TransformTest::meshData3DInPlaceNeighborsUntouched() {
+    /* The values are chosen so that any transformed value would differ from
+       the original, and compared bit-exactly below */
+    TbnVertex vertices[]{
+        {{1.0f, 2.0f, 3.0f}, {1.0f, 0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, 1234.5f},
+        {{4.0f, 5.0f, 6.0f}, {0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, -0.125f},
+        {{7.0f, 8.0f, 9.0f}, {0.0f, 0.0f, 1.0f, -1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 17.0f},
+    };
+
+    Trade::MeshData mesh = tbnMesh(vertices);
+    transform3DInPlace(mesh, Matrix4::translation({10.0f, 20.0f, 30.0f})*Matrix4::scaling(Vector3{3.0f}));
+
+    /* The position got transformed, but the tangent handedness and the
+       attribute following the normal not */
+    CORRADE_COMPARE(vertices[0].position, (Vector3{13.0f, 26.0f, 39.0f}));
+    CORRADE_COMPARE(vertices[0].tangent.w(), -1.0f);
+    CORRADE_COMPARE(vertices[1].tangent.w(), 1.0f);
+    CORRADE_COMPARE(vertices[2].tangent.w(), -1.0f);
+    CORRADE_COMPARE(vertices[0].somethingElse, 1234.5f);
+    CORRADE_COMPARE(vertices[1].somethingElse, -0.125f);
+    CORRADE_COMPARE(vertices[2].somethingElse, 17.0f);
+}
+
+void TransformTest::meshData3DInPlaceNegativeZero() {
+    /* The normal matrix of a translation is an identity, but with some of the
+       off-diagonal zeros being -0.0f due to the cofactor signs, which makes
+       the first components below a sum of three -0.0f products. Adding a
+       zero translation to it would turn it into 0.0f. */
+    TbnVertex vertices[]{
+        {{1.0f, 2.0f, 3.0f}, {-0.0f, 1.0f, -1.0f, 1.0f}, {-0.0f, 1.0f, -1.0f}, {-0.0f, 1.0f, -1.0f}, 0.0f},
+    };
+
+    Trade::MeshData mesh = tbnMesh(vertices);
+    transform3DInPlace(mesh, Matrix4::translation({10.0f, 20.0f, 30.0f}));
+    CORRADE_COMPARE(vertices[0].position, (Vector3{11.0f, 22.0f, 33.0f}));
+    CORRADE_COMPARE(vertices[0].tangent, (Vector4{0.0f, 1.0f, -1.0f, 1.0f}));
+    CORRADE_COMPARE(vertices[0].bitangent, (Vector3{0.0f, 1.0f, -1.0f}));
+    CORRADE_COMPARE(vertices[0].normal, (Vector3{0.0f, 1.0f, -1.0f}));
+    CORRADE_VERIFY(std::signbit(vertices[0].tangent.x()));
+    CORRADE_VERIFY(std::signbit(vertices[0].bitangent.x()));
+    CORRADE_VERIFY(std::signbit(vertices[0].normal.x()));
+}
+
+void TransformTest::meshData3DInPlaceExecutor() {
+    /* Enough vertices to be split into several tasks, with the last one being
+       incomplete */
+    Containers::Array<TbnVertex> vertices{NoInit, 150001};
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        const Float f = Float(i % 1001);
+        vertices[i].position = {f*0.5f - 7.0f, 3.0f - f*0.25f, f*0.125f};
+        vertices[i].tangent = {Vector3{1.0f, f*0.1f, -0.5f}.normalized(), i % 2 ? 1.0f : -1.0f};
+        vertices[i].bitangent = Vector3{-f*0.1f, 1.0f, 0.25f}.normalized();
+        vertices[i].normal = Vector3{0.5f, -0.25f, 1.0f - f*0.05f}.normalized();
+        vertices[i].somethingElse = f;
+    }
+    Containers::Array<TbnVertex> expected{NoInit, vertices.size()};
+    Utility::copy(Containers::arrayView(vertices), Containers::arrayView(expected));
+    const Matrix4 transformation =
+        Matrix4::translation({1.5f, -3.0f, 0.25f})*
+        Matrix4::rotation(37.0_degf, Vector3{1.0f, 2.0f, -0.5f}.normalized())*
+        Matrix4::scaling({2.0f, 0.5f, -1.0f});
+
+    Trade::MeshData expectedMesh = tbnMesh(expected);
+    transform3DInPlace(expectedMesh, transformation);
+
+    /* The output is the same regardless of the executor, including the
+       untouched data in between */
+    std::size_t calls = 0;
+    Trade::MeshData mesh = tbnMesh(vertices);
+    transform3DInPlace(mesh, transformation, 0, -1, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(Containers::arrayView(vertices)),
+        Containers::arrayCast<const Float>(Containers::arrayView(expected)),
+        TestSuite::Compare::Container);
+
+    /* Positions only take a different code path */
+    calls = 0;
+    Trade::MeshData positionsOnly{MeshPrimitive::Points,
+        Trade::DataFlag::Mutable, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::stridedArrayView(vertices).slice(&TbnVertex::position)}
+        }};
+    Trade::MeshData expectedPositionsOnly{MeshPrimitive::Points,
+        Trade::DataFlag::Mutable, expected, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::stridedArrayView(expected).slice(&TbnVertex::position)}
+        }};
+    transform3DInPlace(expectedPositionsOnly, transformation);
+    transform3DInPlace(positionsOnly, transformation, 0, -1, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(Containers::arrayView(vertices)),
+        Containers::arrayCast<const Float>(Containers::arrayView(expected)),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void TransformTest::meshDataTextureCoordinates2D() {
     auto&& data = MeshDataTextureCoordinatesData[testCaseInstanceId()];
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
@@ -1815,6 +2004,54 @@ void TransformTest::meshDataTextureCoordinates2DInPlaceWrongFormat() {
     CORRADE_COMPARE(out, "MeshTools::transformTextureCoordinates2DInPlace(): expected VertexFormat::Vector2 texture coordinates but got VertexFormat::Vector2us\n");
 }
 
+Containers::Array<TbnVertex> benchmarkVertices() {
+    Containers::Array<TbnVertex> vertices{NoInit, 100000};
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        const Float f = Float(i % 1000);
+        vertices[i].position = {f, f*0.5f, -f};
+        vertices[i].tangent = {1.0f, 0.0f, 0.0f, 1.0f};
+        vertices[i].bitangent = {0.0f, 1.0f, 0.0f};
+        vertices[i].normal = {0.0f, 0.0f, 1.0f};
+        vertices[i].somethingElse = f;
+    }
+    return vertices;
+}
+
+const Matrix4 BenchmarkTransformation =
+    Matrix4::translation({1.5f, -3.0f, 0.25f})*
+    Matrix4::rotationX(35.0_degf)*
+    Matrix4::scaling({2.0f, 0.5f, 1.0f});
+
+void TransformTest::benchmarkMeshData3DInPlace() {
+    Containers::Array<TbnVertex> vertices = benchmarkVertices();
+    Trade::MeshData mesh = tbnMesh(vertices);
+
+    CORRADE_BENCHMARK(5)
+        transform3DInPlace(mesh, BenchmarkTransformation);
+
+    CORRADE_COMPARE(vertices[1].somethingElse, 1.0f);
+}
+
+void TransformTest::benchmarkMeshData3DInPlacePerAttribute() {
+    Containers::Array<TbnVertex> vertices = benchmarkVertices();
+    Containers::StridedArrayView1D<TbnVertex> view = vertices;
+
+    /* Equivalent of transform3DInPlace() going through each attribute
+       separately, for comparison */
+    const Matrix3x3 normalMatrix = BenchmarkTransformation.normalMatrix();
+    CORRADE_BENCHMARK(5) {
+        transformPointsInPlace(BenchmarkTransformation, view.slice(&TbnVertex::position));
+        for(Vector4& tangent: view.slice(&TbnVertex::tangent))
+            tangent.xyz() = normalMatrix*tangent.xyz();
+        for(Vector3& bitangent: view.slice(&TbnVertex::bitangent))
+            bitangent = normalMatrix*bitangent;
+        for(Vector3& normal: view.slice(&TbnVertex::normal))
+            normal = normalMatrix*normal;
+    }
+
+    CORRADE_COMPARE(vertices[1].somethingElse, 1.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
@@ -32,6 +32,10 @@
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/Trade/MeshData.h"
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Magnum { namespace MeshTools {
 
 Trade::MeshData transform2D(const Trade::MeshData& mesh, const Matrix3& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
@@ -131,7 +135,7 @@ void transform2DInPlace(Trade::MeshData& mesh, const Matrix3& transformation, co
         position = transformation.transformPoint(position);
 }
 
-Trade::MeshData transform3D(const Trade::MeshData& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
+Trade::MeshData transform3D(const Trade::MeshData& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags, const Executor& executor) {
     const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId);
     #ifndef CORRADE_NO_ASSERT
     if(morphTargetId == -1) CORRADE_ASSERT(positionAttributeId,
@@ -218,7 +222,7 @@ Trade::MeshData transform3D(const Trade::MeshData& mesh, const Matrix4& transfor
         mesh.normalsInto(out.mutableAttribute<Vector3>(*normalAttributeId), id, morphTargetId);
 
     /* Delegate to the in-place implementation and return */
-    transform3DInPlace(out, transformation, id, morphTargetId);
+    transform3DInPlace(out, transformation, id, morphTargetId, executor);
     return out;
 }
 
@@ -228,7 +232,7 @@ Trade::MeshData transform3D(const Trade::MeshData& mesh, const Matrix4& transfor
 }
 #endif
 
-Trade::MeshData transform3D(Trade::MeshData&& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
+Trade::MeshData transform3D(Trade::MeshData&& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags, const Executor& executor) {
     /* Perform the operation in-place, if we can transfer the ownership and
        have positions in the right format already. Explicitly checking for
        presence of the position attribute so we don't need to duplicate the
@@ -246,13 +250,13 @@ Trade::MeshData transform3D(Trade::MeshData&& mesh, const Matrix4& transformatio
        (!bitangentAttributeId || mesh.attributeFormat(*bitangentAttributeId) == VertexFormat::Vector3) &&
        (!normalAttributeId || mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3)
     ) {
-        transform3DInPlace(mesh, transformation, id, morphTargetId);
+        transform3DInPlace(mesh, transformation, id, morphTargetId, executor);
         return Utility::move(mesh);
     }
 
     /* Otherwise delegate to the function that does all the copying and format
        expansion */
-    return transform3D(mesh, transformation, id, morphTargetId, flags);
+    return transform3D(mesh, transformation, id, morphTargetId, flags, executor);
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -261,7 +265,108 @@ Trade::MeshData transform3D(Trade::MeshData&& mesh, const Matrix4& transformatio
 }
 #endif
 
-void transform3DInPlace(Trade::MeshData& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId) {
+namespace {
+
+/* Matrix columns in a form suitable for transformPointColumns() and
+   transformVectorColumns() below. For points the fourth column is the
+   translation, vectors don't have any, which means adding a zero isn't
+   needed and thus doesn't turn a -0.0f into 0.0f. With SSE2 the whole
+   transformation is done with four-component vectors, storing only the first
+   three components in order to not overwrite whatever attribute is next in
+   the vertex. The order of operations is the same as in
+   Matrix4::transformPoint() to give the same results. */
+#ifdef CORRADE_TARGET_SSE2
+typedef __m128 TransformationColumn;
+
+inline TransformationColumn transformationColumn(const Vector3& column) {
+    return _mm_setr_ps(column.x(), column.y(), column.z(), 0.0f);
+}
+
+inline __m128 transformColumns(const Float* const data, const TransformationColumn& a, const TransformationColumn& b, const TransformationColumn& c) {
+    return _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(a, _mm_set1_ps(data[0])),
+        _mm_mul_ps(b, _mm_set1_ps(data[1]))),
+        _mm_mul_ps(c, _mm_set1_ps(data[2])));
+}
+
+inline void storeColumns(Float* const data, const __m128 out) {
+    _mm_storel_pi(reinterpret_cast<__m64*>(data), out);
+    _mm_store_ss(data + 2, _mm_movehl_ps(out, out));
+}
+
+inline void transformPointColumns(Vector3& point, const TransformationColumn& a, const TransformationColumn& b, const TransformationColumn& c, const TransformationColumn& d) {
+    Float* const data = point.data();
+    storeColumns(data, _mm_add_ps(transformColumns(data, a, b, c), d));
+}
+
+inline void transformVectorColumns(Vector3& vector, const TransformationColumn& a, const TransformationColumn& b, const TransformationColumn& c) {
+    Float* const data = vector.data();
+    storeColumns(data, transformColumns(data, a, b, c));
+}
+#else
+typedef Vector3 TransformationColumn;
+
+inline TransformationColumn transformationColumn(const Vector3& column) {
+    return column;
+}
+
+inline void transformPointColumns(Vector3& point, const TransformationColumn& a, const TransformationColumn& b, const TransformationColumn& c, const TransformationColumn& d) {
+    point = a*point.x() + b*point.y() + c*point.z() + d;
+}
+
+inline void transformVectorColumns(Vector3& vector, const TransformationColumn& a, const TransformationColumn& b, const TransformationColumn& c) {
+    vector = a*vector.x() + b*vector.y() + c*vector.z();
+}
+#endif
+
+/* Vertices are transformed in tasks of this size with a non-serial executor.
+   Every vertex is independent of the others, so the output doesn't depend on
+   the executor. */
+constexpr std::size_t TransformVerticesPerTask = 65536;
+
+/* Transforms positions, tangents, bitangents and normals of each vertex
+   together, which means interleaved vertex data are gone through just once
+   instead of once for each attribute. The TBN views are either empty or have
+   the same size as positions. */
+void transform3DInPlaceImplementation(const Matrix4& transformation, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& tangents, const Containers::StridedArrayView1D<Vector3>& bitangents, const Containers::StridedArrayView1D<Vector3>& normals, const Executor& executor) {
+    const TransformationColumn a = transformationColumn(transformation[0].xyz());
+    const TransformationColumn b = transformationColumn(transformation[1].xyz());
+    const TransformationColumn c = transformationColumn(transformation[2].xyz());
+    const TransformationColumn d = transformationColumn(transformation[3].xyz());
+    const std::size_t taskCount = (positions.size() + TransformVerticesPerTask - 1)/TransformVerticesPerTask;
+
+    /* If no other attributes are present, it's just the positions */
+    if(tangents.isEmpty() && bitangents.isEmpty() && normals.isEmpty()) {
+        executor(taskCount, [&](const std::size_t task) {
+            for(std::size_t i = task*TransformVerticesPerTask, end = Math::min(i + TransformVerticesPerTask, positions.size()); i != end; ++i)
+                transformPointColumns(positions[i], a, b, c, d);
+        });
+        return;
+    }
+
+    const Matrix3x3 normalMatrix = transformation.normalMatrix();
+    const TransformationColumn normalA = transformationColumn(normalMatrix[0]);
+    const TransformationColumn normalB = transformationColumn(normalMatrix[1]);
+    const TransformationColumn normalC = transformationColumn(normalMatrix[2]);
+    const bool hasTangents = !tangents.isEmpty();
+    const bool hasBitangents = !bitangents.isEmpty();
+    const bool hasNormals = !normals.isEmpty();
+    executor(taskCount, [&](const std::size_t task) {
+        for(std::size_t i = task*TransformVerticesPerTask, end = Math::min(i + TransformVerticesPerTask, positions.size()); i != end; ++i) {
+            transformPointColumns(positions[i], a, b, c, d);
+            if(hasTangents)
+                transformVectorColumns(tangents[i], normalA, normalB, normalC);
+            if(hasBitangents)
+                transformVectorColumns(bitangents[i], normalA, normalB, normalC);
+            if(hasNormals)
+                transformVectorColumns(normals[i], normalA, normalB, normalC);
+        }
+    });
+}
+
+}
+
+void transform3DInPlace(Trade::MeshData& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId, const Executor& executor) {
     CORRADE_ASSERT(mesh.vertexDataFlags() & Trade::DataFlag::Mutable,
         "MeshTools::transform3DInPlace(): vertex data not mutable", );
     const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId);
@@ -284,32 +389,24 @@ void transform3DInPlace(Trade::MeshData& mesh, const Matrix4& transformation, co
     CORRADE_ASSERT(!normalAttributeId || mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3,
         "MeshTools::transform3DInPlace(): expected" << VertexFormat::Vector3 << "normals but got" << mesh.attributeFormat(*normalAttributeId), );
 
-    /** @todo this needs a proper batch implementation */
-    for(Vector3& position: mesh.mutableAttribute<Vector3>(*positionAttributeId))
-        position = transformation.transformPoint(position);
-
-    /* If no other attributes are present, nothing to do */
-    if(!tangentAttributeId && !bitangentAttributeId && !normalAttributeId)
-        return;
-
-    const Matrix3x3 normalMatrix = transformation.normalMatrix();
+    /* Tangents are transformed only in the first three components, the
+       bitangent sign stays untouched */
+    /** @todo figure out the fourth component, probably has to get flipped
+        when the scale changes handedness? */
+    Containers::StridedArrayView1D<Vector3> tangents;
     if(tangentAttributeId) {
-    /** @todo this needs a proper batch implementation */
         if(tangentAttributeFormat == VertexFormat::Vector3)
-            for(Vector3& tangent: mesh.mutableAttribute<Vector3>(*tangentAttributeId))
-                tangent = normalMatrix*tangent;
-        else for(Vector4& tangent: mesh.mutableAttribute<Vector4>(*tangentAttributeId)) {
-            tangent.xyz() = normalMatrix*tangent.xyz();
-            /** @todo figure out the fourth component, probably has to get
-                flipped when the scale changes handedness? */
-        }
+            tangents = mesh.mutableAttribute<Vector3>(*tangentAttributeId);
+        else
+            tangents = mesh.mutableAttribute<Vector4>(*tangentAttributeId).slice(&Vector4::xyz);
     }
-    /** @todo this needs a proper batch implementation */
-    if(bitangentAttributeId) for(Vector3& bitangent: mesh.mutableAttribute<Vector3>(*bitangentAttributeId))
-        bitangent = normalMatrix*bitangent;
-    /** @todo this needs a proper batch implementation */
-    if(normalAttributeId) for(Vector3& normal: mesh.mutableAttribute<Vector3>(*normalAttributeId))
-        normal = normalMatrix*normal;
+
+    transform3DInPlaceImplementation(transformation,
+        mesh.mutableAttribute<Vector3>(*positionAttributeId),
+        tangents,
+        bitangentAttributeId ? mesh.mutableAttribute<Vector3>(*bitangentAttributeId) : nullptr,
+        normalAttributeId ? mesh.mutableAttribute<Vector3>(*normalAttributeId) : nullptr,
+        executor);
 }
 
 Trade::MeshData transformTextureCoordinates2D(const Trade::MeshData& mesh, const Matrix3& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
@@ -0,0 +1,584 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BoundingVolumeHierarchy.h"
+
+#include <utility> /* std::swap() */
+
+#include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+/* A node is a leaf if `next` is the directly following node, otherwise its
+   first child is the directly following node and the second child is `next`
+   of the first child. Items of a node are in the range from `itemOffset` to
+   `itemOffset` of the `next` node, which is why there's an extra sentinel
+   node at the end. */
+struct Node {
+    Range3D bounds;
+    UnsignedInt itemOffset;
+    UnsignedInt next;
+};
+
+}
+
+struct BoundingVolumeHierarchy::State {
+    Containers::ArrayTuple storage;
+    /* Node count + 1 */
+    Containers::ArrayView<Node> nodes;
+    /* Item IDs and their bounds, in the order in which they're referenced by
+       the leaf nodes */
+    Containers::ArrayView<UnsignedInt> items;
+    Containers::ArrayView<Range3D> itemBounds;
+};
+
+namespace {
+
+constexpr UnsignedInt BinCount = 16;
+constexpr UnsignedInt MaxLeafSize = 8;
+
+/* With a non-serial executor, bounds and bins of nodes with more items than
+   this are calculated in tasks of this many items, and subtrees of nodes
+   with at most this many items are built each in a single task. Bounds are
+   joined with a min and max, which give the same result in any order, so
+   the tree doesn't depend on the executor. */
+constexpr std::size_t BuildItemsPerTask = 16384;
+
+/* Values of Node::next while the tree is being built, the actual values are
+   calculated once all nodes are in place */
+constexpr UnsignedInt InnerNode = 0;
+constexpr UnsignedInt LeafNode = 1;
+constexpr UnsignedInt DeferredNode = 2;
+
+/* Half of the surface area, which is all that's needed for comparing the
+   costs */
+Float halfArea(const Range3D& range) {
+    const Vector3 size = range.size();
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+enum class Containment: UnsignedByte {
+    Outside,
+    Intersects,
+    Inside
+};
+
+/* Like Math::Intersection::rangeFrustum(), but additionally detects the
+   range being fully inside */
+Containment rangeFrustumContainment(const Range3D& range, const Frustum& frustum) {
+    const Vector3 center = range.min() + range.max();
+    const Vector3 extent = range.max() - range.min();
+
+    Containment containment = Containment::Inside;
+    for(const Vector4& plane: frustum) {
+        const Float d = Math::dot(center, plane.xyz());
+        const Float r = Math::dot(extent, Math::abs(plane.xyz()));
+        if(d + r < -2.0f*plane.w()) return Containment::Outside;
+        if(d - r < -2.0f*plane.w()) containment = Containment::Intersects;
+    }
+
+    return containment;
+}
+
+/* Unlike Math::Intersection::rayRange() this rejects ranges that are behind
+   the ray origin */
+bool rayRange(const Vector3& origin, const Vector3& inverseDirection, const Range3D& range) {
+    const Vector3 t0 = (range.min() - origin)*inverseDirection;
+    const Vector3 t1 = (range.max() - origin)*inverseDirection;
+    const Float tMin = Math::min(t0, t1).max();
+    const Float tMax = Math::max(t0, t1).min();
+    return Math::max(tMin, 0.0f) <= tMax;
+}
+
+/* Items of a node in the task-sized chunk `i` */
+Containers::ArrayView<const UnsignedInt> itemChunk(const Containers::ArrayView<const UnsignedInt> items, const std::size_t i) {
+    return items.slice(i*BuildItemsPerTask, Math::min((i + 1)*BuildItemsPerTask, items.size()));
+}
+
+/* Bounds of given items and bounds of their centers, which are used to
+   place the items into bins */
+Containers::Pair<Range3D, Range3D> itemBounds(const Containers::StridedArrayView1D<const Range3D>& bounds, const Containers::ArrayView<const UnsignedInt> items) {
+    Range3D nodeBounds = bounds[items[0]];
+    Range3D centerBounds{bounds[items[0]].center(), bounds[items[0]].center()};
+    for(const UnsignedInt item: items.exceptPrefix(1)) {
+        nodeBounds = Math::join(nodeBounds, bounds[item]);
+        const Vector3 center = bounds[item].center();
+        centerBounds = Range3D{Math::min(centerBounds.min(), center),
+                               Math::max(centerBounds.max(), center)};
+    }
+    return {nodeBounds, centerBounds};
+}
+
+Containers::Pair<Range3D, Range3D> itemBounds(const Containers::StridedArrayView1D<const Range3D>& bounds, const Containers::ArrayView<const UnsignedInt> items, const Executor& executor) {
+    if(executor.isSerial() || items.size() <= BuildItemsPerTask)
+        return itemBounds(bounds, items);
+
+    Containers::Array<Containers::Pair<Range3D, Range3D>> chunkBounds{ValueInit, (items.size() + BuildItemsPerTask - 1)/BuildItemsPerTask};
+    executor(chunkBounds.size(), [&](const std::size_t i) {
+        chunkBounds[i] = itemBounds(bounds, itemChunk(items, i));
+    });
+
+    Containers::Pair<Range3D, Range3D> out = chunkBounds[0];
+    for(const Containers::Pair<Range3D, Range3D>& i: chunkBounds.exceptPrefix(1))
+        out = {Math::join(out.first(), i.first()),
+               Math::join(out.second(), i.second())};
+    return out;
+}
+
+/* Bins for all three axes. Axes along which all item centers are the same
+   have all bins empty. */
+struct Bins {
+    Range3D bounds[3][BinCount];
+    UnsignedInt counts[3][BinCount];
+};
+
+/* Bin scale for each axis, or zero if all item centers are the same along
+   it */
+Vector3 binScale(const Range3D& centerBounds) {
+    Vector3 out;
+    for(UnsignedInt axis = 0; axis != 3; ++axis) {
+        const Float extent = centerBounds.max()[axis] - centerBounds.min()[axis];
+        out[axis] = extent <= 0.0f ? 0.0f : BinCount/extent;
+    }
+    return out;
+}
+
+UnsignedInt binIndex(const Range3D& bounds, const Range3D& centerBounds, const Vector3& scale, const UnsignedInt axis) {
+    return Math::min(UnsignedInt((bounds.center()[axis] - centerBounds.min()[axis])*scale[axis]), BinCount - 1);
+}
+
+void binItems(const Containers::StridedArrayView1D<const Range3D>& bounds, const Containers::ArrayView<const UnsignedInt> items, const Range3D& centerBounds, Bins& bins) {
+    const Vector3 scale = binScale(centerBounds);
+    for(UnsignedInt axis = 0; axis != 3; ++axis) {
+        for(UnsignedInt& count: bins.counts[axis])
+            count = 0;
+        if(scale[axis] == 0.0f)
+            continue;
+
+        for(const UnsignedInt item: items) {
+            const UnsignedInt bin = binIndex(bounds[item], centerBounds, scale, axis);
+            bins.bounds[axis][bin] = bins.counts[axis][bin] ? Math::join(bins.bounds[axis][bin], bounds[item]) : bounds[item];
+            ++bins.counts[axis][bin];
+        }
+    }
+}
+
+void binItems(const Containers::StridedArrayView1D<const Range3D>& bounds, const Containers::ArrayView<const UnsignedInt> items, const Range3D& centerBounds, Bins& bins, const Executor& executor) {
+    if(executor.isSerial() || items.size() <= BuildItemsPerTask)
+        return binItems(bounds, items, centerBounds, bins);
+
+    Containers::Array<Bins> chunkBins{NoInit, (items.size() + BuildItemsPerTask - 1)/BuildItemsPerTask};
+    executor(chunkBins.size(), [&](const std::size_t i) {
+        binItems(bounds, itemChunk(items, i), centerBounds, chunkBins[i]);
+    });
+
+    bins = chunkBins[0];
+    for(const Bins& chunk: chunkBins.exceptPrefix(1)) {
+        for(UnsignedInt axis = 0; axis != 3; ++axis) {
+            for(UnsignedInt bin = 0; bin != BinCount; ++bin) {
+                if(!chunk.counts[axis][bin])
+                    continue;
+                bins.bounds[axis][bin] = bins.counts[axis][bin] ? Math::join(bins.bounds[axis][bin], chunk.bounds[axis][bin]) : chunk.bounds[axis][bin];
+                bins.counts[axis][bin] += chunk.counts[axis][bin];
+            }
+        }
+    }
+}
+
+/* Builds the tree over items in the [rangeBegin, rangeEnd) range into
+   `nodes`, returning the node count, which is at most twice the item count.
+   Ranges to process are put on a stack, the second child is pushed first so
+   the first child is processed right after its parent, resulting in a
+   depth-first order. If `deferred` is not null, ranges with at most
+   BuildItemsPerTask items aren't built but put there instead, with a
+   placeholder node in their place. */
+std::size_t buildNodes(const Containers::StridedArrayView1D<const Range3D>& bounds, const Containers::ArrayView<UnsignedInt> allItems, const UnsignedInt rangeBegin, const UnsignedInt rangeEnd, const Containers::ArrayView<Node> nodes, Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>>* const deferred, const Executor& executor) {
+    std::size_t nodeCount = 0;
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> stack;
+    arrayAppend(stack, InPlaceInit, rangeBegin, rangeEnd);
+    while(!stack.isEmpty()) {
+        const UnsignedInt begin = stack.back().first();
+        const UnsignedInt end = stack.back().second();
+        arrayRemoveSuffix(stack);
+        const Containers::ArrayView<UnsignedInt> items = allItems.slice(begin, end);
+
+        Node& node = nodes[nodeCount++];
+        node.itemOffset = begin;
+        if(deferred && items.size() <= BuildItemsPerTask) {
+            node.next = DeferredNode;
+            arrayAppend(*deferred, InPlaceInit, begin, end);
+            continue;
+        }
+
+        const Containers::Pair<Range3D, Range3D> nodeCenterBounds = itemBounds(bounds, items, executor);
+        const Range3D& centerBounds = nodeCenterBounds.second();
+        node.bounds = nodeCenterBounds.first();
+        /* Leaf by default, reset below if the node gets split */
+        node.next = LeafNode;
+        if(items.size() == 1)
+            continue;
+
+        /* Find the split with the lowest cost, assuming the cost of visiting
+           a node and testing an item is the same */
+        Bins bins;
+        binItems(bounds, items, centerBounds, bins, executor);
+        Float bestCost = Constants::inf();
+        UnsignedInt bestAxis = 0, bestBin = 0;
+        for(UnsignedInt axis = 0; axis != 3; ++axis) {
+            const Range3D* const binBounds = bins.bounds[axis];
+            const UnsignedInt* const binCounts = bins.counts[axis];
+
+            /* Accumulate the right sides from the end first, then sweep from
+               the start and evaluate the cost of splitting after each bin.
+               If all items have the same center along this axis, all bins
+               are empty and there's nothing to split. */
+            Float rightCosts[BinCount - 1];
+            Range3D accumulatedBounds;
+            UnsignedInt accumulatedCount = 0;
+            for(UnsignedInt i = BinCount - 1; i != 0; --i) {
+                if(binCounts[i]) {
+                    accumulatedBounds = accumulatedCount ? Math::join(accumulatedBounds, binBounds[i]) : binBounds[i];
+                    accumulatedCount += binCounts[i];
+                }
+                rightCosts[i - 1] = halfArea(accumulatedBounds)*accumulatedCount;
+            }
+            accumulatedCount = 0;
+            for(UnsignedInt i = 0; i != BinCount - 1; ++i) {
+                if(binCounts[i]) {
+                    accumulatedBounds = accumulatedCount ? Math::join(accumulatedBounds, binBounds[i]) : binBounds[i];
+                    accumulatedCount += binCounts[i];
+                }
+                /* Splits that would leave one side empty aren't useful */
+                if(!accumulatedCount || accumulatedCount == items.size())
+                    continue;
+                const Float cost = halfArea(accumulatedBounds)*accumulatedCount + rightCosts[i];
+                if(cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i;
+                }
+            }
+        }
+
+        /* Small enough nodes stay a leaf unless the split is cheaper than
+           testing all items directly. Splitting additionally involves
+           testing the child nodes, which is counted as the cost of testing
+           one item. */
+        const Float nodeArea = halfArea(node.bounds);
+        if(items.size() <= MaxLeafSize && nodeArea + bestCost >= nodeArea*items.size())
+            continue;
+
+        /* Partition the items based on the chosen bin. If there's no
+           possible split because all item centers are the same, split the
+           node in half. */
+        UnsignedInt middle;
+        if(bestCost != Constants::inf()) {
+            const Vector3 scale = binScale(centerBounds);
+            UnsignedInt* first = items.begin();
+            UnsignedInt* last = items.end();
+            while(first != last) {
+                if(binIndex(bounds[*first], centerBounds, scale, bestAxis) <= bestBin)
+                    ++first;
+                else std::swap(*first, *--last);
+            }
+            middle = UnsignedInt(begin + (first - items.begin()));
+        } else middle = UnsignedInt(begin + items.size()/2);
+
+        node.next = InnerNode;
+        arrayAppend(stack, InPlaceInit, middle, end);
+        arrayAppend(stack, InPlaceInit, begin, middle);
+    }
+
+    return nodeCount;
+}
+
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const Containers::StridedArrayView1D<const Range3D>& bounds, const Executor& executor): _state{InPlaceInit} {
+    State& state = *_state;
+    const std::size_t itemCount = bounds.size();
+
+    /* A binary tree with N leaves has at most 2N - 1 nodes, plus the
+       sentinel node */
+    Containers::ArrayView<Node> nodes;
+    state.storage = Containers::ArrayTuple{
+        {NoInit, itemCount ? 2*itemCount : 1, nodes},
+        {NoInit, itemCount, state.items},
+        {NoInit, itemCount, state.itemBounds}
+    };
+    for(std::size_t i = 0; i != itemCount; ++i)
+        state.items[i] = UnsignedInt(i);
+
+    std::size_t nodeCount = 0;
+    if(itemCount && executor.isSerial()) {
+        nodeCount = buildNodes(bounds, state.items, 0, UnsignedInt(itemCount), nodes, nullptr, executor);
+
+    /* With a non-serial executor, build the top of the tree first, where the
+       nodes are large enough to have their bounds and bins calculated in
+       parallel, and then the remaining subtrees in parallel. */
+    } else if(itemCount) {
+        Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> deferred;
+        const std::size_t topNodeCount = buildNodes(bounds, state.items, 0, UnsignedInt(itemCount), nodes, &deferred, executor);
+
+        /* A subtree over N items has at most 2N - 1 nodes, so putting each at
+           twice its item offset in a temporary array doesn't make them
+           overlap */
+        Containers::Array<Node> subtreeNodes{NoInit, 2*itemCount};
+        Containers::Array<UnsignedInt> subtreeNodeCounts{NoInit, deferred.size()};
+        executor(deferred.size(), [&](const std::size_t i) {
+            const UnsignedInt begin = deferred[i].first();
+            const UnsignedInt end = deferred[i].second();
+            subtreeNodeCounts[i] = UnsignedInt(buildNodes(bounds, state.items, begin, end, subtreeNodes.slice(2*std::size_t(begin), 2*std::size_t(end)), nullptr, Executor{}));
+        });
+
+        /* Replace the placeholders with the subtrees. Every placeholder is
+           replaced with at least one node, so going from the back, nodes
+           that weren't processed yet never get overwritten. */
+        nodeCount = topNodeCount - deferred.size();
+        for(const UnsignedInt count: subtreeNodeCounts)
+            nodeCount += count;
+        std::size_t out = nodeCount;
+        std::size_t subtree = deferred.size();
+        for(std::size_t i = topNodeCount; i != 0; --i) {
+            if(nodes[i - 1].next == DeferredNode) {
+                --subtree;
+                out -= subtreeNodeCounts[subtree];
+                Utility::copy(
+                    Containers::ArrayView<const Node>{subtreeNodes}.sliceSize(2*std::size_t(deferred[subtree].first()), subtreeNodeCounts[subtree]),
+                    nodes.sliceSize(out, subtreeNodeCounts[subtree]));
+            } else nodes[--out] = nodes[i - 1];
+        }
+        CORRADE_INTERNAL_ASSERT(out == 0 && subtree == 0);
+    }
+
+    /* Add the sentinel node */
+    nodes[nodeCount].itemOffset = UnsignedInt(itemCount);
+    nodes[nodeCount].next = UnsignedInt(nodeCount);
+    state.nodes = nodes.prefix(nodeCount + 1);
+
+    /* Calculate the node following each subtree. For a leaf it's the
+       directly following node. Otherwise, going from the back, the first
+       child is the directly following node and its `next` is the second
+       child, whose `next` is then the node following the whole subtree. */
+    for(std::size_t i = nodeCount; i != 0; --i) {
+        Node& node = state.nodes[i - 1];
+        if(node.next == LeafNode)
+            node.next = UnsignedInt(i);
+        else node.next = state.nodes[state.nodes[i].next].next;
+    }
+
+    for(std::size_t i = 0; i != itemCount; ++i)
+        state.itemBounds[i] = bounds[state.items[i]];
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) noexcept = default;
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy() = default;
+
+BoundingVolumeHierarchy& BoundingVolumeHierarchy::operator=(BoundingVolumeHierarchy&&) noexcept = default;
+
+std::size_t BoundingVolumeHierarchy::size() const {
+    return _state->items.size();
+}
+
+std::size_t BoundingVolumeHierarchy::nodeCount() const {
+    return _state->nodes.size() - 1;
+}
+
+Range3D BoundingVolumeHierarchy::bounds() const {
+    return _state->items.isEmpty() ? Range3D{} : _state->nodes[0].bounds;
+}
+
+void BoundingVolumeHierarchy::refit(const Containers::StridedArrayView1D<const Range3D>& bounds) {
+    State& state = *_state;
+    CORRADE_ASSERT(bounds.size() == state.items.size(),
+        "SceneTools::BoundingVolumeHierarchy::refit(): expected" << state.items.size() << "bounds but got" << bounds.size(), );
+
+    for(std::size_t i = 0; i != state.items.size(); ++i)
+        state.itemBounds[i] = bounds[state.items[i]];
+
+    /* Children are always after their parent, so going from the back
+       updates them first */
+    for(std::size_t i = state.nodes.size() - 1; i != 0; --i) {
+        Node& node = state.nodes[i - 1];
+        if(node.next == i) {
+            const Containers::ArrayView<const Range3D> itemBounds = state.itemBounds.slice(node.itemOffset, state.nodes[i].itemOffset);
+            node.bounds = itemBounds[0];
+            for(const Range3D& itemBound: itemBounds.exceptPrefix(1))
+                node.bounds = Math::join(node.bounds, itemBound);
+        } else {
+            node.bounds = Math::join(state.nodes[i].bounds, state.nodes[state.nodes[i].next].bounds);
+        }
+    }
+}
+
+std::size_t BoundingVolumeHierarchy::cullFrustumInto(const Frustum& frustum, const Containers::MutableBitArrayView visible) const {
+    const State& state = *_state;
+    CORRADE_ASSERT(visible.size() == state.items.size(),
+        "SceneTools::BoundingVolumeHierarchy::cullFrustumInto(): expected" << state.items.size() << "bits but got" << visible.size(), {});
+
+    visible.resetAll();
+
+    /* Subtrees that are outside or fully inside are skipped as a whole */
+    std::size_t count = 0;
+    const std::size_t nodeCount = state.nodes.size() - 1;
+    for(std::size_t i = 0; i != nodeCount; ) {
+        const Node& node = state.nodes[i];
+        const Containment containment = rangeFrustumContainment(node.bounds, frustum);
+        if(containment == Containment::Outside) {
+            i = node.next;
+            continue;
+        }
+
+        const UnsignedInt itemEnd = state.nodes[node.next].itemOffset;
+        if(containment == Containment::Inside) {
+            for(UnsignedInt j = node.itemOffset; j != itemEnd; ++j)
+                visible.set(state.items[j]);
+            count += itemEnd - node.itemOffset;
+            i = node.next;
+            continue;
+        }
+
+        /* If it's a leaf, test the items. The next node is the directly
+           following one in both cases. */
+        if(node.next == i + 1) for(UnsignedInt j = node.itemOffset; j != itemEnd; ++j) {
+            if(Math::Intersection::rangeFrustum(state.itemBounds[j], frustum)) {
+                visible.set(state.items[j]);
+                ++count;
+            }
+        }
+        ++i;
+    }
+
+    return count;
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> BoundingVolumeHierarchy::intersectRays(const Containers::StridedArrayView1D<const Vector3>& origins, const Containers::StridedArrayView1D<const Vector3>& directions) const {
+    const State& state = *_state;
+    CORRADE_ASSERT(origins.size() == directions.size(),
+        "SceneTools::BoundingVolumeHierarchy::intersectRays(): expected origin and direction views to have the same size but got" << origins.size() << "and" << directions.size(), {});
+
+    Containers::Array<UnsignedInt> offsets{NoInit, origins.size() + 1};
+    Containers::Array<UnsignedInt> out;
+    const std::size_t nodeCount = state.nodes.size() - 1;
+    for(std::size_t r = 0; r != origins.size(); ++r) {
+        offsets[r] = UnsignedInt(out.size());
+        const Vector3 origin = origins[r];
+        const Vector3 inverseDirection = 1.0f/directions[r];
+
+        for(std::size_t i = 0; i != nodeCount; ) {
+            const Node& node = state.nodes[i];
+            if(!rayRange(origin, inverseDirection, node.bounds)) {
+                i = node.next;
+                continue;
+            }
+
+            if(node.next == i + 1) {
+                const UnsignedInt itemEnd = state.nodes[node.next].itemOffset;
+                for(UnsignedInt j = node.itemOffset; j != itemEnd; ++j) {
+                    if(rayRange(origin, inverseDirection, state.itemBounds[j]))
+                        arrayAppend(out, state.items[j]);
+                }
+            }
+            ++i;
+        }
+    }
+    offsets[origins.size()] = UnsignedInt(out.size());
+
+    /* Convert back to a default deleter to make the array usable in plugins */
+    arrayShrink(out, DefaultInit);
+
+    return {Utility::move(offsets), Utility::move(out)};
+}
+
+Containers::Array<Range3D> meshInstanceBounds3D(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds) {
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+    Containers::Array<Range3D> out{NoInit, meshFieldId ? scene.fieldSize(*meshFieldId) : 0};
+    meshInstanceBounds3DInto(scene, meshBounds, out);
+    return out;
+}
+
+void meshInstanceBounds3DInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const Containers::StridedArrayView1D<Range3D>& bounds) {
+    CORRADE_ASSERT(scene.is3D(),
+        "SceneTools::meshInstanceBounds3DInto(): the scene is not 3D", );
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::meshInstanceBounds3DInto(): the scene has no hierarchy", );
+
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+    const std::size_t instanceCount = meshFieldId ? scene.fieldSize(*meshFieldId) : 0;
+    CORRADE_ASSERT(bounds.size() == instanceCount,
+        "SceneTools::meshInstanceBounds3DInto(): expected bounds destination view with" << instanceCount << "elements but got" << bounds.size(), );
+    if(!meshFieldId)
+        return;
+
+    /* Allocate a single storage for all temporary data */
+    Containers::ArrayView<UnsignedInt> meshes;
+    Containers::ArrayView<Matrix4> transformations;
+    Containers::ArrayTuple storage{
+        {NoInit, instanceCount, meshes},
+        {NoInit, instanceCount, transformations}
+    };
+    scene.meshesMaterialsInto(nullptr, meshes, nullptr);
+    absoluteFieldTransformations3DInto(scene, *meshFieldId, transformations);
+
+    /* Transform the center and then project the half-size onto each axis,
+       which gives the same result as transforming all eight corners and
+       calculating their bounds */
+    for(std::size_t i = 0; i != instanceCount; ++i) {
+        CORRADE_ASSERT(meshes[i] < meshBounds.size(),
+            "SceneTools::meshInstanceBounds3DInto(): mesh" << meshes[i] << "out of range for" << meshBounds.size() << "mesh bounds", );
+        const Range3D& meshBound = meshBounds[meshes[i]];
+        const Matrix4& transformation = transformations[i];
+        const Vector3 halfSize = meshBound.size()*0.5f;
+        const Vector3 transformedHalfSize =
+            Math::abs(transformation[0].xyz())*halfSize.x() +
+            Math::abs(transformation[1].xyz())*halfSize.y() +
+            Math::abs(transformation[2].xyz())*halfSize.z();
+        bounds[i] = Range3D::fromCenter(transformation.transformPoint(meshBound.center()), transformedHalfSize);
+    }
+}
+
+BoundingVolumeHierarchy buildBoundingVolumeHierarchy(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const Executor& executor) {
+    return BoundingVolumeHierarchy{meshInstanceBounds3D(scene, meshBounds), executor};
+}
+
+}}
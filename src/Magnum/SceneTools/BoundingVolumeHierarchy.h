@@ -0,0 +1,213 @@
+#ifndef Magnum_SceneTools_BoundingVolumeHierarchy_h
+#define Magnum_SceneTools_BoundingVolumeHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::BoundingVolumeHierarchy, function @ref Magnum::SceneTools::buildBoundingVolumeHierarchy(), @ref Magnum::SceneTools::meshInstanceBounds3D(), @ref Magnum::SceneTools::meshInstanceBounds3DInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Bounding volume hierarchy
+@m_since_latest
+
+Axis-aligned bounding box tree over a list of items, meant for frustum culling
+and ray queries over large amounts of mesh instances. Use
+@ref buildBoundingVolumeHierarchy() to create it directly from mesh instances
+in a @ref Trade::SceneData, or construct it from arbitrary bounds.
+
+The tree is built top-down, splitting each node where the surface area
+heuristic estimates the lowest cost of traversing the children, evaluated at
+16 bin boundaries along each axis. Nodes are stored in a single flat array in
+a depth-first order, with the first child directly following its parent and
+every node referencing the node that follows its subtree. The queries thus
+walk the array linearly without needing a stack, and items of each subtree
+form a contiguous range, which is used to accept whole subtrees that are fully
+inside a frustum without testing them further.
+
+The build can be parallelized by passing an @ref Executor to the constructor
+or to @ref buildBoundingVolumeHierarchy(). Bounds and bins of nodes with more
+than 16384 items are then calculated in tasks of that size, and subtrees of
+nodes with at most that many items are each built in a single task. The
+resulting tree is the same regardless of the executor used.
+
+For animated content, @ref refit() updates the bounds without rebuilding the
+tree. The tree quality degrades if items move far from their original
+positions, in which case it's better to build a new one.
+@experimental
+*/
+class MAGNUM_SCENETOOLS_EXPORT BoundingVolumeHierarchy {
+    public:
+        /**
+         * @brief Constructor
+         * @param bounds    Item bounds
+         * @param executor  Executor to build the tree with
+         *
+         * Item IDs used by @ref cullFrustumInto() and @ref intersectRays()
+         * are indices into @p bounds. The @p bounds aren't referenced
+         * afterwards. With a non-serial @p executor, a temporary array for
+         * nodes of the subtrees built in parallel is allocated in addition.
+         */
+        explicit BoundingVolumeHierarchy(const Containers::StridedArrayView1D<const Range3D>& bounds, const Executor& executor = {});
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy&) = delete;
+
+        /** @brief Move constructor */
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) noexcept;
+
+        ~BoundingVolumeHierarchy();
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy&) = delete;
+
+        /** @brief Move assignment */
+        BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) noexcept;
+
+        /** @brief Item count */
+        std::size_t size() const;
+
+        /**
+         * @brief Node count
+         *
+         * At most @cpp 2*size() - 1 @ce, or @cpp 0 @ce if there are no
+         * items.
+         */
+        std::size_t nodeCount() const;
+
+        /**
+         * @brief Bounds of all items
+         *
+         * If there are no items, returns a default-constructed range.
+         */
+        Range3D bounds() const;
+
+        /**
+         * @brief Update item bounds
+         *
+         * Recalculates bounds of all nodes while keeping the tree topology.
+         * Expects that @p bounds have the same size as @ref size(), item IDs
+         * are the same as the tree was constructed with.
+         */
+        void refit(const Containers::StridedArrayView1D<const Range3D>& bounds);
+
+        /**
+         * @brief Cull items against a frustum
+         * @param[in]  frustum  Frustum to test against
+         * @param[out] visible  Where to put visible items
+         * @return Count of visible items
+         *
+         * Sets bits of items that intersect or are inside @p frustum and
+         * resets all other bits. Expects that @p visible has the same size as
+         * @ref size(). Equivalent to testing each item with
+         * @ref Math::Intersection::rangeFrustum().
+         */
+        std::size_t cullFrustumInto(const Frustum& frustum, Containers::MutableBitArrayView visible) const;
+
+        /**
+         * @brief Intersect items with rays
+         * @param origins       Ray origins
+         * @param directions    Ray directions
+         *
+         * For each ray returns IDs of all items whose bounds the ray hits at
+         * a non-negative distance from the origin. The first returned array
+         * contains offsets into the second for each ray, with the last item
+         * being the total count --- items hit by ray @cpp i @ce are in the
+         * range given by offsets @cpp i @ce and @cpp i + 1 @ce. The items are
+         * in an unspecified order. Expects that @p origins and @p directions
+         * have the same size, the directions don't need to be normalized.
+         */
+        Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> intersectRays(const Containers::StridedArrayView1D<const Vector3>& origins, const Containers::StridedArrayView1D<const Vector3>& directions) const;
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+/**
+@brief Calculate absolute bounds of 3D mesh instances
+@param scene        Input scene
+@param meshBounds   Bounds of meshes referenced by the scene, for example
+    calculated with @ref MeshTools::boundingRange()
+@m_since_latest
+
+For all entries of the @ref Trade::SceneField::Mesh field in @p scene takes
+bounds of the referenced mesh and transforms them with the absolute
+transformation calculated by @ref absoluteFieldTransformations3D(), producing
+an axis-aligned box that encloses the transformed mesh bounds. The returned
+data are in the same order as the mesh field entries, if @p scene doesn't
+have a mesh field, the returned array is empty. All mesh IDs are expected to
+be less than size of @p meshBounds, the scene is expected to be 3D and
+contain a @ref Trade::SceneField::Parent field, with the same restrictions as
+@ref absoluteFieldTransformations3D().
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Range3D> meshInstanceBounds3D(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds);
+
+/**
+@brief Calculate absolute bounds of 3D mesh instances into an existing array
+@param[in]  scene       Input scene
+@param[in]  meshBounds  Bounds of meshes referenced by the scene
+@param[out] bounds      Where to put the calculated bounds
+@m_since_latest
+
+A variant of @ref meshInstanceBounds3D() that fills existing memory instead of
+allocating a new array. The @p bounds array is expected to have the same size
+as the @ref Trade::SceneField::Mesh field, or be empty if the scene doesn't
+have a mesh field. Useful for example for passing the result to
+@ref BoundingVolumeHierarchy::refit() after the scene transformations change.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void meshInstanceBounds3DInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const Containers::StridedArrayView1D<Range3D>& bounds);
+
+/**
+@brief Build a bounding volume hierarchy over 3D mesh instances
+@param scene        Input scene
+@param meshBounds   Bounds of meshes referenced by the scene, for example
+    calculated with @ref MeshTools::boundingRange()
+@param executor     Executor to build the tree with
+@m_since_latest
+
+Calculates instance bounds using @ref meshInstanceBounds3D() and passes them
+to @ref BoundingVolumeHierarchy::BoundingVolumeHierarchy(). Item IDs used by
+the hierarchy are then indices into the @ref Trade::SceneField::Mesh field.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT BoundingVolumeHierarchy buildBoundingVolumeHierarchy(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const Executor& executor = {});
+
+}}
+
+#endif
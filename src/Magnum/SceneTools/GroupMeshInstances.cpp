@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GroupMeshInstances.h"
+
+#include <algorithm> /* std::stable_sort() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+/* Spreads the lower 10 bits of the value to every third bit */
+UnsignedInt spreadBits(UnsignedInt value) {
+    value &= 0x000003ff;
+    value = (value | (value << 16)) & 0x030000ff;
+    value = (value | (value << 8)) & 0x0300f00f;
+    value = (value | (value << 4)) & 0x030c30c3;
+    value = (value | (value << 2)) & 0x09249249;
+    return value;
+}
+
+}
+
+Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> groupMeshInstances3D(const Trade::SceneData& scene, const GroupMeshInstancesFlags flags, const Matrix4& globalTransformation) {
+    CORRADE_ASSERT(scene.is3D(),
+        "SceneTools::groupMeshInstances3D(): the scene is not 3D", {});
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::groupMeshInstances3D(): the scene has no hierarchy", {});
+
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+    if(!meshFieldId)
+        return {};
+
+    /* Allocate a single storage for all temporary data */
+    const std::size_t instanceCount = scene.fieldSize(*meshFieldId);
+    Containers::ArrayView<UnsignedInt> meshes;
+    Containers::ArrayView<Int> materials;
+    Containers::ArrayView<Matrix4> transformations;
+    Containers::ArrayView<UnsignedInt> mortonCodes;
+    Containers::ArrayView<UnsignedInt> order;
+    Containers::ArrayTuple storage{
+        {NoInit, instanceCount, meshes},
+        {NoInit, instanceCount, materials},
+        {NoInit, instanceCount, transformations},
+        /* Left at zero if MortonOrder isn't set, so the sort preserves the
+           original order in each group */
+        {ValueInit, instanceCount, mortonCodes},
+        {NoInit, instanceCount, order}
+    };
+    scene.meshesMaterialsInto(nullptr, meshes, materials);
+    absoluteFieldTransformations3DInto(scene, *meshFieldId, transformations, globalTransformation);
+
+    /* Quantize the translations to 10 bits in each dimension relative to
+       their bounds and interleave the bits. Dimensions in which all
+       instances are at the same position get quantized to zero. */
+    if((flags & GroupMeshInstancesFlag::MortonOrder) && instanceCount) {
+        Vector3 min = transformations[0].translation();
+        Vector3 max = min;
+        for(const Matrix4& transformation: transformations) {
+            min = Math::min(min, transformation.translation());
+            max = Math::max(max, transformation.translation());
+        }
+
+        const Vector3 size = max - min;
+        Vector3 scale;
+        for(std::size_t i = 0; i != 3; ++i)
+            scale[i] = size[i] > 0.0f ? 1023.0f/size[i] : 0.0f;
+
+        for(std::size_t i = 0; i != instanceCount; ++i) {
+            const Vector3ui quantized{(transformations[i].translation() - min)*scale};
+            mortonCodes[i] =
+                spreadBits(quantized.x())|
+                (spreadBits(quantized.y()) << 1)|
+                (spreadBits(quantized.z()) << 2);
+        }
+    }
+
+    /* Sort the instances by mesh, material and the Morton code. The sort is
+       stable to preserve the scene order if the codes are all zero. */
+    for(std::size_t i = 0; i != instanceCount; ++i)
+        order[i] = UnsignedInt(i);
+    std::stable_sort(order.begin(), order.end(), [&](const UnsignedInt a, const UnsignedInt b) {
+        if(meshes[a] != meshes[b])
+            return meshes[a] < meshes[b];
+        if(materials[a] != materials[b])
+            return materials[a] < materials[b];
+        return mortonCodes[a] < mortonCodes[b];
+    });
+
+    /* Count the groups to allocate the output */
+    std::size_t groupCount = 0;
+    for(std::size_t i = 0; i != instanceCount; ++i) {
+        if(!i || meshes[order[i]] != meshes[order[i - 1]] || materials[order[i]] != materials[order[i - 1]])
+            ++groupCount;
+    }
+
+    Containers::Array<Containers::Pair<UnsignedInt, Int>> groups{NoInit, groupCount};
+    Containers::Array<UnsignedInt> offsets{NoInit, groupCount + 1};
+    Containers::Array<Matrix4> outTransformations{NoInit, instanceCount};
+    std::size_t group = 0;
+    for(std::size_t i = 0; i != instanceCount; ++i) {
+        const UnsignedInt instance = order[i];
+        if(!i || meshes[instance] != meshes[order[i - 1]] || materials[instance] != materials[order[i - 1]]) {
+            groups[group] = {meshes[instance], materials[instance]};
+            offsets[group] = UnsignedInt(i);
+            ++group;
+        }
+        outTransformations[i] = transformations[instance];
+    }
+    CORRADE_INTERNAL_ASSERT(group == groupCount);
+    offsets[groupCount] = UnsignedInt(instanceCount);
+
+    return {Utility::move(groups), Utility::move(offsets), Utility::move(outTransformations)};
+}
+
+Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> groupMeshInstances3D(const Trade::SceneData& scene, const GroupMeshInstancesFlags flags) {
+    return groupMeshInstances3D(scene, flags, {});
+}
+
+}}
@@ -0,0 +1,115 @@
+#ifndef Magnum_SceneTools_GroupMeshInstances_h
+#define Magnum_SceneTools_GroupMeshInstances_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::groupMeshInstances3D(), enum @ref Magnum::SceneTools::GroupMeshInstancesFlag, enum set @ref Magnum::SceneTools::GroupMeshInstancesFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Mesh instance grouping flag
+@m_since_latest
+
+@see @ref GroupMeshInstancesFlags, @ref groupMeshInstances3D()
+*/
+enum class GroupMeshInstancesFlag: UnsignedByte {
+    /**
+     * Order instances in each group by a Morton code of their translation
+     * instead of keeping them in the order they're in the scene. Instances
+     * that are close to each other in space are then close to each other in
+     * the output as well, which improves locality for example when culling
+     * contiguous ranges of instances.
+     */
+    MortonOrder = 1 << 0
+};
+
+/**
+@brief Mesh instance grouping flags
+@m_since_latest
+
+@see @ref groupMeshInstances3D()
+*/
+typedef Containers::EnumSet<GroupMeshInstancesFlag> GroupMeshInstancesFlags;
+
+CORRADE_ENUMSET_OPERATORS(GroupMeshInstancesFlags)
+
+/**
+@brief Group 3D mesh instances by mesh and material
+@param scene                Input scene
+@param flags                Flags
+@param globalTransformation Global transformation to prepend
+@m_since_latest
+
+Takes all @ref Trade::SceneField::Mesh and
+@relativeref{Trade::SceneField,MeshMaterial} entries in @p scene, groups those
+that share the same mesh and material and calculates absolute transformation
+of each using @ref absoluteFieldTransformations3D(). Returns:
+
+-   unique mesh and material pairs, sorted by the mesh ID and then by the
+    material ID. If the scene has no @relativeref{Trade::SceneField,MeshMaterial}
+    field, the material is @cpp -1 @ce.
+-   offsets of each group into the transformation array, with the last item
+    being the total instance count. Transformations of instances in group
+    @cpp i @ce are in the range given by items @cpp i @ce and @cpp i + 1 @ce.
+-   absolute transformations of all instances, contiguous for each group and
+    ready to be uploaded to an instance buffer.
+
+Instances in each group are in the same order as in the scene, unless
+@ref GroupMeshInstancesFlag::MortonOrder is set. If @p scene doesn't have a
+@relativeref{Trade::SceneField,Mesh} field, all returned arrays are empty.
+The scene is expected to be 3D and contain a @ref Trade::SceneField::Parent
+field, with the same restrictions as @ref absoluteFieldTransformations3D().
+
+The operation is done in an @f$ \mathcal{O}(m \log{} m + n) @f$ execution
+time and @f$ \mathcal{O}(m + n) @f$ memory complexity, with @f$ m @f$ being
+the size of the mesh field and @f$ n @f$ being
+@ref Trade::SceneData::mappingBound().
+@experimental
+
+@see @ref Trade::SceneData::meshesMaterialsAsArray(),
+    @ref Trade::SceneData::is3D()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> groupMeshInstances3D(const Trade::SceneData& scene, GroupMeshInstancesFlags flags = {}, const Matrix4& globalTransformation = {});
+#else
+/* To avoid including Matrix4 */
+MAGNUM_SCENETOOLS_EXPORT Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> groupMeshInstances3D(const Trade::SceneData& scene, GroupMeshInstancesFlags flags, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> groupMeshInstances3D(const Trade::SceneData& scene, GroupMeshInstancesFlags flags = {});
+#endif
+
+}}
+
+#endif
@@ -28,6 +28,7 @@
 
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
@@ -36,6 +37,8 @@
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneTools/Implementation/sceneDataDimensionTraits.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace SceneTools {
@@ -260,26 +263,8 @@ void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::Str
 
 namespace {
 
-template<UnsignedInt> struct SceneDataDimensionTraits;
-template<> struct SceneDataDimensionTraits<2> {
-    static bool isDimensions(const Trade::SceneData& scene) {
-        return scene.is2D();
-    }
-    static void transformationsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix3>& transformationDestination) {
-        return scene.transformations2DInto(mappingDestination, transformationDestination);
-    }
-};
-template<> struct SceneDataDimensionTraits<3> {
-    static bool isDimensions(const Trade::SceneData& scene) {
-        return scene.is3D();
-    }
-    static void transformationsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix4>& transformationDestination) {
-        return scene.transformations3DInto(mappingDestination, transformationDestination);
-    }
-};
-
 template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
-    CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
+    CORRADE_ASSERT(Implementation::SceneDataDimensionTraits<dimensions>::isDimensions(scene),
         "SceneTools::absoluteFieldTransformations(): the scene is not" << dimensions << Debug::nospace << "D", );
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
         "SceneTools::absoluteFieldTransformations(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", );
@@ -304,7 +289,7 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
     parentsBreadthFirstInto(scene,
         stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first),
         stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second));
-    SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
+    Implementation::SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
         stridedArrayView(transformations).slice(&decltype(transformations)::Type::first),
         stridedArrayView(transformations).slice(&decltype(transformations)::Type::second));
 
@@ -430,4 +415,225 @@ void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Uns
     return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, {});
 }
 
+namespace {
+
+/* Equivalent to Quaternion::transformVectorNormalized() but without the
+   debug assert, as the rotations may drift slightly away from unit length
+   after being multiplied together in deep hierarchies */
+inline Vector3 rotateVector(const Quaternion& rotation, const Vector3& vector) {
+    const Vector3 t = 2.0f*Math::cross(rotation.vector(), vector);
+    return vector + rotation.scalar()*t + Math::cross(rotation.vector(), t);
+}
+
+/* The `mapping` view is expected to alias one of the outputs, it's
+   subsequently replaced by the output data for given entry. The `output`
+   functor gets called with an index into the field and the absolute
+   translation, rotation and scaling. */
+template<class Output> void absoluteFieldTranslationsRotationsScalingsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<UnsignedInt>& mapping, const Output& output) {
+    CORRADE_ASSERT(scene.is3D(),
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): the scene is not 3D", );
+    CORRADE_ASSERT(fieldId < scene.fieldCount(),
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", );
+    const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
+    CORRADE_ASSERT(parentFieldId,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): the scene has no hierarchy", );
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Translation) || scene.hasField(Trade::SceneField::Rotation) || scene.hasField(Trade::SceneField::Scaling),
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): the scene has no translation, rotation or scaling field", );
+    CORRADE_ASSERT(mapping.size() == scene.fieldSize(fieldId),
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): bad output size, expected" << scene.fieldSize(fieldId) << "but got" << mapping.size(), );
+
+    /* Allocate a single storage for all temporary data. The translations,
+       rotations and scalings are kept in separate arrays to make the loops
+       below operate on tightly packed data. The TRS fields all share the same
+       object mapping, but scene.transformationFieldSize() can't be used as
+       it returns the size of the matrix field if there's one. */
+    std::size_t transformationFieldSize = 0;
+    for(const Trade::SceneField field: {Trade::SceneField::Translation, Trade::SceneField::Rotation, Trade::SceneField::Scaling}) {
+        if(const Containers::Optional<UnsignedInt> translationRotationScalingFieldId = scene.findFieldId(field)) {
+            transformationFieldSize = scene.fieldSize(*translationRotationScalingFieldId);
+            break;
+        }
+    }
+    const std::size_t objectCount = std::size_t(scene.mappingBound());
+    Containers::ArrayView<Containers::Pair<UnsignedInt, Int>> orderedClusteredParents;
+    Containers::ArrayView<UnsignedInt> transformationMapping;
+    Containers::ArrayView<Vector3> transformationTranslations;
+    Containers::ArrayView<Quaternion> transformationRotations;
+    Containers::ArrayView<Vector3> transformationScalings;
+    Containers::ArrayView<Vector3> absoluteTranslations;
+    Containers::ArrayView<Quaternion> absoluteRotations;
+    Containers::ArrayView<Vector3> absoluteScalings;
+    Containers::ArrayTuple storage{
+        /* Output of parentsBreadthFirstInto() */
+        {NoInit, scene.fieldSize(*parentFieldId), orderedClusteredParents},
+        /* Output of scene.translationsRotationsScalings3DInto() */
+        {NoInit, transformationFieldSize, transformationMapping},
+        {NoInit, transformationFieldSize, transformationTranslations},
+        {NoInit, transformationFieldSize, transformationRotations},
+        {NoInit, transformationFieldSize, transformationScalings},
+        /* Above but indexed by object ID, with the first item being an
+           identity so top-level objects don't need to be special-cased. The
+           value-initialized translations and rotations are zero and identity,
+           scalings are set to one below. */
+        {ValueInit, objectCount + 1, absoluteTranslations},
+        {ValueInit, objectCount + 1, absoluteRotations},
+        {NoInit, objectCount + 1, absoluteScalings}
+    };
+    parentsBreadthFirstInto(scene,
+        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first),
+        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second));
+    scene.translationsRotationsScalings3DInto(transformationMapping, transformationTranslations, transformationRotations, transformationScalings);
+
+    /* The transformation matrices aren't decomposed, so objects that have
+       only a matrix would be silently treated as having an identity. Objects
+       that have both are fine, the TRS fields are used for them. */
+    #ifndef CORRADE_NO_ASSERT
+    if(const Containers::Optional<UnsignedInt> transformationFieldId = scene.findFieldId(Trade::SceneField::Transformation)) {
+        Containers::BitArray hasTranslationRotationScaling{ValueInit, objectCount};
+        for(const UnsignedInt object: transformationMapping)
+            hasTranslationRotationScaling.set(object);
+        for(const UnsignedInt object: scene.mappingAsArray(*transformationFieldId))
+            CORRADE_ASSERT(hasTranslationRotationScaling[object],
+                "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): object" << object << "has a transformation matrix but no translation, rotation or scaling", );
+    }
+    #endif
+
+    /* Retrieve transformations of all objects, indexed by object ID. Objects
+       that don't have any transformation stay at an identity. */
+    for(Vector3& scaling: absoluteScalings)
+        scaling = Vector3{1.0f};
+    for(std::size_t i = 0; i != transformationFieldSize; ++i) {
+        const UnsignedInt object = transformationMapping[i];
+        CORRADE_INTERNAL_ASSERT(object < objectCount);
+        absoluteTranslations[object + 1] = transformationTranslations[i];
+        absoluteRotations[object + 1] = transformationRotations[i];
+        absoluteScalings[object + 1] = transformationScalings[i];
+    }
+
+    /* Turn the transformations into absolute. The parents are always before
+       their children so they're already absolute at this point. */
+    for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
+        const std::size_t object = parentOffset.first() + 1;
+        const std::size_t parent = parentOffset.second() + 1;
+        absoluteTranslations[object] = absoluteTranslations[parent] + rotateVector(absoluteRotations[parent], absoluteScalings[parent]*absoluteTranslations[object]);
+        absoluteRotations[object] = absoluteRotations[parent]*absoluteRotations[object];
+        absoluteScalings[object] = absoluteScalings[parent]*absoluteScalings[object];
+    }
+
+    /* Retrieve object mapping for the field and output absolute
+       transformation of each */
+    scene.mappingInto(fieldId, mapping);
+    for(std::size_t i = 0; i != mapping.size(); ++i) {
+        const UnsignedInt object = mapping[i];
+        CORRADE_INTERNAL_ASSERT(object < objectCount);
+        output(i, absoluteTranslations[object + 1], absoluteRotations[object + 1], absoluteScalings[object + 1]);
+    }
+}
+
+struct TranslationRotationScalingOutput {
+    void operator()(std::size_t i, const Vector3& translation, const Quaternion& rotation, const Vector3& scaling) const {
+        translations[i] = translation;
+        rotations[i] = rotation;
+        scalings[i] = scaling;
+    }
+
+    Containers::StridedArrayView1D<Vector3> translations;
+    Containers::StridedArrayView1D<Quaternion> rotations;
+    Containers::StridedArrayView1D<Vector3> scalings;
+};
+
+struct Matrix4Output {
+    void operator()(std::size_t i, const Vector3& translation, const Quaternion& rotation, const Vector3& scaling) const {
+        const Matrix3x3 rotationMatrix = rotation.toMatrix();
+        transformations[i] = Matrix4::from(Matrix3x3{
+            rotationMatrix[0]*scaling.x(),
+            rotationMatrix[1]*scaling.y(),
+            rotationMatrix[2]*scaling.z()
+        }, translation);
+    }
+
+    Containers::StridedArrayView1D<Matrix4> transformations;
+};
+
+struct Matrix4x3Output {
+    void operator()(std::size_t i, const Vector3& translation, const Quaternion& rotation, const Vector3& scaling) const {
+        const Matrix3x3 rotationMatrix = rotation.toMatrix();
+        transformations[i] = Matrix4x3{
+            rotationMatrix[0]*scaling.x(),
+            rotationMatrix[1]*scaling.y(),
+            rotationMatrix[2]*scaling.z(),
+            translation
+        };
+    }
+
+    Containers::StridedArrayView1D<Matrix4x3> transformations;
+};
+
+}
+
+Containers::Array<Containers::Triple<Vector3, Quaternion, Vector3>> absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
+    CORRADE_ASSERT(fieldId < scene.fieldCount(),
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3D(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", {});
+
+    Containers::Array<Containers::Triple<Vector3, Quaternion, Vector3>> out{NoInit, scene.fieldSize(fieldId)};
+    absoluteFieldTranslationsRotationsScalings3DInto(scene, fieldId,
+        stridedArrayView(out).slice(&decltype(out)::Type::first),
+        stridedArrayView(out).slice(&decltype(out)::Type::second),
+        stridedArrayView(out).slice(&decltype(out)::Type::third));
+    return out;
+}
+
+Containers::Array<Containers::Triple<Vector3, Quaternion, Vector3>> absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData& scene, const Trade::SceneField field) {
+    const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
+    CORRADE_ASSERT(fieldId,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3D(): field" << field << "not found", {});
+
+    return absoluteFieldTranslationsRotationsScalings3D(scene, *fieldId);
+}
+
+void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Vector3>& translations, const Containers::StridedArrayView1D<Quaternion>& rotations, const Containers::StridedArrayView1D<Vector3>& scalings) {
+    CORRADE_ASSERT(rotations.size() == translations.size() && scalings.size() == translations.size(),
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): expected translation, rotation and scaling views to have the same size but got" << translations.size() << Debug::nospace << "," << rotations.size() << "and" << scalings.size(), );
+
+    /* The translation location is abused for object mapping, which is
+       subsequently replaced by the absolute translation */
+    absoluteFieldTranslationsRotationsScalingsIntoImplementation(scene, fieldId, Containers::arrayCast<UnsignedInt>(translations), TranslationRotationScalingOutput{translations, rotations, scalings});
+}
+
+void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Vector3>& translations, const Containers::StridedArrayView1D<Quaternion>& rotations, const Containers::StridedArrayView1D<Vector3>& scalings) {
+    const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
+    CORRADE_ASSERT(fieldId,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): field" << field << "not found", );
+
+    absoluteFieldTranslationsRotationsScalings3DInto(scene, *fieldId, translations, rotations, scalings);
+}
+
+void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations) {
+    /* The matrix location is abused for object mapping, which is
+       subsequently replaced by the absolute object transformation */
+    absoluteFieldTranslationsRotationsScalingsIntoImplementation(scene, fieldId, Containers::arrayCast<UnsignedInt>(transformations), Matrix4Output{transformations});
+}
+
+void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations) {
+    const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
+    CORRADE_ASSERT(fieldId,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): field" << field << "not found", );
+
+    absoluteFieldTranslationsRotationsScalings3DInto(scene, *fieldId, transformations);
+}
+
+void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4x3>& transformations) {
+    /* The matrix location is abused for object mapping, which is
+       subsequently replaced by the absolute object transformation */
+    absoluteFieldTranslationsRotationsScalingsIntoImplementation(scene, fieldId, Containers::arrayCast<UnsignedInt>(transformations), Matrix4x3Output{transformations});
+}
+
+void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4x3>& transformations) {
+    const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
+    CORRADE_ASSERT(fieldId,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): field" << field << "not found", );
+
+    absoluteFieldTranslationsRotationsScalings3DInto(scene, *fieldId, transformations);
+}
+
 }}
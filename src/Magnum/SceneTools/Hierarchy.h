@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::SceneTools::parentsBreadthFirst(), @ref Magnum::SceneTools::parentsBreadthFirstInto(), @ref Magnum::SceneTools::childrenDepthFirst(), @ref Magnum::SceneTools::childrenDepthFirstInto(), @ref Magnum::SceneTools::absoluteFieldTransformations2D(), @ref Magnum::SceneTools::absoluteFieldTransformations2DInto(), @ref Magnum::SceneTools::absoluteFieldTransformations3D(), @ref Magnum::SceneTools::absoluteFieldTransformations3DInto()
+ * @brief Function @ref Magnum::SceneTools::parentsBreadthFirst(), @ref Magnum::SceneTools::parentsBreadthFirstInto(), @ref Magnum::SceneTools::childrenDepthFirst(), @ref Magnum::SceneTools::childrenDepthFirstInto(), @ref Magnum::SceneTools::absoluteFieldTransformations2D(), @ref Magnum::SceneTools::absoluteFieldTransformations2DInto(), @ref Magnum::SceneTools::absoluteFieldTransformations3D(), @ref Magnum::SceneTools::absoluteFieldTransformations3DInto(), @ref Magnum::SceneTools::absoluteFieldTranslationsRotationsScalings3D(), @ref Magnum::SceneTools::absoluteFieldTranslationsRotationsScalings3DInto()
  * @m_since_latest
  */
 
@@ -260,6 +260,7 @@ single mesh:
 
 @see @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&),
     @ref absoluteFieldTransformations3DInto(),
+    @ref absoluteFieldTranslationsRotationsScalings3D(),
     @ref absoluteFieldTransformations2D(), @ref Trade::SceneData::hasField(),
     @ref Trade::SceneData::is3D()
 */
@@ -327,6 +328,145 @@ MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::Sc
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations);
 #endif
 
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given field
+@m_since_latest
+
+Like @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&),
+but instead of converting local transformations of all objects to a
+@ref Matrix4 and multiplying them together, it takes the
+@ref Trade::SceneField::Translation, @relativeref{Trade::SceneField,Rotation}
+and @relativeref{Trade::SceneField,Scaling} fields and composes them directly,
+with a parent translation @f$ \boldsymbol{t}_p @f$, rotation @f$ q_p @f$ and
+scaling @f$ \boldsymbol{s}_p @f$ applied to a child as follows: @f[
+    \begin{array}{rcl}
+        \boldsymbol{t} & = & \boldsymbol{t}_p + q_p (\boldsymbol{s}_p \boldsymbol{t}_c) q_p^{-1} \\
+        q & = & q_p q_c \\
+        \boldsymbol{s} & = & \boldsymbol{s}_p \boldsymbol{s}_c
+    \end{array}
+@f]
+
+The intermediate data are stored as separate translation, rotation and
+scaling arrays, which is roughly half the memory and arithmetic compared to a
+@ref Matrix4 for each object. The result is equivalent to
+@ref absoluteFieldTransformations3D() if all scaling is uniform. A
+non-uniform parent scaling combined with a rotated child results in a shear
+that can't be represented with a translation, rotation and scaling, and is
+thus lost. The rotations are expected to be normalized.
+
+The @ref Trade::SceneField::Parent field is expected to be contained in the
+scene, having no cycles or duplicates, the scene is expected to be 3D, have at
+least one of the translation, rotation and scaling fields and @p fieldId is
+expected to be less than @ref Trade::SceneData::fieldCount(). The returned data
+are in the same order as object mapping entries in @p fieldId, fields attached
+to objects without a @ref Trade::SceneField::Parent or to objects in loose
+hierarchy subtrees will have their transformation set to an unspecified value.
+
+The @ref Trade::SceneField::Transformation field isn't decomposed. If it's
+present in the scene as well, objects that have it are expected to also have
+at least one of the translation, rotation and scaling fields, which are then
+used instead of the matrix.
+@experimental
+
+@see @ref absoluteFieldTranslationsRotationsScalings3DInto(),
+    @ref Trade::SceneData::translationsRotationsScalings3DAsArray()
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Triple<Vector3, Quaternion, Vector3>> absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData& scene, UnsignedInt fieldId);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given named field
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData&, UnsignedInt).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Triple<Vector3, Quaternion, Vector3>> absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData& scene, Trade::SceneField field);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given field into existing arrays
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[out] translations    Where to put the calculated translations
+@param[out] rotations       Where to put the calculated rotations
+@param[out] scalings        Where to put the calculated scalings
+@m_since_latest
+
+A variant of @ref absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData&, UnsignedInt)
+that fills existing memory instead of allocating a new array. The
+@p translations, @p rotations and @p scalings arrays are expected to have the
+same size as the @p fieldId.
+@see @ref Trade::SceneData::fieldSize()
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Vector3>& translations, const Containers::StridedArrayView1D<Quaternion>& rotations, const Containers::StridedArrayView1D<Vector3>& scalings);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given named field into existing arrays
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Vector3>&, const Containers::StridedArrayView1D<Quaternion>&, const Containers::StridedArrayView1D<Vector3>&).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Vector3>& translations, const Containers::StridedArrayView1D<Quaternion>& rotations, const Containers::StridedArrayView1D<Vector3>& scalings);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given field into an existing matrix array
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[out] transformations Where to put the calculated transformations
+@m_since_latest
+
+Composes the hierarchy the same way as
+@ref absoluteFieldTranslationsRotationsScalings3D(const Trade::SceneData&, UnsignedInt)
+and converts the result to a matrix only for the entries of @p fieldId. The
+@p transformations array is expected to have the same size as the
+@p fieldId.
+@see @ref Trade::SceneData::fieldSize()
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given named field into an existing matrix array
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given field into an existing affine matrix array
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[out] transformations Where to put the calculated transformations
+@m_since_latest
+
+Like @ref absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&),
+but omits the last row of the matrix, which is always
+@f$ \begin{pmatrix} 0 & 0 & 0 & 1 \end{pmatrix} @f$. Useful for example for
+filling per-instance buffers with less memory bandwidth.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4x3>& transformations);
+
+/**
+@brief Calculate absolute 3D translations, rotations and scalings for given named field into an existing affine matrix array
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4x3>&).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTranslationsRotationsScalings3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4x3>& transformations);
+
 }}
 
 #endif
@@ -0,0 +1,420 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "HierarchyEvaluator.h"
+
+#include <algorithm> /* std::lower_bound() */
+#include <cstring>
+#include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/Implementation/sceneDataDimensionTraits.h"
+#include "Magnum/Trade/SceneData.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#elif defined(CORRADE_TARGET_NEON) && !defined(CORRADE_TARGET_32BIT)
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace SceneTools {
+
+template<UnsignedInt dimensions> struct HierarchyEvaluator<dimensions>::State {
+    Containers::ArrayTuple storage;
+    /* Objects in a depth-first order, count of all their nested children
+       and their parent object or -1, as returned by childrenDepthFirst() */
+    Containers::ArrayView<UnsignedInt> objects;
+    Containers::ArrayView<UnsignedInt> childCounts;
+    Containers::ArrayView<Int> parents;
+    /* Objects in a breadth-first order and their parent object or -1, as
+       returned by parentsBreadthFirst(). Objects in one level of the
+       hierarchy have their parents only in the previous levels, which allows
+       update() to split each level into independent tasks. */
+    Containers::ArrayView<UnsignedInt> levelObjects;
+    Containers::ArrayView<Int> levelParents;
+    /* Offset of each level in the above, plus the end offset */
+    Containers::Array<UnsignedInt> levelOffsets;
+    /* Position of each object in the above, ~UnsignedInt{} if it's not in
+       the hierarchy */
+    Containers::ArrayView<UnsignedInt> positions;
+    Containers::ArrayView<MatrixTypeFor<dimensions, Float>> localTransformations;
+    /* Indexed by object ID + 1, the first item is the global transformation
+       so top-level objects don't need to be special-cased */
+    Containers::ArrayView<MatrixTypeFor<dimensions, Float>> absoluteTransformations;
+    /* Scratch storage for update(BitArrayView), indexed by the position, all
+       bits are cleared again at the end */
+    Containers::MutableBitArrayView dirtyPositions;
+    /* Scratch storage for update(BitArrayView), position of each topmost
+       dirty object and count of objects in the dirty ranges before it */
+    Containers::ArrayView<UnsignedInt> dirtyRanges;
+    Containers::ArrayView<UnsignedInt> dirtyRangeOffsets;
+};
+
+namespace {
+
+/* Returns the first set bit at or after `i`, or the view size if there's
+   none. Skips whole zero 64-bit words, which is the common case when only a
+   small part of the hierarchy changes. */
+std::size_t nextSetBit(const Containers::BitArrayView bits, std::size_t i) {
+    const char* const data = static_cast<const char*>(bits.data());
+    const std::size_t offset = bits.offset();
+    while(i < bits.size()) {
+        const std::size_t bit = offset + i;
+        if(!(bit & 63) && i + 64 <= bits.size()) {
+            UnsignedLong word;
+            std::memcpy(&word, data + (bit >> 3), 8);
+            if(!word) {
+                i += 64;
+                continue;
+            }
+        }
+
+        if(bits[i]) return i;
+        ++i;
+    }
+
+    return bits.size();
+}
+
+/* Absolute transformation of an object is its parent absolute transformation
+   multiplied by its local transformation. With SSE2 and NEON the 4x4 product
+   is done a column at a time with four-component vectors. The order of
+   operations is the same as in Matrix4::operator*() and there's no fused
+   multiply-add, so the results are the same except for the sum not starting
+   from a zero, which means a -0.0f isn't turned into 0.0f. */
+inline Matrix3 multiply(const Matrix3& a, const Matrix3& b) {
+    return a*b;
+}
+
+#ifdef CORRADE_TARGET_SSE2
+inline Matrix4 multiply(const Matrix4& a, const Matrix4& b) {
+    const __m128 a0 = _mm_loadu_ps(a[0].data());
+    const __m128 a1 = _mm_loadu_ps(a[1].data());
+    const __m128 a2 = _mm_loadu_ps(a[2].data());
+    const __m128 a3 = _mm_loadu_ps(a[3].data());
+    Matrix4 out{NoInit};
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Float* const column = b[i].data();
+        _mm_storeu_ps(out[i].data(), _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(a0, _mm_set1_ps(column[0])),
+            _mm_mul_ps(a1, _mm_set1_ps(column[1]))),
+            _mm_mul_ps(a2, _mm_set1_ps(column[2]))),
+            _mm_mul_ps(a3, _mm_set1_ps(column[3]))));
+    }
+    return out;
+}
+#elif defined(CORRADE_TARGET_NEON) && !defined(CORRADE_TARGET_32BIT)
+inline Matrix4 multiply(const Matrix4& a, const Matrix4& b) {
+    const float32x4_t a0 = vld1q_f32(a[0].data());
+    const float32x4_t a1 = vld1q_f32(a[1].data());
+    const float32x4_t a2 = vld1q_f32(a[2].data());
+    const float32x4_t a3 = vld1q_f32(a[3].data());
+    Matrix4 out{NoInit};
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Float* const column = b[i].data();
+        vst1q_f32(out[i].data(), vaddq_f32(vaddq_f32(vaddq_f32(
+            vmulq_n_f32(a0, column[0]),
+            vmulq_n_f32(a1, column[1])),
+            vmulq_n_f32(a2, column[2])),
+            vmulq_n_f32(a3, column[3])));
+    }
+    return out;
+}
+#else
+inline Matrix4 multiply(const Matrix4& a, const Matrix4& b) {
+    return a*b;
+}
+#endif
+
+/* Calculates absolute transformations of given objects, which are expected
+   to have absolute transformations of their parents already calculated. The
+   absolute transformations are indexed by object ID + 1. */
+template<UnsignedInt dimensions> void updateAbsoluteTransformations(const Containers::ArrayView<const UnsignedInt> objects, const Containers::ArrayView<const Int> parents, const Containers::ArrayView<const MatrixTypeFor<dimensions, Float>> localTransformations, const Containers::ArrayView<MatrixTypeFor<dimensions, Float>> absoluteTransformations) {
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        const UnsignedInt object = objects[i];
+        absoluteTransformations[object + 1] = multiply(
+            absoluteTransformations[parents[i] + 1],
+            localTransformations[object]);
+    }
+}
+
+/* With a non-serial executor, update() splits each hierarchy level and
+   update(BitArrayView) splits the dirty subtrees into tasks of roughly this
+   many objects. Every object is calculated the same way regardless of the
+   split, so the output doesn't depend on the executor. */
+constexpr std::size_t UpdateObjectsPerTask = 16384;
+
+}
+
+template<UnsignedInt dimensions> HierarchyEvaluator<dimensions>::HierarchyEvaluator(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation): _state{InPlaceInit} {
+    CORRADE_ASSERT(Implementation::SceneDataDimensionTraits<dimensions>::isDimensions(scene),
+        "SceneTools::HierarchyEvaluator: the scene is not" << dimensions << Debug::nospace << "D", );
+    const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
+    CORRADE_ASSERT(parentFieldId,
+        "SceneTools::HierarchyEvaluator: the scene has no hierarchy", );
+
+    State& state = *_state;
+    const std::size_t parentFieldSize = scene.fieldSize(*parentFieldId);
+    const std::size_t objectCount = std::size_t(scene.mappingBound());
+    state.storage = Containers::ArrayTuple{
+        {NoInit, parentFieldSize, state.objects},
+        {NoInit, parentFieldSize, state.childCounts},
+        {NoInit, parentFieldSize, state.parents},
+        {NoInit, objectCount, state.positions},
+        {NoInit, objectCount, state.localTransformations},
+        {NoInit, objectCount + 1, state.absoluteTransformations},
+        {NoInit, parentFieldSize, state.levelObjects},
+        {NoInit, parentFieldSize, state.levelParents},
+        {ValueInit, parentFieldSize, state.dirtyPositions},
+        {NoInit, parentFieldSize, state.dirtyRanges},
+        {NoInit, parentFieldSize, state.dirtyRangeOffsets}
+    };
+
+    /* Allocate temporary storage for the scene field contents */
+    const std::size_t transformationFieldSize = scene.transformationFieldSize();
+    Containers::ArrayView<Containers::Pair<UnsignedInt, Int>> parents;
+    Containers::ArrayView<Containers::Pair<UnsignedInt, MatrixTypeFor<dimensions, Float>>> transformations;
+    Containers::ArrayTuple storage{
+        {NoInit, parentFieldSize, parents},
+        {NoInit, transformationFieldSize, transformations}
+    };
+
+    /* Calculate the breadth-first order and find where each level of the
+       hierarchy starts in it. The positions array is used as a temporary
+       storage for depth of each object, it's filled with the actual
+       positions below. */
+    parentsBreadthFirstInto(scene, state.levelObjects, state.levelParents);
+    std::size_t levelCount = 0;
+    for(std::size_t i = 0; i != state.levelObjects.size(); ++i) {
+        const Int parent = state.levelParents[i];
+        const UnsignedInt depth = parent == -1 ? 0 : state.positions[parent] + 1;
+        state.positions[state.levelObjects[i]] = depth;
+        /* The breadth-first order goes one level after another, so the depth
+           is at most one more than the deepest level so far */
+        if(depth == levelCount) ++levelCount;
+    }
+    state.levelOffsets = Containers::Array<UnsignedInt>{NoInit, levelCount + 1};
+    levelCount = 0;
+    for(std::size_t i = 0; i != state.levelObjects.size(); ++i)
+        if(state.positions[state.levelObjects[i]] == levelCount)
+            state.levelOffsets[levelCount++] = UnsignedInt(i);
+    state.levelOffsets[levelCount] = UnsignedInt(state.levelObjects.size());
+
+    /* Calculate the depth-first order and remember where each object is in
+       it */
+    childrenDepthFirstInto(scene, state.objects, state.childCounts);
+    for(UnsignedInt& position: state.positions)
+        position = ~UnsignedInt{};
+    for(std::size_t i = 0; i != state.objects.size(); ++i)
+        state.positions[state.objects[i]] = UnsignedInt(i);
+
+    /* Put parents of each object in the same order */
+    scene.parentsInto(
+        stridedArrayView(parents).slice(&decltype(parents)::Type::first),
+        stridedArrayView(parents).slice(&decltype(parents)::Type::second));
+    for(const Containers::Pair<UnsignedInt, Int>& parent: parents)
+        state.parents[state.positions[parent.first()]] = parent.second();
+
+    /* Retrieve local transformations of all objects, indexed by object ID.
+       Not all objects may have a transformation, so initialize them to an
+       identity first. */
+    for(MatrixTypeFor<dimensions, Float>& transformation: state.localTransformations)
+        transformation = MatrixTypeFor<dimensions, Float>{};
+    Implementation::SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
+        stridedArrayView(transformations).slice(&decltype(transformations)::Type::first),
+        stridedArrayView(transformations).slice(&decltype(transformations)::Type::second));
+    for(const Containers::Pair<UnsignedInt, MatrixTypeFor<dimensions, Float>>& transformation: transformations) {
+        CORRADE_INTERNAL_ASSERT(transformation.first() < objectCount);
+        state.localTransformations[transformation.first()] = transformation.second();
+    }
+
+    /* Objects outside of the hierarchy get their local transformation, the
+       rest is calculated below */
+    state.absoluteTransformations[0] = globalTransformation;
+    for(std::size_t i = 0; i != objectCount; ++i)
+        state.absoluteTransformations[i + 1] = state.localTransformations[i];
+    update();
+}
+
+template<UnsignedInt dimensions> HierarchyEvaluator<dimensions>::HierarchyEvaluator(const Trade::SceneData& scene): HierarchyEvaluator{scene, {}} {}
+
+template<UnsignedInt dimensions> HierarchyEvaluator<dimensions>::HierarchyEvaluator(HierarchyEvaluator<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> HierarchyEvaluator<dimensions>::~HierarchyEvaluator() = default;
+
+template<UnsignedInt dimensions> HierarchyEvaluator<dimensions>& HierarchyEvaluator<dimensions>::operator=(HierarchyEvaluator<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> std::size_t HierarchyEvaluator<dimensions>::objectCount() const {
+    return _state->localTransformations.size();
+}
+
+template<UnsignedInt dimensions> Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> HierarchyEvaluator<dimensions>::localTransformations() const {
+    return _state->localTransformations;
+}
+
+template<UnsignedInt dimensions> Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>> HierarchyEvaluator<dimensions>::localTransformations() {
+    return _state->localTransformations;
+}
+
+template<UnsignedInt dimensions> Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> HierarchyEvaluator<dimensions>::absoluteTransformations() const {
+    return _state->absoluteTransformations.exceptPrefix(1);
+}
+
+template<UnsignedInt dimensions> void HierarchyEvaluator<dimensions>::update(const Executor& executor) {
+    State& state = *_state;
+
+    /* Objects in each level have their parents in the previous levels, so
+       with a non-serial executor a level can be split into independent
+       tasks. Levels that would be just a single task, which is usually the
+       case close to the root, are done directly. */
+    for(std::size_t level = 0; level + 1 < state.levelOffsets.size(); ++level) {
+        const std::size_t begin = state.levelOffsets[level];
+        const std::size_t end = state.levelOffsets[level + 1];
+        const std::size_t taskCount = (end - begin + UpdateObjectsPerTask - 1)/UpdateObjectsPerTask;
+        if(executor.isSerial() || taskCount == 1) {
+            updateAbsoluteTransformations<dimensions>(
+                state.levelObjects.slice(begin, end),
+                state.levelParents.slice(begin, end),
+                state.localTransformations, state.absoluteTransformations);
+            continue;
+        }
+
+        executor(taskCount, [&](const std::size_t task) {
+            const std::size_t taskBegin = begin + task*UpdateObjectsPerTask;
+            const std::size_t taskEnd = Math::min(taskBegin + UpdateObjectsPerTask, end);
+            updateAbsoluteTransformations<dimensions>(
+                state.levelObjects.slice(taskBegin, taskEnd),
+                state.levelParents.slice(taskBegin, taskEnd),
+                state.localTransformations, state.absoluteTransformations);
+        });
+    }
+}
+
+template<UnsignedInt dimensions> void HierarchyEvaluator<dimensions>::update(const Containers::BitArrayView dirty, const Executor& executor) {
+    State& state = *_state;
+    CORRADE_ASSERT(dirty.size() == state.localTransformations.size(),
+        "SceneTools::HierarchyEvaluator::update(): expected" << state.localTransformations.size() << "bits but got" << dirty.size(), );
+
+    /* Mark positions of dirty objects in the depth-first order */
+    for(std::size_t i = nextSetBit(dirty, 0); i != dirty.size(); i = nextSetBit(dirty, i + 1)) {
+        const UnsignedInt position = state.positions[i];
+        if(position != ~UnsignedInt{})
+            state.dirtyPositions.set(position);
+    }
+
+    /* Each dirty object and all its nested children are a contiguous range
+       in the depth-first order. Collect the topmost ranges, clearing the
+       dirty bits in each to have the scratch storage clean again at the end.
+       Dirty objects nested in an already collected range are thus
+       skipped. */
+    std::size_t rangeCount = 0;
+    std::size_t dirtyCount = 0;
+    for(std::size_t i = nextSetBit(state.dirtyPositions, 0); i != state.objects.size(); ) {
+        const std::size_t end = i + state.childCounts[i] + 1;
+        state.dirtyPositions.slice(i, end).resetAll();
+        state.dirtyRanges[rangeCount] = UnsignedInt(i);
+        state.dirtyRangeOffsets[rangeCount] = UnsignedInt(dirtyCount);
+        ++rangeCount;
+        dirtyCount += end - i;
+        i = nextSetBit(state.dirtyPositions, end);
+    }
+
+    /* If most of the hierarchy is dirty, such as when a top-level object
+       changed, the dirty ranges are too few to be split into tasks evenly.
+       Update everything level by level instead. */
+    if(!executor.isSerial() && dirtyCount > state.objects.size()/2)
+        return update(executor);
+
+    /* Otherwise the ranges are independent of each other, as their parents
+       are all outside of any dirty range. Split them into tasks with roughly
+       the same count of objects, where each task takes the ranges that start
+       in its share of the dirty objects. A range larger than a single share
+       makes its task larger and some other task empty. */
+    const auto updateRanges = [&](const std::size_t rangeBegin, const std::size_t rangeEnd) {
+        for(std::size_t i = rangeBegin; i != rangeEnd; ++i) {
+            const std::size_t begin = state.dirtyRanges[i];
+            const std::size_t end = begin + state.childCounts[begin] + 1;
+            updateAbsoluteTransformations<dimensions>(
+                state.objects.slice(begin, end),
+                state.parents.slice(begin, end),
+                state.localTransformations, state.absoluteTransformations);
+        }
+    };
+    const std::size_t taskCount = (dirtyCount + UpdateObjectsPerTask - 1)/UpdateObjectsPerTask;
+    if(executor.isSerial() || taskCount <= 1) {
+        updateRanges(0, rangeCount);
+        return;
+    }
+
+    const UnsignedInt* const offsets = state.dirtyRangeOffsets.data();
+    executor(taskCount, [&](const std::size_t task) {
+        const UnsignedInt shareBegin = UnsignedInt(UnsignedLong(task)*dirtyCount/taskCount);
+        const UnsignedInt shareEnd = UnsignedInt(UnsignedLong(task + 1)*dirtyCount/taskCount);
+        updateRanges(
+            std::lower_bound(offsets, offsets + rangeCount, shareBegin) - offsets,
+            std::lower_bound(offsets, offsets + rangeCount, shareEnd) - offsets);
+    });
+}
+
+template<UnsignedInt dimensions> void HierarchyEvaluator<dimensions>::absoluteFieldTransformationsInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& transformations) const {
+    const State& state = *_state;
+    CORRADE_ASSERT(scene.mappingBound() == state.localTransformations.size(),
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): expected a scene with" << state.localTransformations.size() << "objects but got" << scene.mappingBound(), );
+    CORRADE_ASSERT(fieldId < scene.fieldCount(),
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", );
+    CORRADE_ASSERT(transformations.size() == scene.fieldSize(fieldId),
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): bad output size, expected" << scene.fieldSize(fieldId) << "but got" << transformations.size(), );
+
+    /* The matrix location is abused for object mapping, which is subsequently
+       replaced by the absolute object transformation, same as in
+       absoluteFieldTransformationsInto() */
+    const auto mapping = Containers::arrayCast<UnsignedInt>(transformations);
+    scene.mappingInto(fieldId, mapping);
+    for(std::size_t i = 0; i != mapping.size(); ++i) {
+        CORRADE_INTERNAL_ASSERT(mapping[i] < state.localTransformations.size());
+        transformations[i] = state.absoluteTransformations[mapping[i] + 1];
+    }
+}
+
+template<UnsignedInt dimensions> void HierarchyEvaluator<dimensions>::absoluteFieldTransformationsInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& transformations) const {
+    const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
+    CORRADE_ASSERT(fieldId,
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): field" << field << "not found", );
+
+    absoluteFieldTransformationsInto(scene, *fieldId, transformations);
+}
+
+template class MAGNUM_SCENETOOLS_EXPORT HierarchyEvaluator<2>;
+template class MAGNUM_SCENETOOLS_EXPORT HierarchyEvaluator<3>;
+
+}}
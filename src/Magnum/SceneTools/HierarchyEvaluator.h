@@ -0,0 +1,239 @@
+#ifndef Magnum_SceneTools_HierarchyEvaluator_h
+#define Magnum_SceneTools_HierarchyEvaluator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::HierarchyEvaluator, typedef @ref Magnum::SceneTools::HierarchyEvaluator2D, @ref Magnum::SceneTools::HierarchyEvaluator3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Executor.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Incrementally updatable absolute transformation hierarchy
+@m_since_latest
+
+Calculates absolute transformations of all objects in a scene hierarchy
+similarly to @ref absoluteFieldTransformations2D() /
+@ref absoluteFieldTransformations3D(), but keeps the hierarchy order and the
+transformations around so they can be updated when only a few of them change,
+for example when a small part of a scene is animated.
+
+On construction, the @ref Trade::SceneField::Parent field is converted to a
+depth-first order using @ref childrenDepthFirst(), relative transformations of
+all objects are extracted into @ref localTransformations() and the absolute
+transformations are calculated. After modifying the local transformations,
+call either @ref update() to recalculate everything, or
+@ref update(Containers::BitArrayView, const Executor&) with a list of objects
+that changed. The latter recalculates only subtrees of the changed objects,
+each of which is a contiguous range in the depth-first order, so the cost is
+proportional to the count of objects in the changed subtrees instead of the
+whole hierarchy.
+
+The hierarchy is additionally split into levels in a breadth-first order,
+with objects in each level depending only on objects in the previous levels.
+Both update functions take an optional @ref Executor, with which the levels
+or the changed subtrees get split into independent tasks that can run in
+parallel. The output is the same regardless of the executor used. On
+@ref CORRADE_TARGET_SSE2 "SSE2" and 64-bit @ref CORRADE_TARGET_NEON "NEON"
+targets the 3D matrix products are done on four-component vectors, with the
+same output as @ref Math::Matrix4 multiplication.
+
+Absolute transformations can then be queried either for all objects with
+@ref absoluteTransformations() or for entries of a particular field with
+@ref absoluteFieldTransformationsInto(), equivalently to
+@ref absoluteFieldTransformations2DInto() /
+@ref absoluteFieldTransformations3DInto().
+
+@experimental
+
+@see @ref HierarchyEvaluator2D, @ref HierarchyEvaluator3D
+*/
+template<UnsignedInt dimensions> class HierarchyEvaluator {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param scene                 Scene to take the hierarchy and
+         *      transformations from
+         * @param globalTransformation  Global transformation to prepend
+         *
+         * The @ref Trade::SceneField::Parent field is expected to be contained
+         * in the scene, having no cycles and not being sparse, same as with
+         * @ref childrenDepthFirst(). The scene is expected to be 2D or 3D
+         * based on @p dimensions. The @p scene isn't referenced afterwards.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        explicit HierarchyEvaluator(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation = {});
+        #else
+        /* To avoid including Matrix3 / Matrix4 */
+        explicit HierarchyEvaluator(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation);
+        explicit HierarchyEvaluator(const Trade::SceneData& scene);
+        #endif
+
+        /** @brief Copying is not allowed */
+        HierarchyEvaluator(const HierarchyEvaluator<dimensions>&) = delete;
+
+        /** @brief Move constructor */
+        HierarchyEvaluator(HierarchyEvaluator<dimensions>&&) noexcept;
+
+        ~HierarchyEvaluator();
+
+        /** @brief Copying is not allowed */
+        HierarchyEvaluator<dimensions>& operator=(const HierarchyEvaluator<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        HierarchyEvaluator<dimensions>& operator=(HierarchyEvaluator<dimensions>&&) noexcept;
+
+        /**
+         * @brief Object count
+         *
+         * Same as @ref Trade::SceneData::mappingBound() of the scene the
+         * evaluator was created from.
+         */
+        std::size_t objectCount() const;
+
+        /**
+         * @brief Local transformations
+         *
+         * Indexed by object ID, with size equal to @ref objectCount().
+         * Objects that have no transformation in the scene are set to an
+         * identity.
+         */
+        Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> localTransformations() const;
+
+        /**
+         * @brief Mutable local transformations
+         *
+         * Modifying the transformations doesn't update the
+         * @ref absoluteTransformations(), call @ref update() or
+         * @ref update(Containers::BitArrayView, const Executor&) afterwards.
+         */
+        Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>> localTransformations();
+
+        /**
+         * @brief Absolute transformations
+         *
+         * Indexed by object ID, with size equal to @ref objectCount(). Objects
+         * that aren't a part of the hierarchy have their transformation set
+         * to an unspecified value.
+         */
+        Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> absoluteTransformations() const;
+
+        /**
+         * @brief Update all absolute transformations
+         * @param executor  Executor to run the update with
+         *
+         * Recalculates absolute transformations of all objects in the
+         * hierarchy in an @f$ \mathcal{O}(n) @f$ execution time, with
+         * @f$ n @f$ being the count of objects in the hierarchy. The
+         * hierarchy is processed one level after another. With a non-serial
+         * @p executor, levels with more than 16384 objects are split into
+         * tasks of that size.
+         */
+        void update(const Executor& executor = {});
+
+        /**
+         * @brief Update absolute transformations of changed objects
+         * @param dirty     Objects whose local transformation changed
+         * @param executor  Executor to run the update with
+         *
+         * Recalculates absolute transformations of objects set in @p dirty
+         * and all their children, in an @f$ \mathcal{O}(n + k) @f$
+         * execution time, with @f$ n @f$ being the count of bits in @p dirty
+         * that have to be checked and @f$ k @f$ the count of objects in the
+         * changed subtrees. The matrix multiplications are done only for the
+         * @f$ k @f$ objects. Expects that size of @p dirty is equal to
+         * @ref objectCount(). Objects in @p dirty that aren't a part of the
+         * hierarchy are ignored.
+         *
+         * With a non-serial @p executor, the changed subtrees are split into
+         * tasks of roughly 16384 objects. If more than half of the hierarchy
+         * changed, it's delegated to @ref update(const Executor&) instead.
+         */
+        void update(Containers::BitArrayView dirty, const Executor& executor = {});
+
+        /**
+         * @brief Absolute transformations for given field into an existing array
+         *
+         * Takes object mapping of @p fieldId in @p scene and puts an absolute
+         * transformation of each object into @p transformations, equivalently
+         * to @ref absoluteFieldTransformations2DInto() /
+         * @ref absoluteFieldTransformations3DInto() but without recalculating
+         * the hierarchy. Expects that @p scene has the same
+         * @ref Trade::SceneData::mappingBound() as the scene the evaluator was
+         * created from, @p fieldId is less than
+         * @ref Trade::SceneData::fieldCount() and the @p transformations view
+         * has the same size as the field.
+         */
+        void absoluteFieldTransformationsInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& transformations) const;
+
+        /**
+         * @brief Absolute transformations for given named field into an existing array
+         *
+         * Translates @p field to a field ID using
+         * @ref Trade::SceneData::fieldId() and delegates to
+         * @ref absoluteFieldTransformationsInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>&) const.
+         * The @p field is expected to exist in @p scene.
+         */
+        void absoluteFieldTransformationsInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& transformations) const;
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+/**
+@brief Two-dimensional incrementally updatable transformation hierarchy
+@m_since_latest
+
+@experimental
+*/
+typedef HierarchyEvaluator<2> HierarchyEvaluator2D;
+
+/**
+@brief Three-dimensional incrementally updatable transformation hierarchy
+@m_since_latest
+
+@experimental
+*/
+typedef HierarchyEvaluator<3> HierarchyEvaluator3D;
+
+}}
+
+#endif
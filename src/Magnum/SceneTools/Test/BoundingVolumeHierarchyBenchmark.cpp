@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneTools/BoundingVolumeHierarchy.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct BoundingVolumeHierarchyBenchmark: TestSuite::Tester {
+    explicit BoundingVolumeHierarchyBenchmark();
+
+    void build();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void buildThreads();
+    #endif
+    void refit();
+    void cullFrustumBruteForce();
+    void cullFrustum();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    UnsignedInt size;
+} Data[]{
+    {"64k items", 1 << 16},
+    {"1M items", 1 << 20},
+};
+
+/* Emscripten builds don't have threads enabled by default */
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} ThreadData[]{
+    {"serial", 0},
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8},
+};
+
+/* Spawns given count of threads for each call, each picking the next task
+   that wasn't taken yet. The thread creation is included in the measured
+   time, as it would be for an application not having a thread pool. */
+void threadExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != *static_cast<std::size_t*>(userData); ++i)
+        threads.emplace_back([&]{
+            for(std::size_t id; (id = next++) < count; )
+                task(id, state);
+        });
+    for(std::thread& thread: threads) thread.join();
+}
+#endif
+
+BoundingVolumeHierarchyBenchmark::BoundingVolumeHierarchyBenchmark() {
+    addInstancedBenchmarks({&BoundingVolumeHierarchyBenchmark::build}, 5,
+        Containers::arraySize(Data));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addInstancedBenchmarks({&BoundingVolumeHierarchyBenchmark::buildThreads}, 5,
+        Containers::arraySize(ThreadData));
+    #endif
+
+    addInstancedBenchmarks({&BoundingVolumeHierarchyBenchmark::refit,
+                            &BoundingVolumeHierarchyBenchmark::cullFrustumBruteForce,
+                            &BoundingVolumeHierarchyBenchmark::cullFrustum}, 5,
+        Containers::arraySize(Data));
+}
+
+/* Boxes of varying sizes scattered in a 1000x100x1000 area around the origin,
+   with a camera in the middle looking at a small part of them */
+Containers::Array<Range3D> bounds(const UnsignedInt size) {
+    Containers::Array<Range3D> out{NoInit, size};
+    UnsignedInt seed = 1;
+    const auto random = [&seed]() {
+        seed = seed*1664525u + 1013904223u;
+        return Float(seed >> 8)/Float(1 << 24);
+    };
+    for(Range3D& i: out) {
+        const Vector3 center{random()*1000.0f - 500.0f,
+                             random()*100.0f - 50.0f,
+                             random()*1000.0f - 500.0f};
+        i = Range3D::fromCenter(center, Vector3{0.5f + random()*2.0f});
+    }
+    return out;
+}
+
+const Frustum CameraFrustum = Frustum::fromMatrix(Matrix4::perspectiveProjection(60.0_degf, 16.0f/9.0f, 0.1f, 250.0f)*Matrix4::rotationY(30.0_degf));
+
+void BoundingVolumeHierarchyBenchmark::build() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> items = bounds(data.size);
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += BoundingVolumeHierarchy{items}.size();
+
+    CORRADE_COMPARE(size, data.size);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void BoundingVolumeHierarchyBenchmark::buildThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> items = bounds(1 << 20);
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += BoundingVolumeHierarchy{items, executor}.size();
+
+    CORRADE_COMPARE(size, 1 << 20);
+}
+#endif
+
+void BoundingVolumeHierarchyBenchmark::refit() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> items = bounds(data.size);
+    BoundingVolumeHierarchy bvh{items};
+
+    CORRADE_BENCHMARK(1)
+        bvh.refit(items);
+
+    CORRADE_COMPARE(bvh.size(), data.size);
+}
+
+void BoundingVolumeHierarchyBenchmark::cullFrustumBruteForce() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> items = bounds(data.size);
+
+    /* Testing each item separately, for comparison */
+    Containers::BitArray visible{ValueInit, data.size};
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        count = 0;
+        for(std::size_t i = 0; i != items.size(); ++i) {
+            const bool itemVisible = Math::Intersection::rangeFrustum(items[i], CameraFrustum);
+            visible.set(i, itemVisible);
+            count += itemVisible;
+        }
+    }
+
+    CORRADE_VERIFY(count);
+}
+
+void BoundingVolumeHierarchyBenchmark::cullFrustum() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> items = bounds(data.size);
+    BoundingVolumeHierarchy bvh{items};
+
+    Containers::BitArray visible{ValueInit, data.size};
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = bvh.cullFrustumInto(CameraFrustum, visible);
+
+    CORRADE_VERIFY(count);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::BoundingVolumeHierarchyBenchmark)
@@ -0,0 +1,544 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm> /* std::sort() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneTools/BoundingVolumeHierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct BoundingVolumeHierarchyTest: TestSuite::Tester {
+    explicit BoundingVolumeHierarchyTest();
+
+    void construct();
+    void constructEmpty();
+    void constructSameCenters();
+    void constructExecutor();
+    void constructMove();
+
+    void cullFrustum();
+    void cullFrustumInvalidSize();
+
+    void intersectRays();
+    void intersectRaysInvalidSize();
+
+    void refit();
+    void refitInvalidSize();
+
+    void meshInstanceBounds();
+    void meshInstanceBoundsNoMeshField();
+    void meshInstanceBoundsNot3D();
+    void meshInstanceBoundsNoParentField();
+    void meshInstanceBoundsInvalidSize();
+    void meshInstanceBoundsMeshOutOfRange();
+
+    void build();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    UnsignedInt size;
+} ConstructData[]{
+    {"single item", 1},
+    {"single leaf", 8},
+    {"many items", 16*16*16}
+};
+
+const struct {
+    const char* name;
+    Matrix4 transformation;
+} CullFrustumData[]{
+    {"", {}},
+    {"rotated", Matrix4::rotationY(35.0_degf)*Matrix4::rotationX(-20.0_degf)},
+    {"outside of everything", Matrix4::translation({0.0f, 0.0f, 100.0f})},
+};
+
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
+BoundingVolumeHierarchyTest::BoundingVolumeHierarchyTest() {
+    addInstancedTests({&BoundingVolumeHierarchyTest::construct},
+        Containers::arraySize(ConstructData));
+
+    addTests({&BoundingVolumeHierarchyTest::constructEmpty,
+              &BoundingVolumeHierarchyTest::constructSameCenters,
+              &BoundingVolumeHierarchyTest::constructExecutor,
+              &BoundingVolumeHierarchyTest::constructMove});
+
+    addInstancedTests({&BoundingVolumeHierarchyTest::cullFrustum},
+        Containers::arraySize(CullFrustumData));
+
+    addTests({&BoundingVolumeHierarchyTest::cullFrustumInvalidSize,
+
+              &BoundingVolumeHierarchyTest::intersectRays,
+              &BoundingVolumeHierarchyTest::intersectRaysInvalidSize,
+
+              &BoundingVolumeHierarchyTest::refit,
+              &BoundingVolumeHierarchyTest::refitInvalidSize,
+
+              &BoundingVolumeHierarchyTest::meshInstanceBounds,
+              &BoundingVolumeHierarchyTest::meshInstanceBoundsNoMeshField,
+              &BoundingVolumeHierarchyTest::meshInstanceBoundsNot3D,
+              &BoundingVolumeHierarchyTest::meshInstanceBoundsNoParentField,
+              &BoundingVolumeHierarchyTest::meshInstanceBoundsInvalidSize,
+              &BoundingVolumeHierarchyTest::meshInstanceBoundsMeshOutOfRange,
+
+              &BoundingVolumeHierarchyTest::build});
+}
+
+/* Boxes of varying sizes on a grid spanning -16 to 16 on X and Y and -32 to
+   0 on Z, i.e. in front of a default camera */
+Containers::Array<Range3D> gridBounds(const UnsignedInt size) {
+    Containers::Array<Range3D> out{NoInit, size};
+    for(UnsignedInt i = 0; i != size; ++i) {
+        const Vector3 center{Float(i % 16)*2.0f - 15.0f,
+                             Float(i/16 % 16)*2.0f - 15.0f,
+                             -Float(i/256)*2.0f - 1.0f};
+        out[i] = Range3D::fromCenter(center, Vector3{0.25f + Float(i % 3)*0.25f});
+    }
+    return out;
+}
+
+Frustum gridFrustum(const Matrix4& transformation) {
+    return Frustum::fromMatrix(Matrix4::perspectiveProjection(60.0_degf, 1.0f, 0.5f, 20.0f)*transformation);
+}
+
+void BoundingVolumeHierarchyTest::construct() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> bounds = gridBounds(data.size);
+    BoundingVolumeHierarchy bvh{bounds};
+    CORRADE_COMPARE(bvh.size(), data.size);
+    CORRADE_COMPARE_AS(bvh.nodeCount(), 2*data.size - 1,
+        TestSuite::Compare::LessOrEqual);
+
+    Range3D expected = bounds[0];
+    for(const Range3D& i: bounds)
+        expected = Math::join(expected, i);
+    CORRADE_COMPARE(bvh.bounds(), expected);
+
+    /* Culling against a frustum that contains everything should mark all
+       items as visible */
+    Containers::BitArray visible{ValueInit, data.size};
+    CORRADE_COMPARE(bvh.cullFrustumInto(Frustum::fromMatrix(Matrix4::orthographicProjection({100.0f, 100.0f}, -100.0f, 100.0f)), visible), data.size);
+    CORRADE_COMPARE(visible.count(), data.size);
+}
+
+void BoundingVolumeHierarchyTest::constructEmpty() {
+    BoundingVolumeHierarchy bvh{{}};
+    CORRADE_COMPARE(bvh.size(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(bvh.bounds(), Range3D{});
+
+    CORRADE_COMPARE(bvh.cullFrustumInto(Frustum{}, nullptr), 0);
+
+    const Vector3 origins[]{{}, {}};
+    const Vector3 directions[]{Vector3::xAxis(), Vector3::yAxis()};
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> out = bvh.intersectRays(origins, directions);
+    CORRADE_COMPARE_AS(out.first(), Containers::arrayView<UnsignedInt>({
+        0, 0, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(out.second().isEmpty());
+}
+
+void BoundingVolumeHierarchyTest::constructSameCenters() {
+    /* There's no way to split the items based on their centers, so the nodes
+       with too many items get split in half */
+    Containers::Array<Range3D> bounds{NoInit, 100};
+    for(std::size_t i = 0; i != bounds.size(); ++i)
+        bounds[i] = Range3D::fromCenter({1.0f, 2.0f, 3.0f}, Vector3{Float(i + 1)});
+
+    BoundingVolumeHierarchy bvh{bounds};
+    CORRADE_COMPARE(bvh.size(), 100);
+    CORRADE_COMPARE_AS(bvh.nodeCount(), 1,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(bvh.bounds(), Range3D::fromCenter({1.0f, 2.0f, 3.0f}, Vector3{100.0f}));
+
+    /* Everything intersects */
+    Containers::BitArray visible{ValueInit, 100};
+    CORRADE_COMPARE(bvh.cullFrustumInto(Frustum::fromMatrix(Matrix4::orthographicProjection({1.0f, 1.0f}, -1.0f, 1.0f)*Matrix4::translation({-1.0f, -2.0f, -3.0f})), visible), 100);
+}
+
+void BoundingVolumeHierarchyTest::constructExecutor() {
+    /* 80 layers of 16x16 items along Z. The root node has more than 16384
+       items, so its bounds and bins are calculated in two tasks each. Its
+       children have 10240 items each, which are then built in one task
+       each. */
+    const Containers::Array<Range3D> bounds = gridBounds(16*16*80);
+    BoundingVolumeHierarchy serial{bounds};
+
+    std::size_t calls = 0;
+    BoundingVolumeHierarchy parallel{bounds, Executor{reverseExecutor, &calls}};
+    CORRADE_COMPARE(calls, 3);
+    CORRADE_COMPARE(parallel.size(), serial.size());
+    CORRADE_COMPARE(parallel.nodeCount(), serial.nodeCount());
+    CORRADE_COMPARE(parallel.bounds(), serial.bounds());
+
+    /* The trees should be the same, thus giving the same culling results */
+    const Frustum frustum = gridFrustum(Matrix4::rotationY(35.0_degf)*Matrix4::rotationX(-20.0_degf));
+    Containers::BitArray visibleSerial{ValueInit, bounds.size()};
+    Containers::BitArray visibleParallel{ValueInit, bounds.size()};
+    const std::size_t count = serial.cullFrustumInto(frustum, visibleSerial);
+    CORRADE_COMPARE(parallel.cullFrustumInto(frustum, visibleParallel), count);
+    for(std::size_t i = 0; i != bounds.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visibleParallel[i], visibleSerial[i]);
+    }
+
+    /* And the same ray hits, including the order */
+    const Vector3 origins[]{
+        {1.0f, 1.0f, 10.0f},
+        {-15.0f, -15.0f, 0.0f},
+        {1.0f, 100.0f, -81.0f},
+    };
+    const Vector3 directions[]{
+        {0.0f, 0.0f, -1.0f},
+        {0.1f, 0.1f, -1.0f},
+        {0.0f, -1.0f, 0.0f},
+    };
+    const Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> hitsSerial = serial.intersectRays(origins, directions);
+    const Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> hitsParallel = parallel.intersectRays(origins, directions);
+    CORRADE_COMPARE_AS(hitsParallel.first(), hitsSerial.first(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hitsParallel.second(), hitsSerial.second(),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::constructMove() {
+    const Containers::Array<Range3D> bounds = gridBounds(64);
+    BoundingVolumeHierarchy a{bounds};
+    const std::size_t nodeCount = a.nodeCount();
+
+    BoundingVolumeHierarchy b{Utility::move(a)};
+    CORRADE_COMPARE(b.size(), 64);
+    CORRADE_COMPARE(b.nodeCount(), nodeCount);
+
+    BoundingVolumeHierarchy c{{}};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 64);
+    CORRADE_COMPARE(c.nodeCount(), nodeCount);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BoundingVolumeHierarchy>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BoundingVolumeHierarchy>::value);
+}
+
+void BoundingVolumeHierarchyTest::cullFrustum() {
+    auto&& data = CullFrustumData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Range3D> bounds = gridBounds(16*16*16);
+    BoundingVolumeHierarchy bvh{bounds};
+
+    /* Fill the output with garbage to verify it gets reset */
+    const Frustum frustum = gridFrustum(data.transformation);
+    Containers::BitArray visible{DirectInit, bounds.size(), true};
+    const std::size_t count = bvh.cullFrustumInto(frustum, visible);
+
+    /* Compare to testing each item separately */
+    std::size_t expectedCount = 0;
+    for(std::size_t i = 0; i != bounds.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Math::Intersection::rangeFrustum(bounds[i], frustum);
+        CORRADE_COMPARE(visible[i], expected);
+        if(expected) ++expectedCount;
+    }
+    CORRADE_COMPARE(count, expectedCount);
+    CORRADE_COMPARE(visible.count(), expectedCount);
+}
+
+void BoundingVolumeHierarchyTest::cullFrustumInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Containers::Array<Range3D> bounds = gridBounds(5);
+    BoundingVolumeHierarchy bvh{bounds};
+    Containers::BitArray visible{ValueInit, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    bvh.cullFrustumInto(Frustum{}, visible);
+    CORRADE_COMPARE(out, "SceneTools::BoundingVolumeHierarchy::cullFrustumInto(): expected 5 bits but got 4\n");
+}
+
+void BoundingVolumeHierarchyTest::intersectRays() {
+    /* Boxes along the X axis and one above the third */
+    const Range3D bounds[]{
+        Range3D::fromCenter({-4.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+        Range3D::fromCenter({ 0.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+        Range3D::fromCenter({ 4.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+        Range3D::fromCenter({ 8.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+        Range3D::fromCenter({ 4.0f, 5.0f, 0.0f}, Vector3{1.0f}),
+    };
+    BoundingVolumeHierarchy bvh{bounds};
+
+    const Vector3 origins[]{
+        /* Starts inside the second box, the first box is behind */
+        {0.0f, 0.0f, 0.0f},
+        /* Goes down through the last and the third box */
+        {4.0f, 10.0f, 0.0f},
+        /* Misses everything */
+        {0.0f, 10.0f, 0.0f},
+        /* Starts in front of everything, direction not normalized */
+        {-10.0f, 0.0f, 0.0f},
+    };
+    const Vector3 directions[]{
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {5.0f, 0.0f, 0.0f},
+    };
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> out = bvh.intersectRays(origins, directions);
+    CORRADE_COMPARE_AS(out.first(), Containers::arrayView<UnsignedInt>({
+        0, 3, 5, 5, 9
+    }), TestSuite::Compare::Container);
+
+    /* The order of items is unspecified, sort them for the comparison */
+    for(std::size_t i = 0; i != Containers::arraySize(origins); ++i)
+        std::sort(out.second() + out.first()[i], out.second() + out.first()[i + 1]);
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView<UnsignedInt>({
+        1, 2, 3,
+        2, 4,
+        0, 1, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::intersectRaysInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    BoundingVolumeHierarchy bvh{{}};
+    const Vector3 origins[3]{};
+    const Vector3 directions[2]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    bvh.intersectRays(origins, directions);
+    CORRADE_COMPARE(out, "SceneTools::BoundingVolumeHierarchy::intersectRays(): expected origin and direction views to have the same size but got 3 and 2\n");
+}
+
+void BoundingVolumeHierarchyTest::refit() {
+    Containers::Array<Range3D> bounds = gridBounds(16*16*16);
+    BoundingVolumeHierarchy bvh{bounds};
+    const std::size_t nodeCount = bvh.nodeCount();
+
+    /* Move the items around, mirror every other one */
+    for(std::size_t i = 0; i != bounds.size(); ++i) {
+        const Vector3 offset = i % 2 ? Vector3{0.0f, 0.0f, -8.0f} : Vector3{-2.0f*bounds[i].center().x(), 0.0f, 0.0f};
+        bounds[i] = {bounds[i].min() + offset, bounds[i].max() + offset};
+    }
+    bvh.refit(bounds);
+    CORRADE_COMPARE(bvh.nodeCount(), nodeCount);
+
+    Range3D expected = bounds[0];
+    for(const Range3D& i: bounds)
+        expected = Math::join(expected, i);
+    CORRADE_COMPARE(bvh.bounds(), expected);
+
+    /* The queries give the same result as testing each item separately */
+    const Frustum frustum = gridFrustum({});
+    Containers::BitArray visible{ValueInit, bounds.size()};
+    const std::size_t count = bvh.cullFrustumInto(frustum, visible);
+    std::size_t expectedCount = 0;
+    for(std::size_t i = 0; i != bounds.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const bool expectedVisible = Math::Intersection::rangeFrustum(bounds[i], frustum);
+        CORRADE_COMPARE(visible[i], expectedVisible);
+        if(expectedVisible) ++expectedCount;
+    }
+    CORRADE_COMPARE(count, expectedCount);
+}
+
+void BoundingVolumeHierarchyTest::refitInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Containers::Array<Range3D> bounds = gridBounds(5);
+    BoundingVolumeHierarchy bvh{bounds};
+
+    Containers::String out;
+    Error redirectError{&out};
+    bvh.refit(bounds.prefix(4));
+    CORRADE_COMPARE(out, "SceneTools::BoundingVolumeHierarchy::refit(): expected 5 bounds but got 4\n");
+}
+
+/* Object 1 is a child of object 0, object 2 is top-level. Object 0 and 2
+   reference mesh 1, object 1 mesh 0. */
+const struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[3];
+
+    struct Transformation {
+        UnsignedInt object;
+        Matrix4 transformation;
+    } transforms[3];
+
+    struct Mesh {
+        UnsignedInt object;
+        UnsignedInt mesh;
+    } meshes[3];
+} Data[]{{
+    {{0, -1}, {1, 0}, {2, -1}},
+    {{0, Matrix4::translation({10.0f, 0.0f, 0.0f})},
+     {1, Matrix4::rotationZ(90.0_degf)*Matrix4::scaling(Vector3{2.0f})},
+     {2, Matrix4::rotationY(45.0_degf)}},
+    {{0, 1},
+     {1, 0},
+     {2, 1}}
+}};
+
+const Range3D MeshBounds[]{
+    {{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}},
+    {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}
+};
+
+Trade::SceneData scene() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 3, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)},
+    }};
+}
+
+void BoundingVolumeHierarchyTest::meshInstanceBounds() {
+    CORRADE_COMPARE_AS(meshInstanceBounds3D(scene(), MeshBounds), Containers::arrayView<Range3D>({
+        {{9.0f, -1.0f, -1.0f}, {11.0f, 1.0f, 1.0f}},
+        /* Scaled to 2x4x6, rotated so Y goes to -X and translated */
+        {{6.0f, 0.0f, 0.0f}, {10.0f, 2.0f, 6.0f}},
+        /* A cube rotated around Y gets wider in X and Z */
+        {{-Constants::sqrt2(), -1.0f, -Constants::sqrt2()},
+         {Constants::sqrt2(), 1.0f, Constants::sqrt2()}},
+    }), TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::meshInstanceBoundsNoMeshField() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    CORRADE_VERIFY(meshInstanceBounds3D(scene, MeshBounds).isEmpty());
+    CORRADE_COMPARE(buildBoundingVolumeHierarchy(scene, MeshBounds).size(), 0);
+}
+
+void BoundingVolumeHierarchyTest::meshInstanceBoundsNot3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix3x3, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    meshInstanceBounds3D(scene, MeshBounds);
+    CORRADE_COMPARE(out, "SceneTools::meshInstanceBounds3DInto(): the scene is not 3D\n");
+}
+
+void BoundingVolumeHierarchyTest::meshInstanceBoundsNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    meshInstanceBounds3D(scene, MeshBounds);
+    CORRADE_COMPARE(out, "SceneTools::meshInstanceBounds3DInto(): the scene has no hierarchy\n");
+}
+
+void BoundingVolumeHierarchyTest::meshInstanceBoundsInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Range3D bounds[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    meshInstanceBounds3DInto(scene(), MeshBounds, bounds);
+    CORRADE_COMPARE(out, "SceneTools::meshInstanceBounds3DInto(): expected bounds destination view with 3 elements but got 2\n");
+}
+
+void BoundingVolumeHierarchyTest::meshInstanceBoundsMeshOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    meshInstanceBounds3D(scene(), Containers::arrayView(MeshBounds).prefix(1));
+    CORRADE_COMPARE(out, "SceneTools::meshInstanceBounds3DInto(): mesh 1 out of range for 1 mesh bounds\n");
+}
+
+void BoundingVolumeHierarchyTest::build() {
+    BoundingVolumeHierarchy bvh = buildBoundingVolumeHierarchy(scene(), MeshBounds);
+    CORRADE_COMPARE(bvh.size(), 3);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{
+        {-Constants::sqrt2(), -1.0f, -Constants::sqrt2()},
+        {11.0f, 2.0f, 6.0f}}));
+
+    /* Item IDs are indices into the mesh field */
+    const Vector3 origins[]{{8.0f, 1.0f, 5.0f}};
+    const Vector3 directions[]{{0.0f, 0.0f, -1.0f}};
+    CORRADE_COMPARE_AS(bvh.intersectRays(origins, directions).second(), Containers::arrayView<UnsignedInt>({
+        1
+    }), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::BoundingVolumeHierarchyTest)
@@ -0,0 +1,256 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/GroupMeshInstances.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct GroupMeshInstancesTest: TestSuite::Tester {
+    explicit GroupMeshInstancesTest();
+
+    void test();
+    void noMaterialField();
+    void noMeshField();
+
+    void not3D();
+    void noParentField();
+};
+
+const struct {
+    const char* name;
+    GroupMeshInstancesFlags flags;
+    Matrix4 globalTransformation;
+    Vector3 expectedTranslations[6];
+} TestData[]{
+    {"", {}, {}, {
+        {12.0f, 0.0f, 0.0f},
+        {10.0f, 2.0f, 0.0f},
+        {10.0f, 1.0f, 0.0f},
+        {13.0f, 0.0f, 0.0f},
+        {11.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f}}},
+    {"global transformation", {}, Matrix4::translation({0.0f, 0.0f, 5.0f}), {
+        {12.0f, 0.0f, 5.0f},
+        {10.0f, 2.0f, 5.0f},
+        {10.0f, 1.0f, 5.0f},
+        {13.0f, 0.0f, 5.0f},
+        {11.0f, 0.0f, 5.0f},
+        {0.0f, 0.0f, 5.0f}}},
+    /* The last group gets reordered, the first stays the same as the Y
+       coordinate has a higher significance in the Morton code */
+    {"Morton order", GroupMeshInstancesFlag::MortonOrder, {}, {
+        {12.0f, 0.0f, 0.0f},
+        {10.0f, 2.0f, 0.0f},
+        {10.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f},
+        {11.0f, 0.0f, 0.0f},
+        {13.0f, 0.0f, 0.0f}}},
+};
+
+GroupMeshInstancesTest::GroupMeshInstancesTest() {
+    addInstancedTests({&GroupMeshInstancesTest::test},
+        Containers::arraySize(TestData));
+
+    addTests({&GroupMeshInstancesTest::noMaterialField,
+              &GroupMeshInstancesTest::noMeshField,
+
+              &GroupMeshInstancesTest::not3D,
+              &GroupMeshInstancesTest::noParentField});
+}
+
+/* Objects 1 to 5 are children of object 0, object 6 is top-level. Objects 1,
+   3 and 6 share the same mesh and material, objects 2 and 5 share a mesh
+   with no material. */
+const struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[7];
+
+    struct Transformation {
+        UnsignedInt object;
+        Vector3 translation;
+    } transforms[6];
+
+    struct Mesh {
+        UnsignedInt object;
+        UnsignedInt mesh;
+        Int material;
+    } meshes[6];
+} Data[]{{
+    {{0, -1}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}, {6, -1}},
+    {{0, {10.0f, 0.0f, 0.0f}},
+     {1, {3.0f, 0.0f, 0.0f}},
+     {2, {2.0f, 0.0f, 0.0f}},
+     {3, {1.0f, 0.0f, 0.0f}},
+     {4, {0.0f, 1.0f, 0.0f}},
+     {5, {0.0f, 2.0f, 0.0f}}},
+    {{1, 3, 2},
+     {2, 1, -1},
+     {3, 3, 2},
+     {4, 3, 0},
+     {5, 1, -1},
+     {6, 3, 2}}
+}};
+
+void GroupMeshInstancesTest::test() {
+    auto&& data = TestData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 7, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::translation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::material)},
+    }};
+
+    /* To test both overloads */
+    Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> out = data.globalTransformation != Matrix4{} ?
+        groupMeshInstances3D(scene, data.flags, data.globalTransformation) :
+        groupMeshInstances3D(scene, data.flags);
+
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+        {1, -1},
+        {3, 0},
+        {3, 2}
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView<UnsignedInt>({
+        0, 2, 3, 6
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(out.third().size(), Containers::arraySize(data.expectedTranslations));
+    for(std::size_t i = 0; i != out.third().size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out.third()[i], Matrix4::translation(data.expectedTranslations[i]));
+    }
+}
+
+void GroupMeshInstancesTest::noMaterialField() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 7, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::translation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)},
+    }};
+
+    /* All instances of mesh 3 are now in the same group */
+    Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> out = groupMeshInstances3D(scene);
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+        {1, -1},
+        {3, -1}
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView<UnsignedInt>({
+        0, 2, 6
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.third(), Containers::arrayView({
+        Matrix4::translation({12.0f, 0.0f, 0.0f}),
+        Matrix4::translation({10.0f, 2.0f, 0.0f}),
+        Matrix4::translation({13.0f, 0.0f, 0.0f}),
+        Matrix4::translation({11.0f, 0.0f, 0.0f}),
+        Matrix4::translation({10.0f, 1.0f, 0.0f}),
+        Matrix4::translation({0.0f, 0.0f, 0.0f}),
+    }), TestSuite::Compare::Container);
+}
+
+void GroupMeshInstancesTest::noMeshField() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::Triple<Containers::Array<Containers::Pair<UnsignedInt, Int>>, Containers::Array<UnsignedInt>, Containers::Array<Matrix4>> out = groupMeshInstances3D(scene, GroupMeshInstancesFlag::MortonOrder);
+    CORRADE_VERIFY(out.first().isEmpty());
+    CORRADE_VERIFY(out.second().isEmpty());
+    CORRADE_VERIFY(out.third().isEmpty());
+}
+
+void GroupMeshInstancesTest::not3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix3x3, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    groupMeshInstances3D(scene);
+    CORRADE_COMPARE(out, "SceneTools::groupMeshInstances3D(): the scene is not 3D\n");
+}
+
+void GroupMeshInstancesTest::noParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    groupMeshInstances3D(scene);
+    CORRADE_COMPARE(out, "SceneTools::groupMeshInstances3D(): the scene has no hierarchy\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::GroupMeshInstancesTest)
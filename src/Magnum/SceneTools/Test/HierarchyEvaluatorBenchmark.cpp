@@ -0,0 +1,224 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/HierarchyEvaluator.h"
+#include "Magnum/Trade/SceneData.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct HierarchyEvaluatorBenchmark: TestSuite::Tester {
+    explicit HierarchyEvaluatorBenchmark();
+
+    void absoluteFieldTransformations();
+    void update();
+    void updateDirty();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void updateThreads();
+    void updateDirtyThreads();
+    #endif
+};
+
+/* Every dirtyEvery-th object is marked as dirty. Since the objects are
+   shuffled, the dirty subtrees are scattered across the whole hierarchy. */
+const struct {
+    const char* name;
+    UnsignedInt objectCount;
+    UnsignedInt dirtyEvery;
+} Data[]{
+    {"64k objects, 1% dirty", 1 << 16, 100},
+    {"64k objects, 0.1% dirty", 1 << 16, 1000},
+    {"1M objects, 1% dirty", 1 << 20, 100},
+    {"1M objects, 0.1% dirty", 1 << 20, 1000},
+};
+
+/* Emscripten builds don't have threads enabled by default */
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} ThreadData[]{
+    {"serial", 0},
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8},
+};
+
+/* Spawns given count of threads for each call, each picking the next task
+   that wasn't taken yet. The thread creation is included in the measured
+   time, as it would be for an application not having a thread pool. */
+void threadExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != *static_cast<std::size_t*>(userData); ++i)
+        threads.emplace_back([&]{
+            for(std::size_t id; (id = next++) < count; )
+                task(id, state);
+        });
+    for(std::thread& thread: threads) thread.join();
+}
+#endif
+
+HierarchyEvaluatorBenchmark::HierarchyEvaluatorBenchmark() {
+    addInstancedBenchmarks({&HierarchyEvaluatorBenchmark::absoluteFieldTransformations,
+                            &HierarchyEvaluatorBenchmark::update,
+                            &HierarchyEvaluatorBenchmark::updateDirty}, 5,
+        Containers::arraySize(Data));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addInstancedBenchmarks({&HierarchyEvaluatorBenchmark::updateThreads,
+                            &HierarchyEvaluatorBenchmark::updateDirtyThreads}, 5,
+        Containers::arraySize(ThreadData));
+    #endif
+}
+
+struct Field {
+    UnsignedInt object;
+    Int parent;
+    Matrix4 transformation;
+};
+
+/* A balanced binary tree with objects shuffled so the mapping isn't ordered,
+   similarly to what importers usually produce */
+Trade::SceneData binaryTree(const UnsignedInt objectCount) {
+    Containers::Array<char> data{NoInit, objectCount*sizeof(Field)};
+    const Containers::StridedArrayView1D<Field> fields = Containers::arrayCast<Field>(data);
+    for(UnsignedInt i = 0; i != objectCount; ++i) {
+        /* The count is a power of two so any odd multiplier is a bijection */
+        fields[i].object = (i*2654435761u) & (objectCount - 1);
+        fields[i].parent = i == 0 ? -1 : Int((((i - 1)/2)*2654435761u) & (objectCount - 1));
+        fields[i].transformation = Matrix4::translation({0.0f, 0.0f, 1.0f})*Matrix4::rotationZ(Deg(Float(i % 360)));
+    }
+
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, objectCount, Utility::move(data), {
+        Trade::SceneFieldData{Trade::SceneField::Parent, fields.slice(&Field::object), fields.slice(&Field::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, fields.slice(&Field::object), fields.slice(&Field::transformation)}
+    }};
+}
+
+void HierarchyEvaluatorBenchmark::absoluteFieldTransformations() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::SceneData scene = binaryTree(data.objectCount);
+
+    /* The stateless variant, for comparison. Has to extract the hierarchy
+       again on every call. */
+    Containers::Array<Matrix4> out{NoInit, data.objectCount};
+    CORRADE_BENCHMARK(1)
+        absoluteFieldTransformations3DInto(scene, Trade::SceneField::Transformation, out);
+
+    CORRADE_COMPARE(out[0], Matrix4::translation({0.0f, 0.0f, 1.0f}));
+}
+
+void HierarchyEvaluatorBenchmark::update() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::SceneData scene = binaryTree(data.objectCount);
+    HierarchyEvaluator3D evaluator{scene};
+
+    CORRADE_BENCHMARK(1)
+        evaluator.update();
+
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[0], Matrix4::translation({0.0f, 0.0f, 1.0f}));
+}
+
+void HierarchyEvaluatorBenchmark::updateDirty() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::SceneData scene = binaryTree(data.objectCount);
+    HierarchyEvaluator3D evaluator{scene};
+
+    Containers::BitArray dirty{ValueInit, data.objectCount};
+    for(UnsignedInt i = 1; i < data.objectCount; i += data.dirtyEvery)
+        dirty.set(i);
+
+    CORRADE_BENCHMARK(1)
+        evaluator.update(dirty);
+
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[0], Matrix4::translation({0.0f, 0.0f, 1.0f}));
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void HierarchyEvaluatorBenchmark::updateThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::SceneData scene = binaryTree(1 << 20);
+    HierarchyEvaluator3D evaluator{scene};
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    CORRADE_BENCHMARK(1)
+        evaluator.update(executor);
+
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[0], Matrix4::translation({0.0f, 0.0f, 1.0f}));
+}
+
+void HierarchyEvaluatorBenchmark::updateDirtyThreads() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::SceneData scene = binaryTree(1 << 20);
+    HierarchyEvaluator3D evaluator{scene};
+
+    /* Same as the "1M objects, 1% dirty" case above */
+    Containers::BitArray dirty{ValueInit, 1 << 20};
+    for(UnsignedInt i = 1; i < (1 << 20); i += 100)
+        dirty.set(i);
+
+    std::size_t threadCount = data.threadCount;
+    const Executor executor = threadCount ? Executor{threadExecutor, &threadCount} : Executor{};
+
+    CORRADE_BENCHMARK(1)
+        evaluator.update(dirty, executor);
+
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[0], Matrix4::translation({0.0f, 0.0f, 1.0f}));
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::HierarchyEvaluatorBenchmark)
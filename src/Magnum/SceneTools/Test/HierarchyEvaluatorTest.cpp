@@ -0,0 +1,623 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Executor.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/HierarchyEvaluator.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct HierarchyEvaluatorTest: TestSuite::Tester {
+    explicit HierarchyEvaluatorTest();
+
+    void construct2D();
+    void construct3D();
+    void constructNot2DNot3D();
+    void constructNoParentField();
+    void constructMove();
+
+    void update();
+    void updateDirty();
+    void updateDirtyDeep();
+    void updateDirtyInvalidSize();
+    void updateExecutor();
+    void updateDirtyExecutor();
+
+    void absoluteFieldTransformationsInto();
+    void absoluteFieldTransformationsIntoInvalid();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Matrix3 globalTransformation2D;
+    Matrix4 globalTransformation3D;
+} ConstructData[]{
+    {"", {}, {}},
+    {"global transformation",
+        Matrix3::scaling(Vector2{0.5f}), Matrix4::scaling(Vector3{0.5f})},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt dirty[4];
+    std::size_t expectedCalls;
+} UpdateDirtyExecutorData[]{
+    /* Subtrees of 3 and 11 have 16384 and 8191 objects, together with 1000
+       it's two tasks. 40000 is nested in 3. */
+    {"scattered subtrees", {3, 1000, 11, 40000}, 1},
+    /* A single subtree with less than 16384 objects is done directly */
+    {"single task", {11, 1000, 11, 11}, 0},
+    /* Subtree of 1 and 2 together is more than half of the hierarchy, which
+       is delegated to update() */
+    {"most of the hierarchy", {1, 2, 1, 2}, 1},
+};
+
+/* Runs the tasks in reverse order, which verifies the output doesn't depend
+   on the order, and counts how many times it was called */
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ++*static_cast<std::size_t*>(userData);
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
+HierarchyEvaluatorTest::HierarchyEvaluatorTest() {
+    addInstancedTests({&HierarchyEvaluatorTest::construct2D,
+                       &HierarchyEvaluatorTest::construct3D},
+        Containers::arraySize(ConstructData));
+
+    addTests({&HierarchyEvaluatorTest::constructNot2DNot3D,
+              &HierarchyEvaluatorTest::constructNoParentField,
+              &HierarchyEvaluatorTest::constructMove,
+
+              &HierarchyEvaluatorTest::update,
+              &HierarchyEvaluatorTest::updateDirty,
+              &HierarchyEvaluatorTest::updateDirtyDeep,
+              &HierarchyEvaluatorTest::updateDirtyInvalidSize,
+              &HierarchyEvaluatorTest::updateExecutor});
+
+    addInstancedTests({&HierarchyEvaluatorTest::updateDirtyExecutor},
+        Containers::arraySize(UpdateDirtyExecutorData));
+
+    addTests({&HierarchyEvaluatorTest::absoluteFieldTransformationsInto,
+              &HierarchyEvaluatorTest::absoluteFieldTransformationsIntoInvalid});
+}
+
+/* Object 0 and 4 are top-level, 1 and 3 are children of 0, 2 is a child of 1,
+   5 is a child of 4. Object 6 isn't in the hierarchy, object 7 has nothing.
+   Object 3 has no transformation. */
+const struct Scene {
+    struct Parent {
+        UnsignedShort object;
+        Short parent;
+    } parents[6];
+
+    struct Transformation {
+        UnsignedShort object;
+        Matrix3 transformation2D;
+        Matrix4 transformation3D;
+    } transforms[6];
+
+    struct Mesh {
+        UnsignedShort object;
+        UnsignedShort mesh;
+    } meshes[4];
+} Data[]{{
+    {{2, 1}, {0, -1}, {3, 0}, {1, 0}, {5, 4}, {4, -1}},
+    {{5, Matrix3::rotation(90.0_degf),
+         Matrix4::rotationX(90.0_degf)},
+     {1, Matrix3::rotation(35.0_degf),
+         Matrix4::rotationZ(35.0_degf)},
+     {0, Matrix3::translation({1.0f, 0.0f}),
+         Matrix4::translation({1.0f, 0.0f, 0.0f})},
+     {6, Matrix3::translation({0.0f, 7.0f}),
+         Matrix4::translation({0.0f, 0.0f, 7.0f})},
+     {2, Matrix3::scaling({2.0f, 3.0f}),
+         Matrix4::scaling({2.0f, 3.0f, 4.0f})},
+     {4, Matrix3::translation({0.0f, 3.0f}),
+         Matrix4::translation({0.0f, 3.0f, 0.0f})}},
+    {{2, 0}, {5, 1}, {3, 2}, {2, 3}}
+}};
+
+Trade::SceneData scene2D() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 8, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation2D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)},
+    }};
+}
+
+Trade::SceneData scene3D() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 8, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)},
+    }};
+}
+
+void HierarchyEvaluatorTest::construct2D() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = scene2D();
+
+    /* To test both overloads */
+    Containers::Optional<HierarchyEvaluator2D> evaluator;
+    if(data.globalTransformation2D != Matrix3{})
+        evaluator.emplace(scene, data.globalTransformation2D);
+    else
+        evaluator.emplace(scene);
+    CORRADE_COMPARE(evaluator->objectCount(), 8);
+
+    CORRADE_COMPARE_AS(evaluator->localTransformations(), Containers::arrayView({
+        Matrix3::translation({1.0f, 0.0f}),
+        Matrix3::rotation(35.0_degf),
+        Matrix3::scaling({2.0f, 3.0f}),
+        Matrix3{},
+        Matrix3::translation({0.0f, 3.0f}),
+        Matrix3::rotation(90.0_degf),
+        Matrix3::translation({0.0f, 7.0f}),
+        Matrix3{}
+    }), TestSuite::Compare::Container);
+
+    /* Objects 6 and 7 are not in the hierarchy, so their value is
+       unspecified */
+    CORRADE_COMPARE_AS(evaluator->absoluteTransformations().prefix(6), Containers::arrayView({
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, 0.0f}),
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, 0.0f})*
+            Matrix3::rotation(35.0_degf),
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, 0.0f})*
+            Matrix3::rotation(35.0_degf)*
+            Matrix3::scaling({2.0f, 3.0f}),
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, 0.0f}),
+        data.globalTransformation2D*
+            Matrix3::translation({0.0f, 3.0f}),
+        data.globalTransformation2D*
+            Matrix3::translation({0.0f, 3.0f})*
+            Matrix3::rotation(90.0_degf),
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::construct3D() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = scene3D();
+
+    /* To test both overloads */
+    Containers::Optional<HierarchyEvaluator3D> evaluator;
+    if(data.globalTransformation3D != Matrix4{})
+        evaluator.emplace(scene, data.globalTransformation3D);
+    else
+        evaluator.emplace(scene);
+    CORRADE_COMPARE(evaluator->objectCount(), 8);
+
+    CORRADE_COMPARE_AS(evaluator->localTransformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::rotationZ(35.0_degf),
+        Matrix4::scaling({2.0f, 3.0f, 4.0f}),
+        Matrix4{},
+        Matrix4::translation({0.0f, 3.0f, 0.0f}),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({0.0f, 0.0f, 7.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+
+    /* Objects 6 and 7 are not in the hierarchy, so their value is
+       unspecified */
+    CORRADE_COMPARE_AS(evaluator->absoluteTransformations().prefix(6), Containers::arrayView({
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling({2.0f, 3.0f, 4.0f}),
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        data.globalTransformation3D*
+            Matrix4::translation({0.0f, 3.0f, 0.0f}),
+        data.globalTransformation3D*
+            Matrix4::translation({0.0f, 3.0f, 0.0f})*
+            Matrix4::rotationX(90.0_degf),
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::constructNot2DNot3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    HierarchyEvaluator2D{scene};
+    HierarchyEvaluator3D{scene};
+    CORRADE_COMPARE(out,
+        "SceneTools::HierarchyEvaluator: the scene is not 2D\n"
+        "SceneTools::HierarchyEvaluator: the scene is not 3D\n");
+}
+
+void HierarchyEvaluatorTest::constructNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    HierarchyEvaluator3D{scene};
+    CORRADE_COMPARE(out, "SceneTools::HierarchyEvaluator: the scene has no hierarchy\n");
+}
+
+void HierarchyEvaluatorTest::constructMove() {
+    Trade::SceneData scene = scene3D();
+
+    HierarchyEvaluator3D a{scene};
+    HierarchyEvaluator3D b = Utility::move(a);
+    CORRADE_COMPARE(b.objectCount(), 8);
+    CORRADE_COMPARE(b.absoluteTransformations()[5],
+        Matrix4::translation({0.0f, 3.0f, 0.0f})*
+        Matrix4::rotationX(90.0_degf));
+
+    HierarchyEvaluator3D c{scene, Matrix4::scaling(Vector3{2.0f})};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.objectCount(), 8);
+    CORRADE_COMPARE(c.absoluteTransformations()[5],
+        Matrix4::translation({0.0f, 3.0f, 0.0f})*
+        Matrix4::rotationX(90.0_degf));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<HierarchyEvaluator3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<HierarchyEvaluator3D>::value);
+}
+
+void HierarchyEvaluatorTest::update() {
+    Trade::SceneData scene = scene3D();
+    HierarchyEvaluator3D evaluator{scene};
+
+    evaluator.localTransformations()[1] = Matrix4::rotationY(15.0_degf);
+    evaluator.localTransformations()[4] = Matrix4::scaling(Vector3{0.5f});
+
+    /* Nothing changes until update() is called */
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[2],
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+        Matrix4::rotationZ(35.0_degf)*
+        Matrix4::scaling({2.0f, 3.0f, 4.0f}));
+
+    evaluator.update();
+    CORRADE_COMPARE_AS(evaluator.absoluteTransformations().prefix(6), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationY(15.0_degf),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationY(15.0_degf)*
+            Matrix4::scaling({2.0f, 3.0f, 4.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::scaling(Vector3{0.5f}),
+        Matrix4::scaling(Vector3{0.5f})*
+            Matrix4::rotationX(90.0_degf),
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::updateDirty() {
+    Trade::SceneData scene = scene3D();
+    HierarchyEvaluator3D evaluator{scene};
+
+    evaluator.localTransformations()[1] = Matrix4::rotationY(15.0_degf);
+    evaluator.localTransformations()[2] = Matrix4::scaling(Vector3{3.0f});
+    evaluator.localTransformations()[4] = Matrix4::scaling(Vector3{0.5f});
+
+    /* Object 4 isn't marked as dirty so it and its children shouldn't get
+       updated. Object 2 is nested in 1 so it gets updated only once. Object 6
+       isn't in the hierarchy, which should be ignored. */
+    Containers::BitArray dirty{ValueInit, 8};
+    dirty.set(1);
+    dirty.set(2);
+    dirty.set(6);
+    evaluator.update(dirty);
+    CORRADE_COMPARE_AS(evaluator.absoluteTransformations().prefix(6), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationY(15.0_degf),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationY(15.0_degf)*
+            Matrix4::scaling(Vector3{3.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({0.0f, 3.0f, 0.0f}),
+        Matrix4::translation({0.0f, 3.0f, 0.0f})*
+            Matrix4::rotationX(90.0_degf),
+    }), TestSuite::Compare::Container);
+
+    /* Updating just the other subtree now. The internal dirty state should be
+       cleared after the previous call, so changes in 0 shouldn't get
+       picked up either. */
+    evaluator.localTransformations()[0] = Matrix4::translation({5.0f, 0.0f, 0.0f});
+    Containers::BitArray dirty2{ValueInit, 8};
+    dirty2.set(4);
+    evaluator.update(dirty2);
+    CORRADE_COMPARE_AS(evaluator.absoluteTransformations().prefix(6), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationY(15.0_degf),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationY(15.0_degf)*
+            Matrix4::scaling(Vector3{3.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::scaling(Vector3{0.5f}),
+        Matrix4::scaling(Vector3{0.5f})*
+            Matrix4::rotationX(90.0_degf),
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::updateDirtyDeep() {
+    /* Four chains of 50 objects each, to verify the skipping of whole words
+       in the bit arrays */
+    struct Field {
+        UnsignedInt object;
+        Int parent;
+        Matrix4 transformation;
+    };
+    Containers::Array<Field> fields{NoInit, 200};
+    for(UnsignedInt i = 0; i != fields.size(); ++i) {
+        fields[i].object = i;
+        fields[i].parent = i % 50 ? Int(i) - 1 : -1;
+        fields[i].transformation = Matrix4::translation(Vector3::xAxis());
+    }
+
+    Containers::StridedArrayView1D<Field> view = fields;
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 200, {}, Containers::arrayView(fields), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&Field::object),
+            view.slice(&Field::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            view.slice(&Field::object),
+            view.slice(&Field::transformation)}
+    }};
+
+    HierarchyEvaluator3D evaluator{scene};
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[129].translation().x(), 30.0f);
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[149].translation().x(), 50.0f);
+
+    evaluator.localTransformations()[130] = Matrix4::translation(Vector3::xAxis(2.0f));
+    evaluator.localTransformations()[160] = Matrix4::translation(Vector3::xAxis(3.0f));
+
+    /* Using a view with an offset to verify it's accounted for. Object 160
+       isn't marked as dirty. */
+    Containers::BitArray dirty{ValueInit, 203};
+    dirty.set(133);
+    evaluator.update(dirty.exceptPrefix(3));
+
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[129].translation().x(), 30.0f);
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[130].translation().x(), 32.0f);
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[149].translation().x(), 51.0f);
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[150].translation().x(), 1.0f);
+    CORRADE_COMPARE(evaluator.absoluteTransformations()[160].translation().x(), 11.0f);
+
+    /* Everything updated is the same as a full update */
+    evaluator.localTransformations()[160] = Matrix4::translation(Vector3::xAxis(1.0f));
+    Containers::Array<Matrix4> incremental{NoInit, 200};
+    Utility::copy(evaluator.absoluteTransformations(), incremental);
+    evaluator.update();
+    CORRADE_COMPARE_AS(evaluator.absoluteTransformations(),
+        incremental,
+        TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::updateDirtyInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene = scene3D();
+    HierarchyEvaluator3D evaluator{scene};
+
+    Containers::String out;
+    Error redirectError{&out};
+    evaluator.update(Containers::BitArray{ValueInit, 7});
+    CORRADE_COMPARE(out, "SceneTools::HierarchyEvaluator::update(): expected 8 bits but got 7\n");
+}
+
+struct TreeField {
+    UnsignedInt object;
+    Int parent;
+    Matrix4 transformation;
+};
+
+/* A balanced binary tree of 65536 objects. The last level has 32769 objects,
+   which is split into three tasks, the level before has 16384 objects which
+   is done directly. */
+Containers::Array<TreeField> binaryTree() {
+    Containers::Array<TreeField> fields{NoInit, 1 << 16};
+    for(UnsignedInt i = 0; i != fields.size(); ++i) {
+        fields[i].object = i;
+        fields[i].parent = i == 0 ? -1 : Int((i - 1)/2);
+        fields[i].transformation =
+            Matrix4::translation({0.0f, 0.0f, 0.125f})*
+            Matrix4::rotationZ(Deg(Float(i % 360)))*
+            Matrix4::scaling(Vector3{1.0f + (i % 7)*0.0625f});
+    }
+    return fields;
+}
+
+Trade::SceneData binaryTreeScene(const Containers::ArrayView<const TreeField> fields) {
+    const Containers::StridedArrayView1D<const TreeField> view = fields;
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, fields.size(), {}, fields, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&TreeField::object),
+            view.slice(&TreeField::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            view.slice(&TreeField::object),
+            view.slice(&TreeField::transformation)}
+    }};
+}
+
+void HierarchyEvaluatorTest::updateExecutor() {
+    const Containers::Array<TreeField> fields = binaryTree();
+    const Trade::SceneData scene = binaryTreeScene(fields);
+
+    HierarchyEvaluator3D serial{scene};
+    HierarchyEvaluator3D parallel{scene};
+    for(std::size_t i = 0; i != fields.size(); i += 3) {
+        serial.localTransformations()[i] = Matrix4::rotationY(15.0_degf)*fields[i].transformation;
+        parallel.localTransformations()[i] = Matrix4::rotationY(15.0_degf)*fields[i].transformation;
+    }
+
+    std::size_t calls = 0;
+    serial.update();
+    parallel.update(Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE_AS(parallel.absoluteTransformations(),
+        serial.absoluteTransformations(),
+        TestSuite::Compare::Container);
+
+    /* Spot-check that the serial output is actually correct */
+    CORRADE_COMPARE(serial.absoluteTransformations()[65535],
+        serial.absoluteTransformations()[32767]*
+        serial.localTransformations()[65535]);
+}
+
+void HierarchyEvaluatorTest::updateDirtyExecutor() {
+    auto&& data = UpdateDirtyExecutorData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<TreeField> fields = binaryTree();
+    const Trade::SceneData scene = binaryTreeScene(fields);
+
+    HierarchyEvaluator3D serial{scene};
+    HierarchyEvaluator3D parallel{scene};
+    Containers::BitArray dirty{ValueInit, fields.size()};
+    for(const UnsignedInt i: data.dirty) {
+        serial.localTransformations()[i] = Matrix4::rotationY(15.0_degf);
+        parallel.localTransformations()[i] = Matrix4::rotationY(15.0_degf);
+        dirty.set(i);
+    }
+
+    std::size_t calls = 0;
+    serial.update(dirty);
+    parallel.update(dirty, Executor{reverseExecutor, &calls});
+    CORRADE_COMPARE(calls, data.expectedCalls);
+    CORRADE_COMPARE_AS(parallel.absoluteTransformations(),
+        serial.absoluteTransformations(),
+        TestSuite::Compare::Container);
+
+    /* The serial incremental update is the same as a full update */
+    Containers::Array<Matrix4> incremental{NoInit, fields.size()};
+    Utility::copy(serial.absoluteTransformations(), incremental);
+    serial.update();
+    CORRADE_COMPARE_AS(serial.absoluteTransformations(),
+        incremental,
+        TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::absoluteFieldTransformationsInto() {
+    Trade::SceneData scene = scene3D();
+    HierarchyEvaluator3D evaluator{scene, Matrix4::scaling(Vector3{0.5f})};
+
+    /* Should match what the stateless variant calculates */
+    Containers::Array<Matrix4> expected = SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, Matrix4::scaling(Vector3{0.5f}));
+
+    Matrix4 out[4];
+    evaluator.absoluteFieldTransformationsInto(scene, Trade::SceneField::Mesh, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        expected,
+        TestSuite::Compare::Container);
+
+    Matrix4 outId[4];
+    evaluator.absoluteFieldTransformationsInto(scene, 2, outId);
+    CORRADE_COMPARE_AS(Containers::arrayView(outId),
+        expected,
+        TestSuite::Compare::Container);
+}
+
+void HierarchyEvaluatorTest::absoluteFieldTransformationsIntoInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene = scene3D();
+    HierarchyEvaluator3D evaluator{scene};
+
+    Trade::SceneData differentScene{Trade::SceneMappingType::UnsignedShort, 7, nullptr, {}};
+
+    Matrix4 out[4];
+    Containers::String outString;
+    Error redirectError{&outString};
+    evaluator.absoluteFieldTransformationsInto(differentScene, 2, out);
+    evaluator.absoluteFieldTransformationsInto(scene, 3, out);
+    evaluator.absoluteFieldTransformationsInto(scene, Trade::SceneField::Light, out);
+    evaluator.absoluteFieldTransformationsInto(scene, 2, Containers::arrayView(out).exceptSuffix(1));
+    CORRADE_COMPARE(outString,
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): expected a scene with 8 objects but got 7\n"
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): index 3 out of range for 3 fields\n"
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): field Trade::SceneField::Light not found\n"
+        "SceneTools::HierarchyEvaluator::absoluteFieldTransformationsInto(): bad output size, expected 4 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::HierarchyEvaluatorTest)
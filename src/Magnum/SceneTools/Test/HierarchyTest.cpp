@@ -32,6 +32,7 @@
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/Trade/SceneData.h"
 
@@ -64,6 +65,13 @@ struct HierarchyTest: TestSuite::Tester {
     void absoluteFieldTransformationsInto2D();
     void absoluteFieldTransformationsInto3D();
     void absoluteFieldTransformationsIntoInvalidSize();
+
+    void absoluteFieldTranslationsRotationsScalings3D();
+    void absoluteFieldTranslationsRotationsScalings3DInto();
+    void absoluteFieldTranslationsRotationsScalings3DIntoMatrix();
+    void absoluteFieldTranslationsRotationsScalings3DTransformationField();
+    void absoluteFieldTranslationsRotationsScalings3DInvalid();
+    void absoluteFieldTranslationsRotationsScalings3DIntoInvalidSize();
 };
 
 using namespace Math::Literals;
@@ -117,6 +125,14 @@ const struct {
         5},
 };
 
+const struct {
+    const char* name;
+    bool fieldIdInsteadOfName;
+} TranslationRotationScalingData[]{
+    {"", false},
+    {"field ID", true},
+};
+
 HierarchyTest::HierarchyTest() {
     addTests({&HierarchyTest::parentsBreadthFirstChildrenDepthFirst,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSingleBranch,
@@ -145,6 +161,15 @@ HierarchyTest::HierarchyTest() {
         Containers::arraySize(IntoData));
 
     addTests({&HierarchyTest::absoluteFieldTransformationsIntoInvalidSize});
+
+    addInstancedTests({&HierarchyTest::absoluteFieldTranslationsRotationsScalings3D,
+                       &HierarchyTest::absoluteFieldTranslationsRotationsScalings3DInto,
+                       &HierarchyTest::absoluteFieldTranslationsRotationsScalings3DIntoMatrix},
+        Containers::arraySize(TranslationRotationScalingData));
+
+    addTests({&HierarchyTest::absoluteFieldTranslationsRotationsScalings3DTransformationField,
+              &HierarchyTest::absoluteFieldTranslationsRotationsScalings3DInvalid,
+              &HierarchyTest::absoluteFieldTranslationsRotationsScalings3DIntoInvalidSize});
 }
 
 void HierarchyTest::parentsBreadthFirstChildrenDepthFirst() {
@@ -889,6 +914,323 @@ void HierarchyTest::absoluteFieldTransformationsIntoInvalidSize() {
         "SceneTools::absoluteFieldTransformationsInto(): bad output size, expected 5 but got 4\n");
 }
 
+const struct TranslationRotationScalingScene {
+    struct Parent {
+        UnsignedShort object;
+        Byte parent;
+    } parents[9];
+
+    struct Transformation {
+        UnsignedShort object;
+        Vector3 translation;
+        Quaternion rotation;
+        Vector3 scaling;
+    } transforms[6];
+
+    struct Mesh {
+        UnsignedShort object;
+        UnsignedShort mesh;
+    } meshes[5];
+} TranslationRotationScalingSceneData[]{{
+    /* Same hierarchy as above. The non-uniform scaling is only on objects
+       that don't have any rotated children, so the result can be compared to
+       matrix multiplication. */
+    {{3, 5},
+     {11, 4},
+     {5, 1},
+     {1, -1},
+     {7, 5},
+     {6, 2},
+     {2, 1},
+     {4, -1},
+     {16, 11}},
+    {{2, {}, {}, {3.0f, 5.0f, 2.0f}},
+     {1, {1.0f, -1.5f, 0.5f}, Quaternion::rotation(90.0_degf, Vector3::xAxis()), Vector3{2.0f}},
+     {16, {1.0f, -1.5f, 0.5f}, {}, {3.0f, 5.0f, 2.0f}},
+     {7, {}, {}, {2.0f, 1.0f, 0.5f}},
+     {5, {0.0f, 1.0f, 0.0f}, Quaternion::rotation(35.0_degf, Vector3::zAxis()), Vector3{1.0f}},
+     /* Not part of the hierarchy */
+     {32, {1.0f, 0.5f, 2.0f}, {}, Vector3{1.0f}}},
+    {{2, 113},
+     {3, 266},
+     {4, 525},
+     {3, 422},
+     {16, 113}}
+}};
+
+Trade::SceneData translationRotationScalingScene() {
+    const TranslationRotationScalingScene& data = *TranslationRotationScalingSceneData;
+    const Containers::StridedArrayView1D<const TranslationRotationScalingScene::Transformation> transforms = data.transforms;
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 33, {}, TranslationRotationScalingSceneData, {
+        /* To verify it doesn't just pick the first field ever */
+        Trade::SceneFieldData{Trade::SceneField::Camera, Trade::SceneMappingType::UnsignedShort, nullptr, Trade::SceneFieldType::UnsignedInt, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&TranslationRotationScalingScene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&TranslationRotationScalingScene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&TranslationRotationScalingScene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&TranslationRotationScalingScene::Mesh::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            transforms.slice(&TranslationRotationScalingScene::Transformation::object),
+            transforms.slice(&TranslationRotationScalingScene::Transformation::translation)},
+        Trade::SceneFieldData{Trade::SceneField::Rotation,
+            transforms.slice(&TranslationRotationScalingScene::Transformation::object),
+            transforms.slice(&TranslationRotationScalingScene::Transformation::rotation)},
+        Trade::SceneFieldData{Trade::SceneField::Scaling,
+            transforms.slice(&TranslationRotationScalingScene::Transformation::object),
+            transforms.slice(&TranslationRotationScalingScene::Transformation::scaling)},
+    }};
+}
+
+void HierarchyTest::absoluteFieldTranslationsRotationsScalings3D() {
+    auto&& data = TranslationRotationScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = translationRotationScalingScene();
+
+    /* To test both overloads */
+    Containers::Array<Containers::Triple<Vector3, Quaternion, Vector3>> out = data.fieldIdInsteadOfName ?
+        SceneTools::absoluteFieldTranslationsRotationsScalings3D(scene, 2) :
+        SceneTools::absoluteFieldTranslationsRotationsScalings3D(scene, Trade::SceneField::Mesh);
+
+    CORRADE_COMPARE_AS(out, (Containers::arrayView<Containers::Triple<Vector3, Quaternion, Vector3>>({
+        {{1.0f, -1.5f, 0.5f},
+         Quaternion::rotation(90.0_degf, Vector3::xAxis()),
+         {6.0f, 10.0f, 4.0f}},
+        /* The Y translation of object 5 gets scaled and rotated to Z */
+        {{1.0f, -1.5f, 2.5f},
+         Quaternion::rotation(90.0_degf, Vector3::xAxis())*
+            Quaternion::rotation(35.0_degf, Vector3::zAxis()),
+         Vector3{2.0f}},
+        {{}, {}, Vector3{1.0f}},
+        {{1.0f, -1.5f, 2.5f},
+         Quaternion::rotation(90.0_degf, Vector3::xAxis())*
+            Quaternion::rotation(35.0_degf, Vector3::zAxis()),
+         Vector3{2.0f}},
+        {{1.0f, -1.5f, 0.5f},
+         {},
+         {3.0f, 5.0f, 2.0f}},
+    })), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTranslationsRotationsScalings3DInto() {
+    auto&& data = TranslationRotationScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = translationRotationScalingScene();
+
+    /* Just to verify the output gets correctly split to the three views, the
+       calculation is tested thoroughly above */
+    Vector3 translations[5];
+    Quaternion rotations[5];
+    Vector3 scalings[5];
+    if(data.fieldIdInsteadOfName)
+        SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, 2, translations, rotations, scalings);
+    else
+        SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, Trade::SceneField::Mesh, translations, rotations, scalings);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(translations), Containers::arrayView<Vector3>({
+        {1.0f, -1.5f, 0.5f},
+        {1.0f, -1.5f, 2.5f},
+        {},
+        {1.0f, -1.5f, 2.5f},
+        {1.0f, -1.5f, 0.5f},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(rotations), Containers::arrayView<Quaternion>({
+        Quaternion::rotation(90.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(90.0_degf, Vector3::xAxis())*
+            Quaternion::rotation(35.0_degf, Vector3::zAxis()),
+        {},
+        Quaternion::rotation(90.0_degf, Vector3::xAxis())*
+            Quaternion::rotation(35.0_degf, Vector3::zAxis()),
+        {},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(scalings), Containers::arrayView<Vector3>({
+        {6.0f, 10.0f, 4.0f},
+        Vector3{2.0f},
+        Vector3{1.0f},
+        Vector3{2.0f},
+        {3.0f, 5.0f, 2.0f},
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTranslationsRotationsScalings3DIntoMatrix() {
+    auto&& data = TranslationRotationScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = translationRotationScalingScene();
+
+    /* The same as would be calculated by multiplying the matrices together */
+    const Matrix4 expected[]{
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationX(90.0_degf)*
+            Matrix4::scaling(Vector3{2.0f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationX(90.0_degf)*
+            Matrix4::scaling(Vector3{2.0f})*
+            Matrix4::translation({0.0f, 1.0f, 0.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        Matrix4{},
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationX(90.0_degf)*
+            Matrix4::scaling(Vector3{2.0f})*
+            Matrix4::translation({0.0f, 1.0f, 0.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+    };
+
+    /* To test both overloads */
+    Matrix4 out[5];
+    Matrix4x3 outAffine[5];
+    if(data.fieldIdInsteadOfName) {
+        SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, 2, out);
+        SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, 2, outAffine);
+    } else {
+        SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, Trade::SceneField::Mesh, out);
+        SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, Trade::SceneField::Mesh, outAffine);
+    }
+
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    for(std::size_t i = 0; i != Containers::arraySize(expected); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(outAffine[i], (Matrix4x3{
+            expected[i][0].xyz(),
+            expected[i][1].xyz(),
+            expected[i][2].xyz(),
+            expected[i][3].xyz()}));
+    }
+}
+
+void HierarchyTest::absoluteFieldTranslationsRotationsScalings3DTransformationField() {
+    /* The first two objects have a matrix that's different from the TRS,
+       which should get ignored. The third has just a translation, making the
+       matrix field smaller than the TRS fields. */
+    const struct Data {
+        UnsignedInt object;
+        Int parent;
+        Vector3 translation;
+        Matrix4 transformation;
+    } data[]{
+        {0, -1, {1.0f, 2.0f, 3.0f}, Matrix4::scaling(Vector3{5.0f})},
+        {1, 0, {0.5f, 0.0f, 0.0f}, Matrix4::rotationX(90.0_degf)},
+        {2, 1, {0.0f, 0.0f, 1.0f}, {}},
+    };
+    const Containers::StridedArrayView1D<const Data> view = data;
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&Data::object),
+            view.slice(&Data::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            view.slice(&Data::object).prefix(2),
+            view.slice(&Data::transformation).prefix(2)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            view.slice(&Data::object),
+            view.slice(&Data::translation)},
+    }};
+
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTranslationsRotationsScalings3D(scene, Trade::SceneField::Parent), (Containers::arrayView<Containers::Triple<Vector3, Quaternion, Vector3>>({
+        {{1.0f, 2.0f, 3.0f}, {}, Vector3{1.0f}},
+        {{1.5f, 2.0f, 3.0f}, {}, Vector3{1.0f}},
+        {{1.5f, 2.0f, 4.0f}, {}, Vector3{1.0f}},
+    })), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTranslationsRotationsScalings3DInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene2D{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Translation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Vector2, nullptr}
+    }};
+    Trade::SceneData sceneNoParent{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Translation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Vector3, nullptr}
+    }};
+    /* A matrix transformation field alone isn't enough */
+    Trade::SceneData sceneNoTranslationRotationScaling{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    /* Object 1 has only a matrix, object 0 both */
+    const struct Data {
+        UnsignedInt object;
+        Int parent;
+        Vector3 translation;
+        Matrix4 transformation;
+    } data[]{
+        {0, -1, {1.0f, 2.0f, 3.0f}, Matrix4::translation({1.0f, 2.0f, 3.0f})},
+        {1, 0, {}, Matrix4::translation({0.5f, 0.0f, 0.0f})},
+    };
+    const Containers::StridedArrayView1D<const Data> view = data;
+    Trade::SceneData sceneTransformationOnly{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&Data::object),
+            view.slice(&Data::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            view.slice(&Data::object),
+            view.slice(&Data::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            view.slice(&Data::object).prefix(1),
+            view.slice(&Data::translation).prefix(1)},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::absoluteFieldTranslationsRotationsScalings3D(sceneNoParent, Trade::SceneField::Mesh);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3D(sceneNoParent, 1);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(sceneNoParent, Trade::SceneField::Mesh, Containers::ArrayView<Vector3>{}, Containers::ArrayView<Quaternion>{}, Containers::ArrayView<Vector3>{});
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(sceneNoParent, Trade::SceneField::Mesh, Containers::ArrayView<Matrix4>{});
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(sceneNoParent, Trade::SceneField::Mesh, Containers::ArrayView<Matrix4x3>{});
+    SceneTools::absoluteFieldTranslationsRotationsScalings3D(scene2D, 0);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(sceneNoParent, 1, Containers::ArrayView<Vector3>{}, Containers::ArrayView<Quaternion>{}, Containers::ArrayView<Vector3>{});
+    SceneTools::absoluteFieldTranslationsRotationsScalings3D(sceneNoParent, 0);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3D(sceneNoTranslationRotationScaling, 0);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3D(sceneTransformationOnly, 0);
+    CORRADE_COMPARE(out,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3D(): field Trade::SceneField::Mesh not found\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3D(): index 1 out of range for 1 fields\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): field Trade::SceneField::Mesh not found\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): field Trade::SceneField::Mesh not found\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): field Trade::SceneField::Mesh not found\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): the scene is not 3D\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): index 1 out of range for 1 fields\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): the scene has no hierarchy\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): the scene has no translation, rotation or scaling field\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): object 1 has a transformation matrix but no translation, rotation or scaling\n");
+}
+
+void HierarchyTest::absoluteFieldTranslationsRotationsScalings3DIntoInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene = translationRotationScalingScene();
+
+    Vector3 translations[5];
+    Quaternion rotations[4];
+    Vector3 scalings[5];
+    Matrix4 transformations[4];
+    Matrix4x3 transformationsAffine[6];
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, Trade::SceneField::Mesh, translations, rotations, scalings);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, 2, Containers::arrayView(translations).prefix(4), rotations, Containers::arrayView(scalings).prefix(4));
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, Trade::SceneField::Mesh, transformations);
+    SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(scene, 2, transformationsAffine);
+    CORRADE_COMPARE(out,
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): expected translation, rotation and scaling views to have the same size but got 5, 4 and 5\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): bad output size, expected 5 but got 4\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): bad output size, expected 5 but got 4\n"
+        "SceneTools::absoluteFieldTranslationsRotationsScalings3DInto(): bad output size, expected 5 but got 6\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::HierarchyTest)
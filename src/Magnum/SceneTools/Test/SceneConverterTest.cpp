@@ -348,6 +348,166 @@ const struct {
         "Mesh 0 fuzzy duplicate removal: 5 -> 4 vertices\n"
         "Mesh 1 fuzzy duplicate removal: 6 -> 4 vertices\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    {"one implicit mesh, generate tangents, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--generate-tangents", "-v",
+            "-I", "ObjImporter", "-C", "MeshBlobSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-normals-texcoords.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-tangents.mblob")
+        }},
+        "ObjImporter", nullptr, "MeshBlobSceneConverter", {}, nullptr,
+        /* Not checking the file, the vertex data size reported by the
+           converter is enough to verify a four-component tangent got added to
+           each of the four 32-byte vertices. The index data are 24 bytes, the
+           data are aligned to 4096 bytes by default. */
+        nullptr, nullptr,
+        "Trade::MeshBlobSceneConverter::endData(): saved 1 meshes with 216 bytes of index and vertex data into 8384 bytes\n"},
+    {"one implicit mesh, generate tangents, no normals", {InPlaceInit, {
+            "--generate-tangents",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* The mesh is passed through unchanged */
+        "quad.ply", nullptr,
+        "Mesh 0 is not a triangle mesh with normals and texture coordinates, skipping tangent generation\n"},
+    {"one implicit mesh, optimize vertex cache and fetch", {InPlaceInit, {
+            "--optimize-vertex-cache", "--optimize-vertex-fetch",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* The two triangles are already in the optimal order, so this
+           produces the same file */
+        "quad.ply", nullptr,
+        {}},
+    {"one implicit mesh, optimize vertex cache and fetch, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--optimize-vertex-cache", "--optimize-vertex-fetch", "-v",
+            "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        "quad.ply", nullptr,
+        "Mesh 0 vertex cache optimization: ACMR 2 -> 2, ATVR 1 -> 1\n"
+        "Mesh 0 vertex fetch optimization: 4 -> 4 vertices\n"},
+    {"one implicit mesh, optimize vertex cache and fetch, not indexed", {InPlaceInit, {
+            "--optimize-vertex-cache", "--optimize-vertex-fetch",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-strip.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-strip.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter", {}, nullptr,
+        /* Not checking either of the files, the warning output is enough to
+           verify */
+        nullptr, nullptr,
+        "Mesh 0 is not an indexed triangle mesh, skipping vertex cache optimization\n"
+        "Mesh 0 is not indexed, skipping vertex fetch optimization\n"},
+    {"one implicit mesh, simplify, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--simplify", "0.5", "-v",
+            "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* All quad vertices are on the border and collapsing any of them is
+           way over the default error, so nothing gets simplified. The
+           converter doesn't support mesh levels, so the original mesh is
+           written. */
+        "quad.ply", nullptr,
+        "Mesh 0 level 1 simplification: 6 -> 6 indices, 4 -> 4 vertices\n"
+        "Ignoring 1 levels of mesh 0 not supported by the converter\n"},
+    {"one implicit mesh, simplify with a custom error, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--simplify", "0.5", "--simplify-error", "1.0", "-v",
+            "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* With the error limit relaxed, one corner gets collapsed, with the
+           unused vertex removed by the vertex fetch optimization after */
+        "quad.ply", nullptr,
+        "Mesh 0 level 1 simplification: 6 -> 3 indices, 4 -> 3 vertices\n"
+        "Ignoring 1 levels of mesh 0 not supported by the converter\n"},
+    {"one implicit mesh, simplify, not indexed", {InPlaceInit, {
+            "--simplify", "0.5",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-strip.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-strip.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter", {}, nullptr,
+        /* Not checking either of the files, the warning output is enough to
+           verify */
+        nullptr, nullptr,
+        "Mesh 0 is not an indexed triangle mesh, skipping simplification\n"},
+    {"one mesh, simplify, no positions", {InPlaceInit, {
+            /* Picking just the normals */
+            "--mesh", "0", "--only-mesh-attributes", "1", "--simplify", "0.5",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-normals-texcoords.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-normals.gltf")
+        }},
+        "ObjImporter", nullptr, "GltfSceneConverter", {}, nullptr,
+        /* Not checking either of the files, the warning output is enough to
+           verify */
+        nullptr, nullptr,
+        "Mesh 0 has no positions, skipping simplification\n"},
+    {"one implicit mesh, quantize, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--quantize", "-v",
+            "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* The mesh has just positions, which are preserved, so this produces
+           the same file */
+        "quad.ply", nullptr,
+        "Mesh 0 quantization: 48 -> 48 bytes of vertex data\n"},
+    {"one implicit mesh, generate tangents, quantize, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--generate-tangents", "--quantize", "-v",
+            "-I", "ObjImporter", "-C", "MeshBlobSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-normals-texcoords.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-quantized.mblob")
+        }},
+        "ObjImporter", nullptr, "MeshBlobSceneConverter", {}, nullptr,
+        /* Not checking the file, the sizes are enough to verify. Each vertex
+           is a 12-byte position, a 6-byte per-component normal, 4-byte
+           texture coordinates and an 8-byte tangent, with the stride padded
+           from 30 to 32 bytes. */
+        nullptr, nullptr,
+        "Mesh 0 quantization: 192 -> 128 bytes of vertex data\n"
+        "Trade::MeshBlobSceneConverter::endData(): saved 1 meshes with 152 bytes of index and vertex data into 8320 bytes\n"},
+    {"one implicit mesh, generate tangents, quantize byte normals, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--generate-tangents", "--quantize", "--quantize-byte-normals", "-v",
+            "-I", "ObjImporter", "-C", "MeshBlobSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-normals-texcoords.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-quantized.mblob")
+        }},
+        "ObjImporter", nullptr, "MeshBlobSceneConverter", {}, nullptr,
+        /* Compared to above, the normal is 3 bytes, padded to 4 for the
+           texture coordinates, and the tangent 4 bytes */
+        nullptr, nullptr,
+        "Mesh 0 quantization: 192 -> 96 bytes of vertex data\n"
+        "Trade::MeshBlobSceneConverter::endData(): saved 1 meshes with 120 bytes of index and vertex data into 8288 bytes\n"},
+    {"one implicit mesh, quantize byte normals without quantize", {InPlaceInit, {
+            "--quantize-byte-normals",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* The option alone does nothing */
+        "quad.ply", nullptr,
+        {}},
     {"one implicit mesh, two converters", {InPlaceInit, {
             /* Unfortunately *have to* use an option to make the output
                predictable. Using --set instead of -c as in this case as we
@@ -25,8 +25,10 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Reference.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Arguments is std::string-free */
@@ -38,7 +40,12 @@
 #include "Magnum/MaterialTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/MeshTools/Quantize.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Simplify.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
@@ -185,8 +192,10 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [-M|--mesh-converter PLUGIN]... [--plugin-dir DIR]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
     [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
-    [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
-    [--remove-duplicate-materials]
+    [--remove-duplicate-vertices-fuzzy EPSILON] [--generate-tangents]
+    [--optimize-vertex-cache] [--optimize-vertex-fetch] [--simplify RATIO]...
+    [--simplify-error ERROR] [--quantize] [--quantize-byte-normals]
+    [--phong-to-pbr] [--remove-duplicate-materials]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
@@ -229,6 +238,23 @@ Arguments:
 -   `--remove-duplicate-vertices-fuzzy EPSILON` --- remove duplicate vertices
     using @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double)
     in all meshes after import
+-   `--generate-tangents` --- generate tangents for triangle meshes with
+    normals and texture coordinates using
+    @ref MeshTools::generateTangents(const Trade::MeshData&) after import
+-   `--optimize-vertex-cache` --- optimize indexed triangle meshes for
+    post-transform vertex cache using
+    @ref MeshTools::optimizeVertexCache() after import
+-   `--optimize-vertex-fetch` --- renumber vertices of indexed meshes in order
+    of first use using @ref MeshTools::optimizeVertexFetch() after import
+-   `--simplify RATIO` --- generate an additional mesh level with given target
+    index count ratio using @ref MeshTools::simplify(); can be specified
+    multiple times
+-   `--simplify-error ERROR` --- max error for `--simplify`, relative to the
+    mesh bounding box size (default: `0.01`)
+-   `--quantize` --- quantize mesh attributes to compact vertex formats using
+    @ref MeshTools::quantize() before passing them to the scene converter
+-   `--quantize-byte-normals` --- use 8-bit normals and tangents for
+    `--quantize` instead of 16-bit
 -   `--phong-to-pbr` --- convert Phong materials to PBR metallic/roughness
     using @ref MaterialTools::phongToPbrMetallicRoughness()
 -   `--remove-duplicate-materials` --- remove duplicate materials using
@@ -314,17 +340,56 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no `-P` / `-M` is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The `--remove-duplicate-vertices`, `--phong-to-pbr` and
+The `--remove-duplicate-vertices`, `--generate-tangents`,
+`--optimize-vertex-cache`, `--optimize-vertex-fetch`, `--phong-to-pbr` and
 `--remove-duplicate-materials` operations are performed on meshes and materials
-before passing them to any converter.
+before passing them to any converter, in this order. Meshes that aren't indexed
+are passed through the vertex cache and fetch optimization unchanged, as are
+non-triangle meshes through the vertex cache optimization and meshes without
+normals or texture coordinates through the tangent generation. Meshes with an
+implementation-specific index type are passed through both optimizations
+unchanged as well, and meshes with implementation-specific vertex formats
+through the vertex fetch optimization and the tangent generation. With `-v`,
+the vertex cache optimization prints the average cache miss ratio (ACMR) and
+average transformed vertex ratio (ATVR) before and after, calculated with
+@ref MeshTools::simulateVertexCache() for a 16-entry FIFO cache.
+
+Each `--simplify` option produces one additional level of every indexed
+triangle mesh with positions, simplified from the original mesh with
+@ref MeshTools::simplify() and then passed through
+@ref MeshTools::optimizeVertexFetch(). The levels are passed to the scene
+converter together with the original mesh if it supports
+@ref Trade::SceneContent::MeshLevels, otherwise they're ignored with a warning.
+Other meshes, and meshes with implementation-specific index types or vertex
+formats, get no levels and a warning is printed for them. The simplification
+stops earlier if a collapse would introduce an error larger than
+`--simplify-error`, so the resulting index count may be larger than requested.
+With `-v`, the resulting index and vertex count for each level is printed.
+
+The `--quantize` option is applied as the last step on every mesh and every
+level generated by `--simplify`. Normals, tangents, texture coordinates and
+colors are converted to normalized 8- or 16-bit or half-float formats and all
+attributes are packed together, aligned to their component size. Positions are
+currently left in their original format, as the dequantization transformation
+returned by @ref MeshTools::quantize() can't be propagated to the scene yet.
+Normals are quantized per component with
+@ref MeshTools::QuantizeFlag::PerComponentNormals, as octahedral-encoded
+normals can't be represented in common file formats such as glTF. Meshes with
+implementation-specific index types or vertex formats are skipped with a
+warning. With `-v`, the vertex data size before and after is printed.
 
 If `--concatenate-meshes` is given, all meshes of the input file are
-first concatenated into a single mesh using @ref MeshTools::concatenate(), with
+first concatenated into a single mesh using @ref MeshTools::Concatenator, with
 the scene hierarchy transformation baked in using
 @ref SceneTools::absoluteFieldTransformations3D(), and then passed through the
-remaining operations. Only attributes that are present in the first mesh are
-taken, if `--only-mesh-attributes` is specified as well, the IDs reference
-attributes of the first mesh.
+remaining operations. Each transformed mesh is discarded right after being
+added, so only the imported meshes and the concatenated output are in memory
+at the same time. As all meshes are known upfront in that case, the output is
+allocated with the total size right away. If the file has no scene, only the
+concatenated output and the mesh being currently added are in memory and the
+output grows as the meshes are added. Only attributes that are present in the
+first mesh are taken, if `--only-mesh-attributes` is specified as well, the
+IDs reference attributes of the first mesh.
 */
 
 }
@@ -354,6 +419,17 @@ bool isDataInfoRequested(const Utility::Arguments& args) {
            args.isSet("info");
 }
 
+/* The MeshTools algorithms can't operate on data they don't know the layout
+   of, so meshes with such formats are skipped with a warning instead */
+bool hasImplementationSpecificFormats(const Trade::MeshData& mesh) {
+    if(mesh.isIndexed() && isMeshIndexTypeImplementationSpecific(mesh.indexType()))
+        return true;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        if(isVertexFormatImplementationSpecific(mesh.attributeFormat(i)))
+            return true;
+    return false;
+}
+
 template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
     const bool passthroughOnConversionFailure = args.isSet("passthrough-on-image-converter-failure");
 
@@ -437,6 +513,13 @@ int main(int argc, char** argv) {
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
+        .addBooleanOption("generate-tangents").setHelp("generate-tangents", "generate tangents for triangle meshes with normals and texture coordinates after import")
+        .addBooleanOption("optimize-vertex-cache").setHelp("optimize-vertex-cache", "optimize indexed triangle meshes for post-transform vertex cache after import")
+        .addBooleanOption("optimize-vertex-fetch").setHelp("optimize-vertex-fetch", "renumber vertices of indexed meshes in order of first use after import")
+        .addArrayOption("simplify").setHelp("simplify", "generate an additional mesh level with given target index count ratio, can be specified multiple times", "RATIO")
+        .addOption("simplify-error", "0.01").setHelp("simplify-error", "max error for --simplify, relative to the mesh bounding box size", "ERROR")
+        .addBooleanOption("quantize").setHelp("quantize", "quantize mesh attributes to compact vertex formats before passing them to the converter")
+        .addBooleanOption("quantize-byte-normals").setHelp("quantize-byte-normals", "use 8-bit normals and tangents for --quantize instead of 16-bit")
         .addBooleanOption("phong-to-pbr").setHelp("phong-to-pbr", "convert Phong materials to PBR metallic/roughness")
         .addBooleanOption("remove-duplicate-materials").setHelp("remove-duplicate-materials", "remove duplicate materials")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
@@ -517,9 +600,33 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no -P / -M is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The --remove-duplicate-vertices, --phong-to-pbr and
---remove-duplicate-materials operations are performed on meshes and materials
-before passing them to any converter.
+The --remove-duplicate-vertices, --generate-tangents, --optimize-vertex-cache,
+--optimize-vertex-fetch, --phong-to-pbr and --remove-duplicate-materials
+operations are performed on meshes and materials before passing them to any
+converter, in this order. Meshes that aren't indexed are passed through the
+vertex cache and fetch optimization unchanged, as are non-triangle meshes
+through the vertex cache optimization and meshes without normals or texture
+coordinates through the tangent generation. Meshes with an
+implementation-specific index type are passed through both optimizations
+unchanged as well, and meshes with implementation-specific vertex formats
+through the vertex fetch optimization and the tangent generation.
+
+Each --simplify option produces one additional level of every indexed triangle
+mesh with positions, passed to the scene converter together with the original
+mesh if it supports mesh levels. Meshes with implementation-specific index
+types or vertex formats are skipped with a warning. The simplification stops
+earlier if a collapse would introduce an error larger than --simplify-error, so
+the resulting index count may be larger than requested.
+
+The --quantize option is applied as the last step on every mesh and every level
+generated by --simplify. Normals, tangents, texture coordinates and colors are
+converted to normalized 8- or 16-bit or half-float formats and all attributes
+are packed together, aligned to their component size. Positions are currently
+left in their original format, as the dequantization transformation can't be
+propagated to the scene yet. Normals are quantized per component, as
+octahedral-encoded normals can't be represented in common file formats such as
+glTF. Meshes with implementation-specific index types or vertex formats are
+skipped with a warning.
 
 If --concatenate-meshes is given, all meshes of the input file are first
 concatenated into a single mesh, with the scene hierarchy transformation baked
@@ -833,24 +940,32 @@ well, the IDs reference attributes of the first mesh.)")
                 return 1;
             }
 
-            Containers::Array<Trade::MeshData> meshes;
-            arrayReserve(meshes, importer->meshCount());
-            /** @todo handle mesh levels here, once any plugin is capable of
-                importing them */
-            for(std::size_t i = 0, iMax = importer->meshCount(); i != iMax; ++i) {
-                Trade::Implementation::Duration d{importConversionTime};
-                Containers::Optional<Trade::MeshData> meshToConcatenate = importer->mesh(i);
-                if(!meshToConcatenate) {
-                    Error{} << "Cannot import mesh" << i;
-                    return 1;
-                }
-
-                arrayAppend(meshes, *Utility::move(meshToConcatenate));
-            }
+            /* The meshes are added to the concatenator one by one, so the
+               input and the output don't need to be in memory at the same
+               time. The concatenator is created from the first mesh added,
+               as the transformation below may change the layout. */
+            Containers::Optional<MeshTools::Concatenator> concatenator;
 
-            /* If there's a scene, use it to flatten mesh hierarchy. If not,
-               assume all meshes are in the root. */
+            /* If there's a scene, use it to flatten mesh hierarchy. As each
+               mesh can be referenced by the scene multiple times, all of them
+               have to be imported upfront, but the transformed copies are
+               added to the concatenator and discarded again right after. */
             if(importer->defaultScene() != -1 || importer->sceneCount()) {
+                Containers::Array<Trade::MeshData> meshes;
+                arrayReserve(meshes, importer->meshCount());
+                /** @todo handle mesh levels here, once any plugin is capable
+                    of importing them */
+                for(std::size_t i = 0, iMax = importer->meshCount(); i != iMax; ++i) {
+                    Trade::Implementation::Duration d{importConversionTime};
+                    Containers::Optional<Trade::MeshData> meshToConcatenate = importer->mesh(i);
+                    if(!meshToConcatenate) {
+                        Error{} << "Cannot import mesh" << i;
+                        return 1;
+                    }
+
+                    arrayAppend(meshes, *Utility::move(meshToConcatenate));
+                }
+
                 Containers::Optional<Trade::SceneData> scene;
                 {
                     /** @todo once the required SceneTools APIs exist, rework
@@ -870,24 +985,85 @@ well, the IDs reference attributes of the first mesh.)")
                     meshesMaterials = scene->meshesMaterialsAsArray();
                 Containers::Array<Matrix4> transformations =
                     SceneTools::absoluteFieldTransformations3D(*scene, Trade::SceneField::Mesh);
-                Containers::Array<Trade::MeshData> flattenedMeshes;
+
+                /* All meshes are known at this point, so calculate the total
+                   output size to reserve it upfront. Same as in
+                   Concatenator::add(), if any mesh is indexed, the
+                   non-indexed ones get a trivial index buffer. */
+                bool anyIndexed = false;
+                for(const auto& meshMaterial: meshesMaterials)
+                    anyIndexed = anyIndexed || meshes[meshMaterial.second().first()].isIndexed();
+                UnsignedInt totalIndexCount = 0, totalVertexCount = 0;
+                for(const auto& meshMaterial: meshesMaterials) {
+                    const Trade::MeshData& meshToConcatenate = meshes[meshMaterial.second().first()];
+                    if(anyIndexed) totalIndexCount += meshToConcatenate.isIndexed() ? meshToConcatenate.indexCount() : meshToConcatenate.vertexCount();
+                    totalVertexCount += meshToConcatenate.vertexCount();
+                }
+
                 {
                     Trade::Implementation::Duration d{conversionTime};
                     /** @todo once there are 2D scenes, check the scene is 3D */
+                    /** @todo this will assert if the meshes have incompatible
+                        primitives (such as some triangles, some lines), or if
+                        they have loops/strips/fans -- handle that
+                        explicitly */
                     for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
-                        arrayAppend(flattenedMeshes, MeshTools::transform3D(
-                            meshes[meshesMaterials[i].second().first()], transformations[i]));
+                        const Trade::MeshData transformed = MeshTools::transform3D(
+                            meshes[meshesMaterials[i].second().first()], transformations[i]);
+                        if(!concatenator) {
+                            concatenator.emplace(transformed);
+                            concatenator->reserve(totalIndexCount, totalVertexCount);
+                        }
+                        concatenator->add(transformed);
                     }
                 }
-                meshes = Utility::move(flattenedMeshes);
+
+            /* If not, assume all meshes are in the root and add them as they
+               get imported */
+            } else {
+                /** @todo handle mesh levels here, once any plugin is capable
+                    of importing them */
+                for(std::size_t i = 0, iMax = importer->meshCount(); i != iMax; ++i) {
+                    Containers::Optional<Trade::MeshData> meshToConcatenate;
+                    {
+                        Trade::Implementation::Duration d{importConversionTime};
+                        if(!(meshToConcatenate = importer->mesh(i))) {
+                            Error{} << "Cannot import mesh" << i;
+                            return 1;
+                        }
+                    }
+
+                    Trade::Implementation::Duration d{conversionTime};
+                    if(!concatenator) concatenator.emplace(*meshToConcatenate);
+                    concatenator->add(*meshToConcatenate);
+                }
+            }
+
+            if(!concatenator) {
+                Error{} << "No meshes referenced from the scene in" << args.value("input");
+                return 1;
             }
 
             {
                 Trade::Implementation::Duration d{conversionTime};
-                /** @todo this will assert if the meshes have incompatible primitives
-                    (such as some triangles, some lines), or if they have
-                    loops/strips/fans -- handle that explicitly */
-                mesh = MeshTools::concatenate(meshes);
+                mesh = concatenator->release();
+
+                /* Without a scene the meshes are imported one by one and the
+                   total size isn't known upfront, so the output arrays got
+                   grown as needed and can be larger than the actual data. In
+                   that case copy just the used prefix to not have the unused
+                   suffix written to the output as well. */
+                const std::size_t indexDataSize = mesh->isIndexed() ? mesh->indexCount()*sizeof(UnsignedInt) : 0;
+                const std::size_t vertexDataSize = mesh->attributeCount() ? std::size_t(mesh->vertexCount())*concatenator->vertexStride() : 0;
+                if(mesh->indexData().size() != indexDataSize || mesh->vertexData().size() != vertexDataSize) {
+                    Trade::MeshIndexData indices;
+                    if(mesh->isIndexed())
+                        indices = Trade::MeshIndexData{mesh->indices()};
+                    mesh = MeshTools::copy(Trade::MeshData{mesh->primitive(),
+                        {}, mesh->indexData().prefix(indexDataSize), indices,
+                        {}, mesh->vertexData().prefix(vertexDataSize), Trade::meshAttributeDataNonOwningArray(mesh->attributeData()),
+                        mesh->vertexCount()});
+                }
             }
 
         /* Otherwise import just one */
@@ -1032,13 +1208,22 @@ well, the IDs reference attributes of the first mesh.)")
     /* Operations to perform on all meshes in the importer. If there are any,
        meshes are supplied manually to the converter from the array below. */
     Containers::Array<Trade::MeshData> meshes;
+    /* Additional levels for each mesh in the above array, generated by
+       --simplify. Empty if there are none. */
+    Containers::Array<Containers::Array<Trade::MeshData>> meshLevels;
     if(args.isSet("remove-duplicate-vertices") ||
        args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
+       args.isSet("generate-tangents") ||
+       args.isSet("optimize-vertex-cache") ||
+       args.isSet("optimize-vertex-fetch") ||
+       args.arrayValueCount("simplify") ||
+       args.isSet("quantize") ||
        args.arrayValueCount("mesh-converter"))
     {
         const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
 
         arrayReserve(meshes, importer->meshCount());
+        arrayReserve(meshLevels, importer->meshCount());
 
         for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
             Containers::Optional<Trade::MeshData> mesh;
@@ -1083,6 +1268,79 @@ well, the IDs reference attributes of the first mesh.)")
                 }
             }
 
+            /* Tangent generation. Done after duplicate removal so the
+               tangents get averaged across vertices that were duplicates. */
+            if(args.isSet("generate-tangents")) {
+                if(mesh->primitive() != MeshPrimitive::Triangles ||
+                   !mesh->hasAttribute(Trade::MeshAttribute::Position) ||
+                   !mesh->hasAttribute(Trade::MeshAttribute::Normal) ||
+                   !mesh->hasAttribute(Trade::MeshAttribute::TextureCoordinates))
+                {
+                    Warning{} << "Mesh" << i << "is not a triangle mesh with normals and texture coordinates, skipping tangent generation";
+                } else if(hasImplementationSpecificFormats(*mesh)) {
+                    Warning{} << "Mesh" << i << "has an implementation-specific index type or vertex format, skipping tangent generation";
+                } else {
+                    Trade::Implementation::Duration d{conversionTime};
+                    mesh = MeshTools::generateTangents(*mesh);
+                }
+            }
+
+            /* Vertex cache optimization, done before the fetch optimization
+               as that one then follows the new triangle order */
+            if(args.isSet("optimize-vertex-cache")) {
+                if(!mesh->isIndexed() || mesh->primitive() != MeshPrimitive::Triangles) {
+                    Warning{} << "Mesh" << i << "is not an indexed triangle mesh, skipping vertex cache optimization";
+                } else if(isMeshIndexTypeImplementationSpecific(mesh->indexType())) {
+                    Warning{} << "Mesh" << i << "has an implementation-specific index type, skipping vertex cache optimization";
+                } else {
+                    /* The optimizer itself doesn't depend on any particular
+                       cache size, 16 is just a reasonable value to report the
+                       stats for */
+                    Containers::Pair<Float, Float> before;
+                    if(args.isSet("verbose"))
+                        before = MeshTools::simulateVertexCache(mesh->indices(), mesh->vertexCount(), 16);
+
+                    {
+                        Trade::Implementation::Duration d{conversionTime};
+                        mesh = MeshTools::optimizeVertexCache(*Utility::move(mesh));
+                    }
+
+                    if(args.isSet("verbose")) {
+                        const Containers::Pair<Float, Float> after = MeshTools::simulateVertexCache(mesh->indices(), mesh->vertexCount(), 16);
+                        Debug d;
+                        if(singleMesh)
+                            d << "Vertex cache optimization:";
+                        else
+                            d << "Mesh" << i << "vertex cache optimization:";
+                        d << "ACMR" << before.first() << "->" << after.first() << Debug::nospace << ", ATVR" << before.second() << "->" << after.second();
+                    }
+                }
+            }
+
+            /* Vertex fetch optimization */
+            if(args.isSet("optimize-vertex-fetch")) {
+                if(!mesh->isIndexed()) {
+                    Warning{} << "Mesh" << i << "is not indexed, skipping vertex fetch optimization";
+                } else if(hasImplementationSpecificFormats(*mesh)) {
+                    Warning{} << "Mesh" << i << "has an implementation-specific index type or vertex format, skipping vertex fetch optimization";
+                } else {
+                    const UnsignedInt beforeVertexCount = mesh->vertexCount();
+                    {
+                        Trade::Implementation::Duration d{conversionTime};
+                        mesh = MeshTools::optimizeVertexFetch(*mesh);
+                    }
+
+                    if(args.isSet("verbose")) {
+                        Debug d;
+                        if(singleMesh)
+                            d << "Vertex fetch optimization:";
+                        else
+                            d << "Mesh" << i << "vertex fetch optimization:";
+                        d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
+                    }
+                }
+            }
+
             /* Arbitrary mesh converters */
             for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
                 const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
@@ -1123,7 +1381,78 @@ well, the IDs reference attributes of the first mesh.)")
                 }
             }
 
+            /* Simplified mesh levels, each generated from the final mesh
+               and not from the previous level to not accumulate the error */
+            Containers::Array<Trade::MeshData> levels;
+            if(const std::size_t simplifyCount = args.arrayValueCount("simplify")) {
+                if(mesh->primitive() != MeshPrimitive::Triangles || !mesh->isIndexed()) {
+                    Warning{} << "Mesh" << i << "is not an indexed triangle mesh, skipping simplification";
+                } else if(!mesh->hasAttribute(Trade::MeshAttribute::Position)) {
+                    Warning{} << "Mesh" << i << "has no positions, skipping simplification";
+                } else if(hasImplementationSpecificFormats(*mesh)) {
+                    Warning{} << "Mesh" << i << "has an implementation-specific index type or vertex format, skipping simplification";
+                } else for(std::size_t j = 0; j != simplifyCount; ++j) {
+                    const Float ratio = args.arrayValue<Float>("simplify", j);
+                    if(!(ratio >= 0.0f && ratio <= 1.0f)) {
+                        Error{} << "Invalid --simplify ratio" << ratio << Debug::nospace << ", expected a value between 0 and 1";
+                        return 1;
+                    }
+
+                    Containers::Optional<Trade::MeshData> level;
+                    {
+                        Trade::Implementation::Duration d{conversionTime};
+                        level = MeshTools::optimizeVertexFetch(MeshTools::simplify(*mesh, ratio, args.value<Float>("simplify-error")));
+                    }
+
+                    if(args.isSet("verbose")) {
+                        Debug d;
+                        if(singleMesh)
+                            d << "Level" << j + 1 << "simplification:";
+                        else
+                            d << "Mesh" << i << "level" << j + 1 << "simplification:";
+                        d << mesh->indexCount() << "->" << level->indexCount() << "indices," << mesh->vertexCount() << "->" << level->vertexCount() << "vertices";
+                    }
+
+                    arrayAppend(levels, *Utility::move(level));
+                }
+            }
+
+            /* Quantization, done last so all operations above work with the
+               original precision. Positions are preserved as there's
+               currently no way to put the dequantization transformation into
+               the output, normals are quantized per component as glTF and
+               other formats can't store octahedral normals. */
+            /** @todo apply the transformation to objects referencing the mesh
+                once there's an API to add a new object to a scene */
+            if(args.isSet("quantize")) {
+                if(hasImplementationSpecificFormats(*mesh)) {
+                    Warning{} << "Mesh" << i << "has an implementation-specific index type or vertex format, skipping quantization";
+                } else {
+                    MeshTools::QuantizeFlags flags = MeshTools::QuantizeFlag::PreservePositions|MeshTools::QuantizeFlag::PerComponentNormals;
+                    if(args.isSet("quantize-byte-normals"))
+                        flags |= MeshTools::QuantizeFlag::ByteNormals;
+
+                    const std::size_t beforeVertexDataSize = mesh->vertexData().size();
+                    {
+                        Trade::Implementation::Duration d{conversionTime};
+                        mesh = MeshTools::quantize(*mesh, flags).first();
+                        for(Trade::MeshData& level: levels)
+                            level = MeshTools::quantize(level, flags).first();
+                    }
+
+                    if(args.isSet("verbose")) {
+                        Debug d;
+                        if(singleMesh)
+                            d << "Quantization:";
+                        else
+                            d << "Mesh" << i << "quantization:";
+                        d << beforeVertexDataSize << "->" << mesh->vertexData().size() << "bytes of vertex data";
+                    }
+                }
+            }
+
             arrayAppend(meshes, *Utility::move(mesh));
+            arrayAppend(meshLevels, Utility::move(levels));
         }
     }
 
@@ -1342,7 +1671,27 @@ well, the IDs reference attributes of the first mesh.)")
                     }
                 }
 
-                if(!converter->add(mesh, contents & Trade::SceneContent::Names ? importer->meshName(j) : Containers::String{})) {
+                const Containers::String name = contents & Trade::SceneContent::Names ? importer->meshName(j) : Containers::String{};
+
+                /* If there are simplified levels for this mesh, add them
+                   together with the original, if the converter can take
+                   them */
+                if(meshLevels[j] && !(Trade::sceneContentsFor(*converter) & Trade::SceneContent::MeshLevels)) {
+                    Warning{} << "Ignoring" << meshLevels[j].size() << "levels of mesh" << j << "not supported by the converter";
+                } else if(meshLevels[j]) {
+                    Containers::Array<Containers::Reference<const Trade::MeshData>> levels;
+                    arrayReserve(levels, meshLevels[j].size() + 1);
+                    arrayAppend(levels, mesh);
+                    for(const Trade::MeshData& level: meshLevels[j])
+                        arrayAppend(levels, level);
+                    if(!converter->add(Containers::Iterable<const Trade::MeshData>{levels}, name)) {
+                        Error{} << "Cannot add mesh" << j;
+                        return 1;
+                    }
+                    continue;
+                }
+
+                if(!converter->add(mesh, name)) {
                     Error{} << "Cannot add mesh" << j;
                     return 1;
                 }
@@ -1360,6 +1709,7 @@ well, the IDs reference attributes of the first mesh.)")
                 that each change the output to verify the old meshes don't get
                 reused in the next step again */
             meshes = {};
+            meshLevels = {};
         }
 
         /* If there are any loose materials from previous conversion steps, add
@@ -0,0 +1,198 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Executor.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ExecutorTest: TestSuite::Tester {
+    explicit ExecutorTest();
+
+    void constructDefault();
+    void construct();
+    void constructNullFunction();
+
+    void runSerial();
+    void run();
+    void runFunctor();
+    void runFunctorConst();
+    void runZeroTasks();
+};
+
+ExecutorTest::ExecutorTest() {
+    addTests({&ExecutorTest::constructDefault,
+              &ExecutorTest::construct,
+              &ExecutorTest::constructNullFunction,
+
+              &ExecutorTest::runSerial,
+              &ExecutorTest::run,
+              &ExecutorTest::runFunctor,
+              &ExecutorTest::runFunctorConst,
+              &ExecutorTest::runZeroTasks});
+}
+
+/* Runs the tasks in reverse order to verify the order isn't relied upon,
+   recording the count and user data */
+struct ReverseState {
+    std::size_t calls;
+    std::size_t count;
+};
+void reverseExecutor(Executor::Task task, std::size_t count, void* state, void* userData) {
+    ReverseState& reverseState = *static_cast<ReverseState*>(userData);
+    ++reverseState.calls;
+    reverseState.count = count;
+    for(std::size_t i = count; i != 0; --i)
+        task(i - 1, state);
+}
+
+void ExecutorTest::constructDefault() {
+    constexpr Executor a;
+    constexpr Executor b{};
+    CORRADE_VERIFY(a.isSerial());
+    CORRADE_VERIFY(b.isSerial());
+    CORRADE_VERIFY(!a.function());
+    CORRADE_COMPARE(a.userData(), nullptr);
+
+    constexpr bool isSerial = a.isSerial();
+    CORRADE_VERIFY(isSerial);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<Executor>::value);
+}
+
+void ExecutorTest::construct() {
+    int userData;
+    Executor a{reverseExecutor, &userData};
+    CORRADE_VERIFY(!a.isSerial());
+    CORRADE_VERIFY(a.function() == reverseExecutor);
+    CORRADE_COMPARE(a.userData(), &userData);
+
+    constexpr Executor b{reverseExecutor};
+    constexpr bool isSerial = b.isSerial();
+    CORRADE_VERIFY(!isSerial);
+    CORRADE_COMPARE(b.userData(), nullptr);
+
+    /* Implicit construction from a function pointer isn't allowed */
+    CORRADE_VERIFY(!std::is_convertible<Executor::Function, Executor>::value);
+}
+
+void ExecutorTest::constructNullFunction() {
+    Executor a{nullptr};
+    CORRADE_VERIFY(a.isSerial());
+}
+
+void ExecutorTest::runSerial() {
+    Containers::Array<std::size_t> order{ValueInit, 5};
+    struct State {
+        Containers::Array<std::size_t>& order;
+        std::size_t next;
+    } state{order, 0};
+
+    Executor{}(5, [](std::size_t id, void* state) {
+        State& s = *static_cast<State*>(state);
+        s.order[s.next++] = id;
+    }, &state);
+
+    /* The serial executor runs the tasks in order */
+    CORRADE_COMPARE_AS(order, Containers::arrayView<std::size_t>({
+        0, 1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+}
+
+void ExecutorTest::run() {
+    Containers::Array<std::size_t> order{ValueInit, 5};
+    struct State {
+        Containers::Array<std::size_t>& order;
+        std::size_t next;
+    } state{order, 0};
+
+    ReverseState reverseState{};
+    Executor{reverseExecutor, &reverseState}(5, [](std::size_t id, void* state) {
+        State& s = *static_cast<State*>(state);
+        s.order[s.next++] = id;
+    }, &state);
+
+    /* The executor function is called once, with the task count and user
+       data passed through */
+    CORRADE_COMPARE(reverseState.calls, 1);
+    CORRADE_COMPARE(reverseState.count, 5);
+    CORRADE_COMPARE_AS(order, Containers::arrayView<std::size_t>({
+        4, 3, 2, 1, 0
+    }), TestSuite::Compare::Container);
+}
+
+void ExecutorTest::runFunctor() {
+    Containers::Array<std::size_t> values{ValueInit, 5};
+
+    ReverseState reverseState{};
+    Executor{reverseExecutor, &reverseState}(5, [&](std::size_t id) {
+        values[id] = id*10;
+    });
+
+    CORRADE_COMPARE(reverseState.calls, 1);
+    CORRADE_COMPARE_AS(values, Containers::arrayView<std::size_t>({
+        0, 10, 20, 30, 40
+    }), TestSuite::Compare::Container);
+}
+
+void ExecutorTest::runFunctorConst() {
+    Containers::Array<std::size_t> values{ValueInit, 3};
+
+    struct Functor {
+        void operator()(std::size_t id) const {
+            values[id] = id + 1;
+        }
+
+        Containers::Array<std::size_t>& values;
+    };
+    const Functor functor{values};
+
+    Executor{}(3, functor);
+    CORRADE_COMPARE_AS(values, Containers::arrayView<std::size_t>({
+        1, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void ExecutorTest::runZeroTasks() {
+    std::size_t calls = 0;
+    Executor{}(0, [&](std::size_t) { ++calls; });
+    CORRADE_COMPARE(calls, 0);
+
+    /* The executor function gets called even with zero tasks, it's up to it
+       to handle that */
+    ReverseState reverseState{};
+    Executor{reverseExecutor, &reverseState}(0, [&](std::size_t) { ++calls; });
+    CORRADE_COMPARE(reverseState.calls, 1);
+    CORRADE_COMPARE(reverseState.count, 0);
+    CORRADE_COMPARE(calls, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ExecutorTest)
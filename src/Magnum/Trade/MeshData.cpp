@@ -865,7 +865,18 @@ void MeshData::normalsInto(const Containers::StridedArrayView1D<Vector3>& destin
     const MeshAttributeData& attribute = _attributes[attributeId];
     CORRADE_ASSERT(!isVertexFormatImplementationSpecific(attribute._format),
         "Trade::MeshData::normalsInto(): can't extract data out of an implementation-specific vertex format" << Debug::hex << vertexFormatUnwrap(attribute._format), );
-    tangentsOrNormalsInto(attributeDataViewInternal(attribute), destination, attribute._format);
+
+    /* Octahedral-encoded normals get decoded, other formats are
+       copied/unpacked directly */
+    const Containers::StridedArrayView1D<const void> attributeData = attributeDataViewInternal(attribute);
+    const auto destination3f = Containers::arrayCast<2, Float>(destination);
+    if(attribute._format == VertexFormat::Vector2)
+        Math::unpackOctahedralInto(Containers::arrayCast<2, const Float>(attributeData, 2), destination3f);
+    else if(attribute._format == VertexFormat::Vector2bNormalized)
+        Math::unpackOctahedralInto(Containers::arrayCast<2, const Byte>(attributeData, 2), destination3f);
+    else if(attribute._format == VertexFormat::Vector2sNormalized)
+        Math::unpackOctahedralInto(Containers::arrayCast<2, const Short>(attributeData, 2), destination3f);
+    else tangentsOrNormalsInto(attributeData, destination, attribute._format);
 }
 
 Containers::Array<Vector3> MeshData::normalsAsArray(const UnsignedInt id, const Int morphTargetId) const {
@@ -135,7 +135,14 @@ enum class MeshAttribute: UnsignedShort {
      * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized or
      * @ref VertexFormat::Vector3sNormalized. Corresponds to
      * @ref Shaders::GenericGL::Normal.
-     * @see @ref MeshData::normalsAsArray()
+     *
+     * @m_since_latest The type can be also @ref VertexFormat::Vector2,
+     * @ref VertexFormat::Vector2bNormalized or
+     * @ref VertexFormat::Vector2sNormalized, in which case the normal is
+     * octahedral-encoded as described in @ref Math::packOctahedral().
+     * Such normals are transparently decoded by @ref MeshData::normalsAsArray()
+     * but can't be directly used by the builtin shaders.
+     * @see @ref MeshData::normalsAsArray(), @ref Math::packOctahedralInto()
      */
     Normal,
 
@@ -934,7 +941,7 @@ constraints explicitly before passing the values over.
 @snippet Trade.cpp MeshData-special-layouts
 
 In order to convert a mesh with a special data layout to something the GPU
-vertex pipeline is able to consume, @ref MeshTools::interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags) "MeshTools::interleave()"
+vertex pipeline is able to consume, @ref MeshTools::interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags, const Executor&) "MeshTools::interleave()"
 can be used. If you pass neither @ref MeshTools::InterleaveFlag::PreserveInterleavedAttributes
 nor @ref MeshTools::InterleaveFlag::PreserveStridedIndices, it will interleave
 all attributes together, regardless of what stride they had originally, and
@@ -2084,6 +2091,8 @@ class MAGNUM_TRADE_EXPORT MeshData {
          * newly-allocated array. Expects that the vertex format is *not*
          * implementation-specific, in that case you can only access the
          * attribute via the typeless @ref attribute(MeshAttribute, UnsignedInt, Int) const.
+         * Octahedral-encoded two-component normals are decoded using
+         * @ref Math::unpackOctahedralInto().
          * @see @ref normalsInto(), @ref tangentsAsArray(),
          *      @ref bitangentsAsArray(), @ref attributeFormat(),
          *      @ref isVertexFormatImplementationSpecific()
@@ -2606,6 +2615,11 @@ namespace Implementation {
                  format == VertexFormat::Vector3h ||
                  format == VertexFormat::Vector3bNormalized ||
                  format == VertexFormat::Vector3sNormalized)) ||
+            /* Octahedral-encoded normals */
+            (name == MeshAttribute::Normal &&
+                (format == VertexFormat::Vector2 ||
+                 format == VertexFormat::Vector2bNormalized ||
+                 format == VertexFormat::Vector2sNormalized)) ||
             (name == MeshAttribute::Color &&
                 (format == VertexFormat::Vector3 ||
                  format == VertexFormat::Vector3h ||
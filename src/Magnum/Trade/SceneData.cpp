@@ -1215,6 +1215,20 @@ template<class T> std::size_t findObject(const SceneFieldFlags flags, const Cont
 }
 
 std::size_t SceneData::findFieldObjectOffsetInternal(const SceneFieldData& field, const UnsignedLong object, const std::size_t offset) const {
+    /* If there's an index for this field, go through offsets for this object,
+       which are in an ascending order. The field is always one of _fields,
+       so the ID can be calculated from the pointer. */
+    if(!_objectIndexOffsets.isEmpty()) {
+        const std::size_t indexOffset = _objectIndexOffsets[&field - _fields.data()];
+        if(indexOffset != ~std::size_t{}) {
+            const UnsignedInt* const index = _objectIndex.data() + indexOffset;
+            const UnsignedInt* const entries = index + _mappingBound + 1;
+            for(UnsignedInt i = index[object], end = index[object + 1]; i != end; ++i)
+                if(entries[i] >= offset) return entries[i];
+            return field._size;
+        }
+    }
+
     const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field, offset, field._size - offset);
     const SceneMappingType mappingType = field.mappingType();
     if(mappingType == SceneMappingType::UnsignedInt)
@@ -1314,6 +1328,100 @@ bool SceneData::hasFieldObject(const SceneField fieldName, const UnsignedLong ob
     return findFieldObjectOffsetInternal(field, object, 0) != field._size;
 }
 
+namespace {
+
+/* Stable counting sort of `values` by `keys` into a CSR layout. The `out`
+   array is expected to be zero-initialized and have space for `keyCount + 1`
+   begin offsets followed by `keys.size()` values, keys that are out of range
+   are skipped. If `values` are empty, the value is the position in `keys`. */
+void buildObjectIndexCsr(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView1D<const UnsignedInt>& values, const std::size_t keyCount, const Containers::ArrayView<UnsignedInt> out) {
+    UnsignedInt* const offsets = out.data();
+    UnsignedInt* const entries = out.data() + keyCount + 1;
+
+    /* Count entries for every key, shifted by one */
+    for(const UnsignedInt key: keys)
+        if(key < keyCount) ++offsets[key + 1];
+
+    /* Convert the counts to begin offsets */
+    for(std::size_t i = 1; i <= keyCount; ++i)
+        offsets[i] += offsets[i - 1];
+
+    /* Put the values to their places, using the begin offsets as a cursor.
+       Afterwards each offset points to where the next key begins. */
+    for(std::size_t i = 0; i != keys.size(); ++i) {
+        const UnsignedInt key = keys[i];
+        if(key < keyCount)
+            entries[offsets[key]++] = values.isEmpty() ? UnsignedInt(i) : values[i];
+    }
+
+    /* Shift the offsets back to be begin offsets again */
+    for(std::size_t i = keyCount; i != 0; --i)
+        offsets[i] = offsets[i - 1];
+    offsets[0] = 0;
+}
+
+}
+
+void SceneData::buildObjectIndex() {
+    CORRADE_ASSERT(_mappingBound < 0xffffffffull,
+        "Trade::SceneData::buildObjectIndex(): can't index" << _mappingBound << "objects", );
+
+    /* Calculate where each index goes. Fields with an ordered or implicit
+       mapping have a fast enough lookup already, so they're not indexed. */
+    Containers::Array<std::size_t> indexOffsets{NoInit, _fields.size() + 1};
+    std::size_t indexSize = 0;
+    std::size_t maxFieldSize = 0;
+    for(std::size_t i = 0; i != _fields.size(); ++i) {
+        const SceneFieldData& field = _fields[i];
+        if(field._flags & SceneFieldFlag::OrderedMapping) {
+            indexOffsets[i] = ~std::size_t{};
+            continue;
+        }
+
+        CORRADE_ASSERT(field._size < 0xffffffffull,
+            "Trade::SceneData::buildObjectIndex(): can't index" << field._size << "entries in field" << field._name, );
+        indexOffsets[i] = indexSize;
+        indexSize += _mappingBound + 1 + field._size;
+        maxFieldSize = Math::max(maxFieldSize, std::size_t(field._size));
+    }
+
+    /* The children list is indexed by the parent, with -1 being the first */
+    const UnsignedInt parentFieldId = findFieldIdInternal(SceneField::Parent);
+    if(parentFieldId != ~UnsignedInt{}) {
+        const SceneFieldData& parentField = _fields[parentFieldId];
+        CORRADE_ASSERT(parentField._size < 0xffffffffull,
+            "Trade::SceneData::buildObjectIndex(): can't index" << parentField._size << "entries in field" << parentField._name, );
+        indexOffsets[_fields.size()] = indexSize;
+        indexSize += _mappingBound + 2 + parentField._size;
+        maxFieldSize = Math::max(maxFieldSize, std::size_t(parentField._size));
+    } else indexOffsets[_fields.size()] = ~std::size_t{};
+
+    Containers::Array<UnsignedInt> index{ValueInit, indexSize};
+    Containers::Array<UnsignedInt> mapping{NoInit, maxFieldSize};
+    for(UnsignedInt i = 0; i != _fields.size(); ++i) {
+        if(indexOffsets[i] == ~std::size_t{}) continue;
+
+        const std::size_t size = _fields[i]._size;
+        mappingIntoInternal(i, 0, mapping.prefix(size));
+        buildObjectIndexCsr(mapping.prefix(size), nullptr, _mappingBound, index.sliceSize(indexOffsets[i], _mappingBound + 1 + size));
+    }
+
+    /* Children are the object mapping sorted by the parent. Shifting the
+       parent by one makes -1 the first key, and parents that are out of range
+       wrap around to large values which then get skipped. */
+    if(parentFieldId != ~UnsignedInt{}) {
+        const std::size_t size = _fields[parentFieldId]._size;
+        Containers::Array<UnsignedInt> parents{NoInit, size};
+        parentsIntoInternal(parentFieldId, 0, Containers::arrayCast<Int>(stridedArrayView(parents)));
+        for(UnsignedInt& parent: parents) ++parent;
+        mappingIntoInternal(parentFieldId, 0, mapping.prefix(size));
+        buildObjectIndexCsr(parents, mapping.prefix(size), _mappingBound + 1, index.sliceSize(indexOffsets[_fields.size()], _mappingBound + 2 + size));
+    }
+
+    _objectIndexOffsets = Utility::move(indexOffsets);
+    _objectIndex = Utility::move(index);
+}
+
 SceneFieldFlags SceneData::fieldFlags(const SceneField name) const {
     const UnsignedInt fieldId = findFieldIdInternal(name);
     CORRADE_ASSERT(fieldId != ~UnsignedInt{}, "Trade::SceneData::fieldFlags(): field" << name << "not found", {});
@@ -2658,6 +2766,18 @@ Containers::Array<UnsignedLong> SceneData::childrenFor(const Long object) const
     const UnsignedInt parentFieldId = findFieldIdInternal(SceneField::Parent);
     if(parentFieldId == ~UnsignedInt{}) return {};
 
+    /* If there's an index, the children are a contiguous range in it */
+    if(!_objectIndexOffsets.isEmpty()) {
+        const UnsignedInt* const index = _objectIndex.data() + _objectIndexOffsets[_fields.size()];
+        const UnsignedInt* const entries = index + _mappingBound + 2;
+        const UnsignedInt begin = index[object + 1];
+        const UnsignedInt end = index[object + 2];
+        Containers::Array<UnsignedLong> out{NoInit, end - begin};
+        for(UnsignedInt i = begin; i != end; ++i)
+            out[i - begin] = entries[i];
+        return out;
+    }
+
     const SceneFieldData& parentField = _fields[parentFieldId];
 
     /* Collect IDs of all objects that reference this object */
@@ -2907,12 +3027,16 @@ std::vector<UnsignedInt> SceneData::children3D() const {
 Containers::Array<SceneFieldData> SceneData::releaseFieldData() {
     Containers::Array<SceneFieldData> out = Utility::move(_fields);
     _fields = {};
+    _objectIndexOffsets = {};
+    _objectIndex = {};
     return out;
 }
 
 Containers::Array<char> SceneData::releaseData() {
     Containers::Array<char> out = Utility::move(_data);
     _data = {};
+    _objectIndexOffsets = {};
+    _objectIndex = {};
     return out;
 }
 
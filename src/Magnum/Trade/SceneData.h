@@ -2248,8 +2248,10 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * done in an @f$ \mathcal{O}(1) @f$ complexity. Otherwise, if the
          * field has @ref SceneFieldFlag::OrderedMapping, the lookup is done in
          * an @f$ \mathcal{O}(\log{} n) @f$ complexity with @f$ n @f$ being the
-         * size of the field. Otherwise, the lookup is done in an
-         * @f$ \mathcal{O}(n) @f$ complexity.
+         * size of the field. Otherwise, if @ref buildObjectIndex() was called,
+         * the lookup is done in an @f$ \mathcal{O}(k) @f$ complexity with
+         * @f$ k @f$ being the count of entries for @p object in the field, and
+         * in an @f$ \mathcal{O}(n) @f$ complexity if not.
          *
          * You can also use @ref findFieldObjectOffset(SceneField, UnsignedLong, std::size_t) const
          * to directly find offset of an object in given named field.
@@ -2273,8 +2275,11 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * the field count. Otherwise, if the field has
          * @ref SceneFieldFlag::OrderedMapping, the lookup is done in an
          * @f$ \mathcal{O}(m + \log{} n) @f$ complexity with @f$ m @f$ being
-         * the field count and @f$ n @f$ the size of the field. Otherwise, the
-         * lookup is done in an @f$ \mathcal{O}(m + n) @f$ complexity.
+         * the field count and @f$ n @f$ the size of the field. Otherwise, if
+         * @ref buildObjectIndex() was called, the lookup is done in an
+         * @f$ \mathcal{O}(m + k) @f$ complexity with @f$ k @f$ being the
+         * count of entries for @p object in the field, and in an
+         * @f$ \mathcal{O}(m + n) @f$ complexity if not.
          *
          * @see @ref hasField(), @ref hasFieldObject(SceneField, UnsignedLong) const,
          *      @ref fieldObjectOffset(SceneField, UnsignedLong, std::size_t) const
@@ -2326,6 +2331,46 @@ class MAGNUM_TRADE_EXPORT SceneData {
          */
         bool hasFieldObject(SceneField fieldName, UnsignedLong object) const;
 
+        /**
+         * @brief Build a per-object field index
+         * @m_since_latest
+         *
+         * For every field that has neither @ref SceneFieldFlag::OrderedMapping
+         * nor @ref SceneFieldFlag::ImplicitMapping builds a list of field
+         * offsets for each object, and if @ref SceneField::Parent is present,
+         * a list of children for each object. All lookups through
+         * @ref findFieldObjectOffset(), @ref fieldObjectOffset(),
+         * @ref hasFieldObject(), @ref childrenFor() and the other
+         * @cpp *For() @ce accessors then no longer scan the whole field but
+         * are proportional only to the count of entries for given object,
+         * which makes per-object queries on large scenes with unordered
+         * mapping practical. Calling this function again rebuilds the index.
+         *
+         * The index takes @cpp 4 @ce bytes for each object in
+         * @ref mappingBound() and each field entry, for every indexed field
+         * and the parent field. Building it is done in a single pass over
+         * the object mapping of each indexed field, so the cost is
+         * comparable to a few dozen linear lookups --- for just a handful of
+         * queries it's not worth building. The index is a snapshot of the
+         * object mapping, if the mapping or the parent field is modified
+         * through @ref mutableMapping() or @ref mutableField() afterwards,
+         * the index has to be rebuilt. It's discarded by
+         * @ref releaseFieldData() and @ref releaseData().
+         *
+         * Expects that @ref mappingBound() and sizes of all indexed fields
+         * fit into 32 bits.
+         * @see @ref hasObjectIndex()
+         */
+        void buildObjectIndex();
+
+        /**
+         * @brief Whether a per-object field index is built
+         * @m_since_latest
+         *
+         * @see @ref buildObjectIndex()
+         */
+        bool hasObjectIndex() const { return !_objectIndexOffsets.isEmpty(); }
+
         /**
          * @brief Flags of a named field
          * @m_since_latest
@@ -3493,7 +3538,9 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * as @ref parentsAsArray(), returning a list of all object IDs that
          * have it listed as the parent. See the lookup function documentation
          * for operation complexity --- for retrieving parent/child info for
-         * many objects it's recommended to access the field data directly.
+         * many objects it's recommended to access the field data directly or
+         * call @ref buildObjectIndex() first, after which the lookup is
+         * proportional only to the count of children.
          *
          * If the @ref SceneField::Parent field doesn't exist or there are no
          * objects which would have @p object listed as their parent, returns
@@ -3825,6 +3872,11 @@ class MAGNUM_TRADE_EXPORT SceneData {
         const void* _importerState;
         Containers::Array<SceneFieldData> _fields;
         Containers::Array<char> _data;
+        /* Filled by buildObjectIndex(). For every field and then the children
+           list an offset into _objectIndex, or ~std::size_t{} if not
+           indexed. Empty if there's no index. */
+        Containers::Array<std::size_t> _objectIndexOffsets;
+        Containers::Array<UnsignedInt> _objectIndex;
 };
 
 namespace Implementation {
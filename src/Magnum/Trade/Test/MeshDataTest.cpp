@@ -25,6 +25,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <limits>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -180,6 +181,7 @@ struct MeshDataTest: TestSuite::Tester {
     void bitangentsIntoArrayInvalidSize();
     template<class T> void normalsAsArray();
     template<class T> void normalsAsArrayPackedSignedNormalized();
+    template<class T> void normalsAsArrayOctahedral();
     void normalsIntoArrayInvalidSize();
     template<class T> void textureCoordinates2DAsArray();
     template<class T> void textureCoordinates2DAsArrayPackedUnsigned();
@@ -464,6 +466,9 @@ MeshDataTest::MeshDataTest() {
 
     addTests({&MeshDataTest::normalsAsArrayPackedSignedNormalized<Vector3b>,
               &MeshDataTest::normalsAsArrayPackedSignedNormalized<Vector3s>,
+              &MeshDataTest::normalsAsArrayOctahedral<Vector2>,
+              &MeshDataTest::normalsAsArrayOctahedral<Vector2b>,
+              &MeshDataTest::normalsAsArrayOctahedral<Vector2s>,
               &MeshDataTest::normalsIntoArrayInvalidSize});
 
     addInstancedTests<MeshDataTest>({
@@ -3873,6 +3878,35 @@ template<class T> void MeshDataTest::normalsAsArrayPackedSignedNormalized() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void MeshDataTest::normalsAsArrayOctahedral() {
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    /* Values that are exactly representable in all types, including the
+       folded lower hemisphere */
+    typedef typename T::Type TT;
+    const TT one = TT(std::is_same<TT, Float>::value ? 1 : std::numeric_limits<TT>::max());
+    T normals[]{
+        {0, 0},
+        {one, 0},
+        {0, TT(-one)},
+        {one, one},
+        {TT(-one), TT(-one)}
+    };
+
+    MeshData data{MeshPrimitive::Points, {}, normals, {
+        MeshAttributeData{MeshAttribute::Normal,
+            vertexFormat(Implementation::vertexFormatFor<T>(), 2, !std::is_same<TT, Float>::value),
+            Containers::arrayView(normals)}
+    }};
+    CORRADE_COMPARE_AS(data.normalsAsArray(), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f},
+        {0.0f, 0.0f, -1.0f}
+    }), TestSuite::Compare::Container);
+}
+
 void MeshDataTest::normalsIntoArrayInvalidSize() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -0,0 +1,168 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct SceneDataBenchmark: TestSuite::Tester {
+    explicit SceneDataBenchmark();
+
+    void parentFor();
+    void parentForObjectIndex();
+    void childrenFor();
+    void childrenForObjectIndex();
+    void buildObjectIndex();
+};
+
+/* The object index has to be built first so with few objects the linear
+   lookup is faster. With more objects the quadratic cost of querying all of
+   them takes over. */
+const struct {
+    const char* name;
+    UnsignedInt objectCount;
+} Data[]{
+    {"16 objects", 16},
+    {"64 objects", 64},
+    {"256 objects", 256},
+    {"1024 objects", 1024},
+    {"4096 objects", 4096},
+};
+
+SceneDataBenchmark::SceneDataBenchmark() {
+    addInstancedBenchmarks({&SceneDataBenchmark::parentFor,
+                            &SceneDataBenchmark::parentForObjectIndex,
+                            &SceneDataBenchmark::childrenFor,
+                            &SceneDataBenchmark::childrenForObjectIndex,
+                            &SceneDataBenchmark::buildObjectIndex}, 5,
+        Containers::arraySize(Data));
+}
+
+struct Field {
+    UnsignedInt object;
+    Int parent;
+};
+
+/* A balanced binary tree with objects shuffled so the mapping isn't ordered,
+   similarly to what importers usually produce */
+SceneData binaryTree(const UnsignedInt objectCount) {
+    Containers::Array<char> data{NoInit, objectCount*sizeof(Field)};
+    const Containers::StridedArrayView1D<Field> fields = Containers::arrayCast<Field>(data);
+    for(UnsignedInt i = 0; i != objectCount; ++i) {
+        /* The count is a power of two so any odd multiplier is a bijection */
+        fields[i].object = (i*2654435761u) & (objectCount - 1);
+        fields[i].parent = i == 0 ? -1 : Int((((i - 1)/2)*2654435761u) & (objectCount - 1));
+    }
+
+    return SceneData{SceneMappingType::UnsignedInt, objectCount, Utility::move(data), {
+        SceneFieldData{SceneField::Parent, fields.slice(&Field::object), fields.slice(&Field::parent)}
+    }};
+}
+
+void SceneDataBenchmark::parentFor() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const SceneData scene = binaryTree(data.objectCount);
+
+    Long sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(UnsignedInt i = 0; i != data.objectCount; ++i)
+            sum += *scene.parentFor(i);
+
+    CORRADE_VERIFY(sum);
+}
+
+void SceneDataBenchmark::parentForObjectIndex() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    SceneData scene = binaryTree(data.objectCount);
+
+    /* Building the index is included in the measured time */
+    Long sum = 0;
+    CORRADE_BENCHMARK(1) {
+        scene.buildObjectIndex();
+        for(UnsignedInt i = 0; i != data.objectCount; ++i)
+            sum += *scene.parentFor(i);
+    }
+
+    CORRADE_VERIFY(sum);
+}
+
+void SceneDataBenchmark::childrenFor() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const SceneData scene = binaryTree(data.objectCount);
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        for(UnsignedInt i = 0; i != data.objectCount; ++i)
+            count += scene.childrenFor(i).size();
+
+    /* Everything except the root is a child of something */
+    CORRADE_COMPARE(count, std::size_t(data.objectCount - 1));
+}
+
+void SceneDataBenchmark::childrenForObjectIndex() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    SceneData scene = binaryTree(data.objectCount);
+
+    /* Building the index is included in the measured time */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        scene.buildObjectIndex();
+        for(UnsignedInt i = 0; i != data.objectCount; ++i)
+            count += scene.childrenFor(i).size();
+    }
+
+    /* Everything except the root is a child of something */
+    CORRADE_COMPARE(count, std::size_t(data.objectCount - 1));
+}
+
+void SceneDataBenchmark::buildObjectIndex() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    SceneData scene = binaryTree(data.objectCount);
+
+    CORRADE_BENCHMARK(5)
+        scene.buildObjectIndex();
+
+    CORRADE_VERIFY(scene.hasObjectIndex());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::SceneDataBenchmark)
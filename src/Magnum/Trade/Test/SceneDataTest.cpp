@@ -244,6 +244,10 @@ struct SceneDataTest: TestSuite::Tester {
     void fieldForFieldMissing();
     void findFieldObjectOffsetInvalidObject();
 
+    void objectIndex();
+    void objectIndexRelease();
+    void objectIndexTooLarge();
+
     void releaseFieldData();
     void releaseData();
 };
@@ -672,6 +676,10 @@ SceneDataTest::SceneDataTest() {
     addTests({&SceneDataTest::fieldForFieldMissing,
               &SceneDataTest::findFieldObjectOffsetInvalidObject,
 
+              &SceneDataTest::objectIndex,
+              &SceneDataTest::objectIndexRelease,
+              &SceneDataTest::objectIndexTooLarge,
+
               &SceneDataTest::releaseFieldData,
               &SceneDataTest::releaseData});
 }
@@ -7628,6 +7636,128 @@ void SceneDataTest::findFieldObjectOffsetInvalidObject() {
         "Trade::SceneData::skinsFor(): object 7 out of range for 7 objects\n");
 }
 
+void SceneDataTest::objectIndex() {
+    struct Field {
+        UnsignedShort object;
+        Short parent;
+        UnsignedInt mesh;
+        Vector3 translation;
+    };
+    struct Data {
+        Field fields[8];
+        UnsignedShort lightMapping[4];
+        UnsignedInt lights[4];
+    } data[]{{{
+        {4, -1, 1, {1.0f, 0.0f, 0.0f}},
+        {3, 4, 3, {2.0f, 0.0f, 0.0f}},
+        {2, 3, 4, {3.0f, 0.0f, 0.0f}},
+        {1, 4, 5, {4.0f, 0.0f, 0.0f}},
+        {5, 4, 1, {5.0f, 0.0f, 0.0f}},
+        {0, -1, 2, {6.0f, 0.0f, 0.0f}},
+        {2, -5, 6, {7.0f, 0.0f, 0.0f}}, /* invalid parent, ignored */
+        {3, 9, 3, {8.0f, 0.0f, 0.0f}}, /* invalid parent, ignored */
+    }, {1, 2, 2, 5}, {3, 4, 5, 6}}};
+    Containers::StridedArrayView1D<Field> view = data->fields;
+
+    SceneData scene{SceneMappingType::UnsignedShort, 7, {}, data, {
+        SceneFieldData{SceneField::Parent, view.slice(&Field::object), view.slice(&Field::parent)},
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)},
+        SceneFieldData{SceneField::Translation, view.slice(&Field::object), view.slice(&Field::translation)},
+        /* Ordered mapping, not indexed */
+        SceneFieldData{SceneField::Light, Containers::arrayView(data->lightMapping), Containers::arrayView(data->lights), SceneFieldFlag::OrderedMapping},
+    }};
+    CORRADE_VERIFY(!scene.hasObjectIndex());
+
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(scene.hasObjectIndex());
+
+    /* Offset lookup, including skipping earlier entries */
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2), 2);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 3), 6);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 7), Containers::NullOpt);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 6), Containers::NullOpt);
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, 3, 2), 7);
+    CORRADE_VERIFY(scene.hasFieldObject(SceneField::Mesh, 0));
+    CORRADE_VERIFY(!scene.hasFieldObject(SceneField::Mesh, 6));
+
+    /* Duplicate entries -- only the first one gets used, same as without
+       the index */
+    CORRADE_COMPARE(scene.parentFor(3), 4);
+    CORRADE_COMPARE(scene.parentFor(2), 3);
+    CORRADE_COMPARE(scene.parentFor(4), -1);
+    CORRADE_COMPARE(scene.parentFor(6), Containers::NullOpt);
+    CORRADE_COMPARE(scene.translationRotationScaling3DFor(3),
+        Containers::triple(Vector3{2.0f, 0.0f, 0.0f}, Quaternion{}, Vector3{1.0f}));
+
+    /* Children are in the order they're in the field, out-of-range parents
+       are skipped */
+    CORRADE_COMPARE_AS(scene.childrenFor(-1),
+        Containers::arrayView<UnsignedLong>({4, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(4),
+        Containers::arrayView<UnsignedLong>({3, 1, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(3),
+        Containers::arrayView<UnsignedLong>({2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(6),
+        Containers::arrayView<UnsignedLong>({}),
+        TestSuite::Compare::Container);
+
+    /* Multiple entries */
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(3),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+            {3, -1}, {3, -1}
+        })), TestSuite::Compare::Container);
+
+    /* The ordered field goes through the original lookup */
+    CORRADE_COMPARE_AS(scene.lightsFor(2),
+        Containers::arrayView<UnsignedInt>({4, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.lightsFor(3),
+        Containers::arrayView<UnsignedInt>({}),
+        TestSuite::Compare::Container);
+
+    /* Rebuilding picks up a modified mapping */
+    data->fields[7].object = 6;
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 6), Containers::NullOpt);
+    scene.buildObjectIndex();
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 6), 7);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 3, 2), Containers::NullOpt);
+}
+
+void SceneDataTest::objectIndexRelease() {
+    const UnsignedInt mapping[]{2, 0, 1};
+    const UnsignedInt meshes[]{3, 4, 5};
+
+    SceneData scene{SceneMappingType::UnsignedInt, 3, {}, mapping, {
+        SceneFieldData{SceneField::Mesh, Containers::arrayView(mapping), Containers::arrayView(meshes)}
+    }};
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(scene.hasObjectIndex());
+
+    scene.releaseFieldData();
+    CORRADE_VERIFY(!scene.hasObjectIndex());
+
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(scene.hasObjectIndex());
+
+    scene.releaseData();
+    CORRADE_VERIFY(!scene.hasObjectIndex());
+}
+
+void SceneDataTest::objectIndexTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SceneData scene{SceneMappingType::UnsignedLong, 0xffffffffull, nullptr, {}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(!scene.hasObjectIndex());
+    CORRADE_COMPARE(out, "Trade::SceneData::buildObjectIndex(): can't index 4294967295 objects\n");
+}
+
 void SceneDataTest::releaseFieldData() {
     struct Field {
         UnsignedByte object;
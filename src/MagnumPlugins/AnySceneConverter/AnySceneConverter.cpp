@@ -86,6 +86,10 @@ bool AnySceneConverter::doConvertToFile(const MeshData& mesh, const Containers::
     if(normalizedExtension == ".gltf"_s ||
        normalizedExtension == ".glb"_s)
         plugin = "GltfSceneConverter"_s;
+    else if(normalizedExtension == ".mblob"_s)
+        plugin = "MeshBlobSceneConverter"_s;
+    else if(normalizedExtension == ".mcm"_s)
+        plugin = "MeshCodecSceneConverter"_s;
     else if(normalizedExtension == ".ply"_s)
         plugin = "StanfordSceneConverter"_s;
     else {
@@ -138,6 +142,10 @@ bool AnySceneConverter::doBeginFile(const Containers::StringView filename) {
     if(normalizedExtension == ".gltf"_s ||
        normalizedExtension == ".glb"_s)
         plugin = "GltfSceneConverter"_s;
+    else if(normalizedExtension == ".mblob"_s)
+        plugin = "MeshBlobSceneConverter"_s;
+    else if(normalizedExtension == ".mcm"_s)
+        plugin = "MeshCodecSceneConverter"_s;
     else if(normalizedExtension == ".ply"_s)
         plugin = "StanfordSceneConverter"_s;
     else {
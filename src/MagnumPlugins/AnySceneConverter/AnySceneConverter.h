@@ -63,6 +63,10 @@ tries to convert the file with it. Supported formats:
 
 -   glTF (`*.gltf`, `*.glb`), converted with @ref GltfSceneConverter or any
     other plugin that provides it
+-   Magnum mesh blob (`*.mblob`), converted with
+    @ref MeshBlobSceneConverter or any other plugin that provides it
+-   Magnum compressed mesh (`*.mcm`), converted with
+    @ref MeshCodecSceneConverter or any other plugin that provides it
 -   Stanford (`*.ply`), converted with @ref StanfordSceneConverter or any other
     plugin that provides it
 
@@ -108,6 +108,8 @@ constexpr struct {
 } DetectConvertData[]{
     {"glTF", "khronos.gltf", "GltfSceneConverter"},
     {"glTF binary", "khronos.glb", "GltfSceneConverter"},
+    {"Magnum mesh blob", "mesh.mblob", "MeshBlobSceneConverter"},
+    {"Magnum compressed mesh", "mesh.mcm", "MeshCodecSceneConverter"},
     {"Stanford PLY", "bunny.ply", "StanfordSceneConverter"},
     /* Have at least one test case with uppercase */
     {"Stanford PLY uppercase", "ARMADI~1.PLY", "StanfordSceneConverter"}
@@ -120,6 +122,8 @@ constexpr struct {
 } DetectBeginEndData[]{
     {"glTF", "khronos.gltf", "GltfSceneConverter"},
     {"glTF binary", "khronos.glb", "GltfSceneConverter"},
+    {"Magnum mesh blob", "mesh.mblob", "MeshBlobSceneConverter"},
+    {"Magnum compressed mesh", "mesh.mcm", "MeshCodecSceneConverter"},
     {"Stanford PLY", "bunny.ply", "StanfordSceneConverter"},
     /* Have at least one test case with uppercase */
     {"Stanford PLY uppercase", "ARMADI~1.PLY", "StanfordSceneConverter"}
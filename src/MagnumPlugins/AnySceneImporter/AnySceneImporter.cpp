@@ -147,6 +147,10 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
         plugin = "LightWaveImporter"_s;
     else if(normalized.hasSuffix(".lxo"_s))
         plugin = "ModoImporter"_s;
+    else if(normalized.hasSuffix(".mblob"_s))
+        plugin = "MeshBlobImporter"_s;
+    else if(normalized.hasSuffix(".mcm"_s))
+        plugin = "MeshCodecImporter"_s;
     else if(normalized.hasSuffix(".mesh.xml"_s))
         plugin = "OgreImporter"_s;
     else if(normalized.hasSuffix(".ms3d"_s))
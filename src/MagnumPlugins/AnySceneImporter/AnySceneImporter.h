@@ -80,6 +80,10 @@ tries to open the file with it. Supported formats:
 -   LightWave, LightWave Scene (`*.lwo`, `*.lws`), loaded with any plugin that
     provides `LightWaveImporter`
 -   Modo (`*.lxo`), loaded with any plugin that provides `ModoImporter`
+-   Magnum mesh blob (`*.mblob`), loaded with @ref MeshBlobImporter or any
+    other plugin that provides it
+-   Magnum compressed mesh (`*.mcm`), loaded with @ref MeshCodecImporter or
+    any other plugin that provides it
 -   Milkshape 3D (`*.ms3d`), loaded with any plugin that provides
     `MilkshapeImporter`
 -   Wavefront OBJ (`*.obj`), loaded with @ref ObjImporter or any other plugin
@@ -148,6 +148,8 @@ const struct {
     {"LightWave", "magnum.lwo", "LightWaveImporter"},
     {"LightWave Scene", "magnum.lws", "LightWaveImporter"},
     {"Modo", "magnum.lxo", "ModoImporter"},
+    {"Magnum mesh blob", "mesh.mblob", "MeshBlobImporter"},
+    {"Magnum compressed mesh", "mesh.mcm", "MeshCodecImporter"},
     {"Milkshape 3D", "latte.ms3d", "MilkshapeImporter"},
     {"Ogre XML", "weapon.mesh.xml", "OgreImporter"},
     {"OpenGEX", "eric.ogex", "OpenGexImporter"},
@@ -0,0 +1,179 @@
+#ifndef Magnum_Trade_MeshBlobHeader_h
+#define Magnum_Trade_MeshBlobHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Types.h"
+
+/* Used by both MeshBlobImporter and MeshBlobSceneConverter, which is why it
+   isn't directly inside MeshBlobImporter.cpp. OTOH it doesn't need to be
+   exposed publicly, which is why it has no docblocks.
+
+   The file consists of the header, then an array of meshes, scenes, materials
+   and 1D, 2D and 3D images, then mesh attributes, scene fields, material
+   attributes and material layer offsets, then names and material attribute
+   values and then index and vertex data of all meshes, data of all scenes and
+   data of all images, each aligned to MeshBlobHeader::dataAlignment. All
+   values are in the endianness given by MeshBlobHeader::bigEndian, the mesh,
+   scene and image data are stored in the same layout as in MeshData,
+   SceneData and ImageData so they can be referenced directly from a
+   memory-mapped file. */
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Increased every time the file layout changes in an incompatible way */
+constexpr UnsignedByte MeshBlobVersion = 1;
+
+struct MeshBlobHeader {
+    char magic[4];              /* MBLB */
+    UnsignedByte version;       /* MeshBlobVersion */
+    UnsignedByte bigEndian;     /* 1 if all data are Big-Endian, 0 if Little */
+    UnsignedShort:16;
+    UnsignedInt meshCount;
+    UnsignedInt dataAlignment;  /* Alignment of all mesh, scene and image data */
+    UnsignedInt sceneCount;
+    UnsignedInt materialCount;
+    UnsignedInt image1DCount;
+    UnsignedInt image2DCount;
+    UnsignedInt image3DCount;
+    UnsignedInt:32;
+    UnsignedLong size;          /* Size of the whole file */
+};
+
+struct MeshBlobMesh {
+    /* All offsets are from the start of the file */
+    UnsignedLong indexDataOffset;
+    UnsignedLong indexDataSize;
+    UnsignedLong vertexDataOffset;
+    UnsignedLong vertexDataSize;
+    UnsignedLong attributeOffset;
+    UnsignedLong nameOffset;
+    UnsignedLong indexOffset;   /* Offset of the index view in index data */
+    UnsignedInt primitive;      /* MeshPrimitive */
+    UnsignedInt indexType;      /* MeshIndexType, 0 if not indexed */
+    UnsignedInt indexCount;
+    UnsignedInt vertexCount;
+    UnsignedInt attributeCount;
+    UnsignedInt nameSize;
+    Int indexStride;
+    UnsignedInt:32;
+};
+
+struct MeshBlobAttribute {
+    UnsignedLong offset;        /* Offset of the attribute in vertex data */
+    UnsignedInt format;         /* VertexFormat */
+    UnsignedShort name;         /* MeshAttribute */
+    UnsignedShort arraySize;
+    Short stride;
+    Byte morphTargetId;
+    UnsignedByte:8;
+    UnsignedInt:32;
+};
+
+struct MeshBlobScene {
+    /* All offsets are from the start of the file */
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+    UnsignedLong fieldOffset;
+    UnsignedLong nameOffset;
+    UnsignedLong mappingBound;
+    UnsignedInt fieldCount;
+    UnsignedInt nameSize;
+    UnsignedInt mappingType;    /* SceneMappingType */
+    UnsignedInt:32;
+};
+
+struct MeshBlobSceneField {
+    UnsignedLong size;
+    /* All offsets are from the start of the scene data */
+    UnsignedLong mappingOffset;
+    UnsignedLong fieldOffset;
+    UnsignedLong stringOffset;  /* String data offset for string fields */
+    UnsignedInt name;           /* SceneField */
+    UnsignedShort fieldType;    /* SceneFieldType */
+    UnsignedShort fieldArraySize;
+    Short mappingStride;
+    Short fieldStride;          /* In bits for SceneFieldType::Bit */
+    UnsignedByte flags;         /* SceneFieldFlags without OffsetOnly */
+    UnsignedByte fieldBitOffset;
+    UnsignedShort:16;
+};
+
+struct MeshBlobMaterial {
+    /* All offsets are from the start of the file */
+    UnsignedLong attributeOffset;
+    UnsignedLong layerOffset;   /* UnsignedInt layer end offsets */
+    UnsignedLong nameOffset;
+    UnsignedInt types;          /* MaterialTypes */
+    UnsignedInt attributeCount;
+    UnsignedInt layerCount;     /* 0 if there's just the implicit base layer */
+    UnsignedInt nameSize;
+};
+
+struct MeshBlobMaterialAttribute {
+    /* All offsets are from the start of the file */
+    UnsignedLong nameOffset;
+    UnsignedLong valueOffset;   /* The value is not aligned in any way */
+    UnsignedInt nameSize;
+    UnsignedInt valueSize;
+    UnsignedInt type;           /* MaterialAttributeType */
+    UnsignedInt:32;
+};
+
+struct MeshBlobImage {
+    /* All offsets are from the start of the file */
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+    UnsignedLong nameOffset;
+    UnsignedInt nameSize;
+    UnsignedInt format;         /* PixelFormat or CompressedPixelFormat */
+    UnsignedInt formatExtra;    /* 0 if compressed */
+    UnsignedInt pixelSize;      /* 0 if compressed */
+    /* Components past the image dimension count are unused */
+    Int size[3];
+    Int skip[3];
+    Int rowLength;
+    Int imageHeight;
+    Int alignment;              /* 0 if compressed */
+    Int compressedBlockSize[3]; /* All 0 if not compressed */
+    Int compressedBlockDataSize;
+    UnsignedShort flags;        /* ImageFlags */
+    UnsignedByte compressed;
+    UnsignedByte:8;
+};
+
+static_assert(sizeof(MeshBlobHeader) == 48, "MeshBlobHeader size is not 48 bytes");
+static_assert(sizeof(MeshBlobMesh) == 88, "MeshBlobMesh size is not 88 bytes");
+static_assert(sizeof(MeshBlobAttribute) == 24, "MeshBlobAttribute size is not 24 bytes");
+static_assert(sizeof(MeshBlobScene) == 56, "MeshBlobScene size is not 56 bytes");
+static_assert(sizeof(MeshBlobSceneField) == 48, "MeshBlobSceneField size is not 48 bytes");
+static_assert(sizeof(MeshBlobMaterial) == 40, "MeshBlobMaterial size is not 40 bytes");
+static_assert(sizeof(MeshBlobMaterialAttribute) == 32, "MeshBlobMaterialAttribute size is not 32 bytes");
+static_assert(sizeof(MeshBlobImage) == 96, "MeshBlobImage size is not 96 bytes");
+
+}}}
+
+#endif
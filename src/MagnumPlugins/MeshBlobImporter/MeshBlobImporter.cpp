@@ -0,0 +1,971 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlobImporter.h"
+
+#include <cstring>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/ImageFlags.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/PixelStorage.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+struct MeshBlobImporter::State {
+    Containers::Array<char> data;
+    /* If set, the data are guaranteed to stay in scope after the importer is
+       closed and can be referenced directly from the imported meshes */
+    bool externallyOwned;
+    Containers::ArrayView<const Implementation::MeshBlobMesh> meshes;
+    Containers::ArrayView<const Implementation::MeshBlobScene> scenes;
+    Containers::ArrayView<const Implementation::MeshBlobMaterial> materials;
+    /* 1D, 2D and 3D images */
+    Containers::ArrayView<const Implementation::MeshBlobImage> images[3];
+};
+
+namespace {
+
+/* Checks that a strided view of given count, stride and element size starting
+   at given offset fits into size bytes. Uses signed 64-bit arithmetic as the
+   stride can be negative, the count is checked against the size first so the
+   calculation doesn't overflow. */
+bool fitsInto(const UnsignedLong offset, const UnsignedLong count, const Long stride, const UnsignedLong elementSize, const UnsignedLong size) {
+    if(!count) return offset <= size;
+    if(offset > size) return false;
+    const UnsignedLong absoluteStride = stride < 0 ? -stride : stride;
+    if(absoluteStride && count - 1 > size/absoluteStride) return false;
+    const Long span = Long(count - 1)*stride;
+    return Long(offset) + Math::min(span, Long{}) >= 0 &&
+        offset + Math::max(span, Long{}) + elementSize <= size;
+}
+
+bool rangeFitsInto(const UnsignedLong offset, const UnsignedLong size, const UnsignedLong fileSize) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+/* Reads an unsigned integer of given size, which may be unaligned */
+UnsignedLong readUnsigned(const char* const data, const UnsignedInt size) {
+    if(size == 1) {
+        UnsignedByte value;
+        std::memcpy(&value, data, 1);
+        return value;
+    } else if(size == 2) {
+        UnsignedShort value;
+        std::memcpy(&value, data, 2);
+        return value;
+    } else if(size == 4) {
+        UnsignedInt value;
+        std::memcpy(&value, data, 4);
+        return value;
+    }
+    UnsignedLong value;
+    std::memcpy(&value, data, 8);
+    return value;
+}
+
+/* Checks that all strings referenced by a string field are contained in the
+   string data, which span from the string offset until the end of the scene
+   data. The field is already known to be in bounds. SceneData checks just the
+   string data pointer and SceneData::fieldStrings() would otherwise read
+   arbitrary memory. */
+bool stringsInBounds(const Containers::ArrayView<const char> data, const Implementation::MeshBlobSceneField& field) {
+    const Containers::ArrayView<const char> strings = data.exceptPrefix(field.stringOffset);
+    const bool nullTerminated = !!(SceneFieldFlags{field.flags} & SceneFieldFlag::NullTerminatedString);
+
+    /* StringOffset*, StringRange* and StringRangeNullTerminated* types are
+       each four consecutive values, with 8-, 16-, 32- and 64-bit types in
+       order */
+    const UnsignedInt typeId = field.fieldType - UnsignedInt(SceneFieldType::StringOffset8);
+    const UnsignedInt typeSize = 1 << (typeId % 4);
+    const char* item = data.data() + field.fieldOffset;
+
+    /* Offsets are the end of each string, with the first string beginning at
+       zero */
+    if(typeId < 4) {
+        UnsignedLong previous = 0;
+        for(UnsignedLong i = 0; i != field.size; ++i, item += field.fieldStride) {
+            const UnsignedLong current = readUnsigned(item, typeSize);
+            if(current < previous || current > strings.size() || (nullTerminated && (current == previous || strings[current - 1] != '\0')))
+                return false;
+            previous = current;
+        }
+
+    /* Ranges are an offset and a size, null-terminated ranges have the null
+       terminator right after */
+    } else if(typeId < 8) {
+        for(UnsignedLong i = 0; i != field.size; ++i, item += field.fieldStride) {
+            const UnsignedLong offset = readUnsigned(item, typeSize);
+            const UnsignedLong size = readUnsigned(item + typeSize, typeSize);
+            if(!rangeFitsInto(offset, size, strings.size()) || (nullTerminated && (offset + size == strings.size() || strings[offset + size] != '\0')))
+                return false;
+        }
+
+    /* Null-terminated offsets have their size calculated with strlen(), so
+       there has to be a null terminator somewhere after */
+    } else {
+        std::size_t end = strings.size();
+        while(end && strings[end - 1] != '\0') --end;
+        for(UnsignedLong i = 0; i != field.size; ++i, item += field.fieldStride)
+            if(readUnsigned(item, typeSize) >= end) return false;
+    }
+
+    return true;
+}
+
+/* Returns 2 or 3 for fields that imply scene dimensionality, 0 otherwise */
+UnsignedInt sceneFieldDimensions(const SceneFieldType type) {
+    switch(type) {
+        case SceneFieldType::Matrix3x3:
+        case SceneFieldType::Matrix3x3d:
+        case SceneFieldType::Matrix3x2:
+        case SceneFieldType::Matrix3x2d:
+        case SceneFieldType::DualComplex:
+        case SceneFieldType::DualComplexd:
+        case SceneFieldType::Vector2:
+        case SceneFieldType::Vector2d:
+        case SceneFieldType::Complex:
+        case SceneFieldType::Complexd:
+            return 2;
+        case SceneFieldType::Matrix4x4:
+        case SceneFieldType::Matrix4x4d:
+        case SceneFieldType::Matrix4x3:
+        case SceneFieldType::Matrix4x3d:
+        case SceneFieldType::DualQuaternion:
+        case SceneFieldType::DualQuaterniond:
+        case SceneFieldType::Vector3:
+        case SceneFieldType::Vector3d:
+        case SceneFieldType::Quaternion:
+        case SceneFieldType::Quaterniond:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+/* Saturating multiplication for the image data size calculation below, which
+   would otherwise overflow for crafted image sizes */
+UnsignedLong multiplySaturated(const UnsignedLong a, const UnsignedLong b) {
+    return a && b > ~UnsignedLong{}/a ? ~UnsignedLong{} : a*b;
+}
+
+UnsignedLong addSaturated(const UnsignedLong a, const UnsignedLong b) {
+    return b > ~UnsignedLong{} - a ? ~UnsignedLong{} : a + b;
+}
+
+/* Same as Magnum::Implementation::imageDataSize() and
+   PixelStorage::dataProperties() but saturating instead of overflowing. The
+   size is expected to be already padded to three dimensions with ones and all
+   values are expected to be already checked for being non-negative. */
+UnsignedLong imageDataSize(const Implementation::MeshBlobImage& image, const Vector3i& size) {
+    const UnsignedLong rowSize = multiplySaturated(addSaturated(multiplySaturated(image.rowLength ? image.rowLength : size[0], image.pixelSize), image.alignment - 1)/image.alignment, image.alignment);
+    const UnsignedLong height = image.imageHeight ? image.imageHeight : size[1];
+
+    UnsignedLong offset = 0;
+    const UnsignedLong offsetZ = multiplySaturated(multiplySaturated(rowSize, height), image.skip[2]);
+    const UnsignedLong offsetY = multiplySaturated(rowSize, image.skip[1]);
+    const UnsignedLong offsetX = multiplySaturated(image.pixelSize, image.skip[0]);
+    if(offsetZ)
+        offset = offsetZ;
+    else if(offsetY) {
+        if(!image.imageHeight) offset = offsetY;
+    } else if(offsetX) {
+        if(!image.rowLength) offset = offsetX;
+    }
+
+    if(!size[0] || !size[1] || !size[2])
+        return offset;
+    return addSaturated(offset, multiplySaturated(multiplySaturated(rowSize, height), size[2]));
+}
+
+template<UnsignedInt dimensions> ImageData<dimensions> importImage(const Containers::ArrayView<const char> fileData, const bool externallyOwned, const Implementation::MeshBlobImage& image) {
+    VectorTypeFor<dimensions, Int> size;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        size[i] = image.size[i];
+    const Vector3i skip{image.skip[0], image.skip[1], image.skip[2]};
+    const ImageFlags<dimensions> flags{image.flags};
+    const Containers::ArrayView<const char> data = fileData.sliceSize(image.dataOffset, image.dataSize);
+
+    /* If the memory stays in scope, reference it directly, otherwise the data
+       have to be copied as the importer can get closed while the image is
+       still alive */
+    Containers::Array<char> dataCopy;
+    if(!externallyOwned) {
+        dataCopy = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, dataCopy);
+    }
+
+    if(image.compressed) {
+        CompressedPixelStorage storage;
+        storage.setRowLength(image.rowLength)
+            .setImageHeight(image.imageHeight)
+            .setSkip(skip)
+            .setCompressedBlockSize({image.compressedBlockSize[0], image.compressedBlockSize[1], image.compressedBlockSize[2]})
+            .setCompressedBlockDataSize(image.compressedBlockDataSize);
+        if(externallyOwned)
+            return ImageData<dimensions>{storage, CompressedPixelFormat(image.format), size, DataFlag::ExternallyOwned, data, flags};
+        return ImageData<dimensions>{storage, CompressedPixelFormat(image.format), size, Utility::move(dataCopy), flags};
+    }
+
+    PixelStorage storage;
+    storage.setAlignment(image.alignment)
+        .setRowLength(image.rowLength)
+        .setImageHeight(image.imageHeight)
+        .setSkip(skip);
+    if(externallyOwned)
+        return ImageData<dimensions>{storage, PixelFormat(image.format), image.formatExtra, image.pixelSize, size, DataFlag::ExternallyOwned, data, flags};
+    return ImageData<dimensions>{storage, PixelFormat(image.format), image.formatExtra, image.pixelSize, size, Utility::move(dataCopy), flags};
+}
+
+}
+
+MeshBlobImporter::MeshBlobImporter() = default;
+
+MeshBlobImporter::MeshBlobImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
+
+MeshBlobImporter::~MeshBlobImporter() = default;
+
+ImporterFeatures MeshBlobImporter::doFeatures() const { return ImporterFeature::OpenData; }
+
+bool MeshBlobImporter::doIsOpened() const { return !!_state; }
+
+void MeshBlobImporter::doClose() { _state = nullptr; }
+
+void MeshBlobImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
+    if(data.size() < sizeof(Implementation::MeshBlobHeader)) {
+        Error{} << "Trade::MeshBlobImporter::openData(): file too short, expected at least" << sizeof(Implementation::MeshBlobHeader) << "bytes but got" << data.size();
+        return;
+    }
+
+    /* Take over the existing array if it's owned or guaranteed to stay in
+       scope and is sufficiently aligned to be accessed directly, otherwise
+       copy the data. Arrays allocated with new[] are aligned for any
+       builtin type. */
+    Containers::Pointer<State> state{InPlaceInit};
+    if((dataFlags & DataFlag::Owned) || ((dataFlags & DataFlag::ExternallyOwned) && reinterpret_cast<std::uintptr_t>(data.data()) % 8 == 0)) {
+        state->data = Utility::move(data);
+        state->externallyOwned = !(dataFlags & DataFlag::Owned);
+    } else {
+        state->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, state->data);
+        state->externallyOwned = false;
+    }
+
+    const Implementation::MeshBlobHeader& header = *reinterpret_cast<const Implementation::MeshBlobHeader*>(state->data.data());
+    if(Containers::StringView{header.magic, 4} != "MBLB"_s) {
+        Error{} << "Trade::MeshBlobImporter::openData(): invalid file signature" << Containers::StringView{header.magic, 4};
+        return;
+    }
+    if(header.version != Implementation::MeshBlobVersion) {
+        Error{} << "Trade::MeshBlobImporter::openData(): unsupported version" << header.version;
+        return;
+    }
+    if(header.bigEndian != Utility::Endianness::isBigEndian()) {
+        Error{} << "Trade::MeshBlobImporter::openData(): unsupported" << (header.bigEndian ? "Big-Endian" : "Little-Endian") << "file";
+        return;
+    }
+    if(header.size != state->data.size()) {
+        Error{} << "Trade::MeshBlobImporter::openData(): file size mismatch, expected" << header.size << "bytes but got" << state->data.size();
+        return;
+    }
+    if(header.dataAlignment < 8 || (header.dataAlignment & (header.dataAlignment - 1))) {
+        Error{} << "Trade::MeshBlobImporter::openData(): expected data alignment to be a power of two and at least 8 bytes but got" << header.dataAlignment;
+        return;
+    }
+    if(!rangeFitsInto(sizeof(Implementation::MeshBlobHeader), UnsignedLong(header.meshCount)*sizeof(Implementation::MeshBlobMesh), header.size)) {
+        Error{} << "Trade::MeshBlobImporter::openData(): file too short for" << header.meshCount << "meshes";
+        return;
+    }
+    const std::size_t sceneOffset = sizeof(Implementation::MeshBlobHeader) + header.meshCount*sizeof(Implementation::MeshBlobMesh);
+    if(!rangeFitsInto(sceneOffset, UnsignedLong(header.sceneCount)*sizeof(Implementation::MeshBlobScene), header.size)) {
+        Error{} << "Trade::MeshBlobImporter::openData(): file too short for" << header.sceneCount << "scenes";
+        return;
+    }
+    const std::size_t materialOffset = sceneOffset + header.sceneCount*sizeof(Implementation::MeshBlobScene);
+    if(!rangeFitsInto(materialOffset, UnsignedLong(header.materialCount)*sizeof(Implementation::MeshBlobMaterial), header.size)) {
+        Error{} << "Trade::MeshBlobImporter::openData(): file too short for" << header.materialCount << "materials";
+        return;
+    }
+    const UnsignedInt imageCounts[]{header.image1DCount, header.image2DCount, header.image3DCount};
+    std::size_t imageOffsets[3];
+    imageOffsets[0] = materialOffset + header.materialCount*sizeof(Implementation::MeshBlobMaterial);
+    for(UnsignedInt dimensions = 1; dimensions <= 3; ++dimensions) {
+        const std::size_t offset = imageOffsets[dimensions - 1];
+        if(!rangeFitsInto(offset, UnsignedLong(imageCounts[dimensions - 1])*sizeof(Implementation::MeshBlobImage), header.size)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): file too short for" << imageCounts[dimensions - 1] << dimensions << Debug::nospace << "D images";
+            return;
+        }
+        if(dimensions != 3)
+            imageOffsets[dimensions] = offset + imageCounts[dimensions - 1]*sizeof(Implementation::MeshBlobImage);
+    }
+
+    /* Validate all meshes upfront so the MeshData construction in doMesh()
+       doesn't assert and doesn't need to check anything */
+    const Containers::ArrayView<const Implementation::MeshBlobMesh> meshes = Containers::arrayCast<const Implementation::MeshBlobMesh>(state->data.sliceSize(sizeof(Implementation::MeshBlobHeader), header.meshCount*sizeof(Implementation::MeshBlobMesh)));
+    for(UnsignedInt i = 0; i != meshes.size(); ++i) {
+        const Implementation::MeshBlobMesh& mesh = meshes[i];
+
+        /* Implementation-specific primitives have no special treatment in the
+           file, so they're allowed */
+        if(!isMeshPrimitiveImplementationSpecific(MeshPrimitive(mesh.primitive)) && (!mesh.primitive || mesh.primitive > UnsignedInt(MeshPrimitive::Meshlets))) {
+            Error{} << "Trade::MeshBlobImporter::openData(): invalid mesh" << i << "primitive" << MeshPrimitive(mesh.primitive);
+            return;
+        }
+        if(mesh.indexType > UnsignedInt(MeshIndexType::UnsignedInt)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): invalid mesh" << i << "index type" << MeshIndexType(mesh.indexType);
+            return;
+        }
+        if((!mesh.indexType || !mesh.indexCount) && (mesh.indexCount || mesh.indexDataSize)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): expected no index data for mesh" << i << "but got" << mesh.indexCount << "indices in" << mesh.indexDataSize << "bytes";
+            return;
+        }
+        if(mesh.indexStride < -32768 || mesh.indexStride > 32767) {
+            Error{} << "Trade::MeshBlobImporter::openData(): expected mesh" << i << "index stride to fit into 16 bits but got" << mesh.indexStride;
+            return;
+        }
+        if(mesh.indexDataOffset % header.dataAlignment || mesh.vertexDataOffset % header.dataAlignment) {
+            Error{} << "Trade::MeshBlobImporter::openData(): mesh" << i << "data not aligned to" << header.dataAlignment << "bytes";
+            return;
+        }
+        if(mesh.attributeOffset % 8) {
+            Error{} << "Trade::MeshBlobImporter::openData(): mesh" << i << "attributes not aligned to 8 bytes";
+            return;
+        }
+        if(!rangeFitsInto(mesh.indexDataOffset, mesh.indexDataSize, header.size) ||
+           !rangeFitsInto(mesh.vertexDataOffset, mesh.vertexDataSize, header.size) ||
+           !rangeFitsInto(mesh.attributeOffset, UnsignedLong(mesh.attributeCount)*sizeof(Implementation::MeshBlobAttribute), header.size) ||
+           !rangeFitsInto(mesh.nameOffset, mesh.nameSize, header.size)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): mesh" << i << "data out of bounds for a file of" << header.size << "bytes";
+            return;
+        }
+        if(mesh.indexType && !fitsInto(mesh.indexOffset, mesh.indexCount, mesh.indexStride, meshIndexTypeSize(MeshIndexType(mesh.indexType)), mesh.indexDataSize)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): mesh" << i << "indices out of bounds for" << mesh.indexDataSize << "bytes of index data";
+            return;
+        }
+
+        const Containers::ArrayView<const Implementation::MeshBlobAttribute> attributes = Containers::arrayCast<const Implementation::MeshBlobAttribute>(state->data.sliceSize(mesh.attributeOffset, mesh.attributeCount*sizeof(Implementation::MeshBlobAttribute)));
+        for(UnsignedInt j = 0; j != attributes.size(); ++j) {
+            const Implementation::MeshBlobAttribute& attribute = attributes[j];
+            const MeshAttribute name = MeshAttribute(attribute.name);
+            const VertexFormat format = VertexFormat(attribute.format);
+
+            if(!isMeshAttributeCustom(name) && (name == MeshAttribute{} || attribute.name > UnsignedShort(MeshAttribute::ObjectId))) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid mesh" << i << "attribute" << j << "name" << name;
+                return;
+            }
+            if(format == VertexFormat{} || isVertexFormatImplementationSpecific(format) || attribute.format > UnsignedInt(VertexFormat::Matrix4x3sNormalizedAligned)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid mesh" << i << "attribute" << j << "format" << format;
+                return;
+            }
+            if(!Implementation::isVertexFormatCompatibleWithAttribute(name, format)) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << format << "is not a valid format for" << name << "in mesh" << i;
+                return;
+            }
+            if(attribute.arraySize && !Implementation::isAttributeArrayAllowed(name)) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << name << "can't be an array attribute in mesh" << i;
+                return;
+            }
+            if(!attribute.arraySize && Implementation::isAttributeArrayExpected(name)) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << name << "has to be an array attribute in mesh" << i;
+                return;
+            }
+            if(attribute.morphTargetId != -1 && (attribute.morphTargetId < 0 || !Implementation::isMorphTargetAllowed(name))) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid morph target ID" << Int(attribute.morphTargetId) << "for" << name << "in mesh" << i;
+                return;
+            }
+            if(!fitsInto(attribute.offset, mesh.vertexCount, attribute.stride, UnsignedLong(vertexFormatSize(format))*Math::max(attribute.arraySize, UnsignedShort{1}), mesh.vertexDataSize)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): mesh" << i << "attribute" << j << "out of bounds for" << mesh.vertexDataSize << "bytes of vertex data";
+                return;
+            }
+        }
+
+        /* Skin joint IDs and weights are paired in order of appearance, their
+           count and array sizes have to match */
+        UnsignedInt jointIdAttributeCount = 0;
+        UnsignedInt weightAttributeCount = 0;
+        for(const Implementation::MeshBlobAttribute& attribute: attributes) {
+            if(MeshAttribute(attribute.name) == MeshAttribute::JointIds)
+                ++jointIdAttributeCount;
+            else if(MeshAttribute(attribute.name) == MeshAttribute::Weights)
+                ++weightAttributeCount;
+        }
+        if(weightAttributeCount != jointIdAttributeCount) {
+            Error{} << "Trade::MeshBlobImporter::openData(): expected" << jointIdAttributeCount << "weight attributes to match joint IDs but got" << weightAttributeCount << "in mesh" << i;
+            return;
+        }
+        for(std::size_t j = 0, k = 0, pair = 0; j != attributes.size(); ++j) {
+            if(MeshAttribute(attributes[j].name) != MeshAttribute::JointIds) continue;
+            while(MeshAttribute(attributes[k].name) != MeshAttribute::Weights) ++k;
+            if(attributes[k].arraySize != attributes[j].arraySize) {
+                Error{} << "Trade::MeshBlobImporter::openData(): expected" << attributes[j].arraySize << "array items for weight attribute" << pair << "to match joint IDs but got" << attributes[k].arraySize << "in mesh" << i;
+                return;
+            }
+            ++k;
+            ++pair;
+        }
+    }
+
+    /* Validate all scenes so the SceneFieldData and SceneData construction in
+       doScene() doesn't assert either. This replicates all checks done by
+       SceneData, and additionally checks that string fields reference only
+       the string data. Object mapping, parent or other index values are not
+       checked, same as SceneData doesn't check them. */
+    const Containers::ArrayView<const Implementation::MeshBlobScene> scenes = Containers::arrayCast<const Implementation::MeshBlobScene>(state->data.sliceSize(sceneOffset, header.sceneCount*sizeof(Implementation::MeshBlobScene)));
+    for(UnsignedInt i = 0; i != scenes.size(); ++i) {
+        const Implementation::MeshBlobScene& scene = scenes[i];
+        const SceneMappingType mappingType = SceneMappingType(scene.mappingType);
+
+        if(!scene.mappingType || scene.mappingType > UnsignedInt(SceneMappingType::UnsignedLong)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): invalid scene" << i << "mapping type" << mappingType;
+            return;
+        }
+        if((mappingType == SceneMappingType::UnsignedByte && scene.mappingBound > 0xffull) ||
+           (mappingType == SceneMappingType::UnsignedShort && scene.mappingBound > 0xffffull) ||
+           (mappingType == SceneMappingType::UnsignedInt && scene.mappingBound > 0xffffffffull)) {
+            Error{} << "Trade::MeshBlobImporter::openData():" << mappingType << "is too small for" << scene.mappingBound << "objects in scene" << i;
+            return;
+        }
+        if(scene.dataOffset % header.dataAlignment) {
+            Error{} << "Trade::MeshBlobImporter::openData(): scene" << i << "data not aligned to" << header.dataAlignment << "bytes";
+            return;
+        }
+        if(scene.fieldOffset % 8) {
+            Error{} << "Trade::MeshBlobImporter::openData(): scene" << i << "fields not aligned to 8 bytes";
+            return;
+        }
+        if(!rangeFitsInto(scene.dataOffset, scene.dataSize, header.size) ||
+           !rangeFitsInto(scene.fieldOffset, UnsignedLong(scene.fieldCount)*sizeof(Implementation::MeshBlobSceneField), header.size) ||
+           !rangeFitsInto(scene.nameOffset, scene.nameSize, header.size)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): scene" << i << "data out of bounds for a file of" << header.size << "bytes";
+            return;
+        }
+
+        const Containers::ArrayView<const char> data = state->data.sliceSize(scene.dataOffset, scene.dataSize);
+        const Containers::ArrayView<const Implementation::MeshBlobSceneField> fields = Containers::arrayCast<const Implementation::MeshBlobSceneField>(state->data.sliceSize(scene.fieldOffset, scene.fieldCount*sizeof(Implementation::MeshBlobSceneField)));
+        /* Builtin field names are all less than 32 */
+        UnsignedInt builtinFieldsPresent = 0;
+        /* Translation, rotation and scaling and mesh and mesh material fields
+           have to share the same object mapping */
+        const Implementation::MeshBlobSceneField* trsField = nullptr;
+        const Implementation::MeshBlobSceneField* meshMaterialField = nullptr;
+        UnsignedInt dimensions = 0;
+        bool hasSkin = false;
+        for(UnsignedInt j = 0; j != fields.size(); ++j) {
+            const Implementation::MeshBlobSceneField& field = fields[j];
+            const SceneField name = SceneField(field.name);
+            const SceneFieldType type = SceneFieldType(field.fieldType);
+            const SceneFieldFlags flags{field.flags};
+
+            if(!isSceneFieldCustom(name) && (name == SceneField{} || field.name > UnsignedInt(SceneField::ImporterState))) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid scene" << i << "field" << j << "name" << name;
+                return;
+            }
+            /* Pointers make no sense in a file */
+            if(type == SceneFieldType{} || field.fieldType >= UnsignedShort(SceneFieldType::Pointer)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid scene" << i << "field" << j << "type" << type;
+                return;
+            }
+            if(!Implementation::isSceneFieldTypeCompatibleWithField(name, type)) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << type << "is not a valid type for" << name << "in scene" << i;
+                return;
+            }
+            if(field.fieldArraySize && (!Implementation::isSceneFieldArrayAllowed(name) || Implementation::isSceneFieldTypeString(type))) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << name << "can't be an array field in scene" << i;
+                return;
+            }
+            if(flags & ~(SceneFieldFlag::ImplicitMapping|SceneFieldFlag::NullTerminatedString|SceneFieldFlag::MultiEntry) ||
+              ((flags & SceneFieldFlag::NullTerminatedString) && !Implementation::isSceneFieldTypeString(type)) ||
+              (flags & Implementation::disallowedSceneFieldFlagsFor(name))) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid flags" << flags << "for" << name << "of" << type << "in scene" << i;
+                return;
+            }
+            if(!isSceneFieldCustom(name)) {
+                if(builtinFieldsPresent & (1 << field.name)) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): duplicate field" << name << "in scene" << i;
+                    return;
+                }
+                builtinFieldsPresent |= 1 << field.name;
+            } else for(UnsignedInt k = 0; k != j; ++k) {
+                if(fields[k].name == field.name) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): duplicate field" << name << "in scene" << i;
+                    return;
+                }
+            }
+
+            /* Unlike in SceneData, offsets of empty fields are checked as
+               well */
+            const UnsignedLong fieldTypeSize = type == SceneFieldType::Bit ? 1 : sceneFieldTypeSize(type);
+            if(type == SceneFieldType::Bit && field.fieldBitOffset >= 8) {
+                Error{} << "Trade::MeshBlobImporter::openData(): expected scene" << i << "field" << j << "bit offset to be less than 8 but got" << field.fieldBitOffset;
+                return;
+            }
+            if(type != SceneFieldType::Bit && field.fieldBitOffset) {
+                Error{} << "Trade::MeshBlobImporter::openData(): expected no bit offset for scene" << i << "field" << j << "of" << type;
+                return;
+            }
+            if(!fitsInto(field.mappingOffset, field.size, field.mappingStride, sceneMappingTypeSize(mappingType), scene.dataSize) ||
+               (type == SceneFieldType::Bit ?
+                    field.fieldOffset > scene.dataSize || !fitsInto(field.fieldOffset*8 + field.fieldBitOffset, field.size, field.fieldStride, Math::max(field.fieldArraySize, UnsignedShort{1}), scene.dataSize*8) :
+                    !fitsInto(field.fieldOffset, field.size, field.fieldStride, fieldTypeSize*Math::max(field.fieldArraySize, UnsignedShort{1}), scene.dataSize)) ||
+               (Implementation::isSceneFieldTypeString(type) && field.stringOffset > scene.dataSize)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): scene" << i << "field" << j << "out of bounds for" << scene.dataSize << "bytes of scene data";
+                return;
+            }
+            if(Implementation::isSceneFieldTypeString(type) && !stringsInBounds(data, field)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): scene" << i << "field" << j << "strings out of bounds for" << scene.dataSize - field.stringOffset << "bytes of string data";
+                return;
+            }
+
+            const Implementation::MeshBlobSceneField** sharedField = nullptr;
+            if(name == SceneField::Translation || name == SceneField::Rotation || name == SceneField::Scaling)
+                sharedField = &trsField;
+            else if(name == SceneField::Mesh || name == SceneField::MeshMaterial)
+                sharedField = &meshMaterialField;
+            if(sharedField) {
+                if(*sharedField && ((*sharedField)->mappingOffset != field.mappingOffset || (*sharedField)->size != field.size || (*sharedField)->mappingStride != field.mappingStride)) {
+                    Error{} << "Trade::MeshBlobImporter::openData():" << name << "mapping data in scene" << i << "is different from" << SceneField((*sharedField)->name) << "mapping data";
+                    return;
+                }
+                *sharedField = &field;
+            }
+
+            if(name == SceneField::Transformation || name == SceneField::Translation || name == SceneField::Rotation || name == SceneField::Scaling) {
+                const UnsignedInt fieldDimensions = sceneFieldDimensions(type);
+                if(dimensions && dimensions != fieldDimensions) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): expected a" << dimensions << Debug::nospace << "D" << name << "field in scene" << i << "but got" << type;
+                    return;
+                }
+                dimensions = fieldDimensions;
+            } else if(name == SceneField::Skin) hasSkin = true;
+        }
+
+        if(hasSkin && !dimensions) {
+            Error{} << "Trade::MeshBlobImporter::openData(): a skin field requires some transformation field to be present in scene" << i;
+            return;
+        }
+    }
+
+    /* Validate all materials so the MaterialAttributeData and MaterialData
+       construction in doMaterial() doesn't assert. The attributes are expected
+       to be sorted in each layer already, so there's no need to sort them on
+       import. */
+    const Containers::ArrayView<const Implementation::MeshBlobMaterial> materials = Containers::arrayCast<const Implementation::MeshBlobMaterial>(state->data.sliceSize(materialOffset, header.materialCount*sizeof(Implementation::MeshBlobMaterial)));
+    for(UnsignedInt i = 0; i != materials.size(); ++i) {
+        const Implementation::MeshBlobMaterial& material = materials[i];
+
+        if(material.types & ~UnsignedInt(MaterialType::Flat|MaterialType::Phong|MaterialType::PbrMetallicRoughness|MaterialType::PbrSpecularGlossiness|MaterialType::PbrClearCoat)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): invalid material" << i << "types" << MaterialTypes{material.types};
+            return;
+        }
+        if(material.attributeOffset % 8 || material.layerOffset % 4) {
+            Error{} << "Trade::MeshBlobImporter::openData(): material" << i << "attributes not aligned";
+            return;
+        }
+        if(!rangeFitsInto(material.attributeOffset, UnsignedLong(material.attributeCount)*sizeof(Implementation::MeshBlobMaterialAttribute), header.size) ||
+           !rangeFitsInto(material.layerOffset, UnsignedLong(material.layerCount)*sizeof(UnsignedInt), header.size) ||
+           !rangeFitsInto(material.nameOffset, material.nameSize, header.size)) {
+            Error{} << "Trade::MeshBlobImporter::openData(): material" << i << "data out of bounds for a file of" << header.size << "bytes";
+            return;
+        }
+
+        const Containers::ArrayView<const Implementation::MeshBlobMaterialAttribute> attributes = Containers::arrayCast<const Implementation::MeshBlobMaterialAttribute>(state->data.sliceSize(material.attributeOffset, material.attributeCount*sizeof(Implementation::MeshBlobMaterialAttribute)));
+        for(UnsignedInt j = 0; j != attributes.size(); ++j) {
+            const Implementation::MeshBlobMaterialAttribute& attribute = attributes[j];
+            const MaterialAttributeType type = MaterialAttributeType(attribute.type);
+
+            /* Pointers make no sense in a file */
+            if(type == MaterialAttributeType{} || attribute.type > UnsignedInt(MaterialAttributeType::TextureSwizzle) || type == MaterialAttributeType::Pointer || type == MaterialAttributeType::MutablePointer) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid material" << i << "attribute" << j << "type" << type;
+                return;
+            }
+            if(!rangeFitsInto(attribute.nameOffset, attribute.nameSize, header.size) ||
+               !rangeFitsInto(attribute.valueOffset, attribute.valueSize, header.size)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): material" << i << "attribute" << j << "out of bounds for a file of" << header.size << "bytes";
+                return;
+            }
+
+            /* The name is stored null-terminated inside MaterialAttributeData,
+               so it can't contain a null byte */
+            const Containers::StringView name{state->data.data() + attribute.nameOffset, attribute.nameSize};
+            if(name.isEmpty() || std::memchr(name.data(), '\0', name.size())) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid material" << i << "attribute" << j << "name";
+                return;
+            }
+
+            /* Strings have a size byte and two null terminators, buffers a
+               size byte and a single null terminator, other types have a
+               fixed size */
+            UnsignedLong maxValueSize = Implementation::MaterialAttributeDataSize - 2;
+            if(type == MaterialAttributeType::String)
+                maxValueSize -= 2;
+            else if(type == MaterialAttributeType::Buffer)
+                maxValueSize -= 1;
+            else if(attribute.valueSize != materialAttributeTypeSize(type)) {
+                Error{} << "Trade::MeshBlobImporter::openData(): expected" << materialAttributeTypeSize(type) << "bytes for" << type << "material" << i << "attribute" << j << "but got" << attribute.valueSize;
+                return;
+            }
+            if(UnsignedLong(attribute.nameSize) + attribute.valueSize > maxValueSize) {
+                Error{} << "Trade::MeshBlobImporter::openData(): material" << i << "attribute" << name << "and its value too long, expected at most" << maxValueSize << "bytes in total but got" << UnsignedLong(attribute.nameSize) + attribute.valueSize;
+                return;
+            }
+        }
+
+        const UnsignedInt implicitLayerData[]{material.attributeCount};
+        const Containers::ArrayView<const UnsignedInt> layers = material.layerCount ? Containers::arrayCast<const UnsignedInt>(state->data.sliceSize(material.layerOffset, material.layerCount*sizeof(UnsignedInt))) : Containers::arrayView(implicitLayerData);
+        for(UnsignedInt j = 0, begin = 0; j != layers.size(); ++j) {
+            const UnsignedInt end = layers[j];
+            if(end < begin || end > material.attributeCount) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid material" << i << "layer" << j << "range (" << Debug::nospace << begin << Debug::nospace << "," << end << Debug::nospace << ") for" << material.attributeCount << "attributes";
+                return;
+            }
+            for(UnsignedInt k = begin + 1; k < end; ++k) {
+                const Implementation::MeshBlobMaterialAttribute& a = attributes[k - 1];
+                const Implementation::MeshBlobMaterialAttribute& b = attributes[k];
+                if(Containers::StringView{state->data.data() + a.nameOffset, a.nameSize} >= Containers::StringView{state->data.data() + b.nameOffset, b.nameSize}) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): material" << i << "layer" << j << "attributes not sorted or not unique";
+                    return;
+                }
+            }
+            begin = end;
+        }
+        if(layers.back() != material.attributeCount) {
+            Error{} << "Trade::MeshBlobImporter::openData(): material" << i << "last layer offset" << layers.back() << "too short for" << material.attributeCount << "attributes";
+            return;
+        }
+    }
+
+    /* Validate all images so the ImageData construction in doImage*D()
+       doesn't assert */
+    Containers::ArrayView<const Implementation::MeshBlobImage> images[3];
+    for(UnsignedInt dimensions = 1; dimensions <= 3; ++dimensions) {
+        images[dimensions - 1] = Containers::arrayCast<const Implementation::MeshBlobImage>(state->data.sliceSize(imageOffsets[dimensions - 1], imageCounts[dimensions - 1]*sizeof(Implementation::MeshBlobImage)));
+        for(UnsignedInt i = 0; i != images[dimensions - 1].size(); ++i) {
+            const Implementation::MeshBlobImage& image = images[dimensions - 1][i];
+
+            /* Unused size components are treated as 1, same as in the
+               ImageData internals */
+            Vector3i paddedSize{1};
+            for(UnsignedInt j = 0; j != dimensions; ++j)
+                paddedSize[j] = image.size[j];
+
+            if(image.compressed > 1) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "compression flag" << image.compressed;
+                return;
+            }
+            if(paddedSize.min() < 0 || image.skip[0] < 0 || image.skip[1] < 0 || image.skip[2] < 0 || image.rowLength < 0 || image.imageHeight < 0) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "size or pixel storage";
+                return;
+            }
+            if(image.dataOffset % header.dataAlignment) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << dimensions << Debug::nospace << "D image" << i << "data not aligned to" << header.dataAlignment << "bytes";
+                return;
+            }
+            if(!rangeFitsInto(image.dataOffset, image.dataSize, header.size) ||
+               !rangeFitsInto(image.nameOffset, image.nameSize, header.size)) {
+                Error{} << "Trade::MeshBlobImporter::openData():" << dimensions << Debug::nospace << "D image" << i << "data out of bounds for a file of" << header.size << "bytes";
+                return;
+            }
+
+            if(image.compressed) {
+                const CompressedPixelFormat format = CompressedPixelFormat(image.format);
+                if(!isCompressedPixelFormatImplementationSpecific(format) && (format == CompressedPixelFormat{} || image.format > UnsignedInt(CompressedPixelFormat::PvrtcRGBA4bppSrgb))) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "format" << format;
+                    return;
+                }
+                if(image.compressedBlockSize[0] < 0 || image.compressedBlockSize[1] < 0 || image.compressedBlockSize[2] < 0 || image.compressedBlockDataSize < 0) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "size or pixel storage";
+                    return;
+                }
+            } else {
+                const PixelFormat format = PixelFormat(image.format);
+                if(!isPixelFormatImplementationSpecific(format) && (format == PixelFormat{} || image.format > UnsignedInt(PixelFormat::Depth32FStencil8UI))) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "format" << format;
+                    return;
+                }
+                if(!image.pixelSize || image.pixelSize > 255 || (!isPixelFormatImplementationSpecific(format) && image.pixelSize != pixelFormatSize(format))) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "pixel size" << image.pixelSize << "for" << format;
+                    return;
+                }
+                if(image.alignment != 1 && image.alignment != 2 && image.alignment != 4 && image.alignment != 8) {
+                    Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "size or pixel storage";
+                    return;
+                }
+                const UnsignedLong expectedDataSize = imageDataSize(image, paddedSize);
+                if(expectedDataSize > image.dataSize) {
+                    Error{} << "Trade::MeshBlobImporter::openData():" << dimensions << Debug::nospace << "D image" << i << "data too small, got" << image.dataSize << "but expected at least" << expectedDataSize << "bytes";
+                    return;
+                }
+            }
+
+            /* Only 2D and 3D images have flags, only 3D images have
+               restrictions on them */
+            const UnsignedShort flagMask = dimensions == 1 ? 0 : dimensions == 2 ? UnsignedShort(ImageFlag2D::Array) : UnsignedShort(ImageFlag3D::Array|ImageFlag3D::CubeMap);
+            if((image.flags & ~flagMask) || (dimensions == 3 && (image.flags & UnsignedShort(ImageFlag3D::CubeMap)) && (paddedSize.x() != paddedSize.y() || ((image.flags & UnsignedShort(ImageFlag3D::Array)) ? paddedSize.z() % 6 : paddedSize.z() != 6)))) {
+                Error{} << "Trade::MeshBlobImporter::openData(): invalid" << dimensions << Debug::nospace << "D image" << i << "flags" << Debug::hex << image.flags << "for a size of" << Debug::packed << paddedSize;
+                return;
+            }
+        }
+    }
+
+    state->meshes = meshes;
+    state->scenes = scenes;
+    state->materials = materials;
+    for(UnsignedInt i = 0; i != 3; ++i)
+        state->images[i] = images[i];
+    _state = Utility::move(state);
+}
+
+UnsignedInt MeshBlobImporter::doSceneCount() const {
+    return _state->scenes.size();
+}
+
+UnsignedLong MeshBlobImporter::doObjectCount() const {
+    UnsignedLong count = 0;
+    for(const Implementation::MeshBlobScene& scene: _state->scenes)
+        count = Math::max(count, scene.mappingBound);
+    return count;
+}
+
+Int MeshBlobImporter::doSceneForName(const Containers::StringView name) {
+    for(UnsignedInt i = 0; i != _state->scenes.size(); ++i)
+        if(doSceneName(i) == name) return i;
+    return -1;
+}
+
+Containers::String MeshBlobImporter::doSceneName(const UnsignedInt id) {
+    const Implementation::MeshBlobScene& scene = _state->scenes[id];
+    return Containers::StringView{_state->data.data() + scene.nameOffset, scene.nameSize};
+}
+
+Containers::Optional<SceneData> MeshBlobImporter::doScene(const UnsignedInt id) {
+    const Implementation::MeshBlobScene& scene = _state->scenes[id];
+    const SceneMappingType mappingType = SceneMappingType(scene.mappingType);
+
+    /* The fields are the only thing that has to be allocated always. They're
+       all offset-only so they can be used with both the referenced and the
+       copied data. */
+    const Containers::ArrayView<const Implementation::MeshBlobSceneField> fieldData = Containers::arrayCast<const Implementation::MeshBlobSceneField>(_state->data.sliceSize(scene.fieldOffset, scene.fieldCount*sizeof(Implementation::MeshBlobSceneField)));
+    Containers::Array<SceneFieldData> fields{ValueInit, fieldData.size()};
+    for(std::size_t i = 0; i != fieldData.size(); ++i) {
+        const Implementation::MeshBlobSceneField& field = fieldData[i];
+        const SceneFieldType type = SceneFieldType(field.fieldType);
+        const SceneFieldFlags flags{field.flags};
+        if(type == SceneFieldType::Bit)
+            fields[i] = SceneFieldData{SceneField(field.name), std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), field.mappingStride, std::size_t(field.fieldOffset), field.fieldBitOffset, field.fieldStride, field.fieldArraySize, flags};
+        else if(Implementation::isSceneFieldTypeString(type))
+            fields[i] = SceneFieldData{SceneField(field.name), std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), field.mappingStride, std::size_t(field.stringOffset), type, std::size_t(field.fieldOffset), field.fieldStride, flags};
+        else
+            fields[i] = SceneFieldData{SceneField(field.name), std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), field.mappingStride, type, std::size_t(field.fieldOffset), field.fieldStride, field.fieldArraySize, flags};
+    }
+
+    const Containers::ArrayView<const char> data = _state->data.sliceSize(scene.dataOffset, scene.dataSize);
+
+    /* If the memory stays in scope, reference it directly */
+    if(_state->externallyOwned)
+        return SceneData{mappingType, scene.mappingBound, DataFlag::ExternallyOwned, data, Utility::move(fields)};
+
+    /* Otherwise the data have to be copied as the importer can get closed
+       while the scene is still alive */
+    Containers::Array<char> dataCopy{NoInit, data.size()};
+    Utility::copy(data, dataCopy);
+    return SceneData{mappingType, scene.mappingBound, Utility::move(dataCopy), Utility::move(fields)};
+}
+
+UnsignedInt MeshBlobImporter::doMeshCount() const {
+    return _state->meshes.size();
+}
+
+Int MeshBlobImporter::doMeshForName(const Containers::StringView name) {
+    for(UnsignedInt i = 0; i != _state->meshes.size(); ++i)
+        if(doMeshName(i) == name) return i;
+    return -1;
+}
+
+Containers::String MeshBlobImporter::doMeshName(const UnsignedInt id) {
+    const Implementation::MeshBlobMesh& mesh = _state->meshes[id];
+    return Containers::StringView{_state->data.data() + mesh.nameOffset, mesh.nameSize};
+}
+
+Containers::Optional<MeshData> MeshBlobImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    const Implementation::MeshBlobMesh& mesh = _state->meshes[id];
+
+    /* The attributes are the only thing that has to be allocated always */
+    const Containers::ArrayView<const Implementation::MeshBlobAttribute> attributeData = Containers::arrayCast<const Implementation::MeshBlobAttribute>(_state->data.sliceSize(mesh.attributeOffset, mesh.attributeCount*sizeof(Implementation::MeshBlobAttribute)));
+    Containers::Array<MeshAttributeData> attributes{ValueInit, attributeData.size()};
+    for(std::size_t i = 0; i != attributeData.size(); ++i) {
+        const Implementation::MeshBlobAttribute& attribute = attributeData[i];
+        attributes[i] = MeshAttributeData{MeshAttribute(attribute.name), VertexFormat(attribute.format), std::size_t(attribute.offset), mesh.vertexCount, attribute.stride, attribute.arraySize, attribute.morphTargetId};
+    }
+
+    const Containers::ArrayView<const char> indexData = _state->data.sliceSize(mesh.indexDataOffset, mesh.indexDataSize);
+    const Containers::ArrayView<const char> vertexData = _state->data.sliceSize(mesh.vertexDataOffset, mesh.vertexDataSize);
+
+    /* If the memory stays in scope, reference it directly */
+    if(_state->externallyOwned) {
+        const MeshIndexData indices = mesh.indexType ?
+            MeshIndexData{MeshIndexType(mesh.indexType), Containers::StridedArrayView1D<const void>{indexData, indexData.data() + mesh.indexOffset, mesh.indexCount, mesh.indexStride}} : MeshIndexData{};
+        return MeshData{MeshPrimitive(mesh.primitive),
+            DataFlag::ExternallyOwned, indexData, indices,
+            DataFlag::ExternallyOwned, vertexData, Utility::move(attributes),
+            mesh.vertexCount};
+    }
+
+    /* Otherwise the data have to be copied as the importer can get closed
+       while the mesh is still alive */
+    Containers::Array<char> indexDataCopy{NoInit, indexData.size()};
+    Utility::copy(indexData, indexDataCopy);
+    Containers::Array<char> vertexDataCopy{NoInit, vertexData.size()};
+    Utility::copy(vertexData, vertexDataCopy);
+    const MeshIndexData indices = mesh.indexType ?
+        MeshIndexData{MeshIndexType(mesh.indexType), Containers::StridedArrayView1D<const void>{indexDataCopy, indexDataCopy.data() + mesh.indexOffset, mesh.indexCount, mesh.indexStride}} : MeshIndexData{};
+    return MeshData{MeshPrimitive(mesh.primitive),
+        Utility::move(indexDataCopy), indices,
+        Utility::move(vertexDataCopy), Utility::move(attributes),
+        mesh.vertexCount};
+}
+
+UnsignedInt MeshBlobImporter::doMaterialCount() const {
+    return _state->materials.size();
+}
+
+Int MeshBlobImporter::doMaterialForName(const Containers::StringView name) {
+    for(UnsignedInt i = 0; i != _state->materials.size(); ++i)
+        if(doMaterialName(i) == name) return i;
+    return -1;
+}
+
+Containers::String MeshBlobImporter::doMaterialName(const UnsignedInt id) {
+    const Implementation::MeshBlobMaterial& material = _state->materials[id];
+    return Containers::StringView{_state->data.data() + material.nameOffset, material.nameSize};
+}
+
+Containers::Optional<MaterialData> MeshBlobImporter::doMaterial(const UnsignedInt id) {
+    const Implementation::MeshBlobMaterial& material = _state->materials[id];
+
+    /* Material attributes are a packed representation that can't be
+       referenced from the file, so they're always copied */
+    const Containers::ArrayView<const Implementation::MeshBlobMaterialAttribute> attributeData = Containers::arrayCast<const Implementation::MeshBlobMaterialAttribute>(_state->data.sliceSize(material.attributeOffset, material.attributeCount*sizeof(Implementation::MeshBlobMaterialAttribute)));
+    Containers::Array<MaterialAttributeData> attributes{ValueInit, attributeData.size()};
+    for(std::size_t i = 0; i != attributeData.size(); ++i) {
+        const Implementation::MeshBlobMaterialAttribute& attribute = attributeData[i];
+        const MaterialAttributeType type = MaterialAttributeType(attribute.type);
+        const Containers::StringView name{_state->data.data() + attribute.nameOffset, attribute.nameSize};
+        const char* const value = _state->data.data() + attribute.valueOffset;
+        /* Strings and buffers are passed through a view, the rest directly
+           as the value pointer */
+        if(type == MaterialAttributeType::String) {
+            const Containers::StringView string{value, attribute.valueSize};
+            attributes[i] = MaterialAttributeData{name, type, &string};
+        } else if(type == MaterialAttributeType::Buffer) {
+            const Containers::ArrayView<const void> buffer{value, attribute.valueSize};
+            attributes[i] = MaterialAttributeData{name, type, &buffer};
+        } else attributes[i] = MaterialAttributeData{name, type, value};
+    }
+
+    Containers::Array<UnsignedInt> layers{NoInit, material.layerCount};
+    Utility::copy(Containers::arrayCast<const UnsignedInt>(_state->data.sliceSize(material.layerOffset, material.layerCount*sizeof(UnsignedInt))), layers);
+
+    return MaterialData{MaterialTypes{material.types}, Utility::move(attributes), Utility::move(layers)};
+}
+
+UnsignedInt MeshBlobImporter::doImage1DCount() const {
+    return _state->images[0].size();
+}
+
+Int MeshBlobImporter::doImage1DForName(const Containers::StringView name) {
+    for(UnsignedInt i = 0; i != _state->images[0].size(); ++i)
+        if(doImage1DName(i) == name) return i;
+    return -1;
+}
+
+Containers::String MeshBlobImporter::doImage1DName(const UnsignedInt id) {
+    const Implementation::MeshBlobImage& image = _state->images[0][id];
+    return Containers::StringView{_state->data.data() + image.nameOffset, image.nameSize};
+}
+
+Containers::Optional<ImageData1D> MeshBlobImporter::doImage1D(const UnsignedInt id, UnsignedInt) {
+    return importImage<1>(_state->data, _state->externallyOwned, _state->images[0][id]);
+}
+
+UnsignedInt MeshBlobImporter::doImage2DCount() const {
+    return _state->images[1].size();
+}
+
+Int MeshBlobImporter::doImage2DForName(const Containers::StringView name) {
+    for(UnsignedInt i = 0; i != _state->images[1].size(); ++i)
+        if(doImage2DName(i) == name) return i;
+    return -1;
+}
+
+Containers::String MeshBlobImporter::doImage2DName(const UnsignedInt id) {
+    const Implementation::MeshBlobImage& image = _state->images[1][id];
+    return Containers::StringView{_state->data.data() + image.nameOffset, image.nameSize};
+}
+
+Containers::Optional<ImageData2D> MeshBlobImporter::doImage2D(const UnsignedInt id, UnsignedInt) {
+    return importImage<2>(_state->data, _state->externallyOwned, _state->images[1][id]);
+}
+
+UnsignedInt MeshBlobImporter::doImage3DCount() const {
+    return _state->images[2].size();
+}
+
+Int MeshBlobImporter::doImage3DForName(const Containers::StringView name) {
+    for(UnsignedInt i = 0; i != _state->images[2].size(); ++i)
+        if(doImage3DName(i) == name) return i;
+    return -1;
+}
+
+Containers::String MeshBlobImporter::doImage3DName(const UnsignedInt id) {
+    const Implementation::MeshBlobImage& image = _state->images[2][id];
+    return Containers::StringView{_state->data.data() + image.nameOffset, image.nameSize};
+}
+
+Containers::Optional<ImageData3D> MeshBlobImporter::doImage3D(const UnsignedInt id, UnsignedInt) {
+    return importImage<3>(_state->data, _state->externallyOwned, _state->images[2][id]);
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MeshBlobImporter, Magnum::Trade::MeshBlobImporter,
+    MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE)
@@ -0,0 +1,209 @@
+#ifndef Magnum_Trade_MeshBlobImporter_h
+#define Magnum_Trade_MeshBlobImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshBlobImporter
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MeshBlobImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHBLOBIMPORTER_BUILD_STATIC
+    #ifdef MeshBlobImporter_EXPORTS
+        #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHBLOBIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MESHBLOBIMPORTER_EXPORT
+#define MAGNUM_MESHBLOBIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob importer plugin
+@m_since_latest
+
+Imports meshes, scenes, materials and images from binary blobs (`*.mblob`)
+produced by the @ref MeshBlobSceneConverter plugin. The blobs store mesh,
+scene and image data in the same layout as in @ref MeshData, @ref SceneData
+and @ref ImageData, which makes it possible to import them directly from a
+memory-mapped file without any parsing or copying.
+
+@section Trade-MeshBlobImporter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractImporter interface. See its documentation for
+    introduction and usage examples.
+
+This plugin depends on the @ref Trade library and is built if
+`MAGNUM_WITH_MESHBLOBIMPORTER` is enabled when building Magnum. To use as a
+dynamic plugin, load @cpp "MeshBlobImporter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MESHBLOBIMPORTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MeshBlobImporter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MeshBlobImporter` component of the `Magnum` package and
+link to the `Magnum::MeshBlobImporter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MeshBlobImporter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MeshBlobImporter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MeshBlobImporter-behavior Behavior and limitations
+
+The file can contain any number of meshes, which are imported with the same
+primitive, index and vertex data layout, attribute formats, array sizes and
+morph target IDs as they were saved with. Mesh names are imported as well,
+custom attributes are imported without names. Files with a different
+endianness than the machine are not supported.
+
+Scenes are imported with the same mapping type, field layout, flags and array
+sizes as they were saved with, including bit and string fields. Scene names
+are imported, custom fields are imported without names and there are no
+object names. @ref objectCount() is the largest mapping bound of all scenes.
+
+Materials are imported with the same types, layers and attributes as they
+were saved with, together with their names. Images are imported with the same
+pixel storage, format, flags and data layout, both uncompressed and compressed
+ones, with their names and always with just a single level.
+
+The file header and the layout of all meshes, scenes, materials and images is
+validated already when opening the file, so @ref mesh(), @ref scene(),
+@ref material() and @ref image2D() don't need to perform any checks. That
+includes checking that all strings in scene string fields are in bounds.
+Object mapping, parent, mesh and other index values in scenes aren't checked,
+same as @ref SceneData itself doesn't check them.
+
+@section Trade-MeshBlobImporter-zero-copy Zero-copy import
+
+If the file is opened with @ref openMemory(), for example with a
+memory-mapped file, the imported meshes have @ref DataFlag::ExternallyOwned
+set for both @ref MeshData::indexDataFlags() and
+@relativeref{MeshData,vertexDataFlags()} and reference the index and vertex
+data directly, with only the attribute metadata being allocated. Similarly,
+imported scenes and images have @ref DataFlag::ExternallyOwned set in
+@ref SceneData::dataFlags() and @ref ImageData::dataFlags() and reference the
+data directly, with only the scene field metadata being allocated. Materials
+are always copied as their attributes are stored in a packed representation
+that can't be referenced. The memory thus has to stay in scope for as long as
+the imported meshes, scenes and images are used. As the data in the file are
+aligned to page boundaries, the import cost is bound only by page faults on
+first access:
+
+@snippet plugins.cpp MeshBlobImporter-zero-copy
+
+In other cases, such as with @ref openData() or @ref openFile(), the data are
+copied to each imported @ref MeshData, @ref SceneData and @ref ImageData. A
+copy is made also if the memory passed to @ref openMemory() isn't aligned to
+at least 8 bytes, as the file header and all metadata are accessed directly.
+*/
+class MAGNUM_MESHBLOBIMPORTER_EXPORT MeshBlobImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshBlobImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshBlobImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~MeshBlobImporter();
+
+    private:
+        struct State;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedInt doSceneCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedLong doObjectCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Int doSceneForName(Containers::StringView name) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::String doSceneName(UnsignedInt id) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::Optional<SceneData> doScene(UnsignedInt id) override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Int doMeshForName(Containers::StringView name) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::String doMeshName(UnsignedInt id) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedInt doMaterialCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Int doMaterialForName(Containers::StringView name) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::String doMaterialName(UnsignedInt id) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Int doImage1DForName(Containers::StringView name) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::String doImage1DName(UnsignedInt id) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Int doImage2DForName(Containers::StringView name) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::String doImage2DName(UnsignedInt id) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MESHBLOBIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Int doImage3DForName(Containers::StringView name) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::String doImage3DName(UnsignedInt id) override;
+        MAGNUM_MESHBLOBIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,799 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/ImageFlags.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+using namespace Containers::Literals;
+
+struct MeshBlobImporterTest: TestSuite::Tester {
+    explicit MeshBlobImporterTest();
+
+    void invalid();
+    void invalidFileSize();
+    void invalidSkinAttributes();
+    void invalidContents();
+
+    void openData();
+    void openMemory();
+    void openMemoryUnaligned();
+    void nonIndexed();
+    void names();
+
+    void scene();
+    void material();
+    void image();
+
+    void openTwice();
+    void importTwice();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+struct Vertex {
+    Vector3 position;
+    Vector2 textureCoordinates;
+};
+
+const Vertex Vertices[]{
+    {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
+    {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f}},
+    {{0.0f, 1.0f, 0.0f}, {0.0f, 1.0f}},
+    {{1.0f, 1.0f, 0.0f}, {1.0f, 1.0f}},
+};
+
+const UnsignedShort Indices[]{0, 1, 2, 2, 1, 3};
+
+/* Assembles a file with a single mesh named "quad" the same way as
+   MeshBlobSceneConverter does, with the data aligned to 16 bytes. The header
+   is 48 bytes, the mesh 88 bytes, the two attributes 48 bytes and the name 4
+   bytes, so the index data are at 192 and vertex data at 208 bytes, with the
+   whole file being 288 bytes. The tests assume a Little-Endian machine, like
+   elsewhere. */
+Containers::Array<char> file(bool indexed = true) {
+    const std::size_t meshOffset = sizeof(Implementation::MeshBlobHeader);
+    const std::size_t attributeOffset = meshOffset + sizeof(Implementation::MeshBlobMesh);
+    const std::size_t nameOffset = attributeOffset + 2*sizeof(Implementation::MeshBlobAttribute);
+    const std::size_t indexDataOffset = (nameOffset + 4 + 15) & ~15;
+    const std::size_t indexDataSize = indexed ? sizeof(Indices) : 0;
+    const std::size_t vertexDataOffset = (indexDataOffset + indexDataSize + 15) & ~15;
+    Containers::Array<char> out{ValueInit, vertexDataOffset + sizeof(Vertices)};
+
+    Implementation::MeshBlobHeader& header = *reinterpret_cast<Implementation::MeshBlobHeader*>(out.data());
+    header.magic[0] = 'M';
+    header.magic[1] = 'B';
+    header.magic[2] = 'L';
+    header.magic[3] = 'B';
+    header.version = Implementation::MeshBlobVersion;
+    header.bigEndian = 0;
+    header.meshCount = 1;
+    header.dataAlignment = 16;
+    header.size = out.size();
+
+    Implementation::MeshBlobMesh& mesh = *reinterpret_cast<Implementation::MeshBlobMesh*>(out.data() + meshOffset);
+    mesh.indexDataOffset = indexDataOffset;
+    mesh.indexDataSize = indexDataSize;
+    mesh.vertexDataOffset = vertexDataOffset;
+    mesh.vertexDataSize = sizeof(Vertices);
+    mesh.attributeOffset = attributeOffset;
+    mesh.nameOffset = nameOffset;
+    mesh.indexOffset = 0;
+    mesh.primitive = UnsignedInt(indexed ? MeshPrimitive::Triangles : MeshPrimitive::LineStrip);
+    mesh.indexType = indexed ? UnsignedInt(MeshIndexType::UnsignedShort) : 0;
+    mesh.indexCount = indexed ? Containers::arraySize(Indices) : 0;
+    mesh.vertexCount = Containers::arraySize(Vertices);
+    mesh.attributeCount = 2;
+    mesh.nameSize = 4;
+    mesh.indexStride = indexed ? sizeof(UnsignedShort) : 0;
+
+    Implementation::MeshBlobAttribute* attributes = reinterpret_cast<Implementation::MeshBlobAttribute*>(out.data() + attributeOffset);
+    attributes[0].offset = 0;
+    attributes[0].format = UnsignedInt(VertexFormat::Vector3);
+    attributes[0].name = UnsignedShort(MeshAttribute::Position);
+    attributes[0].stride = sizeof(Vertex);
+    attributes[0].morphTargetId = -1;
+    attributes[1].offset = sizeof(Vector3);
+    attributes[1].format = UnsignedInt(VertexFormat::Vector2);
+    attributes[1].name = UnsignedShort(MeshAttribute::TextureCoordinates);
+    attributes[1].stride = sizeof(Vertex);
+    attributes[1].morphTargetId = -1;
+
+    Utility::copy(Containers::arrayView("quad").prefix(4), out.sliceSize(nameOffset, 4));
+    if(indexed)
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(Indices)), out.sliceSize(indexDataOffset, indexDataSize));
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(Vertices)), out.exceptPrefix(vertexDataOffset));
+    return out;
+}
+
+struct SceneFileData {
+    UnsignedInt mapping[3];
+    Int parents[3];
+    UnsignedByte stringOffsets[3];
+    char strings[9];
+};
+
+const UnsignedByte ImagePixels[]{
+    0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80
+};
+
+/* Assembles a file with a scene named "scene", a material named "mat" and a
+   2D image named "img", with the data aligned to 16 bytes. The header is 48
+   bytes, the scene 56 bytes, the material 40 bytes and the image 96 bytes, so
+   the two scene fields are at 240, the two material attributes at 336, the
+   names at 400, 405 and 408 and the attribute names and values at 411. The
+   36 bytes of scene data are then at 432 and the 16 bytes of image data at
+   480, with the whole file being 496 bytes. */
+Containers::Array<char> contentsFile() {
+    const std::size_t sceneOffset = sizeof(Implementation::MeshBlobHeader);
+    const std::size_t materialOffset = sceneOffset + sizeof(Implementation::MeshBlobScene);
+    const std::size_t imageOffset = materialOffset + sizeof(Implementation::MeshBlobMaterial);
+    const std::size_t fieldOffset = imageOffset + sizeof(Implementation::MeshBlobImage);
+    const std::size_t attributeOffset = fieldOffset + 2*sizeof(Implementation::MeshBlobSceneField);
+    const std::size_t nameOffset = attributeOffset + 2*sizeof(Implementation::MeshBlobMaterialAttribute);
+    const std::size_t attributeStringOffset = nameOffset + 5 + 3 + 3;
+    const std::size_t sceneDataOffset = (attributeStringOffset + 11 + 1 + 4 + 2 + 15) & ~15;
+    const std::size_t imageDataOffset = (sceneDataOffset + sizeof(SceneFileData) + 15) & ~15;
+    Containers::Array<char> out{ValueInit, imageDataOffset + sizeof(ImagePixels)};
+
+    Implementation::MeshBlobHeader& header = *reinterpret_cast<Implementation::MeshBlobHeader*>(out.data());
+    header.magic[0] = 'M';
+    header.magic[1] = 'B';
+    header.magic[2] = 'L';
+    header.magic[3] = 'B';
+    header.version = Implementation::MeshBlobVersion;
+    header.bigEndian = 0;
+    header.dataAlignment = 16;
+    header.sceneCount = 1;
+    header.materialCount = 1;
+    header.image2DCount = 1;
+    header.size = out.size();
+
+    Implementation::MeshBlobScene& scene = *reinterpret_cast<Implementation::MeshBlobScene*>(out.data() + sceneOffset);
+    scene.dataOffset = sceneDataOffset;
+    scene.dataSize = sizeof(SceneFileData);
+    scene.fieldOffset = fieldOffset;
+    scene.nameOffset = nameOffset;
+    scene.mappingBound = 3;
+    scene.fieldCount = 2;
+    scene.nameSize = 5;
+    scene.mappingType = UnsignedInt(SceneMappingType::UnsignedInt);
+
+    Implementation::MeshBlobSceneField* fields = reinterpret_cast<Implementation::MeshBlobSceneField*>(out.data() + fieldOffset);
+    fields[0].size = 3;
+    fields[0].mappingOffset = offsetof(SceneFileData, mapping);
+    fields[0].fieldOffset = offsetof(SceneFileData, parents);
+    fields[0].name = UnsignedInt(SceneField::Parent);
+    fields[0].fieldType = UnsignedShort(SceneFieldType::Int);
+    fields[0].mappingStride = sizeof(UnsignedInt);
+    fields[0].fieldStride = sizeof(Int);
+    fields[1].size = 3;
+    fields[1].mappingOffset = offsetof(SceneFileData, mapping);
+    fields[1].fieldOffset = offsetof(SceneFileData, stringOffsets);
+    fields[1].stringOffset = offsetof(SceneFileData, strings);
+    fields[1].name = UnsignedInt(sceneFieldCustom(3));
+    fields[1].fieldType = UnsignedShort(SceneFieldType::StringOffset8);
+    fields[1].mappingStride = sizeof(UnsignedInt);
+    fields[1].fieldStride = sizeof(UnsignedByte);
+
+    Implementation::MeshBlobMaterial& material = *reinterpret_cast<Implementation::MeshBlobMaterial*>(out.data() + materialOffset);
+    material.attributeOffset = attributeOffset;
+    material.nameOffset = nameOffset + 5;
+    material.types = UnsignedInt(MaterialType::PbrMetallicRoughness);
+    material.attributeCount = 2;
+    material.nameSize = 3;
+
+    /* The attributes are expected to be sorted */
+    Implementation::MeshBlobMaterialAttribute* attributes = reinterpret_cast<Implementation::MeshBlobMaterialAttribute*>(out.data() + attributeOffset);
+    attributes[0].nameOffset = attributeStringOffset;
+    attributes[0].valueOffset = attributeStringOffset + 11;
+    attributes[0].nameSize = 11;
+    attributes[0].valueSize = 1;
+    attributes[0].type = UnsignedInt(MaterialAttributeType::Bool);
+    attributes[1].nameOffset = attributeStringOffset + 12;
+    attributes[1].valueOffset = attributeStringOffset + 16;
+    attributes[1].nameSize = 4;
+    attributes[1].valueSize = 2;
+    attributes[1].type = UnsignedInt(MaterialAttributeType::String);
+
+    Implementation::MeshBlobImage& image = *reinterpret_cast<Implementation::MeshBlobImage*>(out.data() + imageOffset);
+    image.dataOffset = imageDataOffset;
+    image.dataSize = sizeof(ImagePixels);
+    image.nameOffset = nameOffset + 8;
+    image.nameSize = 3;
+    image.format = UnsignedInt(PixelFormat::RGBA8Unorm);
+    image.pixelSize = 4;
+    image.size[0] = 2;
+    image.size[1] = 2;
+    image.alignment = 4;
+
+    Utility::copy(Containers::arrayView("scenematimgDoubleSided\x01notehi").prefix(29), out.sliceSize(nameOffset, 29));
+
+    SceneFileData& sceneData = *reinterpret_cast<SceneFileData*>(out.data() + sceneDataOffset);
+    sceneData = SceneFileData{
+        {2, 0, 1},
+        {-1, 2, 2},
+        {1, 3, 6},
+        "abcdef"
+    };
+
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(ImagePixels)), out.exceptPrefix(imageDataOffset));
+    return out;
+}
+
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t offset;
+    UnsignedInt value;
+    std::size_t valueSize;
+    const char* message;
+} InvalidData[]{
+    {"too short", 47, 0, 0, 0,
+        "file too short, expected at least 48 bytes but got 47"},
+    {"invalid signature", 0, 0, 'X', 1,
+        "invalid file signature XBLB"},
+    {"unsupported version", 0, 4, 2, 1,
+        "unsupported version 2"},
+    {"different endianness", 0, 5, 1, 1,
+        "unsupported Big-Endian file"},
+    {"data alignment not a power of two", 0, 12, 12, 4,
+        "expected data alignment to be a power of two and at least 8 bytes but got 12"},
+    {"data alignment too small", 0, 12, 4, 4,
+        "expected data alignment to be a power of two and at least 8 bytes but got 4"},
+    {"too many meshes", 0, 8, 3, 4,
+        "file too short for 3 meshes"},
+    {"invalid primitive", 0, 48 + 56, 0xdead, 4,
+        "invalid mesh 0 primitive MeshPrimitive(0xdead)"},
+    {"invalid index type", 0, 48 + 60, 0x4, 4,
+        "invalid mesh 0 index type MeshIndexType(0x4)"},
+    {"index data for a non-indexed mesh", 0, 48 + 60, 0, 4,
+        "expected no index data for mesh 0 but got 6 indices in 12 bytes"},
+    {"index stride too large", 0, 48 + 80, 32768, 4,
+        "expected mesh 0 index stride to fit into 16 bits but got 32768"},
+    {"data not aligned", 0, 48 + 16, 200, 4,
+        "mesh 0 data not aligned to 16 bytes"},
+    {"attributes not aligned", 0, 48 + 32, 140, 4,
+        "mesh 0 attributes not aligned to 8 bytes"},
+    {"index data out of bounds", 0, 48 + 8, 97, 4,
+        "mesh 0 data out of bounds for a file of 288 bytes"},
+    {"vertex data out of bounds", 0, 48 + 24, 81, 4,
+        "mesh 0 data out of bounds for a file of 288 bytes"},
+    {"attributes out of bounds", 0, 48 + 72, 7, 4,
+        "mesh 0 data out of bounds for a file of 288 bytes"},
+    {"name out of bounds", 0, 48 + 76, 113, 4,
+        "mesh 0 data out of bounds for a file of 288 bytes"},
+    {"indices out of bounds", 0, 48 + 64, 7, 4,
+        "mesh 0 indices out of bounds for 12 bytes of index data"},
+    {"indices out of bounds with a negative stride", 0, 48 + 80, 0xfffffffeu, 4,
+        "mesh 0 indices out of bounds for 12 bytes of index data"},
+    {"invalid attribute name", 0, 136 + 12, 0, 2,
+        "invalid mesh 0 attribute 0 name Trade::MeshAttribute(0x0)"},
+    {"invalid attribute format", 0, 136 + 8, 0xdead, 4,
+        "invalid mesh 0 attribute 0 format VertexFormat(0xdead)"},
+    {"implementation-specific attribute format", 0, 136 + 8, 0x80000003u, 4,
+        "invalid mesh 0 attribute 0 format VertexFormat::ImplementationSpecific(0x3)"},
+    {"attribute format not compatible", 0, 160 + 8, UnsignedInt(VertexFormat::Vector3), 4,
+        "VertexFormat::Vector3 is not a valid format for Trade::MeshAttribute::TextureCoordinates in mesh 0"},
+    {"array attribute not allowed", 0, 136 + 14, 3, 2,
+        "Trade::MeshAttribute::Position can't be an array attribute in mesh 0"},
+    {"invalid morph target ID", 0, 136 + 18, 0x80, 1,
+        "invalid morph target ID -128 for Trade::MeshAttribute::Position in mesh 0"},
+    {"attribute out of bounds", 0, 160, 64, 4,
+        "mesh 0 attribute 1 out of bounds for 80 bytes of vertex data"},
+};
+
+const struct {
+    const char* name;
+    std::size_t offset;
+    UnsignedInt value;
+    std::size_t valueSize;
+    const char* message;
+} InvalidContentsData[]{
+    {"too many scenes", 16, 100, 4,
+        "file too short for 100 scenes"},
+    {"too many materials", 20, 100, 4,
+        "file too short for 100 materials"},
+    {"too many 2D images", 28, 100, 4,
+        "file too short for 100 2D images"},
+    {"invalid scene mapping type", 48 + 48, 7, 4,
+        "invalid scene 0 mapping type Trade::SceneMappingType(0x7)"},
+    {"scene data not aligned", 48 + 0, 440, 4,
+        "scene 0 data not aligned to 16 bytes"},
+    {"scene fields not aligned", 48 + 16, 244, 4,
+        "scene 0 fields not aligned to 8 bytes"},
+    {"scene fields out of bounds", 48 + 40, 7, 4,
+        "scene 0 data out of bounds for a file of 496 bytes"},
+    {"invalid scene field name", 240 + 32, 0x20, 4,
+        "invalid scene 0 field 0 name Trade::SceneField(0x20)"},
+    {"invalid scene field type", 240 + 36, 0xdead, 2,
+        "invalid scene 0 field 0 type Trade::SceneFieldType(0xdead)"},
+    {"pointer scene field type", 240 + 36, UnsignedInt(SceneFieldType::Pointer), 2,
+        "invalid scene 0 field 0 type Trade::SceneFieldType::Pointer"},
+    {"scene field type not compatible", 240 + 36, UnsignedInt(SceneFieldType::Float), 2,
+        "Trade::SceneFieldType::Float is not a valid type for Trade::SceneField::Parent in scene 0"},
+    {"array scene field not allowed", 240 + 38, 2, 2,
+        "Trade::SceneField::Parent can't be an array field in scene 0"},
+    {"scene field flags not allowed", 240 + 44, UnsignedInt(SceneFieldFlag::MultiEntry), 1,
+        "invalid flags Trade::SceneFieldFlag::MultiEntry for Trade::SceneField::Parent of Trade::SceneFieldType::Int in scene 0"},
+    {"duplicate scene field", 240 + 32, 0x80000003u, 4,
+        "duplicate field Trade::SceneField::Custom(3) in scene 0"},
+    {"bit offset for a non-bit scene field", 240 + 45, 1, 1,
+        "expected no bit offset for scene 0 field 0 of Trade::SceneFieldType::Int"},
+    {"scene field mapping out of bounds", 240 + 8, 28, 4,
+        "scene 0 field 0 out of bounds for 36 bytes of scene data"},
+    {"scene field out of bounds", 240 + 16, 30, 4,
+        "scene 0 field 0 out of bounds for 36 bytes of scene data"},
+    {"scene string data out of bounds", 288 + 24, 37, 4,
+        "scene 0 field 1 out of bounds for 36 bytes of scene data"},
+    {"scene strings out of bounds", 432 + 26, 10, 1,
+        "scene 0 field 1 strings out of bounds for 9 bytes of string data"},
+    {"scene string offsets not monotonic", 432 + 25, 0, 1,
+        "scene 0 field 1 strings out of bounds for 9 bytes of string data"},
+    {"invalid material types", 104 + 24, 0x20, 4,
+        "invalid material 0 types Trade::MaterialType(0x20)"},
+    {"material attributes not aligned", 104 + 0, 340, 4,
+        "material 0 attributes not aligned"},
+    {"material attributes out of bounds", 104 + 28, 7, 4,
+        "material 0 data out of bounds for a file of 496 bytes"},
+    {"invalid material attribute type", 336 + 24, 0xfe, 4,
+        "invalid material 0 attribute 0 type Trade::MaterialAttributeType(0xfe)"},
+    {"pointer material attribute type", 336 + 24, UnsignedInt(MaterialAttributeType::Pointer), 4,
+        "invalid material 0 attribute 0 type Trade::MaterialAttributeType::Pointer"},
+    {"material attribute out of bounds", 336 + 0, 490, 4,
+        "material 0 attribute 0 out of bounds for a file of 496 bytes"},
+    {"empty material attribute name", 336 + 16, 0, 4,
+        "invalid material 0 attribute 0 name"},
+    {"material attribute value size mismatch", 336 + 20, 4, 4,
+        "expected 1 bytes for Trade::MaterialAttributeType::Bool material 0 attribute 0 but got 4"},
+    {"material attributes not sorted", 336 + 32, 411, 4,
+        "material 0 layer 0 attributes not sorted or not unique"},
+    {"invalid image compression flag", 144 + 94, 2, 1,
+        "invalid 2D image 0 compression flag 2"},
+    {"image data not aligned", 144 + 0, 488, 4,
+        "2D image 0 data not aligned to 16 bytes"},
+    {"image data out of bounds", 144 + 8, 17, 4,
+        "2D image 0 data out of bounds for a file of 496 bytes"},
+    {"invalid image format", 144 + 28, 0xdead, 4,
+        "invalid 2D image 0 format PixelFormat(0xdead)"},
+    {"invalid image pixel size", 144 + 36, 3, 4,
+        "invalid 2D image 0 pixel size 3 for PixelFormat::RGBA8Unorm"},
+    {"invalid image alignment", 144 + 72, 3, 4,
+        "invalid 2D image 0 size or pixel storage"},
+    {"image data too small", 144 + 8, 15, 4,
+        "2D image 0 data too small, got 15 but expected at least 16 bytes"},
+    {"invalid image flags", 144 + 92, 2, 2,
+        "invalid 2D image 0 flags 0x2 for a size of {2, 2, 1}"},
+};
+
+MeshBlobImporterTest::MeshBlobImporterTest() {
+    addInstancedTests({&MeshBlobImporterTest::invalid},
+        Containers::arraySize(InvalidData));
+
+    addTests({&MeshBlobImporterTest::invalidFileSize,
+              &MeshBlobImporterTest::invalidSkinAttributes});
+
+    addInstancedTests({&MeshBlobImporterTest::invalidContents},
+        Containers::arraySize(InvalidContentsData));
+
+    addTests({&MeshBlobImporterTest::openData,
+              &MeshBlobImporterTest::openMemory,
+              &MeshBlobImporterTest::openMemoryUnaligned,
+              &MeshBlobImporterTest::nonIndexed,
+              &MeshBlobImporterTest::names,
+
+              &MeshBlobImporterTest::scene,
+              &MeshBlobImporterTest::material,
+              &MeshBlobImporterTest::image,
+
+              &MeshBlobImporterTest::openTwice,
+              &MeshBlobImporterTest::importTwice});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MESHBLOBIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MESHBLOBIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MeshBlobImporterTest::invalid() {
+    auto&& data = InvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = file();
+    for(std::size_t i = 0; i != data.valueSize; ++i)
+        in[data.offset + i] = char(data.value >> 8*i);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data.size ? in.prefix(data.size) : in));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshBlobImporter::openData(): {}\n", data.message));
+}
+
+void MeshBlobImporterTest::invalidFileSize() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = file();
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(in.exceptSuffix(1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshBlobImporter::openData(): file size mismatch, expected {} bytes but got {}\n", in.size(), in.size() - 1));
+}
+
+void MeshBlobImporterTest::invalidSkinAttributes() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    /* Turn the position into joint IDs, leaving texture coordinates as the
+       second attribute, so there are no matching weights */
+    Containers::Array<char> jointIdsOnly = file();
+    Implementation::MeshBlobAttribute* jointIdsOnlyAttributes = reinterpret_cast<Implementation::MeshBlobAttribute*>(jointIdsOnly.data() + 136);
+    jointIdsOnlyAttributes[0].format = UnsignedInt(VertexFormat::UnsignedByte);
+    jointIdsOnlyAttributes[0].name = UnsignedShort(MeshAttribute::JointIds);
+    jointIdsOnlyAttributes[0].arraySize = 4;
+
+    /* Then turn the texture coordinates into weights with a different array
+       size */
+    Containers::Array<char> arraySizeMismatch = file();
+    Implementation::MeshBlobAttribute* arraySizeMismatchAttributes = reinterpret_cast<Implementation::MeshBlobAttribute*>(arraySizeMismatch.data() + 136);
+    arraySizeMismatchAttributes[0].format = UnsignedInt(VertexFormat::UnsignedByte);
+    arraySizeMismatchAttributes[0].name = UnsignedShort(MeshAttribute::JointIds);
+    arraySizeMismatchAttributes[0].arraySize = 4;
+    arraySizeMismatchAttributes[1].offset = 4;
+    arraySizeMismatchAttributes[1].format = UnsignedInt(VertexFormat::Float);
+    arraySizeMismatchAttributes[1].name = UnsignedShort(MeshAttribute::Weights);
+    arraySizeMismatchAttributes[1].arraySize = 3;
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(jointIdsOnly));
+    CORRADE_VERIFY(!importer->openData(arraySizeMismatch));
+    CORRADE_COMPARE(out,
+        "Trade::MeshBlobImporter::openData(): expected 1 weight attributes to match joint IDs but got 0 in mesh 0\n"
+        "Trade::MeshBlobImporter::openData(): expected 4 array items for weight attribute 0 to match joint IDs but got 3 in mesh 0\n");
+}
+
+void MeshBlobImporterTest::invalidContents() {
+    auto&& data = InvalidContentsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = contentsFile();
+    for(std::size_t i = 0; i != data.valueSize; ++i)
+        in[data.offset + i] = char(data.value >> 8*i);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(in));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshBlobImporter::openData(): {}\n", data.message));
+}
+
+void MeshBlobImporterTest::openData() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = file();
+    CORRADE_COMPARE(in.size(), 288);
+    CORRADE_VERIFY(importer->openData(in));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+
+    /* The data are copied, not referenced */
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(mesh->indexData().data() != static_cast<const void*>(in.data() + 192));
+    CORRADE_VERIFY(mesh->vertexData().data() != static_cast<const void*>(in.data() + 208));
+
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE(mesh->attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE(mesh->attributeOffset(0), 0);
+    CORRADE_COMPARE(mesh->attributeStride(0), sizeof(Vertex));
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(0),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeName(1), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(mesh->attributeFormat(1), VertexFormat::Vector2);
+    CORRADE_COMPARE(mesh->attributeOffset(1), 12);
+    CORRADE_COMPARE(mesh->attributeStride(1), sizeof(Vertex));
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(1),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::textureCoordinates),
+        TestSuite::Compare::Container);
+
+    /* The mesh should stay valid after the importer is closed */
+    importer->close();
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::openMemory() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = file();
+    CORRADE_VERIFY(importer->openMemory(in));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+
+    /* The data are referenced directly */
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(mesh->indexData().data(), static_cast<const void*>(in.data() + 192));
+    CORRADE_COMPARE(mesh->indexData().size(), sizeof(Indices));
+    CORRADE_COMPARE(mesh->vertexData().data(), static_cast<const void*>(in.data() + 208));
+    CORRADE_COMPARE(mesh->vertexData().size(), sizeof(Vertices));
+
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::textureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::openMemoryUnaligned() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    /* Memory allocated with new[] is aligned to at least 8 bytes, so offset
+       it by 4 to make it unaligned */
+    Containers::Array<char> data = file();
+    Containers::Array<char> in{ValueInit, data.size() + 4};
+    Utility::copy(data, in.exceptPrefix(4));
+    CORRADE_VERIFY(importer->openMemory(in.exceptPrefix(4)));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+
+    /* The data got copied */
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::nonIndexed() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = file(false);
+    CORRADE_VERIFY(importer->openMemory(in));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::LineStrip);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::names() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    CORRADE_VERIFY(importer->openData(file()));
+    CORRADE_COMPARE(importer->meshName(0), "quad");
+    CORRADE_COMPARE(importer->meshForName("quad"), 0);
+    CORRADE_COMPARE(importer->meshForName("triangle"), -1);
+}
+
+void MeshBlobImporterTest::scene() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = contentsFile();
+    CORRADE_COMPARE(in.size(), 496);
+    CORRADE_VERIFY(importer->openMemory(in));
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+    CORRADE_COMPARE(importer->objectCount(), 3);
+    CORRADE_COMPARE(importer->sceneName(0), "scene");
+    CORRADE_COMPARE(importer->sceneForName("scene"), 0);
+    CORRADE_COMPARE(importer->sceneForName("mat"), -1);
+
+    /* The data are referenced directly */
+    {
+        Containers::Optional<SceneData> scene = importer->scene(0);
+        CORRADE_VERIFY(scene);
+        CORRADE_COMPARE(scene->dataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(scene->data().data(), static_cast<const void*>(in.data() + 432));
+        CORRADE_COMPARE(scene->data().size(), sizeof(SceneFileData));
+    }
+
+    /* The data are copied */
+    CORRADE_VERIFY(importer->openData(in));
+    Containers::Optional<SceneData> scene = importer->scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(scene->data().data() != static_cast<const void*>(in.data() + 432));
+
+    /* The scene should stay valid after the importer is closed */
+    importer->close();
+    CORRADE_COMPARE(scene->mappingType(), SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(scene->mappingBound(), 3);
+    CORRADE_COMPARE(scene->fieldCount(), 2);
+    CORRADE_COMPARE(scene->fieldName(0), SceneField::Parent);
+    CORRADE_COMPARE(scene->fieldType(0), SceneFieldType::Int);
+    CORRADE_COMPARE(scene->fieldFlags(0), SceneFieldFlag::OffsetOnly);
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedInt>(SceneField::Parent),
+        Containers::arrayView<UnsignedInt>({2, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<Int>(SceneField::Parent),
+        Containers::arrayView({-1, 2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene->fieldName(1), sceneFieldCustom(3));
+    CORRADE_COMPARE(scene->fieldType(1), SceneFieldType::StringOffset8);
+    CORRADE_COMPARE_AS(scene->fieldStrings(1), Containers::arrayView({
+        "a"_s, "bc"_s, "def"_s
+    }), TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::material() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = contentsFile();
+    CORRADE_VERIFY(importer->openMemory(in));
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->materialName(0), "mat");
+    CORRADE_COMPARE(importer->materialForName("mat"), 0);
+    CORRADE_COMPARE(importer->materialForName("scene"), -1);
+
+    Containers::Optional<MaterialData> material = importer->material(0);
+    CORRADE_VERIFY(material);
+
+    /* The material should stay valid after the importer is closed, as it's
+       always copied */
+    importer->close();
+    CORRADE_COMPARE(material->types(), MaterialType::PbrMetallicRoughness);
+    CORRADE_COMPARE(material->layerCount(), 1);
+    CORRADE_COMPARE(material->attributeCount(), 2);
+    CORRADE_COMPARE(material->attributeName(0), "DoubleSided");
+    CORRADE_COMPARE(material->attributeType(0), MaterialAttributeType::Bool);
+    CORRADE_VERIFY(material->isDoubleSided());
+    CORRADE_COMPARE(material->attributeName(1), "note");
+    CORRADE_COMPARE(material->attributeType(1), MaterialAttributeType::String);
+    CORRADE_COMPARE(material->attribute<Containers::StringView>("note"), "hi");
+}
+
+void MeshBlobImporterTest::image() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> in = contentsFile();
+    CORRADE_VERIFY(importer->openMemory(in));
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+    CORRADE_COMPARE(importer->image2DName(0), "img");
+    CORRADE_COMPARE(importer->image2DForName("img"), 0);
+    CORRADE_COMPARE(importer->image2DForName("mat"), -1);
+
+    /* The data are referenced directly */
+    {
+        Containers::Optional<ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(image->data().data(), static_cast<const void*>(in.data() + 480));
+        CORRADE_COMPARE(image->data().size(), sizeof(ImagePixels));
+    }
+
+    /* The data are copied */
+    CORRADE_VERIFY(importer->openData(in));
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(image->data().data() != static_cast<const void*>(in.data() + 480));
+
+    /* The image should stay valid after the importer is closed */
+    importer->close();
+    CORRADE_VERIFY(!image->isCompressed());
+    CORRADE_COMPARE(image->flags(), ImageFlags2D{});
+    CORRADE_COMPARE(image->storage().alignment(), 4);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->formatExtra(), 0);
+    CORRADE_COMPARE(image->pixelSize(), 4);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(image->data()),
+        Containers::arrayView(ImagePixels),
+        TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::openTwice() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    CORRADE_VERIFY(importer->openData(file()));
+    CORRADE_VERIFY(importer->openData(file()));
+
+    /* Shouldn't crash, leak or anything */
+}
+
+void MeshBlobImporterTest::importTwice() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    CORRADE_VERIFY(importer->openData(file()));
+
+    /* Verify that everything is working the same way on second use */
+    {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+            Containers::arrayView(Indices),
+            TestSuite::Compare::Container);
+    } {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+            Containers::arrayView(Indices),
+            TestSuite::Compare::Container);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshBlobImporterTest)
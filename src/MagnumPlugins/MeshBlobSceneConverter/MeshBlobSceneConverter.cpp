@@ -0,0 +1,509 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlobSceneConverter.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+struct AddedMesh {
+    Implementation::MeshBlobMesh header;
+    Containers::Array<char> indexData;
+    Containers::Array<char> vertexData;
+    Containers::Array<Implementation::MeshBlobAttribute> attributes;
+    Containers::String name;
+};
+
+struct AddedScene {
+    Implementation::MeshBlobScene header;
+    Containers::Array<char> data;
+    Containers::Array<Implementation::MeshBlobSceneField> fields;
+    Containers::String name;
+};
+
+struct AddedMaterial {
+    Implementation::MeshBlobMaterial header;
+    Containers::Array<Implementation::MeshBlobMaterialAttribute> attributes;
+    Containers::Array<UnsignedInt> layers;
+    /* Attribute names and values, the offsets in attributes are relative to
+       this array until they get turned into file offsets in endData() */
+    Containers::Array<char> strings;
+    Containers::String name;
+};
+
+struct AddedImage {
+    Implementation::MeshBlobImage header;
+    Containers::Array<char> data;
+    Containers::String name;
+};
+
+std::size_t alignTo(const std::size_t offset, const std::size_t alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+void appendString(Containers::Array<char>& out, const Containers::StringView string) {
+    arrayAppend(out, Containers::ArrayView<const char>{string.data(), string.size()});
+}
+
+template<UnsignedInt dimensions> void addImage(Containers::Array<AddedImage>& images, const ImageData<dimensions>& image, const Containers::StringView name) {
+    AddedImage& out = arrayAppend(images, InPlaceInit);
+    out.header = {};
+    out.header.nameSize = name.size();
+    out.header.flags = UnsignedShort(image.flags());
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        out.header.size[i] = image.size()[i];
+
+    /* The row length, image height and skip are shared by both storage
+       types, alignment is only for uncompressed images and block properties
+       only for compressed */
+    const PixelStorage storage = image.isCompressed() ?
+        PixelStorage{image.compressedStorage()} : image.storage();
+    out.header.rowLength = storage.rowLength();
+    out.header.imageHeight = storage.imageHeight();
+    for(UnsignedInt i = 0; i != 3; ++i)
+        out.header.skip[i] = storage.skip()[i];
+    if(image.isCompressed()) {
+        const CompressedPixelStorage& compressedStorage = image.compressedStorage();
+        out.header.format = UnsignedInt(image.compressedFormat());
+        out.header.compressed = 1;
+        for(UnsignedInt i = 0; i != 3; ++i)
+            out.header.compressedBlockSize[i] = compressedStorage.compressedBlockSize()[i];
+        out.header.compressedBlockDataSize = compressedStorage.compressedBlockDataSize();
+    } else {
+        out.header.format = UnsignedInt(image.format());
+        out.header.formatExtra = image.formatExtra();
+        out.header.pixelSize = image.pixelSize();
+        out.header.alignment = image.storage().alignment();
+    }
+
+    /* The data are copied as a whole including any padding described by the
+       pixel storage */
+    out.data = Containers::Array<char>{NoInit, image.data().size()};
+    Utility::copy(image.data(), out.data);
+
+    /* The name may go out of scope before endData() is called */
+    out.name = Containers::String{name};
+}
+
+}
+
+struct MeshBlobSceneConverter::State {
+    Containers::Array<AddedMesh> meshes;
+    Containers::Array<AddedScene> scenes;
+    Containers::Array<AddedMaterial> materials;
+    /* 1D, 2D and 3D images */
+    Containers::Array<AddedImage> images[3];
+};
+
+MeshBlobSceneConverter::MeshBlobSceneConverter() = default;
+
+MeshBlobSceneConverter::MeshBlobSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractSceneConverter{manager, plugin} {}
+
+MeshBlobSceneConverter::~MeshBlobSceneConverter() = default;
+
+SceneConverterFeatures MeshBlobSceneConverter::doFeatures() const {
+    return SceneConverterFeature::ConvertMultipleToData|
+           SceneConverterFeature::AddScenes|
+           SceneConverterFeature::AddMeshes|
+           SceneConverterFeature::AddMaterials|
+           SceneConverterFeature::AddImages1D|
+           SceneConverterFeature::AddImages2D|
+           SceneConverterFeature::AddImages3D|
+           SceneConverterFeature::AddCompressedImages1D|
+           SceneConverterFeature::AddCompressedImages2D|
+           SceneConverterFeature::AddCompressedImages3D;
+}
+
+void MeshBlobSceneConverter::doAbort() {
+    _state = nullptr;
+}
+
+bool MeshBlobSceneConverter::doBeginData() {
+    _state.emplace();
+    return true;
+}
+
+bool MeshBlobSceneConverter::doAdd(UnsignedInt, const SceneData& scene, const Containers::StringView name) {
+    /* Pointers make no sense outside of the process that created them */
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const SceneFieldType type = scene.fieldType(i);
+        if(type == SceneFieldType::Pointer || type == SceneFieldType::MutablePointer) {
+            Error{} << "Trade::MeshBlobSceneConverter::add():" << type << "field" << scene.fieldName(i) << "is not supported";
+            return false;
+        }
+    }
+
+    AddedScene& out = arrayAppend(_state->scenes, InPlaceInit);
+    out.header = {};
+    out.header.mappingBound = scene.mappingBound();
+    out.header.fieldCount = scene.fieldCount();
+    out.header.nameSize = name.size();
+    out.header.mappingType = UnsignedInt(scene.mappingType());
+
+    /* The data are copied as a whole including any padding, the fields are
+       then described by offsets and strides relative to them */
+    const char* const data = scene.data().data();
+    out.data = Containers::Array<char>{NoInit, scene.data().size()};
+    Utility::copy(scene.data(), out.data);
+
+    out.fields = Containers::Array<Implementation::MeshBlobSceneField>{ValueInit, scene.fieldCount()};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        /* Unlike fieldData() without arguments, this one always returns
+           absolute pointers */
+        const SceneFieldData field = scene.fieldData(i);
+        Implementation::MeshBlobSceneField& outField = out.fields[i];
+        outField.size = field.size();
+        outField.name = UnsignedInt(field.name());
+        outField.fieldType = UnsignedShort(field.fieldType());
+        outField.fieldArraySize = field.fieldArraySize();
+        outField.flags = UnsignedByte(field.flags() & ~SceneFieldFlag::OffsetOnly);
+
+        /* Views of empty fields are allowed to point anywhere, so their
+           offsets are left at zero */
+        if(!field.size()) continue;
+
+        const Containers::StridedArrayView1D<const void> mappingData = field.mappingData();
+        outField.mappingOffset = static_cast<const char*>(mappingData.data()) - data;
+        outField.mappingStride = mappingData.stride();
+        if(field.fieldType() == SceneFieldType::Bit) {
+            const Containers::StridedBitArrayView2D fieldData = field.fieldBitData();
+            outField.fieldOffset = static_cast<const char*>(fieldData.data()) - data;
+            outField.fieldBitOffset = fieldData.offset();
+            outField.fieldStride = fieldData.stride()[0];
+        } else {
+            const Containers::StridedArrayView1D<const void> fieldData = field.fieldData();
+            outField.fieldOffset = static_cast<const char*>(fieldData.data()) - data;
+            outField.fieldStride = fieldData.stride();
+            if(Implementation::isSceneFieldTypeString(field.fieldType()))
+                outField.stringOffset = field.stringData() - data;
+        }
+    }
+
+    /* The name may go out of scope before endData() is called */
+    out.name = Containers::String{name};
+
+    return true;
+}
+
+bool MeshBlobSceneConverter::doAdd(UnsignedInt, const MeshData& mesh, const Containers::StringView name) {
+    if(mesh.isIndexed() && isMeshIndexTypeImplementationSpecific(mesh.indexType())) {
+        Error{} << "Trade::MeshBlobSceneConverter::add(): implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()) << "is not supported";
+        return false;
+    }
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        if(isVertexFormatImplementationSpecific(format)) {
+            Error{} << "Trade::MeshBlobSceneConverter::add(): implementation-specific vertex format" << Debug::hex << vertexFormatUnwrap(format) << "of attribute" << i << "is not supported";
+            return false;
+        }
+    }
+
+    AddedMesh& out = arrayAppend(_state->meshes, InPlaceInit);
+    out.header = {};
+    out.header.primitive = UnsignedInt(mesh.primitive());
+    out.header.vertexCount = mesh.vertexCount();
+    out.header.attributeCount = mesh.attributeCount();
+    out.header.nameSize = name.size();
+
+    /* The index and vertex data are copied as a whole including any padding,
+       the views are then described by offsets and strides relative to them */
+    if(mesh.isIndexed()) {
+        out.header.indexType = UnsignedInt(mesh.indexType());
+        out.header.indexCount = mesh.indexCount();
+        out.header.indexOffset = mesh.indexOffset();
+        out.header.indexStride = mesh.indexStride();
+        out.indexData = Containers::Array<char>{NoInit, mesh.indexData().size()};
+        Utility::copy(mesh.indexData(), out.indexData);
+    }
+    out.vertexData = Containers::Array<char>{NoInit, mesh.vertexData().size()};
+    Utility::copy(mesh.vertexData(), out.vertexData);
+
+    out.attributes = Containers::Array<Implementation::MeshBlobAttribute>{ValueInit, mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        Implementation::MeshBlobAttribute& attribute = out.attributes[i];
+        attribute.offset = mesh.attributeOffset(i);
+        attribute.format = UnsignedInt(mesh.attributeFormat(i));
+        attribute.name = UnsignedShort(mesh.attributeName(i));
+        attribute.arraySize = mesh.attributeArraySize(i);
+        attribute.stride = mesh.attributeStride(i);
+        attribute.morphTargetId = mesh.attributeMorphTargetId(i);
+    }
+
+    /* The name may go out of scope before endData() is called */
+    out.name = Containers::String{name};
+
+    return true;
+}
+
+bool MeshBlobSceneConverter::doAdd(UnsignedInt, const MaterialData& material, const Containers::StringView name) {
+    /* Pointers make no sense outside of the process that created them */
+    const Containers::ArrayView<const MaterialAttributeData> attributeData = material.attributeData();
+    for(const MaterialAttributeData& attribute: attributeData) {
+        if(attribute.type() == MaterialAttributeType::Pointer || attribute.type() == MaterialAttributeType::MutablePointer) {
+            Error{} << "Trade::MeshBlobSceneConverter::add():" << attribute.type() << "material attribute" << attribute.name() << "is not supported";
+            return false;
+        }
+    }
+
+    AddedMaterial& out = arrayAppend(_state->materials, InPlaceInit);
+    out.header = {};
+    out.header.types = UnsignedInt(material.types());
+    out.header.attributeCount = attributeData.size();
+    out.header.layerCount = material.layerData().size();
+    out.header.nameSize = name.size();
+
+    /* The attributes are already sorted in each layer, so they're saved in
+       the same order to not need any sorting on import */
+    out.attributes = Containers::Array<Implementation::MeshBlobMaterialAttribute>{ValueInit, attributeData.size()};
+    for(std::size_t i = 0; i != attributeData.size(); ++i) {
+        const MaterialAttributeData& attribute = attributeData[i];
+        const MaterialAttributeType type = attribute.type();
+        Containers::StringView value;
+        if(type == MaterialAttributeType::String)
+            value = attribute.value<Containers::StringView>();
+        else if(type == MaterialAttributeType::Buffer) {
+            const Containers::ArrayView<const void> buffer = attribute.value<Containers::ArrayView<const void>>();
+            value = {static_cast<const char*>(buffer.data()), buffer.size()};
+        } else value = {static_cast<const char*>(attribute.value()), materialAttributeTypeSize(type)};
+
+        Implementation::MeshBlobMaterialAttribute& outAttribute = out.attributes[i];
+        outAttribute.type = UnsignedInt(type);
+        outAttribute.nameOffset = out.strings.size();
+        outAttribute.nameSize = attribute.name().size();
+        appendString(out.strings, attribute.name());
+        outAttribute.valueOffset = out.strings.size();
+        outAttribute.valueSize = value.size();
+        appendString(out.strings, value);
+    }
+
+    out.layers = Containers::Array<UnsignedInt>{NoInit, material.layerData().size()};
+    Utility::copy(material.layerData(), out.layers);
+
+    /* The name may go out of scope before endData() is called */
+    out.name = Containers::String{name};
+
+    return true;
+}
+
+bool MeshBlobSceneConverter::doAdd(UnsignedInt, const ImageData1D& image, const Containers::StringView name) {
+    addImage(_state->images[0], image, name);
+    return true;
+}
+
+bool MeshBlobSceneConverter::doAdd(UnsignedInt, const ImageData2D& image, const Containers::StringView name) {
+    addImage(_state->images[1], image, name);
+    return true;
+}
+
+bool MeshBlobSceneConverter::doAdd(UnsignedInt, const ImageData3D& image, const Containers::StringView name) {
+    addImage(_state->images[2], image, name);
+    return true;
+}
+
+Containers::Optional<Containers::Array<char>> MeshBlobSceneConverter::doEndData() {
+    const UnsignedInt alignment = configuration().value<UnsignedInt>("alignment");
+    if(alignment < 8 || (alignment & (alignment - 1))) {
+        Error{} << "Trade::MeshBlobSceneConverter::endData(): expected alignment to be a power of two and at least 8 bytes but got" << alignment;
+        return {};
+    }
+
+    const std::size_t imageCount = _state->images[0].size() + _state->images[1].size() + _state->images[2].size();
+
+    /* Calculate the layout. The header and all records except for material
+       layer offsets have sizes divisible by 8 so they're aligned without any
+       padding, the layer offsets, names and material attribute values are
+       after them and the data then aligned to the requested value. */
+    std::size_t offset = sizeof(Implementation::MeshBlobHeader) +
+        _state->meshes.size()*sizeof(Implementation::MeshBlobMesh) +
+        _state->scenes.size()*sizeof(Implementation::MeshBlobScene) +
+        _state->materials.size()*sizeof(Implementation::MeshBlobMaterial) +
+        imageCount*sizeof(Implementation::MeshBlobImage);
+    for(AddedMesh& mesh: _state->meshes) {
+        mesh.header.attributeOffset = offset;
+        offset += mesh.attributes.size()*sizeof(Implementation::MeshBlobAttribute);
+    }
+    for(AddedScene& scene: _state->scenes) {
+        scene.header.fieldOffset = offset;
+        offset += scene.fields.size()*sizeof(Implementation::MeshBlobSceneField);
+    }
+    for(AddedMaterial& material: _state->materials) {
+        material.header.attributeOffset = offset;
+        offset += material.attributes.size()*sizeof(Implementation::MeshBlobMaterialAttribute);
+    }
+    for(AddedMaterial& material: _state->materials) {
+        material.header.layerOffset = offset;
+        offset += material.layers.size()*sizeof(UnsignedInt);
+    }
+    for(AddedMesh& mesh: _state->meshes) {
+        mesh.header.nameOffset = offset;
+        offset += mesh.name.size();
+    }
+    for(AddedScene& scene: _state->scenes) {
+        scene.header.nameOffset = offset;
+        offset += scene.name.size();
+    }
+    for(AddedMaterial& material: _state->materials) {
+        material.header.nameOffset = offset;
+        offset += material.name.size();
+    }
+    for(Containers::Array<AddedImage>& images: _state->images) {
+        for(AddedImage& image: images) {
+            image.header.nameOffset = offset;
+            offset += image.name.size();
+        }
+    }
+    for(AddedMaterial& material: _state->materials) {
+        for(Implementation::MeshBlobMaterialAttribute& attribute: material.attributes) {
+            attribute.nameOffset += offset;
+            attribute.valueOffset += offset;
+        }
+        offset += material.strings.size();
+    }
+    std::size_t dataSize = 0;
+    for(AddedMesh& mesh: _state->meshes) {
+        offset = alignTo(offset, alignment);
+        mesh.header.indexDataOffset = offset;
+        mesh.header.indexDataSize = mesh.indexData.size();
+        offset = alignTo(offset + mesh.indexData.size(), alignment);
+        mesh.header.vertexDataOffset = offset;
+        mesh.header.vertexDataSize = mesh.vertexData.size();
+        offset += mesh.vertexData.size();
+        dataSize += mesh.indexData.size() + mesh.vertexData.size();
+    }
+    for(AddedScene& scene: _state->scenes) {
+        offset = alignTo(offset, alignment);
+        scene.header.dataOffset = offset;
+        scene.header.dataSize = scene.data.size();
+        offset += scene.data.size();
+        dataSize += scene.data.size();
+    }
+    for(Containers::Array<AddedImage>& images: _state->images) {
+        for(AddedImage& image: images) {
+            offset = alignTo(offset, alignment);
+            image.header.dataOffset = offset;
+            image.header.dataSize = image.data.size();
+            offset += image.data.size();
+            dataSize += image.data.size();
+        }
+    }
+
+    Containers::Array<char> out{ValueInit, offset};
+
+    Implementation::MeshBlobHeader& header = *reinterpret_cast<Implementation::MeshBlobHeader*>(out.data());
+    header.magic[0] = 'M';
+    header.magic[1] = 'B';
+    header.magic[2] = 'L';
+    header.magic[3] = 'B';
+    header.version = Implementation::MeshBlobVersion;
+    header.bigEndian = Utility::Endianness::isBigEndian();
+    header.meshCount = _state->meshes.size();
+    header.dataAlignment = alignment;
+    header.sceneCount = _state->scenes.size();
+    header.materialCount = _state->materials.size();
+    header.image1DCount = _state->images[0].size();
+    header.image2DCount = _state->images[1].size();
+    header.image3DCount = _state->images[2].size();
+    header.size = out.size();
+
+    std::size_t recordOffset = sizeof(Implementation::MeshBlobHeader);
+    const Containers::ArrayView<Implementation::MeshBlobMesh> meshes = Containers::arrayCast<Implementation::MeshBlobMesh>(out.sliceSize(recordOffset, _state->meshes.size()*sizeof(Implementation::MeshBlobMesh)));
+    for(std::size_t i = 0; i != _state->meshes.size(); ++i) {
+        const AddedMesh& mesh = _state->meshes[i];
+        meshes[i] = mesh.header;
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(mesh.attributes)), out.sliceSize(mesh.header.attributeOffset, mesh.attributes.size()*sizeof(Implementation::MeshBlobAttribute)));
+        Utility::copy(Containers::ArrayView<const char>{mesh.name}, out.sliceSize(mesh.header.nameOffset, mesh.name.size()));
+        Utility::copy(mesh.indexData, out.sliceSize(mesh.header.indexDataOffset, mesh.indexData.size()));
+        Utility::copy(mesh.vertexData, out.sliceSize(mesh.header.vertexDataOffset, mesh.vertexData.size()));
+    }
+    recordOffset += meshes.size()*sizeof(Implementation::MeshBlobMesh);
+
+    const Containers::ArrayView<Implementation::MeshBlobScene> scenes = Containers::arrayCast<Implementation::MeshBlobScene>(out.sliceSize(recordOffset, _state->scenes.size()*sizeof(Implementation::MeshBlobScene)));
+    for(std::size_t i = 0; i != _state->scenes.size(); ++i) {
+        const AddedScene& scene = _state->scenes[i];
+        scenes[i] = scene.header;
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(scene.fields)), out.sliceSize(scene.header.fieldOffset, scene.fields.size()*sizeof(Implementation::MeshBlobSceneField)));
+        Utility::copy(Containers::ArrayView<const char>{scene.name}, out.sliceSize(scene.header.nameOffset, scene.name.size()));
+        Utility::copy(scene.data, out.sliceSize(scene.header.dataOffset, scene.data.size()));
+    }
+    recordOffset += scenes.size()*sizeof(Implementation::MeshBlobScene);
+
+    const Containers::ArrayView<Implementation::MeshBlobMaterial> materials = Containers::arrayCast<Implementation::MeshBlobMaterial>(out.sliceSize(recordOffset, _state->materials.size()*sizeof(Implementation::MeshBlobMaterial)));
+    for(std::size_t i = 0; i != _state->materials.size(); ++i) {
+        const AddedMaterial& material = _state->materials[i];
+        materials[i] = material.header;
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(material.attributes)), out.sliceSize(material.header.attributeOffset, material.attributes.size()*sizeof(Implementation::MeshBlobMaterialAttribute)));
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(material.layers)), out.sliceSize(material.header.layerOffset, material.layers.size()*sizeof(UnsignedInt)));
+        Utility::copy(Containers::ArrayView<const char>{material.name}, out.sliceSize(material.header.nameOffset, material.name.size()));
+        /* The attribute names and values are all next to each other, so
+           copy them at once */
+        if(!material.attributes.isEmpty())
+            Utility::copy(material.strings, out.sliceSize(material.attributes[0].nameOffset, material.strings.size()));
+    }
+    recordOffset += materials.size()*sizeof(Implementation::MeshBlobMaterial);
+
+    const Containers::ArrayView<Implementation::MeshBlobImage> images = Containers::arrayCast<Implementation::MeshBlobImage>(out.sliceSize(recordOffset, imageCount*sizeof(Implementation::MeshBlobImage)));
+    std::size_t imageId = 0;
+    for(const Containers::Array<AddedImage>& imagesOfDimension: _state->images) {
+        for(const AddedImage& image: imagesOfDimension) {
+            images[imageId++] = image.header;
+            Utility::copy(Containers::ArrayView<const char>{image.name}, out.sliceSize(image.header.nameOffset, image.name.size()));
+            Utility::copy(image.data, out.sliceSize(image.header.dataOffset, image.data.size()));
+        }
+    }
+
+    if(flags() & SceneConverterFlag::Verbose)
+        Debug{} << "Trade::MeshBlobSceneConverter::endData(): saved" << _state->meshes.size() << "meshes," << _state->scenes.size() << "scenes," << _state->materials.size() << "materials and" << imageCount << "images with" << dataSize << "bytes of mesh, scene and image data into" << out.size() << "bytes";
+
+    _state = nullptr;
+
+    /* GCC 4.8 needs extra help here */
+    return Containers::optional(Utility::move(out));
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MeshBlobSceneConverter, Magnum::Trade::MeshBlobSceneConverter,
+    MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE)
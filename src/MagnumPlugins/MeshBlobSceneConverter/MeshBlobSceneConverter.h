@@ -0,0 +1,181 @@
+#ifndef Magnum_Trade_MeshBlobSceneConverter_h
+#define Magnum_Trade_MeshBlobSceneConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshBlobSceneConverter
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Trade/AbstractSceneConverter.h"
+
+#include "MagnumPlugins/MeshBlobSceneConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHBLOBSCENECONVERTER_BUILD_STATIC
+    #ifdef MeshBlobSceneConverter_EXPORTS
+        #define MAGNUM_MESHBLOBSCENECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHBLOBSCENECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHBLOBSCENECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHBLOBSCENECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MESHBLOBSCENECONVERTER_EXPORT
+#define MAGNUM_MESHBLOBSCENECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob converter plugin
+@m_since_latest
+
+Creates mesh blob files (`*.mblob`) with meshes, scenes, materials and images
+that can be imported back with the @ref MeshBlobImporter plugin. The mesh,
+scene and image data are stored unchanged, aligned for direct memory mapping,
+which allows the importer to reference them without any copy or processing.
+
+@section Trade-MeshBlobSceneConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractSceneConverter interface. See its
+    documentation for introduction and usage examples.
+
+This plugin depends on the @ref Trade library and is built if
+`MAGNUM_WITH_MESHBLOBSCENECONVERTER` is enabled when building Magnum. To use
+as a dynamic plugin, load @cpp "MeshBlobSceneConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MESHBLOBSCENECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MeshBlobSceneConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MeshBlobSceneConverter` component of the `Magnum`
+package and link to the `Magnum::MeshBlobSceneConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MeshBlobSceneConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MeshBlobSceneConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MeshBlobSceneConverter-behavior Behavior and limitations
+
+Any number of meshes, scenes, materials and 1D, 2D and 3D images can be added
+to the file, which is then written at the end of the conversion. Mesh, scene,
+material and image names are saved, custom mesh attribute and scene field
+names are not, only their numeric IDs. The data are saved in the machine
+endian, together with a flag that allows the importer to reject files of the
+other endianness.
+
+The index and vertex data of each mesh are copied as-is, including any padding
+between attributes and with the original index and attribute strides, offsets,
+array sizes and morph target IDs preserved. Attributes and indices with
+implementation-specific formats are not supported. If a smaller file size is
+desired, use @ref MeshTools::interleave() and @ref MeshTools::compressIndices()
+on the meshes first.
+
+The scene data are copied as-is as well, with field offsets, strides, flags
+and array sizes preserved. That includes bit and string fields. Fields of
+@ref SceneFieldType::Pointer and @relativeref{SceneFieldType,MutablePointer}
+are not supported. Object mapping, parent and other index values are not
+checked against each other in any way.
+
+Material attributes are saved with their names, types and values in the
+original per-layer order, together with the layer offsets and material types.
+Attributes of @ref MaterialAttributeType::Pointer and
+@relativeref{MaterialAttributeType,MutablePointer} are not supported.
+
+Image data are copied as-is including any padding, together with the pixel
+storage properties, image flags and, for uncompressed images, the pixel format,
+extra format value and pixel size. Both generic and implementation-specific
+pixel formats are supported, as well as compressed images. Only a single
+level is saved for each image.
+
+The converter recognizes @ref SceneConverterFlag::Verbose, printing the count
+of saved meshes, scenes, materials and images together with the total size of
+their data and of the output file when the flag is enabled.
+
+@section Trade-MeshBlobSceneConverter-configuration Plugin-specific configuration
+
+It's possible to tune various output options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/MeshBlobSceneConverter/MeshBlobSceneConverter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+*/
+class MAGNUM_MESHBLOBSCENECONVERTER_EXPORT MeshBlobSceneConverter: public AbstractSceneConverter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshBlobSceneConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshBlobSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~MeshBlobSceneConverter();
+
+    private:
+        struct State;
+
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL SceneConverterFeatures doFeatures() const override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL void doAbort() override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doBeginData() override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL Containers::Optional<Containers::Array<char>> doEndData() override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const SceneData& scene, Containers::StringView name) override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const MeshData& mesh, Containers::StringView name) override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const MaterialData& material, Containers::StringView name) override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData1D& image, Containers::StringView name) override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData2D& image, Containers::StringView name) override;
+        MAGNUM_MESHBLOBSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData3D& image, Containers::StringView name) override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,565 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+
+#include "Magnum/ImageFlags.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+using namespace Containers::Literals;
+using namespace Math::Literals;
+
+struct MeshBlobSceneConverterTest: TestSuite::Tester {
+    explicit MeshBlobSceneConverterTest();
+
+    void implementationSpecificIndexType();
+    void implementationSpecificVertexFormat();
+    void invalidAlignment();
+    void pointerSceneField();
+    void pointerMaterialAttribute();
+
+    void convert();
+    void convertScene();
+    void convertMaterial();
+    void convertImages();
+    void convertEmpty();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractSceneConverter> _converterManager{"nonexistent"};
+    PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    SceneConverterFlags flags;
+    bool verbose;
+} VerboseData[]{
+    {"", {}, false},
+    {"verbose", SceneConverterFlag::Verbose, true},
+};
+
+/* Positions and texture coordinates not interleaved, with the indices
+   strided. The converter preserves the layout. */
+const struct {
+    Vector3 positions[4];
+    Vector2 textureCoordinates[4];
+} VertexData{{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+}, {
+    {0.0f, 0.0f},
+    {1.0f, 0.0f},
+    {0.0f, 1.0f},
+    {1.0f, 1.0f},
+}};
+
+const UnsignedInt Indices[]{
+    0, 0xffffffff, 1, 0xffffffff, 2, 0xffffffff,
+    2, 0xffffffff, 1, 0xffffffff, 3, 0xffffffff,
+};
+
+const UnsignedInt ExpectedIndices[]{0, 1, 2, 2, 1, 3};
+
+/* All fields in a single struct, the converter copies the data as a whole and
+   preserves the layout */
+const struct {
+    UnsignedInt mapping[3];
+    Int parents[3];
+    Vector3 translations[3];
+    UnsignedInt nameEnds[3];
+    char names[7];
+    UnsignedByte visible;
+} SceneContents{
+    {2, 0, 1},
+    {-1, 2, 2},
+    {{1.0f, 2.0f, 3.0f},
+     {4.0f, 5.0f, 6.0f},
+     {7.0f, 8.0f, 9.0f}},
+    {1, 3, 6},
+    "abcdef",
+    0x05
+};
+
+MeshBlobSceneConverterTest::MeshBlobSceneConverterTest() {
+    addTests({&MeshBlobSceneConverterTest::implementationSpecificIndexType,
+              &MeshBlobSceneConverterTest::implementationSpecificVertexFormat,
+              &MeshBlobSceneConverterTest::invalidAlignment,
+              &MeshBlobSceneConverterTest::pointerSceneField,
+              &MeshBlobSceneConverterTest::pointerMaterialAttribute});
+
+    addInstancedTests({&MeshBlobSceneConverterTest::convert},
+        Containers::arraySize(VerboseData));
+
+    addTests({&MeshBlobSceneConverterTest::convertScene,
+              &MeshBlobSceneConverterTest::convertMaterial,
+              &MeshBlobSceneConverterTest::convertImages,
+              &MeshBlobSceneConverterTest::convertEmpty});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MESHBLOBSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_converterManager.load(MESHBLOBSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    /* Optional plugins that don't have to be here */
+    #ifdef MESHBLOBIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(MESHBLOBIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MeshBlobSceneConverterTest::implementationSpecificIndexType() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    const char indices[6]{};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{indices, 3, 2}},
+        {}, VertexData.positions, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)}
+        }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertToData(mesh));
+    CORRADE_COMPARE(out, "Trade::MeshBlobSceneConverter::add(): implementation-specific index type 0xcaca is not supported\n");
+}
+
+void MeshBlobSceneConverterTest::implementationSpecificVertexFormat() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    MeshData mesh{MeshPrimitive::Triangles, {}, VertexData.positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)},
+        MeshAttributeData{MeshAttribute::Normal, vertexFormatWrap(0xcaca), Containers::StridedArrayView1D<const void>{Containers::stridedArrayView(VertexData.positions)}}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertToData(mesh));
+    CORRADE_COMPARE(out, "Trade::MeshBlobSceneConverter::add(): implementation-specific vertex format 0xcaca of attribute 1 is not supported\n");
+}
+
+void MeshBlobSceneConverterTest::invalidAlignment() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+    converter->configuration().setValue("alignment", 12);
+
+    MeshData mesh{MeshPrimitive::Triangles, {}, VertexData.positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertToData(mesh));
+    CORRADE_COMPARE(out, "Trade::MeshBlobSceneConverter::endData(): expected alignment to be a power of two and at least 8 bytes but got 12\n");
+}
+
+void MeshBlobSceneConverterTest::pointerSceneField() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    const struct {
+        UnsignedInt mapping[1];
+        const void* importerState[1];
+    } data{{0}, {nullptr}};
+    SceneData scene{SceneMappingType::UnsignedInt, 1, {}, Containers::arrayView(&data, 1), {
+        SceneFieldData{SceneField::ImporterState, Containers::arrayView(data.mapping), Containers::arrayView(data.importerState)}
+    }};
+
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(scene));
+    CORRADE_COMPARE(out, "Trade::MeshBlobSceneConverter::add(): Trade::SceneFieldType::Pointer field Trade::SceneField::ImporterState is not supported\n");
+}
+
+void MeshBlobSceneConverterTest::pointerMaterialAttribute() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    const Int value{};
+    MaterialData material{{}, {
+        {"pointer", static_cast<const void*>(&value)}
+    }};
+
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(material));
+    CORRADE_COMPARE(out, "Trade::MeshBlobSceneConverter::add(): Trade::MaterialAttributeType::Pointer material attribute pointer is not supported\n");
+}
+
+void MeshBlobSceneConverterTest::convert() {
+    auto&& data = VerboseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+    converter->setFlags(data.flags);
+
+    MeshData indexed{MeshPrimitive::Triangles,
+        {}, Indices, MeshIndexData{Containers::stridedArrayView(Indices).every(2)},
+        {}, Containers::arrayView(&VertexData, 1), {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, Containers::arrayView(VertexData.textureCoordinates)},
+        }};
+
+    /* Vertex data are just bytes for the converter, so the attributes can be
+       anything */
+    MeshData nonIndexed{MeshPrimitive::Points,
+        {}, Containers::arrayView(&VertexData, 1), {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions), 3},
+            MeshAttributeData{meshAttributeCustom(15), VertexFormat::Float, Containers::stridedArrayView(VertexData.textureCoordinates), 2},
+        }};
+
+    Containers::String out;
+    Containers::Optional<Containers::Array<char>> converted;
+    {
+        Debug redirectOutput{&out};
+        CORRADE_VERIFY(converter->beginData());
+        CORRADE_VERIFY(converter->add(indexed, "quad"));
+        CORRADE_VERIFY(converter->add(nonIndexed, "points"));
+        converted = converter->endData();
+    }
+    CORRADE_VERIFY(converted);
+
+    /* Header and two meshes take 224 bytes, the four attributes 96 and the
+       names 10, after which the data are aligned to the default 4096 bytes.
+       The tests assume a Little-Endian machine, like elsewhere. */
+    const Implementation::MeshBlobHeader& header = *reinterpret_cast<const Implementation::MeshBlobHeader*>(converted->data());
+    CORRADE_COMPARE(Containers::StringView(header.magic, 4), "MBLB");
+    CORRADE_COMPARE(header.version, Implementation::MeshBlobVersion);
+    CORRADE_COMPARE(header.bigEndian, 0);
+    CORRADE_COMPARE(header.meshCount, 2);
+    CORRADE_COMPARE(header.dataAlignment, 4096);
+    CORRADE_COMPARE(header.size, 3*4096 + 80);
+    CORRADE_COMPARE(converted->size(), 3*4096 + 80);
+    if(data.verbose) CORRADE_COMPARE(out,
+        "Trade::MeshBlobSceneConverter::endData(): saved 2 meshes, 0 scenes, 0 materials and 0 images with 208 bytes of mesh, scene and image data into 12368 bytes\n");
+    else CORRADE_COMPARE(out, "");
+
+    if(!(_importerManager.loadState("MeshBlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshBlobImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshBlobImporter");
+    CORRADE_VERIFY(importer->openMemory(*converted));
+    CORRADE_COMPARE(importer->meshCount(), 2);
+    CORRADE_COMPARE(importer->meshName(0), "quad");
+    CORRADE_COMPARE(importer->meshName(1), "points");
+
+    {
+        Containers::Optional<MeshData> imported = importer->mesh("quad");
+        CORRADE_VERIFY(imported);
+        CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Triangles);
+
+        /* The data are page-aligned and referenced directly from the file */
+        CORRADE_COMPARE(imported->indexDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(imported->vertexDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(imported->indexData().data(), static_cast<const void*>(converted->data() + 4096));
+        CORRADE_COMPARE(imported->vertexData().data(), static_cast<const void*>(converted->data() + 2*4096));
+
+        /* The strided index layout is preserved */
+        CORRADE_VERIFY(imported->isIndexed());
+        CORRADE_COMPARE(imported->indexType(), MeshIndexType::UnsignedInt);
+        CORRADE_COMPARE(imported->indexStride(), 8);
+        CORRADE_COMPARE_AS(imported->indices<UnsignedInt>(),
+            Containers::arrayView(ExpectedIndices),
+            TestSuite::Compare::Container);
+
+        CORRADE_COMPARE(imported->attributeCount(), 2);
+        CORRADE_COMPARE(imported->attributeName(0), MeshAttribute::Position);
+        CORRADE_COMPARE(imported->attributeOffset(0), 0);
+        CORRADE_COMPARE(imported->attributeStride(0), sizeof(Vector3));
+        CORRADE_COMPARE_AS(imported->attribute<Vector3>(0),
+            Containers::arrayView(VertexData.positions),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(imported->attributeName(1), MeshAttribute::TextureCoordinates);
+        CORRADE_COMPARE(imported->attributeOffset(1), sizeof(VertexData.positions));
+        CORRADE_COMPARE(imported->attributeStride(1), sizeof(Vector2));
+        CORRADE_COMPARE_AS(imported->attribute<Vector2>(1),
+            Containers::arrayView(VertexData.textureCoordinates),
+            TestSuite::Compare::Container);
+    } {
+        Containers::Optional<MeshData> imported = importer->mesh("points");
+        CORRADE_VERIFY(imported);
+        CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Points);
+        CORRADE_VERIFY(!imported->isIndexed());
+        CORRADE_COMPARE(imported->vertexData().data(), static_cast<const void*>(converted->data() + 3*4096));
+
+        CORRADE_COMPARE(imported->attributeCount(), 2);
+        CORRADE_COMPARE(imported->attributeName(0), MeshAttribute::Position);
+        CORRADE_COMPARE(imported->attributeMorphTargetId(0), 3);
+        CORRADE_COMPARE(imported->attributeArraySize(0), 0);
+        CORRADE_COMPARE(imported->attributeName(1), meshAttributeCustom(15));
+        CORRADE_COMPARE(imported->attributeFormat(1), VertexFormat::Float);
+        CORRADE_COMPARE(imported->attributeMorphTargetId(1), -1);
+        CORRADE_COMPARE(imported->attributeArraySize(1), 2);
+        CORRADE_COMPARE_AS(imported->vertexData(),
+            Containers::arrayCast<const char>(Containers::arrayView(&VertexData, 1)),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MeshBlobSceneConverterTest::convertScene() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    SceneData scene{SceneMappingType::UnsignedInt, 3, {}, Containers::arrayView(&SceneContents, 1), {
+        SceneFieldData{SceneField::Parent, Containers::arrayView(SceneContents.mapping), Containers::arrayView(SceneContents.parents)},
+        SceneFieldData{SceneField::Translation, Containers::arrayView(SceneContents.mapping), Containers::arrayView(SceneContents.translations)},
+        SceneFieldData{sceneFieldCustom(7), Containers::arrayView(SceneContents.mapping), SceneContents.names, SceneFieldType::StringOffset32, Containers::arrayView(SceneContents.nameEnds)},
+        SceneFieldData{sceneFieldCustom(8), Containers::arrayView(SceneContents.mapping), Containers::BitArrayView{&SceneContents.visible, 0, 3}},
+    }};
+
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(scene, "scene"));
+    Containers::Optional<Containers::Array<char>> converted = converter->endData();
+    CORRADE_VERIFY(converted);
+
+    /* Header, the scene and its four fields take 296 bytes and the name 5,
+       after which the data are aligned to the default 4096 bytes */
+    const Implementation::MeshBlobHeader& header = *reinterpret_cast<const Implementation::MeshBlobHeader*>(converted->data());
+    CORRADE_COMPARE(header.meshCount, 0);
+    CORRADE_COMPARE(header.sceneCount, 1);
+    CORRADE_COMPARE(header.size, 4096 + sizeof(SceneContents));
+    CORRADE_COMPARE(converted->size(), 4096 + sizeof(SceneContents));
+
+    if(!(_importerManager.loadState("MeshBlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshBlobImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshBlobImporter");
+    CORRADE_VERIFY(importer->openMemory(*converted));
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+    CORRADE_COMPARE(importer->sceneName(0), "scene");
+    CORRADE_COMPARE(importer->objectCount(), 3);
+
+    Containers::Optional<SceneData> imported = importer->scene(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->mappingType(), SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(imported->mappingBound(), 3);
+
+    /* The data are page-aligned and referenced directly from the file */
+    CORRADE_COMPARE(imported->dataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(imported->data().data(), static_cast<const void*>(converted->data() + 4096));
+    CORRADE_COMPARE(imported->data().size(), sizeof(SceneContents));
+
+    CORRADE_COMPARE(imported->fieldCount(), 4);
+    CORRADE_VERIFY(imported->is3D());
+    CORRADE_COMPARE_AS(imported->mapping<UnsignedInt>(SceneField::Parent),
+        Containers::arrayView(SceneContents.mapping),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imported->field<Int>(SceneField::Parent),
+        Containers::arrayView(SceneContents.parents),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imported->field<Vector3>(SceneField::Translation),
+        Containers::arrayView(SceneContents.translations),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(imported->fieldType(sceneFieldCustom(7)), SceneFieldType::StringOffset32);
+    CORRADE_COMPARE(imported->fieldStringData(sceneFieldCustom(7)), static_cast<const void*>(converted->data() + 4096 + (SceneContents.names - reinterpret_cast<const char*>(&SceneContents))));
+    CORRADE_COMPARE_AS(imported->fieldStrings(sceneFieldCustom(7)), Containers::arrayView({
+        "a"_s, "bc"_s, "def"_s
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(imported->fieldType(sceneFieldCustom(8)), SceneFieldType::Bit);
+    CORRADE_COMPARE_AS(imported->fieldBits(sceneFieldCustom(8)), Containers::stridedArrayView({
+        true, false, true
+    }).sliceBit(0), TestSuite::Compare::Container);
+}
+
+void MeshBlobSceneConverterTest::convertMaterial() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    const char buffer[]{'\x0a', '\x0b', '\x0c'};
+    MaterialData material{MaterialType::PbrMetallicRoughness|MaterialType::PbrClearCoat, {
+        {MaterialAttribute::BaseColor, 0x3bd26799_rgbaf},
+        {MaterialAttribute::DoubleSided, true},
+        {"data", Containers::arrayView(buffer)},
+        {"note", "hello"_s},
+        {MaterialLayer::ClearCoat},
+        {MaterialAttribute::LayerFactor, 0.5f},
+    }, {4, 6}};
+
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(material, "mat"));
+    Containers::Optional<Containers::Array<char>> converted = converter->endData();
+    CORRADE_VERIFY(converted);
+
+    const Implementation::MeshBlobHeader& header = *reinterpret_cast<const Implementation::MeshBlobHeader*>(converted->data());
+    CORRADE_COMPARE(header.materialCount, 1);
+
+    if(!(_importerManager.loadState("MeshBlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshBlobImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshBlobImporter");
+    CORRADE_VERIFY(importer->openData(*converted));
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->materialName(0), "mat");
+
+    Containers::Optional<MaterialData> imported = importer->material(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->types(), MaterialType::PbrMetallicRoughness|MaterialType::PbrClearCoat);
+    CORRADE_COMPARE(imported->layerCount(), 2);
+    CORRADE_COMPARE_AS(imported->layerData(),
+        Containers::arrayView<UnsignedInt>({4, 6}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(imported->attributeCount(0), 4);
+    CORRADE_COMPARE(imported->attribute<Color4>(MaterialAttribute::BaseColor), 0x3bd26799_rgbaf);
+    CORRADE_VERIFY(imported->isDoubleSided());
+    CORRADE_COMPARE(imported->attributeType("data"), MaterialAttributeType::Buffer);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const char>(imported->attribute<Containers::ArrayView<const void>>("data")),
+        Containers::arrayView(buffer),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(imported->attribute<Containers::StringView>("note"), "hello");
+
+    CORRADE_COMPARE(imported->attributeCount(1), 2);
+    CORRADE_COMPARE(imported->layerName(1), "ClearCoat");
+    CORRADE_COMPARE(imported->layerFactor(1), 0.5f);
+}
+
+void MeshBlobSceneConverterTest::convertImages() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    /* An implementation-specific 1D format with a three-byte pixel, a 2D
+       image with a one-byte row alignment and a compressed cube map */
+    const char data1D[12]{'\x01', '\x02', '\x03', '\x04', '\x05', '\x06',
+                          '\x07', '\x08', '\x09', '\x0a', '\x0b', '\x0c'};
+    const char data2D[18]{'\x0a', '\x0b', '\x0c', '\x0d', '\x0e', '\x0f',
+                          '\x1a', '\x1b', '\x1c', '\x1d', '\x1e', '\x1f',
+                          '\x2a', '\x2b', '\x2c', '\x2d', '\x2e', '\x2f'};
+    char data3D[48];
+    for(std::size_t i = 0; i != Containers::arraySize(data3D); ++i)
+        data3D[i] = char(i);
+    ImageData1D image1D{PixelStorage{}, 0xcaca, 0xfefe, 3, 4, {}, data1D};
+    ImageData2D image2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 3}, {}, data2D};
+    ImageData3D image3D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4, 6}, {}, data3D, ImageFlag3D::CubeMap};
+
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(image1D, "line"));
+    CORRADE_VERIFY(converter->add(image2D, "rgb"));
+    CORRADE_VERIFY(converter->add(image3D, "cube"));
+    Containers::Optional<Containers::Array<char>> converted = converter->endData();
+    CORRADE_VERIFY(converted);
+
+    /* Header and the three images take 336 bytes and the names 11, after
+       which each image is aligned to the default 4096 bytes */
+    const Implementation::MeshBlobHeader& header = *reinterpret_cast<const Implementation::MeshBlobHeader*>(converted->data());
+    CORRADE_COMPARE(header.image1DCount, 1);
+    CORRADE_COMPARE(header.image2DCount, 1);
+    CORRADE_COMPARE(header.image3DCount, 1);
+    CORRADE_COMPARE(header.size, 3*4096 + 48);
+    CORRADE_COMPARE(converted->size(), 3*4096 + 48);
+
+    if(!(_importerManager.loadState("MeshBlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshBlobImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshBlobImporter");
+    CORRADE_VERIFY(importer->openMemory(*converted));
+    CORRADE_COMPARE(importer->image1DCount(), 1);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 1);
+    CORRADE_COMPARE(importer->image1DName(0), "line");
+    CORRADE_COMPARE(importer->image2DName(0), "rgb");
+    CORRADE_COMPARE(importer->image3DName(0), "cube");
+
+    /* The data are page-aligned and referenced directly from the file */
+    {
+        Containers::Optional<ImageData1D> imported = importer->image1D(0);
+        CORRADE_VERIFY(imported);
+        CORRADE_VERIFY(!imported->isCompressed());
+        CORRADE_COMPARE(imported->dataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(imported->data().data(), static_cast<const void*>(converted->data() + 4096));
+        CORRADE_COMPARE(imported->format(), pixelFormatWrap(0xcaca));
+        CORRADE_COMPARE(imported->formatExtra(), 0xfefe);
+        CORRADE_COMPARE(imported->pixelSize(), 3);
+        CORRADE_COMPARE(imported->size(), Math::Vector<1, Int>{4});
+        CORRADE_COMPARE_AS(imported->data(),
+            Containers::arrayView(data1D),
+            TestSuite::Compare::Container);
+    } {
+        Containers::Optional<ImageData2D> imported = importer->image2D(0);
+        CORRADE_VERIFY(imported);
+        CORRADE_VERIFY(!imported->isCompressed());
+        CORRADE_COMPARE(imported->data().data(), static_cast<const void*>(converted->data() + 2*4096));
+        CORRADE_COMPARE(imported->storage().alignment(), 1);
+        CORRADE_COMPARE(imported->format(), PixelFormat::RGB8Unorm);
+        CORRADE_COMPARE(imported->size(), (Vector2i{2, 3}));
+        CORRADE_COMPARE_AS(imported->data(),
+            Containers::arrayView(data2D),
+            TestSuite::Compare::Container);
+    } {
+        Containers::Optional<ImageData3D> imported = importer->image3D(0);
+        CORRADE_VERIFY(imported);
+        CORRADE_VERIFY(imported->isCompressed());
+        CORRADE_COMPARE(imported->data().data(), static_cast<const void*>(converted->data() + 3*4096));
+        CORRADE_COMPARE(imported->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+        CORRADE_COMPARE(imported->flags(), ImageFlag3D::CubeMap);
+        CORRADE_COMPARE(imported->size(), (Vector3i{4, 4, 6}));
+        CORRADE_COMPARE_AS(imported->data(),
+            Containers::arrayView(data3D),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MeshBlobSceneConverterTest::convertEmpty() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshBlobSceneConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+    Containers::Optional<Containers::Array<char>> converted = converter->endData();
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), sizeof(Implementation::MeshBlobHeader));
+
+    if(!(_importerManager.loadState("MeshBlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshBlobImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshBlobImporter");
+    CORRADE_VERIFY(importer->openData(*converted));
+    CORRADE_COMPARE(importer->meshCount(), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshBlobSceneConverterTest)
@@ -0,0 +1,289 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshCodecImporter.h"
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/MeshTools/Encode.h"
+#include "Magnum/Trade/MeshData.h"
+#include "MagnumPlugins/MeshCodecImporter/MeshCodecHeader.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+struct MeshCodecImporter::State {
+    Containers::Array<char> data;
+    MeshPrimitive primitive;
+    MeshIndexType indexType;
+    UnsignedInt indexCount;
+    UnsignedInt vertexCount;
+    UnsignedInt vertexSize;
+    Containers::Array<MeshAttributeData> attributes;
+    Containers::ArrayView<const char> indexData;
+    Containers::ArrayView<const char> vertexData;
+};
+
+MeshCodecImporter::MeshCodecImporter() = default;
+
+MeshCodecImporter::MeshCodecImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
+
+MeshCodecImporter::~MeshCodecImporter() = default;
+
+ImporterFeatures MeshCodecImporter::doFeatures() const { return ImporterFeature::OpenData; }
+
+bool MeshCodecImporter::doIsOpened() const { return !!_state; }
+
+void MeshCodecImporter::doClose() { _state = nullptr; }
+
+void MeshCodecImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
+    if(data.size() < sizeof(Implementation::MeshCodecHeader)) {
+        Error{} << "Trade::MeshCodecImporter::openData(): file too short, expected at least" << sizeof(Implementation::MeshCodecHeader) << "bytes but got" << data.size();
+        return;
+    }
+
+    const Implementation::MeshCodecHeader& header = *reinterpret_cast<const Implementation::MeshCodecHeader*>(data.data());
+    if(Containers::StringView{header.magic, 3} != "MCM"_s) {
+        Error{} << "Trade::MeshCodecImporter::openData(): invalid file signature" << Containers::StringView{header.magic, 3};
+        return;
+    }
+    if(header.version != Implementation::MeshCodecVersion) {
+        Error{} << "Trade::MeshCodecImporter::openData(): unsupported version" << header.version;
+        return;
+    }
+
+    /* Header values in machine endian */
+    const UnsignedInt primitive = Utility::Endianness::littleEndian(header.primitive);
+    const UnsignedInt indexType = Utility::Endianness::littleEndian(header.indexType);
+    const UnsignedInt indexCount = Utility::Endianness::littleEndian(header.indexCount);
+    const UnsignedInt vertexCount = Utility::Endianness::littleEndian(header.vertexCount);
+    const UnsignedInt vertexSize = Utility::Endianness::littleEndian(header.vertexSize);
+    const UnsignedInt attributeCount = Utility::Endianness::littleEndian(header.attributeCount);
+    const UnsignedInt indexDataSize = Utility::Endianness::littleEndian(header.indexDataSize);
+    const UnsignedInt vertexDataSize = Utility::Endianness::littleEndian(header.vertexDataSize);
+
+    /* Implementation-specific primitives have no special treatment in the
+       file, so they're allowed */
+    if(!isMeshPrimitiveImplementationSpecific(MeshPrimitive(primitive)) && (!primitive || primitive > UnsignedInt(MeshPrimitive::Meshlets))) {
+        Error{} << "Trade::MeshCodecImporter::openData(): invalid primitive" << MeshPrimitive(primitive);
+        return;
+    }
+    if(indexType > UnsignedInt(MeshIndexType::UnsignedInt)) {
+        Error{} << "Trade::MeshCodecImporter::openData(): invalid index type" << MeshIndexType(indexType);
+        return;
+    }
+    if(!indexType && (indexCount || indexDataSize)) {
+        Error{} << "Trade::MeshCodecImporter::openData(): expected no index data for a non-indexed mesh but got" << indexCount << "indices in" << indexDataSize << "bytes";
+        return;
+    }
+    if(vertexSize > 32767) {
+        Error{} << "Trade::MeshCodecImporter::openData(): expected vertex size to fit into 15 bits but got" << vertexSize;
+        return;
+    }
+
+    /* The decoded data are allocated based on the counts in the header, so
+       check them against the smallest possible encoded size to not allocate
+       gigabytes for a few-byte file. Each triangle takes at least a control
+       byte and each remaining index at least one byte, each byte of each 64
+       vertices at least a byte with bit widths of the groups, and both have
+       a version byte in front. */
+    if(indexType) {
+        const UnsignedLong minIndexDataSize = 1 + indexCount/3 + indexCount%3;
+        if(indexDataSize < minIndexDataSize) {
+            Error{} << "Trade::MeshCodecImporter::openData(): expected at least" << minIndexDataSize << "bytes of encoded index data for" << indexCount << "indices but got" << indexDataSize;
+            return;
+        }
+    }
+    const UnsignedLong minVertexDataSize = 1 + UnsignedLong(vertexSize)*((UnsignedLong(vertexCount) + 63)/64);
+    if(vertexDataSize < minVertexDataSize) {
+        Error{} << "Trade::MeshCodecImporter::openData(): expected at least" << minVertexDataSize << "bytes of encoded vertex data for" << vertexCount << "vertices of" << vertexSize << "bytes but got" << vertexDataSize;
+        return;
+    }
+
+    const std::size_t attributeOffset = sizeof(Implementation::MeshCodecHeader);
+    const std::size_t indexDataOffset = attributeOffset + std::size_t(attributeCount)*sizeof(Implementation::MeshCodecAttribute);
+    const std::size_t vertexDataOffset = indexDataOffset + indexDataSize;
+    const std::size_t expectedSize = vertexDataOffset + vertexDataSize;
+    if(data.size() != expectedSize) {
+        Error{} << "Trade::MeshCodecImporter::openData(): file size mismatch, expected" << expectedSize << "bytes but got" << data.size();
+        return;
+    }
+
+    /* Validate all attributes upfront so MeshData construction in doMesh()
+       doesn't assert */
+    Containers::Array<MeshAttributeData> attributes{attributeCount};
+    const Containers::ArrayView<const Implementation::MeshCodecAttribute> attributeData = Containers::arrayCast<const Implementation::MeshCodecAttribute>(data.slice(attributeOffset, indexDataOffset));
+    for(std::size_t i = 0; i != attributeData.size(); ++i) {
+        const MeshAttribute name = MeshAttribute(Utility::Endianness::littleEndian(attributeData[i].name));
+        const UnsignedShort arraySize = Utility::Endianness::littleEndian(attributeData[i].arraySize);
+        const VertexFormat format = VertexFormat(Utility::Endianness::littleEndian(attributeData[i].format));
+        const UnsignedInt offset = Utility::Endianness::littleEndian(attributeData[i].offset);
+        const Int morphTargetId = Utility::Endianness::littleEndian(attributeData[i].morphTargetId);
+
+        if(!isMeshAttributeCustom(name) && (name == MeshAttribute{} || UnsignedShort(name) > UnsignedShort(MeshAttribute::ObjectId))) {
+            Error{} << "Trade::MeshCodecImporter::openData(): invalid attribute" << i << "name" << name;
+            return;
+        }
+        if(format == VertexFormat{} || isVertexFormatImplementationSpecific(format) || UnsignedInt(format) > UnsignedInt(VertexFormat::Matrix4x3sNormalizedAligned)) {
+            Error{} << "Trade::MeshCodecImporter::openData(): invalid attribute" << i << "format" << format;
+            return;
+        }
+        if(!Implementation::isVertexFormatCompatibleWithAttribute(name, format)) {
+            Error{} << "Trade::MeshCodecImporter::openData():" << format << "is not a valid format for" << name;
+            return;
+        }
+        if(arraySize && !Implementation::isAttributeArrayAllowed(name)) {
+            Error{} << "Trade::MeshCodecImporter::openData():" << name << "can't be an array attribute";
+            return;
+        }
+        if(!arraySize && Implementation::isAttributeArrayExpected(name)) {
+            Error{} << "Trade::MeshCodecImporter::openData():" << name << "has to be an array attribute";
+            return;
+        }
+        if(morphTargetId != -1 && (UnsignedInt(morphTargetId) >= 128 || !Implementation::isMorphTargetAllowed(name))) {
+            Error{} << "Trade::MeshCodecImporter::openData(): invalid morph target ID" << morphTargetId << "for" << name;
+            return;
+        }
+        const std::size_t attributeSize = std::size_t(vertexFormatSize(format))*Math::max(arraySize, UnsignedShort{1});
+        if(offset + attributeSize > vertexSize) {
+            Error{} << "Trade::MeshCodecImporter::openData(): attribute" << i << "spans" << offset + attributeSize << "bytes but vertex size is" << vertexSize;
+            return;
+        }
+
+        attributes[i] = MeshAttributeData{name, format, offset, vertexCount, vertexSize, arraySize, morphTargetId};
+    }
+
+    /* Skin joint IDs and weights are paired in order of appearance, their
+       count and array sizes have to match */
+    UnsignedInt jointIdAttributeCount = 0;
+    UnsignedInt weightAttributeCount = 0;
+    for(const MeshAttributeData& attribute: attributes) {
+        if(attribute.name() == MeshAttribute::JointIds)
+            ++jointIdAttributeCount;
+        else if(attribute.name() == MeshAttribute::Weights)
+            ++weightAttributeCount;
+    }
+    if(weightAttributeCount != jointIdAttributeCount) {
+        Error{} << "Trade::MeshCodecImporter::openData(): expected" << jointIdAttributeCount << "weight attributes to match joint IDs but got" << weightAttributeCount;
+        return;
+    }
+    for(std::size_t i = 0, j = 0, pair = 0; i != attributes.size(); ++i) {
+        if(attributes[i].name() != MeshAttribute::JointIds) continue;
+        while(attributes[j].name() != MeshAttribute::Weights) ++j;
+        if(attributes[j].arraySize() != attributes[i].arraySize()) {
+            Error{} << "Trade::MeshCodecImporter::openData(): expected" << attributes[i].arraySize() << "array items for weight attribute" << pair << "to match joint IDs but got" << attributes[j].arraySize();
+            return;
+        }
+        ++j;
+        ++pair;
+    }
+
+    /* Take over the existing array or copy the data if we can't */
+    Containers::Pointer<State> state{InPlaceInit};
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned))
+        state->data = Utility::move(data);
+    else {
+        state->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, state->data);
+    }
+
+    state->primitive = MeshPrimitive(primitive);
+    state->indexType = MeshIndexType(indexType);
+    state->indexCount = indexCount;
+    state->vertexCount = vertexCount;
+    state->vertexSize = vertexSize;
+    state->attributes = Utility::move(attributes);
+    state->indexData = state->data.slice(indexDataOffset, vertexDataOffset);
+    state->vertexData = state->data.exceptPrefix(vertexDataOffset);
+    _state = Utility::move(state);
+}
+
+UnsignedInt MeshCodecImporter::doMeshCount() const { return 1; }
+
+Containers::Optional<MeshData> MeshCodecImporter::doMesh(UnsignedInt, UnsignedInt) {
+    Containers::Array<char> indexData;
+    if(_state->indexType != MeshIndexType{}) {
+        const UnsignedInt indexTypeSize = meshIndexTypeSize(_state->indexType);
+        indexData = Containers::Array<char>{NoInit, std::size_t(_state->indexCount)*indexTypeSize};
+        if(!MeshTools::decodeIndexBufferInto(_state->indexData, Containers::StridedArrayView2D<char>{indexData, {_state->indexCount, indexTypeSize}})) {
+            Error{} << "Trade::MeshCodecImporter::mesh(): can't decode index data";
+            return {};
+        }
+
+        /* The codec can represent any index value, check that they all
+           reference existing vertices */
+        if(_state->indexCount) {
+            UnsignedInt maxIndex;
+            if(_state->indexType == MeshIndexType::UnsignedInt)
+                maxIndex = Math::max(Containers::arrayCast<const UnsignedInt>(indexData));
+            else if(_state->indexType == MeshIndexType::UnsignedShort)
+                maxIndex = Math::max(Containers::arrayCast<const UnsignedShort>(indexData));
+            else
+                maxIndex = Math::max(Containers::arrayCast<const UnsignedByte>(indexData));
+            if(maxIndex >= _state->vertexCount) {
+                Error{} << "Trade::MeshCodecImporter::mesh(): index" << maxIndex << "out of range for" << _state->vertexCount << "vertices";
+                return {};
+            }
+        }
+    }
+
+    Containers::Array<char> vertexData{NoInit, std::size_t(_state->vertexCount)*_state->vertexSize};
+    if(!MeshTools::decodeVertexBufferInto(_state->vertexData, Containers::StridedArrayView2D<char>{vertexData, {_state->vertexCount, _state->vertexSize}})) {
+        Error{} << "Trade::MeshCodecImporter::mesh(): can't decode vertex data";
+        return {};
+    }
+
+    /* The attributes are offset-only, so they can be copied as-is */
+    Containers::Array<MeshAttributeData> attributes{_state->attributes.size()};
+    for(std::size_t i = 0; i != attributes.size(); ++i)
+        attributes[i] = _state->attributes[i];
+
+    if(_state->indexType == MeshIndexType{})
+        return MeshData{_state->primitive,
+            Utility::move(vertexData), Utility::move(attributes),
+            _state->vertexCount};
+
+    const MeshIndexData indices{_state->indexType, indexData};
+    return MeshData{_state->primitive,
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributes),
+        _state->vertexCount};
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MeshCodecImporter, Magnum::Trade::MeshCodecImporter,
+    MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE)
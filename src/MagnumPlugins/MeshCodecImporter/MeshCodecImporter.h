@@ -0,0 +1,146 @@
+#ifndef Magnum_Trade_MeshCodecImporter_h
+#define Magnum_Trade_MeshCodecImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshCodecImporter
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MeshCodecImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHCODECIMPORTER_BUILD_STATIC
+    #ifdef MeshCodecImporter_EXPORTS
+        #define MAGNUM_MESHCODECIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHCODECIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHCODECIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHCODECIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MESHCODECIMPORTER_EXPORT
+#define MAGNUM_MESHCODECIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Compressed mesh importer plugin
+@m_since_latest
+
+Imports compressed meshes (`*.mcm`) produced by the
+@ref MeshCodecSceneConverter plugin. The index and vertex data are
+decompressed with @ref MeshTools::decodeIndexBufferInto() and
+@ref MeshTools::decodeVertexBufferInto().
+
+@section Trade-MeshCodecImporter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractImporter interface. See its documentation for
+    introduction and usage examples.
+
+This plugin depends on the @ref Trade and @ref MeshTools libraries and is built
+if `MAGNUM_WITH_MESHCODECIMPORTER` is enabled when building Magnum. To use as
+a dynamic plugin, load @cpp "MeshCodecImporter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MESHCODECIMPORTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MeshCodecImporter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MeshCodecImporter` component of the `Magnum` package and
+link to the `Magnum::MeshCodecImporter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MeshCodecImporter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MeshCodecImporter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MeshCodecImporter-behavior Behavior and limitations
+
+The file contains exactly one mesh, which is imported with the same primitive,
+index type, vertex count and attribute formats, array sizes and morph target
+IDs as it was saved with. Vertex data are always imported as a single
+interleaved buffer without any padding between attributes. Custom attributes
+are imported without names.
+
+The file header and attribute layout is validated already when opening the
+file, including a check that the index and vertex data sizes aren't smaller
+than the minimal encoded size for the index and vertex count, so a truncated
+or malicious file can't cause excessive allocations. The index and vertex data
+are decompressed on every @ref mesh() call.
+*/
+class MAGNUM_MESHCODECIMPORTER_EXPORT MeshCodecImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshCodecImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshCodecImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~MeshCodecImporter();
+
+    private:
+        struct State;
+
+        MAGNUM_MESHCODECIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
+
+        MAGNUM_MESHCODECIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_MESHCODECIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
+        MAGNUM_MESHCODECIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_MESHCODECIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
+        MAGNUM_MESHCODECIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,431 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Encode.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "MagnumPlugins/MeshCodecImporter/MeshCodecHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MeshCodecImporterTest: TestSuite::Tester {
+    explicit MeshCodecImporterTest();
+
+    void invalid();
+    void invalidFileSize();
+    void invalidDataSize();
+    void invalidIndexData();
+    void invalidIndexRange();
+    void invalidVertexData();
+    void invalidSkinAttributes();
+
+    void indexed();
+    void nonIndexed();
+    void arrayMorphTargetCustom();
+
+    void openTwice();
+    void importTwice();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+struct Vertex {
+    Vector3 position;
+    Vector2 textureCoordinates;
+};
+
+const Vertex Vertices[]{
+    {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
+    {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f}},
+    {{0.0f, 1.0f, 0.0f}, {0.0f, 1.0f}},
+    {{1.0f, 1.0f, 0.0f}, {1.0f, 1.0f}},
+};
+
+/* Encodes to 3 bytes, see MeshToolsEncodeTest */
+const UnsignedShort Indices[]{0, 1, 2, 2, 1, 3};
+
+const Implementation::MeshCodecAttribute Attributes[]{
+    {UnsignedShort(MeshAttribute::Position), 0, UnsignedInt(VertexFormat::Vector3), 0, -1},
+    {UnsignedShort(MeshAttribute::TextureCoordinates), 0, UnsignedInt(VertexFormat::Vector2), 12, -1},
+};
+
+/* Assembles a file the same way as MeshCodecSceneConverter does. The tests
+   assume a Little-Endian machine, like elsewhere. */
+Containers::Array<char> file(MeshPrimitive primitive, MeshIndexType indexType, Containers::ArrayView<const char> indexData, UnsignedInt indexCount, Containers::ArrayView<const char> vertexData, UnsignedInt vertexCount, UnsignedInt vertexSize, Containers::ArrayView<const Implementation::MeshCodecAttribute> attributes) {
+    const std::size_t indexDataOffset = sizeof(Implementation::MeshCodecHeader) + attributes.size()*sizeof(Implementation::MeshCodecAttribute);
+    const std::size_t vertexDataOffset = indexDataOffset + indexData.size();
+    Containers::Array<char> out{ValueInit, vertexDataOffset + vertexData.size()};
+
+    Implementation::MeshCodecHeader& header = *reinterpret_cast<Implementation::MeshCodecHeader*>(out.data());
+    header.magic[0] = 'M';
+    header.magic[1] = 'C';
+    header.magic[2] = 'M';
+    header.version = Implementation::MeshCodecVersion;
+    header.primitive = UnsignedInt(primitive);
+    header.indexType = UnsignedInt(indexType);
+    header.indexCount = indexCount;
+    header.vertexCount = vertexCount;
+    header.vertexSize = vertexSize;
+    header.attributeCount = UnsignedInt(attributes.size());
+    header.indexDataSize = UnsignedInt(indexData.size());
+    header.vertexDataSize = UnsignedInt(vertexData.size());
+
+    Utility::copy(Containers::arrayCast<const char>(attributes), out.slice(sizeof(Implementation::MeshCodecHeader), indexDataOffset));
+    Utility::copy(indexData, out.slice(indexDataOffset, vertexDataOffset));
+    Utility::copy(vertexData, out.exceptPrefix(vertexDataOffset));
+    return out;
+}
+
+Containers::Array<char> file() {
+    return file(MeshPrimitive::Triangles, MeshIndexType::UnsignedShort,
+        MeshTools::encodeIndexBuffer(Containers::stridedArrayView(Indices)), Containers::arraySize(Indices),
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        Attributes);
+}
+
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t offset;
+    UnsignedInt value;
+    std::size_t valueSize;
+    const char* message;
+} InvalidData[]{
+    {"too short", 35, 0, 0, 0,
+        "file too short, expected at least 36 bytes but got 35"},
+    {"invalid signature", 0, 0, 'X', 1,
+        "invalid file signature XCM"},
+    {"unsupported version", 0, 3, 2, 1,
+        "unsupported version 2"},
+    {"invalid primitive", 0, 4, 0xdead, 4,
+        "invalid primitive MeshPrimitive(0xdead)"},
+    {"invalid index type", 0, 8, 0x4, 4,
+        "invalid index type MeshIndexType(0x4)"},
+    {"index data for a non-indexed mesh", 0, 8, 0, 4,
+        "expected no index data for a non-indexed mesh but got 6 indices in 3 bytes"},
+    {"vertex size too large", 0, 20, 32768, 4,
+        "expected vertex size to fit into 15 bits but got 32768"},
+    {"index data too small for index count", 0, 12, 0xffffffffu, 4,
+        "expected at least 1431655766 bytes of encoded index data for 4294967295 indices but got 3"},
+    {"invalid attribute name", 0, 36 + 0, 0, 2,
+        "invalid attribute 0 name Trade::MeshAttribute(0x0)"},
+    {"invalid attribute format", 0, 36 + 4, 0xdead, 4,
+        "invalid attribute 0 format VertexFormat(0xdead)"},
+    {"implementation-specific attribute format", 0, 36 + 4, 0x80000003u, 4,
+        "invalid attribute 0 format VertexFormat::ImplementationSpecific(0x3)"},
+    {"attribute format not compatible", 0, 52 + 4, UnsignedInt(VertexFormat::Vector3), 4,
+        "VertexFormat::Vector3 is not a valid format for Trade::MeshAttribute::TextureCoordinates"},
+    {"array attribute not allowed", 0, 36 + 2, 3, 2,
+        "Trade::MeshAttribute::Position can't be an array attribute"},
+    {"invalid morph target ID", 0, 36 + 12, 128, 4,
+        "invalid morph target ID 128 for Trade::MeshAttribute::Position"},
+    {"attribute out of bounds", 0, 52 + 8, 13, 4,
+        "attribute 1 spans 21 bytes but vertex size is 20"},
+};
+
+MeshCodecImporterTest::MeshCodecImporterTest() {
+    addInstancedTests({&MeshCodecImporterTest::invalid},
+        Containers::arraySize(InvalidData));
+
+    addTests({&MeshCodecImporterTest::invalidFileSize,
+              &MeshCodecImporterTest::invalidDataSize,
+              &MeshCodecImporterTest::invalidIndexData,
+              &MeshCodecImporterTest::invalidIndexRange,
+              &MeshCodecImporterTest::invalidVertexData,
+              &MeshCodecImporterTest::invalidSkinAttributes,
+
+              &MeshCodecImporterTest::indexed,
+              &MeshCodecImporterTest::nonIndexed,
+              &MeshCodecImporterTest::arrayMorphTargetCustom,
+
+              &MeshCodecImporterTest::openTwice,
+              &MeshCodecImporterTest::importTwice});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MESHCODECIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MESHCODECIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MeshCodecImporterTest::invalid() {
+    auto&& data = InvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    Containers::Array<char> in = file();
+    for(std::size_t i = 0; i != data.valueSize; ++i)
+        in[data.offset + i] = char(data.value >> 8*i);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data.size ? in.prefix(data.size) : in));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshCodecImporter::openData(): {}\n", data.message));
+}
+
+void MeshCodecImporterTest::invalidFileSize() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    Containers::Array<char> in = file();
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(in.exceptSuffix(1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshCodecImporter::openData(): file size mismatch, expected {} bytes but got {}\n", in.size(), in.size() - 1));
+}
+
+void MeshCodecImporterTest::invalidDataSize() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    /* A tiny file declaring a huge vertex count shouldn't cause the whole
+       vertex data to be allocated */
+    const char vertexData[]{1};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(file(MeshPrimitive::Points, MeshIndexType{},
+        nullptr, 0,
+        vertexData, 0xffffffffu, sizeof(Vertex),
+        Attributes)));
+    CORRADE_COMPARE(out, "Trade::MeshCodecImporter::openData(): expected at least 1342177281 bytes of encoded vertex data for 4294967295 vertices of 20 bytes but got 1\n");
+}
+
+void MeshCodecImporterTest::invalidIndexData() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    /* Index 300 doesn't fit into the 8-bit type that's in the header */
+    const UnsignedInt indices[]{0, 1, 300};
+    CORRADE_VERIFY(importer->openData(file(MeshPrimitive::Triangles, MeshIndexType::UnsignedByte,
+        MeshTools::encodeIndexBuffer(Containers::stridedArrayView(indices)), 3,
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        Attributes)));
+
+    /* The error is only discovered on import */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out,
+        "MeshTools::decodeIndexBufferInto(): index 300 doesn't fit into 8 bits\n"
+        "Trade::MeshCodecImporter::mesh(): can't decode index data\n");
+}
+
+void MeshCodecImporterTest::invalidIndexRange() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    /* Index 4 fits into the type but there's just 4 vertices */
+    const UnsignedShort indices[]{0, 1, 4};
+    CORRADE_VERIFY(importer->openData(file(MeshPrimitive::Triangles, MeshIndexType::UnsignedShort,
+        MeshTools::encodeIndexBuffer(Containers::stridedArrayView(indices)), 3,
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        Attributes)));
+
+    /* The error is only discovered on import */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, "Trade::MeshCodecImporter::mesh(): index 4 out of range for 4 vertices\n");
+}
+
+void MeshCodecImporterTest::invalidVertexData() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    /* Vertex data claiming an unknown encoder version. Has to be large enough
+       to pass the minimal size check in openData(). */
+    Containers::Array<char> vertexData = MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices)));
+    vertexData[0] = 2;
+    CORRADE_VERIFY(importer->openData(file(MeshPrimitive::Points, MeshIndexType{},
+        nullptr, 0,
+        vertexData, Containers::arraySize(Vertices), sizeof(Vertex),
+        Attributes)));
+
+    /* The error is only discovered on import */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out,
+        "MeshTools::decodeVertexBufferInto(): unsupported version 2\n"
+        "Trade::MeshCodecImporter::mesh(): can't decode vertex data\n");
+}
+
+void MeshCodecImporterTest::invalidSkinAttributes() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    /* Vertex data are just bytes for the codec, the attributes can overlay
+       anything */
+    const Implementation::MeshCodecAttribute jointIdsOnly[]{
+        {UnsignedShort(MeshAttribute::JointIds), 4, UnsignedInt(VertexFormat::UnsignedByte), 0, -1},
+    };
+    const Implementation::MeshCodecAttribute arraySizeMismatch[]{
+        {UnsignedShort(MeshAttribute::JointIds), 4, UnsignedInt(VertexFormat::UnsignedByte), 0, -1},
+        {UnsignedShort(MeshAttribute::Weights), 3, UnsignedInt(VertexFormat::Float), 4, -1},
+    };
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(file(MeshPrimitive::Points, MeshIndexType{},
+        nullptr, 0,
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        jointIdsOnly)));
+    CORRADE_VERIFY(!importer->openData(file(MeshPrimitive::Points, MeshIndexType{},
+        nullptr, 0,
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        arraySizeMismatch)));
+    CORRADE_COMPARE(out,
+        "Trade::MeshCodecImporter::openData(): expected 1 weight attributes to match joint IDs but got 0\n"
+        "Trade::MeshCodecImporter::openData(): expected 4 array items for weight attribute 0 to match joint IDs but got 3\n");
+}
+
+void MeshCodecImporterTest::indexed() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    CORRADE_VERIFY(importer->openData(file()));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE(mesh->attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE(mesh->attributeOffset(0), 0);
+    CORRADE_COMPARE(mesh->attributeStride(0), sizeof(Vertex));
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(0),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeName(1), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(mesh->attributeFormat(1), VertexFormat::Vector2);
+    CORRADE_COMPARE(mesh->attributeOffset(1), 12);
+    CORRADE_COMPARE(mesh->attributeStride(1), sizeof(Vertex));
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(1),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::textureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void MeshCodecImporterTest::nonIndexed() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    CORRADE_VERIFY(importer->openData(file(MeshPrimitive::LineStrip, MeshIndexType{},
+        nullptr, 0,
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        Containers::arrayView(Attributes).prefix(1))));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::LineStrip);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 1);
+    CORRADE_COMPARE(mesh->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(0),
+        Containers::stridedArrayView(Vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+}
+
+void MeshCodecImporterTest::arrayMorphTargetCustom() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    /* Vertex data are just bytes for the codec, so it can be anything */
+    const Implementation::MeshCodecAttribute attributes[]{
+        {UnsignedShort(MeshAttribute::Position), 0, UnsignedInt(VertexFormat::Vector3), 0, 37},
+        {UnsignedShort(meshAttributeCustom(15)), 2, UnsignedInt(VertexFormat::Vector2us), 12, -1},
+    };
+    CORRADE_VERIFY(importer->openData(file(MeshPrimitive::Points, MeshIndexType{},
+        nullptr, 0,
+        MeshTools::encodeVertexBuffer(Containers::arrayCast<2, const char>(Containers::stridedArrayView(Vertices))), Containers::arraySize(Vertices), sizeof(Vertex),
+        attributes)));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE(mesh->attributeMorphTargetId(0), 37);
+    CORRADE_COMPARE(mesh->attributeArraySize(0), 0);
+    CORRADE_COMPARE(mesh->attributeName(1), meshAttributeCustom(15));
+    CORRADE_COMPARE(mesh->attributeFormat(1), VertexFormat::Vector2us);
+    CORRADE_COMPARE(mesh->attributeMorphTargetId(1), -1);
+    CORRADE_COMPARE(mesh->attributeArraySize(1), 2);
+    CORRADE_COMPARE_AS(mesh->vertexData(),
+        Containers::arrayCast<const char>(Containers::arrayView(Vertices)),
+        TestSuite::Compare::Container);
+}
+
+void MeshCodecImporterTest::openTwice() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    CORRADE_VERIFY(importer->openData(file()));
+    CORRADE_VERIFY(importer->openData(file()));
+
+    /* Shouldn't crash, leak or anything */
+}
+
+void MeshCodecImporterTest::importTwice() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MeshCodecImporter");
+
+    CORRADE_VERIFY(importer->openData(file()));
+
+    /* Verify that everything is working the same way on second use */
+    {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+            Containers::arrayView(Indices),
+            TestSuite::Compare::Container);
+    } {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+            Containers::arrayView(Indices),
+            TestSuite::Compare::Container);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshCodecImporterTest)
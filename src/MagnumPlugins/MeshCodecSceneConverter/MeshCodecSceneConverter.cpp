@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshCodecSceneConverter.h"
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/MeshTools/Encode.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+#include "MagnumPlugins/MeshCodecImporter/MeshCodecHeader.h"
+
+namespace Magnum { namespace Trade {
+
+MeshCodecSceneConverter::MeshCodecSceneConverter() = default;
+
+MeshCodecSceneConverter::MeshCodecSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractSceneConverter{manager, plugin} {}
+
+SceneConverterFeatures MeshCodecSceneConverter::doFeatures() const {
+    return SceneConverterFeature::ConvertMeshToData;
+}
+
+Containers::Optional<Containers::Array<char>> MeshCodecSceneConverter::doConvertToData(const MeshData& mesh) {
+    if(mesh.isIndexed() && isMeshIndexTypeImplementationSpecific(mesh.indexType())) {
+        Error{} << "Trade::MeshCodecSceneConverter::convertToData(): implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()) << "is not supported";
+        return {};
+    }
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        if(isVertexFormatImplementationSpecific(format)) {
+            Error{} << "Trade::MeshCodecSceneConverter::convertToData(): implementation-specific vertex format" << Debug::hex << vertexFormatUnwrap(format) << "of attribute" << i << "is not supported";
+            return {};
+        }
+    }
+
+    /* Repack the attributes to remove any padding and get tightly packed
+       indices. The vertex stride is then the same for all attributes. */
+    const MeshData packed = MeshTools::interleave(mesh, {}, {});
+    const UnsignedInt vertexSize = packed.attributeCount() ? packed.attributeStride(0) : 0;
+
+    Containers::Array<char> indexData;
+    if(packed.isIndexed())
+        indexData = MeshTools::encodeIndexBuffer(packed.indices());
+    const Containers::Array<char> vertexData = MeshTools::encodeVertexBuffer(Containers::StridedArrayView2D<const char>{packed.vertexData(), {packed.vertexCount(), vertexSize}});
+
+    /* The format has 32-bit sizes, which should be plenty given that the
+       MeshData vertex and index counts are 32-bit as well */
+    if(indexData.size() > ~UnsignedInt{} || vertexData.size() > ~UnsignedInt{}) {
+        Error{} << "Trade::MeshCodecSceneConverter::convertToData(): encoded data too large, got" << indexData.size() << "index and" << vertexData.size() << "vertex bytes";
+        return {};
+    }
+
+    const std::size_t attributeOffset = sizeof(Implementation::MeshCodecHeader);
+    const std::size_t indexDataOffset = attributeOffset + packed.attributeCount()*sizeof(Implementation::MeshCodecAttribute);
+    const std::size_t vertexDataOffset = indexDataOffset + indexData.size();
+    Containers::Array<char> out{ValueInit, vertexDataOffset + vertexData.size()};
+
+    Implementation::MeshCodecHeader& header = *reinterpret_cast<Implementation::MeshCodecHeader*>(out.data());
+    header.magic[0] = 'M';
+    header.magic[1] = 'C';
+    header.magic[2] = 'M';
+    header.version = Implementation::MeshCodecVersion;
+    header.primitive = Utility::Endianness::littleEndian(UnsignedInt(packed.primitive()));
+    header.indexType = Utility::Endianness::littleEndian(packed.isIndexed() ? UnsignedInt(packed.indexType()) : 0);
+    header.indexCount = Utility::Endianness::littleEndian(packed.isIndexed() ? packed.indexCount() : 0);
+    header.vertexCount = Utility::Endianness::littleEndian(packed.vertexCount());
+    header.vertexSize = Utility::Endianness::littleEndian(vertexSize);
+    header.attributeCount = Utility::Endianness::littleEndian(packed.attributeCount());
+    header.indexDataSize = Utility::Endianness::littleEndian(UnsignedInt(indexData.size()));
+    header.vertexDataSize = Utility::Endianness::littleEndian(UnsignedInt(vertexData.size()));
+
+    const Containers::ArrayView<Implementation::MeshCodecAttribute> attributes = Containers::arrayCast<Implementation::MeshCodecAttribute>(out.slice(attributeOffset, indexDataOffset));
+    for(UnsignedInt i = 0; i != packed.attributeCount(); ++i) {
+        attributes[i].name = Utility::Endianness::littleEndian(UnsignedShort(packed.attributeName(i)));
+        attributes[i].arraySize = Utility::Endianness::littleEndian(packed.attributeArraySize(i));
+        attributes[i].format = Utility::Endianness::littleEndian(UnsignedInt(packed.attributeFormat(i)));
+        attributes[i].offset = Utility::Endianness::littleEndian(UnsignedInt(packed.attributeOffset(i)));
+        attributes[i].morphTargetId = Utility::Endianness::littleEndian(packed.attributeMorphTargetId(i));
+    }
+
+    Utility::copy(indexData, out.slice(indexDataOffset, vertexDataOffset));
+    Utility::copy(vertexData, out.exceptPrefix(vertexDataOffset));
+
+    if(flags() & SceneConverterFlag::Verbose)
+        Debug{} << "Trade::MeshCodecSceneConverter::convertToData(): compressed" << packed.indexData().size() << "index and" << packed.vertexData().size() << "vertex bytes to" << indexData.size() << "and" << vertexData.size() << "bytes";
+
+    /* GCC 4.8 needs extra help here */
+    return Containers::optional(Utility::move(out));
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MeshCodecSceneConverter, Magnum::Trade::MeshCodecSceneConverter,
+    MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE)
@@ -0,0 +1,136 @@
+#ifndef Magnum_Trade_MeshCodecSceneConverter_h
+#define Magnum_Trade_MeshCodecSceneConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshCodecSceneConverter
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractSceneConverter.h"
+
+#include "MagnumPlugins/MeshCodecSceneConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHCODECSCENECONVERTER_BUILD_STATIC
+    #ifdef MeshCodecSceneConverter_EXPORTS
+        #define MAGNUM_MESHCODECSCENECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHCODECSCENECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHCODECSCENECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHCODECSCENECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MESHCODECSCENECONVERTER_EXPORT
+#define MAGNUM_MESHCODECSCENECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Compressed mesh converter plugin
+@m_since_latest
+
+Creates compressed mesh files (`*.mcm`) that can be imported back with the
+@ref MeshCodecImporter plugin. The index and vertex data are losslessly
+compressed with @ref MeshTools::encodeIndexBuffer() and
+@ref MeshTools::encodeVertexBuffer().
+
+@section Trade-MeshCodecSceneConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractSceneConverter interface. See its
+    documentation for introduction and usage examples.
+
+This plugin depends on the @ref Trade and @ref MeshTools libraries and is built
+if `MAGNUM_WITH_MESHCODECSCENECONVERTER` is enabled when building Magnum. To
+use as a dynamic plugin, load @cpp "MeshCodecSceneConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MESHCODECSCENECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MeshCodecSceneConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MeshCodecSceneConverter` component of the `Magnum`
+package and link to the `Magnum::MeshCodecSceneConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MeshCodecSceneConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MeshCodecSceneConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MeshCodecSceneConverter-behavior Behavior and limitations
+
+The mesh is first interleaved with @ref MeshTools::interleave() to remove any
+padding between attributes and to make the index buffer tightly packed, which
+means the vertex layout may differ from the input. Attributes and indices with
+implementation-specific formats are not supported. The index data are encoded
+as triangles regardless of the mesh primitive, which is lossless for all
+primitives but compresses well only for @ref MeshPrimitive::Triangles.
+
+Custom attribute names are not saved, only their numeric IDs. For best
+compression ratio, quantize the attributes with @ref MeshTools::quantize() and
+optimize the index and vertex order with
+@ref MeshTools::optimizeVertexCacheInPlace() and
+@ref MeshTools::optimizeVertexFetch() before saving.
+
+The converter recognizes @ref SceneConverterFlag::Verbose, printing the
+original and compressed data sizes when the flag is enabled.
+*/
+class MAGNUM_MESHCODECSCENECONVERTER_EXPORT MeshCodecSceneConverter: public AbstractSceneConverter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshCodecSceneConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshCodecSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+    private:
+        MAGNUM_MESHCODECSCENECONVERTER_LOCAL SceneConverterFeatures doFeatures() const override;
+        MAGNUM_MESHCODECSCENECONVERTER_LOCAL Containers::Optional<Containers::Array<char>> doConvertToData(const MeshData& mesh) override;
+};
+
+}}
+
+#endif
@@ -0,0 +1,246 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "MagnumPlugins/MeshCodecImporter/MeshCodecHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MeshCodecSceneConverterTest: TestSuite::Tester {
+    explicit MeshCodecSceneConverterTest();
+
+    void implementationSpecificIndexType();
+    void implementationSpecificVertexFormat();
+
+    void convert();
+    void convertNonIndexed();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractSceneConverter> _converterManager{"nonexistent"};
+    PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    SceneConverterFlags flags;
+    bool verbose;
+} VerboseData[]{
+    {"", {}, false},
+    {"verbose", SceneConverterFlag::Verbose, true},
+};
+
+/* Positions and texture coordinates not interleaved, with the indices
+   strided. The converter interleaves and packs them. */
+const struct {
+    Vector3 positions[4];
+    Vector2 textureCoordinates[4];
+} VertexData{{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+}, {
+    {0.0f, 0.0f},
+    {1.0f, 0.0f},
+    {0.0f, 1.0f},
+    {1.0f, 1.0f},
+}};
+
+const UnsignedInt Indices[]{
+    0, 0xffffffff, 1, 0xffffffff, 2, 0xffffffff,
+    2, 0xffffffff, 1, 0xffffffff, 3, 0xffffffff,
+};
+
+const UnsignedInt ExpectedIndices[]{0, 1, 2, 2, 1, 3};
+
+MeshCodecSceneConverterTest::MeshCodecSceneConverterTest() {
+    addTests({&MeshCodecSceneConverterTest::implementationSpecificIndexType,
+              &MeshCodecSceneConverterTest::implementationSpecificVertexFormat});
+
+    addInstancedTests({&MeshCodecSceneConverterTest::convert},
+        Containers::arraySize(VerboseData));
+
+    addTests({&MeshCodecSceneConverterTest::convertNonIndexed});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MESHCODECSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_converterManager.load(MESHCODECSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    /* Optional plugins that don't have to be here */
+    #ifdef MESHCODECIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(MESHCODECIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MeshCodecSceneConverterTest::implementationSpecificIndexType() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshCodecSceneConverter");
+
+    const char indices[6]{};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{indices, 3, 2}},
+        {}, VertexData.positions, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)}
+        }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertToData(mesh));
+    CORRADE_COMPARE(out, "Trade::MeshCodecSceneConverter::convertToData(): implementation-specific index type 0xcaca is not supported\n");
+}
+
+void MeshCodecSceneConverterTest::implementationSpecificVertexFormat() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshCodecSceneConverter");
+
+    MeshData mesh{MeshPrimitive::Triangles, {}, VertexData.positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)},
+        MeshAttributeData{MeshAttribute::Normal, vertexFormatWrap(0xcaca), Containers::StridedArrayView1D<const void>{Containers::stridedArrayView(VertexData.positions)}}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertToData(mesh));
+    CORRADE_COMPARE(out, "Trade::MeshCodecSceneConverter::convertToData(): implementation-specific vertex format 0xcaca of attribute 1 is not supported\n");
+}
+
+void MeshCodecSceneConverterTest::convert() {
+    auto&& data = VerboseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshCodecSceneConverter");
+    converter->setFlags(data.flags);
+
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, Indices, MeshIndexData{Containers::stridedArrayView(Indices).every(2)},
+        {}, Containers::arrayView(&VertexData, 1), {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, Containers::arrayView(VertexData.textureCoordinates)},
+        }};
+
+    Containers::String out;
+    Containers::Optional<Containers::Array<char>> converted;
+    {
+        Debug redirectOutput{&out};
+        converted = converter->convertToData(mesh);
+    }
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE_AS(converted->size(), sizeof(Implementation::MeshCodecHeader) + 2*sizeof(Implementation::MeshCodecAttribute),
+        TestSuite::Compare::Greater);
+
+    /* Verify just the header here, the data are verified by importing them
+       below. The tests assume a Little-Endian machine, like elsewhere. */
+    const Implementation::MeshCodecHeader& header = *reinterpret_cast<const Implementation::MeshCodecHeader*>(converted->data());
+    CORRADE_COMPARE(Containers::StringView(header.magic, 3), "MCM");
+    CORRADE_COMPARE(header.version, Implementation::MeshCodecVersion);
+    CORRADE_COMPARE(MeshPrimitive(header.primitive), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(MeshIndexType(header.indexType), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(header.indexCount, 6);
+    CORRADE_COMPARE(header.vertexCount, 4);
+    CORRADE_COMPARE(header.vertexSize, sizeof(Vector3) + sizeof(Vector2));
+    CORRADE_COMPARE(header.attributeCount, 2);
+    CORRADE_COMPARE(converted->size(), sizeof(Implementation::MeshCodecHeader) + 2*sizeof(Implementation::MeshCodecAttribute) + header.indexDataSize + header.vertexDataSize);
+    if(data.verbose) CORRADE_COMPARE(out, Utility::format(
+        "Trade::MeshCodecSceneConverter::convertToData(): compressed 24 index and 80 vertex bytes to {} and {} bytes\n", header.indexDataSize, header.vertexDataSize));
+    else CORRADE_COMPARE(out, "");
+
+    if(!(_importerManager.loadState("MeshCodecImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshCodecImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshCodecImporter");
+    CORRADE_VERIFY(importer->openData(*converted));
+
+    Containers::Optional<MeshData> imported = importer->mesh(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(imported->isIndexed());
+    CORRADE_COMPARE(imported->indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(imported->indices<UnsignedInt>(),
+        Containers::arrayView(ExpectedIndices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(imported->attributeCount(), 2);
+    CORRADE_COMPARE(imported->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE_AS(imported->attribute<Vector3>(0),
+        Containers::arrayView(VertexData.positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(imported->attributeName(1), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE_AS(imported->attribute<Vector2>(1),
+        Containers::arrayView(VertexData.textureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void MeshCodecSceneConverterTest::convertNonIndexed() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MeshCodecSceneConverter");
+
+    MeshData mesh{MeshPrimitive::LineLoop, {}, VertexData.positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(VertexData.positions)}
+    }};
+
+    Containers::Optional<Containers::Array<char>> converted = converter->convertToData(mesh);
+    CORRADE_VERIFY(converted);
+
+    const Implementation::MeshCodecHeader& header = *reinterpret_cast<const Implementation::MeshCodecHeader*>(converted->data());
+    CORRADE_COMPARE(MeshPrimitive(header.primitive), MeshPrimitive::LineLoop);
+    CORRADE_COMPARE(header.indexType, 0);
+    CORRADE_COMPARE(header.indexCount, 0);
+    CORRADE_COMPARE(header.indexDataSize, 0);
+    CORRADE_COMPARE(header.vertexCount, 4);
+
+    if(!(_importerManager.loadState("MeshCodecImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshCodecImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MeshCodecImporter");
+    CORRADE_VERIFY(importer->openData(*converted));
+
+    Containers::Optional<MeshData> imported = importer->mesh(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::LineLoop);
+    CORRADE_VERIFY(!imported->isIndexed());
+    CORRADE_COMPARE_AS(imported->attribute<Vector3>(0),
+        Containers::arrayView(VertexData.positions),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshCodecSceneConverterTest)
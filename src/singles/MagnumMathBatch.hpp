@@ -83,5 +83,6 @@
    definitions. */
 #if defined(MAGNUM_MATH_BATCH_IMPLEMENTATION) && !defined(MagnumMathBatch_hpp_implementation)
 #define MagnumMathBatch_hpp_implementation
+#include "Magnum/Math/FunctionsBatch.cpp"
 #include "Magnum/Math/PackingBatch.cpp"
 #endif